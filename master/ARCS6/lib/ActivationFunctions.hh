@@ -16,6 +16,7 @@
 
 #include <cassert>
 #include "Matrix.hh"
+#include "FastMath.hh"
 
 // ARCS組込み用マクロ
 #ifdef ARCS_IN
@@ -68,7 +69,7 @@ class ActivationFunctions {
 		//! @param[in]	u	入力データ
 		//! @return	出力
 		static double Sigmoid(double u){
-			return 1.0/(1.0 + exp(-u));
+			return FastMath::Sigmoid(u);
 		}
 		
 		//! @brief シグモイド関数活性化関数の微分
@@ -147,7 +148,11 @@ class ActivationFunctions {
 			if constexpr(T == ActvFunc::TANH){
 				// tanh活性化関数の場合
 				// 行列の要素ごとにtanh関数を掛ける
-				Y = tanhe(U);
+				for(size_t n = 1; n <= N; ++n){
+					for(size_t m = 1; m <= M; ++m){
+						Y.SetElement(n, m, FastMath::Tanh(U.GetElement(n, m)));
+					}
+				}
 			}
 			if constexpr(T == ActvFunc::ReLU){
 				// ReLU活性化関数の場合
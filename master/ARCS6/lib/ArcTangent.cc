@@ -14,6 +14,7 @@
 #include <cassert>
 #include <cmath>
 #include "ArcTangent.hh"
+#include "FastMath.hh"
 
 // ARCS組込み用マクロ
 #ifdef ARCS_IN
@@ -66,7 +67,7 @@ ArcTangent::~ArcTangent(){
 //! @param[in]	Den	atan3の分母
 //! @return tan(Num/Den)の角度 [rad]
 double ArcTangent::GetAngle(const double Num, const double Den){
-	const double thbuff = atan2(Num, Den);
+	const double thbuff = FastMath::Atan2(Num, Den);
 	if((thbuff < -M_PI_2) && (M_PI_2 < theta_z1)){
 		// 正から負に移動したら，+1回転したとみなす
 		++RotationCounter;
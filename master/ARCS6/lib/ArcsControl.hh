@@ -13,8 +13,14 @@
 #define ARCSCONTROL
 
 #include <cassert>
+#include <cmath>
+#include <limits>
+#include <algorithm>
 #include <tuple>
+#include <array>
+#include <type_traits>
 #include "ArcsMatrix.hh"
+#include "ArcsMatrixKernel.hh"
 #include "Matrix.hh"
 
 // ARCS組込み用マクロ
@@ -34,7 +40,208 @@ using namespace ARCS::ArcsMatrix;
 
 namespace ARCS {		// ARCS名前空間
 namespace ArcsControl {	// ArcsControl名前空間
+	//! @brief 疑似上三角行列の対角ブロックの大きさを返す関数 (内部用)
+	//! @tparam		M,N,T	行列の高さ, 幅, データ型
+	//! @param[in]	S	疑似上三角行列 (実Schur形式)
+	//! @param[in]	k	ブロックの先頭の位置
+	//! @return	1×1ブロックなら1，2×2ブロックなら2
+	template<size_t M, size_t N, typename T = double>
+	static constexpr size_t QuasiTriBlockSize(const ArcsMat<M,N,T>& S, const size_t k){
+		return (k < M && S(k+1,k) != 0) ? 2 : 1;
+	}
+
+	//! @brief 疑似上三角行列 S, R に関する小さなシルベスタ方程式を解く関数 (内部用)
+	//!        対角ブロック同士の1～4元の連立方程式を部分ピボット選択付きのガウスの消去法で解く。
+	//! @tparam		Disc	false = 連続系 SY + YR = G，true = 離散系 SYR - Y = G
+	//! @tparam		M,N,T	行列の高さ, 幅, データ型
+	//! @param[in]	S	左側の疑似上三角行列
+	//! @param[in]	k	Sの対角ブロックの先頭の位置
+	//! @param[in]	mb	Sの対角ブロックの大きさ
+	//! @param[in]	R	右側の疑似上三角行列
+	//! @param[in]	j	Rの対角ブロックの先頭の位置
+	//! @param[in]	nb	Rの対角ブロックの大きさ
+	//! @param[in,out]	g	右辺 vec(G) (列優先，mb*nb個)，解 vec(Y) で上書きされる
+	template<bool Disc, size_t M, size_t N, typename T = double>
+	static constexpr void QuasiTriSolveBlock(
+		const ArcsMat<M,M,T>& S, const size_t k, const size_t mb,
+		const ArcsMat<N,N,T>& R, const size_t j, const size_t nb,
+		std::array<T,4>& g
+	){
+		// 係数行列 K を vec(Y) の添字 (a,b) → a + mb*b の順で組み立てる
+		const size_t n = mb*nb;
+		std::array<std::array<T,4>,4> K = {};
+		for(size_t b = 0; b < nb; ++b) for(size_t a = 0; a < mb; ++a){
+			for(size_t d = 0; d < nb; ++d) for(size_t c = 0; c < mb; ++c){
+				if constexpr(Disc){
+					K[a + mb*b][c + mb*d] = S(k+a,k+c)*R(j+d,j+b) - static_cast<T>(a == c && b == d);	// (R' ox S - I)
+				}else{
+					K[a + mb*b][c + mb*d] = S(k+a,k+c)*static_cast<T>(b == d) + R(j+d,j+b)*static_cast<T>(a == c);	// (I ox S + R' ox I)
+				}
+			}
+		}
+
+		// 前進消去
+		for(size_t p = 0; p < n; ++p){
+			size_t q = p;
+			for(size_t i = p + 1; i < n; ++i) if(ArcsMatrixMath::Abs(K[q][p]) < ArcsMatrixMath::Abs(K[i][p])) q = i;
+			if(q != p){
+				for(size_t c = 0; c < n; ++c){
+					const T k = K[p][c];
+					K[p][c] = K[q][c];
+					K[q][c] = k;
+				}
+				const T h = g[p];
+				g[p] = g[q];
+				g[q] = h;
+			}
+			for(size_t i = p + 1; i < n; ++i){
+				const T l = K[i][p]/K[p][p];
+				for(size_t c = p + 1; c < n; ++c) K[i][c] -= l*K[p][c];
+				g[i] -= l*g[p];
+			}
+		}
+
+		// 後退代入
+		for(size_t p = n; 0 < p; --p){
+			for(size_t c = p; c < n; ++c) g[p-1] -= K[p-1][c]*g[c];
+			g[p-1] /= K[p-1][p-1];
+		}
+	}
+
+	//! @brief 疑似上三角行列 S, R に関するシルベスタ方程式を解く関数 (内部用)
+	//!        Bartels–Stewart法の後半部分で，Rの列ブロックを左から順に，Sの行ブロックを下から順に
+	//!        1×1 または 2×2 のブロック毎に代入していくので O(M^2 N + M N^2) で解ける。
+	//! @tparam		Disc	false = 連続系 SY + YR = F，true = 離散系 SYR - Y = F
+	//! @tparam		M,N,T	行列の高さ, 幅, データ型
+	//! @param[in]	S	左側の疑似上三角行列 (M×M)
+	//! @param[in]	R	右側の疑似上三角行列 (N×N)
+	//! @param[in]	F	右辺の行列 (M×N)
+	//! @param[out]	Y	解の行列 (M×N)
+	template<bool Disc, size_t M, size_t N, typename T = double>
+	static constexpr void QuasiTriSylvester(const ArcsMat<M,M,T>& S, const ArcsMat<N,N,T>& R, const ArcsMat<M,N,T>& F, ArcsMat<M,N,T>& Y){
+		// Sの行ブロックの先頭位置を下から辿れるように記録しておく
+		std::array<size_t,M> kb = {0};
+		size_t nk = 0;
+		for(size_t k = 1; k <= M; k += QuasiTriBlockSize(S, k)) kb[nk++] = k;
+
+		ArcsMat<M,2,T> W, G;	// W = Σ_{i<j} Y_i R_ij，G = 列ブロックの右辺
+		std::array<T,4> g = {0};
+		Y.FillAllZero();
+		for(size_t j = 1; j <= N; ){
+			const size_t nb = QuasiTriBlockSize(R, j);
+
+			// 既に求まった左側の列の寄与を右辺から引く
+			W.FillAllZero();
+			for(size_t b = 0; b < nb; ++b) for(size_t i = 1; i < j; ++i){
+				const T r = R(i,j+b);
+				if(r != 0) for(size_t m = 1; m <= M; ++m) W(m,b+1) += Y(m,i)*r;
+			}
+			for(size_t b = 0; b < nb; ++b) for(size_t m = 1; m <= M; ++m){
+				if constexpr(Disc){
+					T w = 0;
+					for(size_t l = m - (1 < m ? 1 : 0); l <= M; ++l) w += S(m,l)*W(l,b+1);	// S*W (Sはヘッセンベルグ形)
+					G(m,b+1) = F(m,j+b) - w;
+				}else{
+					G(m,b+1) = F(m,j+b) - W(m,b+1);
+				}
+			}
+
+			// Sの行ブロックを下から順に解く
+			for(size_t p = nk; 0 < p; --p){
+				const size_t k = kb[p-1];
+				const size_t mb = QuasiTriBlockSize(S, k);
+				for(size_t b = 0; b < nb; ++b) for(size_t a = 0; a < mb; ++a){
+					T w = 0;
+					for(size_t l = k + mb; l <= M; ++l) w += S(k+a,l)*Y(l,j+b);	// 既に求まった下側の行の寄与
+					g[a + mb*b] = w;
+				}
+				if constexpr(Disc){
+					// 離散系では下側の寄与にも右からRの対角ブロックが掛かる
+					std::array<T,4> h = g;
+					for(size_t b = 0; b < nb; ++b) for(size_t a = 0; a < mb; ++a){
+						T w = 0;
+						for(size_t d = 0; d < nb; ++d) w += h[a + mb*d]*R(j+d,j+b);
+						g[a + mb*b] = w;
+					}
+				}
+				for(size_t b = 0; b < nb; ++b) for(size_t a = 0; a < mb; ++a) g[a + mb*b] = G(k+a,b+1) - g[a + mb*b];
+				QuasiTriSolveBlock<Disc>(S, k, mb, R, j, nb, g);
+				for(size_t b = 0; b < nb; ++b) for(size_t a = 0; a < mb; ++a) Y(k+a,j+b) = g[a + mb*b];
+			}
+			j += nb;
+		}
+	}
+
+	//! @brief 疑似上三角行列の転置を逆順に並べ替えた R = J S' J を返す関数 (内部用)
+	//!        SY + YS' = F は Z = YJ とおくと SZ + ZR = FJ となり，Rも疑似上三角行列になる。(Jは反転行列)
+	//! @tparam		M,T	行列の大きさ, データ型
+	//! @param[in]	S	疑似上三角行列
+	//! @return	R = J S' J
+	template<size_t M, typename T = double>
+	static constexpr ArcsMat<M,M,T> QuasiTriReverse(const ArcsMat<M,M,T>& S){
+		ArcsMat<M,M,T> R;
+		for(size_t j = 1; j <= M; ++j) for(size_t i = 1; i <= M; ++i) R(i,j) = S(M+1-j,M+1-i);
+		return R;
+	}
+
+	//! @brief 行列の列の順序を反転させる関数 (内部用)
+	//! @tparam		M,N,T	行列の高さ, 幅, データ型
+	//! @param[in]	U	入力行列
+	//! @return	UJ (Jは反転行列)
+	template<size_t M, size_t N, typename T = double>
+	static constexpr ArcsMat<M,N,T> ReverseColumns(const ArcsMat<M,N,T>& U){
+		ArcsMat<M,N,T> Y;
+		for(size_t j = 1; j <= N; ++j) for(size_t i = 1; i <= M; ++i) Y(i,j) = U(i,N+1-j);
+		return Y;
+	}
+
+	//! @brief シルベスタ方程式 AX + XB = C の解Xを求める関数 (引数渡し版)
+	//!        Bartels–Stewart法により，A = USU', B = VRV' と実Schur分解して
+	//!        SY + YR = U'CV を代入で解き，X = UYV' とする。計算量は O(M^3 + N^3)。
+	//! @tparam		M,MB,MC,MX	行列の高さ
+	//! @tparam		N,NB,NC,NX	行列の幅
+	//! @tparam		T,TB,TC,TX	行列のデータ型
+	//! @param[in]	A	A行列 (M×M)
+	//! @param[in]	B	B行列 (N×N)
+	//! @param[in]	C	C行列 (M×N)
+	//! @param[out]	X	解Xの行列 (M×N)
+	template<
+		size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double,
+		size_t MC, size_t NC, typename TC = double, size_t MX, size_t NX, typename TX = double
+	>
+	static constexpr void Sylvester(const ArcsMat<M,N,T>& A, const ArcsMat<MB,NB,TB>& B, const ArcsMat<MC,NC,TC>& C, ArcsMat<MX,NX,TX>& X){
+		static_assert(M == N,   "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MB == NB, "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MC == M,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(NC == NB, "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MX == MC, "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(NX == NC, "ArcsCtrl: Size Error");	// サイズチェック
+
+		const auto [U, S] = RealSchur(A);
+		const auto [V, R] = RealSchur(B);
+		const ArcsMat<MC,NC,T> F = ~U*C*V;
+		ArcsMat<MC,NC,T> Y;
+		QuasiTriSylvester<false>(S, R, F, Y);
+		X = U*Y*~V;
+	}
+
+	//! @brief シルベスタ方程式 AX + XB = C の解Xを求める関数 (戻り値返し版)
+	//! @tparam		M,MB,MC	行列の高さ
+	//! @tparam		N,NB,NC	行列の幅
+	//! @tparam		T,TB,TC	行列のデータ型
+	//! @param[in]	A	A行列 (M×M)
+	//! @param[in]	B	B行列 (N×N)
+	//! @param[in]	C	C行列 (M×N)
+	//! @return	解Xの行列 (M×N)
+	template<size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double, size_t MC, size_t NC, typename TC = double>
+	static constexpr ArcsMat<MC,NC,T> Sylvester(const ArcsMat<M,N,T>& A, const ArcsMat<MB,NB,TB>& B, const ArcsMat<MC,NC,TC>& C){
+		ArcsMat<MC,NC,T> X;
+		Sylvester(A, B, C, X);
+		return X;
+	}
+
 	//! @brief 連続リアプノフ方程式 AX + XA' + Q = 0 の解Xを求める関数 (引数渡し版)
+	//!        Bartels–Stewart法により O(n^3) で解く。
 	//! @tparam		M,MQ,MX	行列の高さ
 	//! @tparam		N,NQ,NX	行列の幅
 	//! @tparam		T,TQ,TX	行列のデータ型
@@ -51,6 +258,94 @@ namespace ArcsControl {	// ArcsControl名前空間
 		static_assert(NQ == N,  "ArcsCtrl: Size Error");	// サイズチェック
 		static_assert(NX == N,  "ArcsCtrl: Size Error");	// サイズチェック
 
+		// A = USU' と実Schur分解すると，Y = U'XU について
+		// 　SY + YS' = -U'QU
+		// となる。S'は下三角なので反転行列Jを使って Z = YJ, R = JS'J とおけば
+		// 　SZ + ZR = -U'QUJ
+		// のようにS, Rともに疑似上三角行列のシルベスタ方程式になるので，ブロック毎の代入で解ける。
+		const auto [U, S] = RealSchur(A);
+		const ArcsMat<M,N,T> F = -(~U*Q*U);
+		ArcsMat<M,N,T> Z;
+		QuasiTriSylvester<false>(S, QuasiTriReverse(S), ReverseColumns(F), Z);
+		X = U*ReverseColumns(Z)*~U;
+	}
+
+	//! @brief 連続リアプノフ方程式 AX + XA' + Q = 0 の解Xを求める関数 (戻り値返し版)
+	//! @tparam		M,MQ	行列の高さ
+	//! @tparam		N,NQ	行列の幅
+	//! @tparam		T,TQ	行列のデータ型
+	//! @param[in]	A	A行列
+	//! @param[in]	Q	Q行列
+	//! @return	解Xの行列
+	template<size_t M, size_t N, typename T = double, size_t MQ, size_t NQ, typename TQ = double>
+	static constexpr ArcsMat<M,N,T> Lyapunov(const ArcsMat<M,N,T>& A, const ArcsMat<MQ, NQ, TQ>& Q){
+		ArcsMat<M,N,T> X;
+		Lyapunov(A, Q, X);
+		return X;
+	}
+
+	//! @brief 離散リアプノフ方程式 AXA' - X + Q = 0 の解Xを求める関数 (引数渡し版)
+	//!        Kitagawa/Barraudの方法により O(n^3) で解く。
+	//! @tparam		M,MQ,MX	行列の高さ
+	//! @tparam		N,NQ,NX	行列の幅
+	//! @tparam		T,TQ,TX	行列のデータ型
+	//! @param[in]	A	A行列
+	//! @param[in]	Q	Q行列
+	//! @param[out]	X	解Xの行列
+	template<size_t M, size_t N, typename T = double, size_t MQ, size_t NQ, typename TQ = double, size_t MX, size_t NX, typename TX = double>
+	static constexpr void DiscLyapunov(const ArcsMat<M,N,T>& A, const ArcsMat<MQ, NQ, TQ>& Q, ArcsMat<MX,NX,TX>& X){
+		static_assert(M == N,   "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MQ == NQ, "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MX == NX, "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MQ == M,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MX == M,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(NQ == N,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(NX == N,  "ArcsCtrl: Size Error");	// サイズチェック
+
+		// A = USU' と実Schur分解すると，Y = U'XU について
+		// 　SYS' - Y = -U'QU
+		// となる。連続系と同様に Z = YJ, R = JS'J とおけば
+		// 　SZR - Z = -U'QUJ
+		// となるので，ブロック毎の代入で解ける。
+		const auto [U, S] = RealSchur(A);
+		const ArcsMat<M,N,T> F = -(~U*Q*U);
+		ArcsMat<M,N,T> Z;
+		QuasiTriSylvester<true>(S, QuasiTriReverse(S), ReverseColumns(F), Z);
+		X = U*ReverseColumns(Z)*~U;
+	}
+
+	//! @brief 離散リアプノフ方程式 AXA' - X + Q = 0 の解Xを求める関数 (戻り値返し版)
+	//! @tparam		M,MQ	行列の高さ
+	//! @tparam		N,NQ	行列の幅
+	//! @tparam		T,TQ	行列のデータ型
+	//! @param[in]	A	A行列
+	//! @param[in]	Q	Q行列
+	//! @return	解Xの行列
+	template<size_t M, size_t N, typename T = double, size_t MQ, size_t NQ, typename TQ = double>
+	static constexpr ArcsMat<M,N,T> DiscLyapunov(const ArcsMat<M,N,T>& A, const ArcsMat<MQ, NQ, TQ>& Q){
+		ArcsMat<M,N,T> X;
+		DiscLyapunov(A, Q, X);
+		return X;
+	}
+
+	//! @brief 連続リアプノフ方程式 AX + XA' + Q = 0 の解Xをクロネッカー積で求める関数 (引数渡し版)
+	//!        n^2×n^2 の線形方程式を解くので O(n^6) の計算量と O(n^4) のスタックを要する。検証用。
+	//! @tparam		M,MQ,MX	行列の高さ
+	//! @tparam		N,NQ,NX	行列の幅
+	//! @tparam		T,TQ,TX	行列のデータ型
+	//! @param[in]	A	A行列
+	//! @param[in]	Q	Q行列
+	//! @param[out]	X	解Xの行列
+	template<size_t M, size_t N, typename T = double, size_t MQ, size_t NQ, typename TQ = double, size_t MX, size_t NX, typename TX = double>
+	static constexpr void LyapunovKron(const ArcsMat<M,N,T>& A, const ArcsMat<MQ, NQ, TQ>& Q, ArcsMat<MX,NX,TX>& X){
+		static_assert(M == N,   "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MQ == NQ, "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MX == NX, "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MQ == M,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MX == M,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(NQ == N,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(NX == N,  "ArcsCtrl: Size Error");	// サイズチェック
+
 		// 連続リアプノフ方程式は以下のように線形方程式に変形できるので、
 		// 　AX + XA' + Q = 0
 		// 　AX + XA' = -Q
@@ -69,7 +364,7 @@ namespace ArcsControl {	// ArcsControl名前空間
 		X = vecinv<M,N>( linsolve(C, d) );		// 線形方程式 Cy = d を y について解いて逆vec作用素を掛けるだけ
 	}
 
-	//! @brief 連続リアプノフ方程式 AX + XA' + Q = 0 の解Xを求める関数 (戻り値返し版)
+	//! @brief 連続リアプノフ方程式 AX + XA' + Q = 0 の解Xをクロネッカー積で求める関数 (戻り値返し版)
 	//! @tparam		M,MQ	行列の高さ
 	//! @tparam		N,NQ	行列の幅
 	//! @tparam		T,TQ	行列のデータ型
@@ -77,13 +372,14 @@ namespace ArcsControl {	// ArcsControl名前空間
 	//! @param[in]	Q	Q行列
 	//! @return	解Xの行列
 	template<size_t M, size_t N, typename T = double, size_t MQ, size_t NQ, typename TQ = double>
-	static constexpr ArcsMat<M,N,T> Lyapunov(const ArcsMat<M,N,T>& A, const ArcsMat<MQ, NQ, TQ>& Q){
+	static constexpr ArcsMat<M,N,T> LyapunovKron(const ArcsMat<M,N,T>& A, const ArcsMat<MQ, NQ, TQ>& Q){
 		ArcsMat<M,N,T> X;
-		Lyapunov(A, Q, X);
+		LyapunovKron(A, Q, X);
 		return X;
 	}
 
-	//! @brief 離散リアプノフ方程式 AXA' - X + Q = 0 の解Xを求める関数 (引数渡し版)
+	//! @brief 離散リアプノフ方程式 AXA' - X + Q = 0 の解Xをクロネッカー積で求める関数 (引数渡し版)
+	//!        n^2×n^2 の線形方程式を解くので O(n^6) の計算量と O(n^4) のスタックを要する。検証用。
 	//! @tparam		M,MQ,MX	行列の高さ
 	//! @tparam		N,NQ,NX	行列の幅
 	//! @tparam		T,TQ,TX	行列のデータ型
@@ -91,7 +387,7 @@ namespace ArcsControl {	// ArcsControl名前空間
 	//! @param[in]	Q	Q行列
 	//! @param[out]	X	解Xの行列
 	template<size_t M, size_t N, typename T = double, size_t MQ, size_t NQ, typename TQ = double, size_t MX, size_t NX, typename TX = double>
-	static constexpr void DiscLyapunov(const ArcsMat<M,N,T>& A, const ArcsMat<MQ, NQ, TQ>& Q, ArcsMat<MX,NX,TX>& X){
+	static constexpr void DiscLyapunovKron(const ArcsMat<M,N,T>& A, const ArcsMat<MQ, NQ, TQ>& Q, ArcsMat<MX,NX,TX>& X){
 		static_assert(M == N,   "ArcsCtrl: Size Error");	// 正方行列のみ対応
 		static_assert(MQ == NQ, "ArcsCtrl: Size Error");	// 正方行列のみ対応
 		static_assert(MX == NX, "ArcsCtrl: Size Error");	// 正方行列のみ対応
@@ -117,7 +413,7 @@ namespace ArcsControl {	// ArcsControl名前空間
 		X = vecinv<M,N>( linsolve(C, d) );			// 線形方程式 Cy = d を y について解いて逆vec作用素を掛けるだけ
 	}
 
-	//! @brief 離散リアプノフ方程式 AXA' - X + Q = 0 の解Xを求める関数 (戻り値返し版)
+	//! @brief 離散リアプノフ方程式 AXA' - X + Q = 0 の解Xをクロネッカー積で求める関数 (戻り値返し版)
 	//! @tparam		M,MQ	行列の高さ
 	//! @tparam		N,NQ	行列の幅
 	//! @tparam		T,TQ	行列のデータ型
@@ -125,9 +421,9 @@ namespace ArcsControl {	// ArcsControl名前空間
 	//! @param[in]	Q	Q行列
 	//! @return	解Xの行列
 	template<size_t M, size_t N, typename T = double, size_t MQ, size_t NQ, typename TQ = double>
-	static constexpr ArcsMat<M,N,T> DiscLyapunov(const ArcsMat<M,N,T>& A, const ArcsMat<MQ, NQ, TQ>& Q){
+	static constexpr ArcsMat<M,N,T> DiscLyapunovKron(const ArcsMat<M,N,T>& A, const ArcsMat<MQ, NQ, TQ>& Q){
 		ArcsMat<M,N,T> X;
-		DiscLyapunov(A, Q, X);
+		DiscLyapunovKron(A, Q, X);
 		return X;
 	}
 
@@ -321,7 +617,207 @@ namespace ArcsControl {	// ArcsControl名前空間
 		return {Ah, Bh, Ch};
 	}
 	
-	//! @brief 連続系状態空間モデルを離散化する関数 (引数渡し版)
+	//! @brief 離散化の方法の定義
+	enum class DiscMethod {
+		DSC_ZOH,	//!< 0次ホールド (ステップ不変変換)
+		DSC_FOH,	//!< 1次ホールド (三角ホールド, ランプ不変変換)
+		DSC_TUSTIN	//!< 双一次変換 (Tustin変換)
+	};
+
+	//! @brief 連続系状態空間モデルを0次ホールドで離散化する関数 (引数渡し版)
+	//! Van Loanの方法により，ブロック行列の行列指数関数
+	//! 　expm([Ac Bc; 0 0]*Ts) = [Ad Bd; 0 I]
+	//! を1回だけ計算して Ad と Bd を同時に得る。
+	//! @tparam	Npade	[-] パデ近似の最高次数 (デフォルト値 = 13次)
+	//! @tparam	Nintg	[-] 非推奨・未使用 (数値積分で離散化していた頃の定積分の分割数。Discretize<13,30> のような従来の呼び出しがそのまま通るように残してある)
+	//! @tparam	M	Ac行列の高さ
+	//! @tparam	N	Ac行列の幅
+	//! @tparam	MB	Bc行列の高さ
+	//! @tparam	NB	Bc行列の幅
+	//! @tparam	MAD	Ad行列の高さ
+	//! @tparam	NAD	Ad行列の幅
+	//! @tparam	MBD	Bd行列の高さ
+	//! @tparam	NBD	Bd行列の幅
+	//! @param[in]	Ac	連続系のA行列
+	//! @param[in]	Bc	連続系のB行列
+	//! @param[out]	Ad	離散系のA行列
+	//! @param[out]	Bd	離散系のB行列
+	//! @param[in]	Ts	[s] サンプリング時間
+	template<
+		size_t Npade = 13, size_t Nintg = 0,
+		size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double,
+		size_t MAD, size_t NAD, typename TAD = double, size_t MBD, size_t NBD, typename TBD = double
+	>
+	static constexpr void Discretize(
+		const ArcsMat<M,N,T>& Ac, const ArcsMat<MB,NB,TB>& Bc, ArcsMat<MAD,NAD,TAD>& Ad, ArcsMat<MBD,NBD,TBD>& Bd, const double Ts
+	){
+		static_assert(M == N,   "ArcsCtrl: Size Error");	// A行列は正方行列
+		static_assert(MAD == NAD, "ArcsCtrl: Size Error");	// Ah行列は正方行列
+		static_assert(MB == M , "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MAD == M , "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MBD == MB , "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(NBD == NB , "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(0 < Npade, "ArcsCtrl: Setting Error");// 設定チェック
+		arcs_assert(0 < Ts);	// 設定チェック
+
+		ArcsMat<N + NB, N + NB, T> Z, E;
+		setsubmatrix(Z, Ac*Ts, 1, 1);		// Z = [Ac*Ts Bc*Ts]
+		setsubmatrix(Z, Bc*Ts, 1, N + 1);	//     [    0     0]
+		expm<Npade>(Z, E);					// E = [Ad Bd; 0 I]
+		getsubmatrix(E, Ad, 1, 1);			// A行列の離散化
+		getsubmatrix(E, Bd, 1, N + 1);		// B行列の離散化
+	}
+	
+	//! @brief 連続系状態空間モデルを0次ホールドで離散化する関数 (タプル返し版)
+	//! @tparam	Npade	[-] パデ近似の最高次数 (デフォルト値 = 13次)
+	//! @tparam	Nintg	[-] 非推奨・未使用 (引数渡し版と同じ)
+	//! @tparam	M	Ac行列の高さ
+	//! @tparam	N	Ac行列の幅
+	//! @tparam	MB	Bc行列の高さ
+	//! @tparam	NB	Bc行列の幅
+	//! @param[in]	Ac	連続系のA行列
+	//! @param[in]	Bc	連続系のB行列
+	//! @param[in]	Ts	[s] サンプリング時間
+	//! @return	(Ad, Bd)	離散系のA行列とB行列のタプル
+	template<
+		size_t Npade = 13, size_t Nintg = 0,
+		size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double
+	>
+	static constexpr std::tuple<ArcsMat<M,N,T>, ArcsMat<MB,NB,TB>> Discretize(const ArcsMat<M,N,T>& Ac, const ArcsMat<MB,NB,TB>& Bc, const double Ts){
+		ArcsMat<M,N,T> Ad;
+		ArcsMat<MB,NB,TB> Bd;
+		Discretize<Npade>(Ac, Bc, Ad, Bd, Ts);
+		return {Ad, Bd};
+	}
+	
+	//! @brief 連続系状態空間モデルを指定の方法で離散化する関数 (引数渡し版)
+	//! FOHと双一次変換では離散系のC行列とD行列も変わるので，A,B,C,D行列のすべてを変換する。
+	//! - DSC_ZOH    : expm([Ac Bc; 0 0]*Ts) = [Ad Bd; 0 I], Cd = Cc, Dd = Dc
+	//! - DSC_FOH    : expm([Ac*Ts Bc*Ts 0; 0 0 I; 0 0 0]) = [Φ Γ1 Γ2; 0 I I; 0 0 I] として，
+	//!                Ad = Φ, Bd = Γ1 + (Φ - I)Γ2, Cd = Cc, Dd = Dc + Cc*Γ2
+	//! - DSC_TUSTIN : E = I - Ac*Ts/2 として，Ad = E^-1 (I + Ac*Ts/2), Bd = E^-1 Bc Ts, Cd = Cc E^-1, Dd = Dc + Cc E^-1 Bc Ts/2
+	//! @tparam	Method	離散化の方法 (デフォルト値 = 0次ホールド)
+	//! @tparam	Npade	[-] パデ近似の最高次数 (デフォルト値 = 13次)
+	//! @tparam	M, N, T, MB, NB, TB, MC, NC, TC, MD, ND, TD	連続系のA,B,C,D行列の高さ, 幅, 要素の型
+	//! @tparam	MAD, NAD, TAD, MBD, NBD, TBD, MCD, NCD, TCD, MDD, NDD, TDD	離散系のA,B,C,D行列の高さ, 幅, 要素の型
+	//! @param[in]	Ac	連続系のA行列
+	//! @param[in]	Bc	連続系のB行列
+	//! @param[in]	Cc	連続系のC行列
+	//! @param[in]	Dc	連続系のD行列
+	//! @param[out]	Ad	離散系のA行列
+	//! @param[out]	Bd	離散系のB行列
+	//! @param[out]	Cd	離散系のC行列
+	//! @param[out]	Dd	離散系のD行列
+	//! @param[in]	Ts	[s] サンプリング時間
+	template<
+		DiscMethod Method = DiscMethod::DSC_ZOH, size_t Npade = 13,
+		size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double,
+		size_t MC, size_t NC, typename TC = double, size_t MD, size_t ND, typename TD = double,
+		size_t MAD, size_t NAD, typename TAD = double, size_t MBD, size_t NBD, typename TBD = double,
+		size_t MCD, size_t NCD, typename TCD = double, size_t MDD, size_t NDD, typename TDD = double
+	>
+	static constexpr void DiscretizeSystem(
+		const ArcsMat<M,N,T>& Ac, const ArcsMat<MB,NB,TB>& Bc, const ArcsMat<MC,NC,TC>& Cc, const ArcsMat<MD,ND,TD>& Dc,
+		ArcsMat<MAD,NAD,TAD>& Ad, ArcsMat<MBD,NBD,TBD>& Bd, ArcsMat<MCD,NCD,TCD>& Cd, ArcsMat<MDD,NDD,TDD>& Dd, const double Ts
+	){
+		static_assert(M == N,   "ArcsCtrl: Size Error");	// A行列は正方行列
+		static_assert(MB == M,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(NC == N,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MD == MC, "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(ND == NB, "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MAD == M && NAD == N, "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MBD == MB && NBD == NB, "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MCD == MC && NCD == NC, "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MDD == MD && NDD == ND, "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(0 < Npade, "ArcsCtrl: Setting Error");// 設定チェック
+		arcs_assert(0 < Ts);	// 設定チェック
+
+		if constexpr(Method == DiscMethod::DSC_ZOH){
+			// 0次ホールドの場合
+			Discretize<Npade>(Ac, Bc, Ad, Bd, Ts);
+			Cd = Cc;
+			Dd = Dc;
+		}else if constexpr(Method == DiscMethod::DSC_FOH){
+			// 1次ホールドの場合
+			ArcsMat<N + 2*NB, N + 2*NB, T> Z, E;
+			setsubmatrix(Z, Ac*Ts, 1, 1);							// Z = [Ac*Ts Bc*Ts 0]
+			setsubmatrix(Z, Bc*Ts, 1, N + 1);						//     [    0     0 I]
+			setsubmatrix(Z, ArcsMat<NB,NB,T>::eye(), N + 1, N + NB + 1);	//     [    0     0 0]
+			expm<Npade>(Z, E);										// E = [Φ Γ1 Γ2; 0 I I; 0 0 I]
+			const auto Phi = getsubmatrix<N,N>(E, 1, 1);
+			const auto Gam1 = getsubmatrix<N,NB>(E, 1, N + 1);
+			const auto Gam2 = getsubmatrix<N,NB>(E, 1, N + NB + 1);
+			Ad = Phi;
+			Bd = lazy(Gam1) + lazy(Phi)*Gam2 - Gam2;	// 次の時刻の入力の項を状態変数に含めて因果的な形にする
+			Cd = Cc;
+			Dd = lazy(Dc) + lazy(Cc)*Gam2;
+		}else if constexpr(Method == DiscMethod::DSC_TUSTIN){
+			// 双一次変換の場合
+			const auto I = ArcsMat<N,N,T>::eye();
+			const ArcsMat<N,N,T> Einv = inv(ArcsMat<N,N,T>(lazy(I) - lazy(Ac)*(Ts/2.0)));	// E^-1 = (I - Ac*Ts/2)^-1
+			const ArcsMat<N,NB,T> EinvB = Einv*Bc;
+			Ad = lazy(Einv)*(lazy(I) + lazy(Ac)*(Ts/2.0));
+			Bd = lazy(EinvB)*Ts;
+			Cd = Cc*Einv;
+			Dd = lazy(Dc) + lazy(Cc)*EinvB*(Ts/2.0);
+		}
+	}
+	
+	//! @brief 連続系状態空間モデルを指定の方法で離散化する関数 (タプル返し版)
+	//! @tparam	Method	離散化の方法 (デフォルト値 = 0次ホールド)
+	//! @tparam	Npade	[-] パデ近似の最高次数 (デフォルト値 = 13次)
+	//! @tparam	M, N, T, MB, NB, TB, MC, NC, TC, MD, ND, TD	連続系のA,B,C,D行列の高さ, 幅, 要素の型
+	//! @param[in]	Ac	連続系のA行列
+	//! @param[in]	Bc	連続系のB行列
+	//! @param[in]	Cc	連続系のC行列
+	//! @param[in]	Dc	連続系のD行列
+	//! @param[in]	Ts	[s] サンプリング時間
+	//! @return	(Ad, Bd, Cd, Dd)	離散系のA,B,C,D行列のタプル
+	template<
+		DiscMethod Method = DiscMethod::DSC_ZOH, size_t Npade = 13,
+		size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double,
+		size_t MC, size_t NC, typename TC = double, size_t MD, size_t ND, typename TD = double
+	>
+	static constexpr std::tuple<ArcsMat<M,N,T>, ArcsMat<MB,NB,TB>, ArcsMat<MC,NC,TC>, ArcsMat<MD,ND,TD>> DiscretizeSystem(
+		const ArcsMat<M,N,T>& Ac, const ArcsMat<MB,NB,TB>& Bc, const ArcsMat<MC,NC,TC>& Cc, const ArcsMat<MD,ND,TD>& Dc, const double Ts
+	){
+		ArcsMat<M,N,T> Ad;
+		ArcsMat<MB,NB,TB> Bd;
+		ArcsMat<MC,NC,TC> Cd;
+		ArcsMat<MD,ND,TD> Dd;
+		DiscretizeSystem<Method, Npade>(Ac, Bc, Cc, Dc, Ad, Bd, Cd, Dd, Ts);
+		return {Ad, Bd, Cd, Dd};
+	}
+
+	//! @brief 連続系の2次(または1次)の伝達関数を双一次変換で離散化する関数 (2次セクション用)
+	//! (n2*s^2 + n1*s + n0)/(d2*s^2 + d1*s + d0) に s = K(1 - z^-1)/(1 + z^-1) を代入して，
+	//! (b0 + b1*z^-1 + b2*z^-2)/(a0 + a1*z^-1 + a2*z^-2) の係数を返す。ただし a0 = 1 に正規化する。
+	//! n2 = d2 = 0 の1次の場合は z = -1 の極零相殺が起きないように1次のまま離散化する(b2 = a2 = 0)。
+	//! @param[in]	Num	連続系の分子係数ベクトル {n2, n1, n0}
+	//! @param[in]	Den	連続系の分母係数ベクトル {d2, d1, d0}
+	//! @param[in]	Ts	[s] サンプリング周期
+	//! @param[in]	wp	[rad/s] プリワーピング周波数 (0 ならプリワーピングしない, デフォルト値 = 0)
+	//! @return	(離散系の分子係数ベクトル {b0, b1, b2}, 離散系の分母係数ベクトル {1, a1, a2}) のタプル
+	static std::tuple<ArcsMat<3,1>, ArcsMat<3,1>> BilinearSection(const ArcsMat<3,1>& Num, const ArcsMat<3,1>& Den, const double Ts, const double wp = 0){
+		arcs_assert(0 < Ts);	// 設定チェック
+		const double K = 0 < wp ? wp/std::tan(wp*Ts/2.0) : 2.0/Ts;	// s = K(1 - z^-1)/(1 + z^-1)
+		ArcsMat<3,1> b, a;
+		if(Num[1] == 0 && Den[1] == 0){
+			// 1次の場合
+			b = { Num[2]*K + Num[3], Num[3] - Num[2]*K, 0 };
+			a = { Den[2]*K + Den[3], Den[3] - Den[2]*K, 0 };
+		}else{
+			// 2次の場合
+			const double K2 = K*K;
+			b = { Num[1]*K2 + Num[2]*K + Num[3], 2.0*(Num[3] - Num[1]*K2), Num[1]*K2 - Num[2]*K + Num[3] };
+			a = { Den[1]*K2 + Den[2]*K + Den[3], 2.0*(Den[3] - Den[1]*K2), Den[1]*K2 - Den[2]*K + Den[3] };
+		}
+		arcs_assert(a[1] != 0);	// 分母の最上位係数が零でないかチェック
+		return {b/a[1], a/a[1]};
+	}
+
+	//! @brief 連続系状態空間モデルをシンプソン法による数値積分で離散化する関数 (引数渡し版)
+	//! 従来の離散化の方法。Discretize() の結果の検証用に残してある。
 	//! @tparam	Npade	[-] パデ近似の次数 (デフォルト値 = 13次)
 	//! @tparam	Nint	[-] 定積分の分割数 (デフォルト値 = 10000点)
 	//! @tparam	M	Ac行列の高さ
@@ -342,7 +838,7 @@ namespace ArcsControl {	// ArcsControl名前空間
 		size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double,
 		size_t MAD, size_t NAD, typename TAD = double, size_t MBD, size_t NBD, typename TBD = double
 	>
-	static constexpr void Discretize(
+	static constexpr void DiscretizeSimpson(
 		const ArcsMat<M,N,T>& Ac, const ArcsMat<MB,NB,TB>& Bc, ArcsMat<MAD,NAD,TAD>& Ad, ArcsMat<MBD,NBD,TBD>& Bd, const double Ts
 	){
 		static_assert(M == N,   "ArcsCtrl: Size Error");	// A行列は正方行列
@@ -374,7 +870,7 @@ namespace ArcsControl {	// ArcsControl名前空間
 		Bd = intg_expm*Bc;						// B行列の離散化
 	}
 	
-	//! @brief 連続系状態空間モデルを離散化する関数 (タプル返し版)
+	//! @brief 連続系状態空間モデルをシンプソン法による数値積分で離散化する関数 (タプル返し版)
 	//! @tparam	Npade	[-] パデ近似の次数 (デフォルト値 = 13次)
 	//! @tparam	Nint	[-] 定積分の分割数 (デフォルト値 = 10000点)
 	//! @tparam	M	Ac行列の高さ
@@ -389,10 +885,10 @@ namespace ArcsControl {	// ArcsControl名前空間
 		size_t Npade = 13, size_t Nintg = 10000,
 		size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double
 	>
-	static constexpr std::tuple<ArcsMat<M,N,T>, ArcsMat<MB,NB,TB>> Discretize(const ArcsMat<M,N,T>& Ac, const ArcsMat<MB,NB,TB>& Bc, const double Ts){
+	static constexpr std::tuple<ArcsMat<M,N,T>, ArcsMat<MB,NB,TB>> DiscretizeSimpson(const ArcsMat<M,N,T>& Ac, const ArcsMat<MB,NB,TB>& Bc, const double Ts){
 		ArcsMat<M,N,T> Ad;
 		ArcsMat<MB,NB,TB> Bd;
-		Discretize<Npade, Nintg>(Ac, Bc, Ad, Bd, Ts);
+		DiscretizeSimpson<Npade, Nintg>(Ac, Bc, Ad, Bd, Ts);
 		return {Ad, Bd};
 	}
 
@@ -461,52 +957,396 @@ namespace ArcsControl {	// ArcsControl名前空間
 		return M == rank(Co);	// ランクを計算して状態数と同一なら可観測
 	}
 
-//--------------------- ここから廃止予定
+	//! @brief 構造保存倍増法 (SDA) の反復を収束するまで回す関数 (内部用)
+	//! A, G, H を初期値として
+	//! 　W = I + GH,  A ← A W^-1 A,  G ← G + A W^-1 G A',  H ← H + A' H W^-1 A
+	//! を繰り返すと，H はリカッチ方程式の安定化解に2次収束し，A は零に収束する。
+	//! @tparam		M	行列の高さと幅
+	//! @tparam		T	行列のデータ型
+	//! @param[in,out]	A	A行列 (反復後は零に近づく)
+	//! @param[in,out]	G	G行列 (反復後は双対側の解)
+	//! @param[in,out]	H	H行列 (反復後は安定化解)
+	template<size_t M, typename T = double>
+	static constexpr void DoublingIteration(ArcsMat<M,M,T>& A, ArcsMat<M,M,T>& G, ArcsMat<M,M,T>& H){
+		constexpr size_t ITERMAX = 100;	// 最大反復回数
+		constexpr T eps = std::numeric_limits<T>::epsilon();
+		const auto I = ArcsMat<M,M,T>::eye();
+		for(size_t k = 0; k < ITERMAX; ++k){
+			const ArcsMat<M,M,T> Wi = inv(ArcsMat<M,M,T>(lazy(I) + lazy(G)*H));	// W^-1
+			const ArcsMat<M,M,T> WA = Wi*A;
+			const ArcsMat<M,M,T> WG = Wi*G;
+			const ArcsMat<M,M,T> dH = ~A*H*WA;
+			const ArcsMat<M,M,T> dG = A*WG*~A;
+			A = A*WA;
+			G = lazy(G) + lazy(dG)*0.5 + lazy(~dG)*0.5;	// 丸め誤差で対称性が崩れないようにする
+			const ArcsMat<M,M,T> Hn = lazy(H) + lazy(dH)*0.5 + lazy(~dH)*0.5;
+			const T d = max(abs(ArcsMat<M,M,T>(Hn - H)));
+			H = Hn;
+			if(d <= eps*max(abs(H))) return;	// 更新量が丸め誤差以下になったら収束
+		}
+		arcs_assert(false);	// 収束しない場合 (安定化解が無い場合など)
+	}
 
-	//! @brief 連続リアプノフ方程式 A*X + X*A^T + Q = 0 の解Xを求める関数(実数版, 引数で返す版)
-	//! @tparam		NN	行列の幅
-	//! @tparam		MM	行列の高さ
+	//! @brief 離散リカッチ方程式 A'XA - X - A'XB(R + B'XB)^-1 B'XA + Q = 0 の安定化解Xを求める関数 (引数渡し版)
+	//!        構造保存倍増法 (SDA) により，A = A, G = BR^-1B', H = Q から反復して解く。
+	//!        1回の反復は O(n^3) で，閉ループ極 z について |z|^(2^k) で収束するので，数十回以内で収束する。
+	//! @tparam		M,MB,MQ,MR,MX	行列の高さ
+	//! @tparam		N,NB,NQ,NR,NX	行列の幅
+	//! @tparam		T,TB,TQ,TR,TX	行列のデータ型
 	//! @param[in]	A	A行列
-	//! @param[in]	Q	Q行列
-	//! @param[out]	X	解Xの行列
-	template<size_t NN, size_t MM>
-	static constexpr void Lyapunov(const Matrix<NN,MM,double>& A, const Matrix<NN,MM,double>& Q, Matrix<NN,MM,double>& X){
-		static_assert(NN == MM);					// 正方行列のみ対応
-		constexpr auto I = Matrix<NN,NN>::eye();	// 単位行列
-		X = Matrix<1,NN*MM>::template vecinv<NN,MM>( -inv( Kronecker(I,A) + Kronecker(A,I) )*vec(Q) );	// A*X + X*A^T + Q = 0 をXについて解く
+	//! @param[in]	B	B行列
+	//! @param[in]	Q	状態の重み行列 (半正定対称)
+	//! @param[in]	R	入力の重み行列 (正定対称)
+	//! @param[out]	X	安定化解Xの行列
+	template<
+		size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double, size_t MQ, size_t NQ, typename TQ = double,
+		size_t MR, size_t NR, typename TR = double, size_t MX, size_t NX, typename TX = double
+	>
+	static constexpr void DiscRiccati(
+		const ArcsMat<M,N,T>& A, const ArcsMat<MB,NB,TB>& B, const ArcsMat<MQ,NQ,TQ>& Q, const ArcsMat<MR,NR,TR>& R, ArcsMat<MX,NX,TX>& X
+	){
+		static_assert(M == N,   "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MQ == NQ, "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MR == NR, "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MX == NX, "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MB == M,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MQ == M,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MR == NB, "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MX == M,  "ArcsCtrl: Size Error");	// サイズチェック
+
+		// 参考文献： E. K.-W. Chu, H.-Y. Fan, and W.-W. Lin,
+		//           "A structure-preserving doubling algorithm for discrete-time algebraic Riccati equations,"
+		//           Linear Algebra Appl., vol. 396, pp. 55-80, 2005.
+		ArcsMat<M,N,T> Ak = A;
+		ArcsMat<M,N,T> Gk = B*inv(R)*~B;
+		ArcsMat<M,N,T> Hk = Q;
+		DoublingIteration(Ak, Gk, Hk);
+		X = Hk;
 	}
-	
-	//! @brief 連続リアプノフ方程式 A*X + X*A^T + Q = 0 の解Xを求める関数(実数版, 戻り値で返す版)
-	//! @tparam		NN	行列の幅
-	//! @tparam		MM	行列の高さ
+
+	//! @brief 離散リカッチ方程式 A'XA - X - A'XB(R + B'XB)^-1 B'XA + Q = 0 の安定化解Xを求める関数 (戻り値返し版)
+	//! @tparam		M,MB,MQ,MR	行列の高さ
+	//! @tparam		N,NB,NQ,NR	行列の幅
+	//! @tparam		T,TB,TQ,TR	行列のデータ型
 	//! @param[in]	A	A行列
-	//! @param[in]	Q	Q行列
-	//! @return		解Xの行列
-	template<size_t NN, size_t MM>
-	static constexpr Matrix<NN,MM,double> Lyapunov(const Matrix<NN,MM,double>& A, const Matrix<NN,MM,double>& Q){
-		Matrix<NN,MM,double> X;
-		Lyapunov(A, Q, X);
+	//! @param[in]	B	B行列
+	//! @param[in]	Q	状態の重み行列 (半正定対称)
+	//! @param[in]	R	入力の重み行列 (正定対称)
+	//! @return	安定化解Xの行列
+	template<size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double, size_t MQ, size_t NQ, typename TQ = double, size_t MR, size_t NR, typename TR = double>
+	static constexpr ArcsMat<M,N,T> DiscRiccati(const ArcsMat<M,N,T>& A, const ArcsMat<MB,NB,TB>& B, const ArcsMat<MQ,NQ,TQ>& Q, const ArcsMat<MR,NR,TR>& R){
+		ArcsMat<M,N,T> X;
+		DiscRiccati(A, B, Q, R, X);
 		return X;
 	}
-	
-	//! @brief 可制御グラミアンを計算する関数(引数で返す版)
-	//! @tparam		NA	A行列の幅
-	//! @tparam		MA	A行列の高さ
-	//! @tparam		NB	b行列の幅
+
+	//! @brief 連続リカッチ方程式 A'X + XA - XBR^-1B'X + Q = 0 の安定化解Xを求める関数 (引数渡し版)
+	//!        ハミルトン行列をケーリー変換して離散系と同じ形にしてから，構造保存倍増法 (SDA) で解く。
+	//!        変換のパラメータγは，ハミルトン行列の固有値の大きさの幾何平均とする。
+	//! @tparam		M,MB,MQ,MR,MX	行列の高さ
+	//! @tparam		N,NB,NQ,NR,NX	行列の幅
+	//! @tparam		T,TB,TQ,TR,TX	行列のデータ型
 	//! @param[in]	A	A行列
-	//! @param[in]	b	b行列
-	//! @param[out]	Wc	可制御グラミアン
-	template<size_t NA, size_t MA, size_t NB>
-	static constexpr void GramianCtrb(const Matrix<NA,MA>& A, const Matrix<NB,MA>& b, Matrix<NA,MA>& Wc){
-		Lyapunov(A, b*tp(b), Wc);
+	//! @param[in]	B	B行列
+	//! @param[in]	Q	状態の重み行列 (半正定対称)
+	//! @param[in]	R	入力の重み行列 (正定対称)
+	//! @param[out]	X	安定化解Xの行列
+	template<
+		size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double, size_t MQ, size_t NQ, typename TQ = double,
+		size_t MR, size_t NR, typename TR = double, size_t MX, size_t NX, typename TX = double
+	>
+	static constexpr void Riccati(
+		const ArcsMat<M,N,T>& A, const ArcsMat<MB,NB,TB>& B, const ArcsMat<MQ,NQ,TQ>& Q, const ArcsMat<MR,NR,TR>& R, ArcsMat<MX,NX,TX>& X
+	){
+		static_assert(M == N,   "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MQ == NQ, "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MR == NR, "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MX == NX, "ArcsCtrl: Size Error");	// 正方行列のみ対応
+		static_assert(MB == M,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MQ == M,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MR == NB, "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(MX == M,  "ArcsCtrl: Size Error");	// サイズチェック
+
+		// 参考文献： E. K.-W. Chu, H.-Y. Fan, W.-W. Lin, and C.-S. Wang,
+		//           "Structure-preserving algorithms for periodic discrete-time algebraic Riccati equations,"
+		//           Int. J. Control, vol. 77, no. 8, pp. 767-788, 2004.
+		//           T.-M. Huang, R.-C. Li, and W.-W. Lin, "Structure-Preserving Doubling Algorithms for Nonlinear Matrix Equations," SIAM, 2018.
+		const auto I = ArcsMat<M,N,T>::eye();
+		const ArcsMat<M,N,T> G = B*inv(R)*~B;
+
+		// 1. ケーリー変換のパラメータγの決定
+		// ハミルトン行列 [A -G; -Q -A'] の固有値は閉ループ極 λ とその鏡像 -λ なので，
+		// 大きさの幾何平均をγとすると (λ + γ)/(λ - γ) の大きさが最も1から離れる。
+		// また，γ を A の固有値の実部より大きくすると Aγ = A - γI が安定になり，Aγ と Wγ の正則性が保証される。
+		ArcsMat<2*M,2*N,T> Ham;
+		setsubmatrix(Ham, A, 1, 1);
+		setsubmatrix(Ham, -G, 1, N + 1);
+		setsubmatrix(Ham, -Q, M + 1, 1);
+		setsubmatrix(Ham, -~A, M + 1, N + 1);
+		const auto lh = eig(Ham);
+		const auto la = eig(A);
+		T lmin = std::numeric_limits<T>::max(), lmax = 0, amax = 0;
+		for(size_t i = 1; i <= 2*M; ++i){
+			lmin = std::min(lmin, std::abs(lh[i]));
+			lmax = std::max(lmax, std::abs(lh[i]));
+		}
+		for(size_t i = 1; i <= M; ++i) amax = std::max(amax, la[i].real());
+		arcs_assert(0 < lmin);	// 原点に固有値があると安定化解は存在しない
+		const T g = std::max(std::sqrt(lmin*lmax), 2*amax);
+
+		// 2. ケーリー変換による初期値
+		// 　Aγ = A - γI,  Wγ = Aγ' + Q Aγ^-1 G
+		// 　A0 = I + 2γ Wγ^-T,  G0 = 2γ Aγ^-1 G Wγ^-1,  H0 = 2γ Wγ^-1 Q Aγ^-1
+		const ArcsMat<M,N,T> Ag = lazy(A) - lazy(I)*g;
+		const ArcsMat<M,N,T> Agi = inv(Ag);								// Aγ^-1
+		const ArcsMat<M,N,T> AgiG = Agi*G;								// Aγ^-1 G
+		const ArcsMat<M,N,T> Wgi = inv(ArcsMat<M,N,T>(~Ag + Q*AgiG));	// Wγ^-1
+		ArcsMat<M,N,T> Ak = lazy(I) + lazy(~Wgi)*(2*g);
+		ArcsMat<M,N,T> Gk = AgiG*Wgi*(2*g);
+		ArcsMat<M,N,T> Hk = Wgi*Q*Agi*(2*g);
+
+		// 3. 離散系と同じ倍増法の反復
+		DoublingIteration(Ak, Gk, Hk);
+		X = Hk;
 	}
-	
-	//! @brief 可制御グラミアンを計算する関数(戻り値で返す版)
-	//! @tparam		NA	A行列の幅
-	//! @tparam		MA	A行列の高さ
-	//! @tparam		NB	b行列の幅
+
+	//! @brief 連続リカッチ方程式 A'X + XA - XBR^-1B'X + Q = 0 の安定化解Xを求める関数 (戻り値返し版)
+	//! @tparam		M,MB,MQ,MR	行列の高さ
+	//! @tparam		N,NB,NQ,NR	行列の幅
+	//! @tparam		T,TB,TQ,TR	行列のデータ型
 	//! @param[in]	A	A行列
-	//! @param[in]	b	b行列
+	//! @param[in]	B	B行列
+	//! @param[in]	Q	状態の重み行列 (半正定対称)
+	//! @param[in]	R	入力の重み行列 (正定対称)
+	//! @return	安定化解Xの行列
+	template<size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double, size_t MQ, size_t NQ, typename TQ = double, size_t MR, size_t NR, typename TR = double>
+	static constexpr ArcsMat<M,N,T> Riccati(const ArcsMat<M,N,T>& A, const ArcsMat<MB,NB,TB>& B, const ArcsMat<MQ,NQ,TQ>& Q, const ArcsMat<MR,NR,TR>& R){
+		ArcsMat<M,N,T> X;
+		Riccati(A, B, Q, R, X);
+		return X;
+	}
+
+	//! @brief 連続系の最適レギュレータ(LQR)の状態フィードバックゲインを求める関数 (引数渡し版)
+	//!        評価関数 J = ∫(x'Qx + u'Ru)dt を最小にする u = -Kx のゲイン K = R^-1 B'X を返す。
+	//! @tparam		M,MB,MQ,MR,MK,MX	行列の高さ
+	//! @tparam		N,NB,NQ,NR,NK,NX	行列の幅
+	//! @tparam		T,TB,TQ,TR,TK,TX	行列のデータ型
+	//! @param[in]	A	A行列
+	//! @param[in]	B	B行列
+	//! @param[in]	Q	状態の重み行列 (半正定対称)
+	//! @param[in]	R	入力の重み行列 (正定対称)
+	//! @param[out]	K	状態フィードバックゲイン
+	//! @param[out]	X	リカッチ方程式の安定化解
+	template<
+		size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double, size_t MQ, size_t NQ, typename TQ = double,
+		size_t MR, size_t NR, typename TR = double, size_t MK, size_t NK, typename TK = double, size_t MX, size_t NX, typename TX = double
+	>
+	static constexpr void LQR(
+		const ArcsMat<M,N,T>& A, const ArcsMat<MB,NB,TB>& B, const ArcsMat<MQ,NQ,TQ>& Q, const ArcsMat<MR,NR,TR>& R,
+		ArcsMat<MK,NK,TK>& K, ArcsMat<MX,NX,TX>& X
+	){
+		static_assert(MK == NB, "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(NK == N,  "ArcsCtrl: Size Error");	// サイズチェック
+		Riccati(A, B, Q, R, X);
+		K = inv(R)*~B*X;
+	}
+
+	//! @brief 連続系の最適レギュレータ(LQR)の状態フィードバックゲインを求める関数 (タプル返し版)
+	//! @tparam		M,MB,MQ,MR	行列の高さ
+	//! @tparam		N,NB,NQ,NR	行列の幅
+	//! @tparam		T,TB,TQ,TR	行列のデータ型
+	//! @param[in]	A	A行列
+	//! @param[in]	B	B行列
+	//! @param[in]	Q	状態の重み行列 (半正定対称)
+	//! @param[in]	R	入力の重み行列 (正定対称)
+	//! @return	(K, X)	状態フィードバックゲインとリカッチ方程式の安定化解のタプル
+	template<size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double, size_t MQ, size_t NQ, typename TQ = double, size_t MR, size_t NR, typename TR = double>
+	static constexpr std::tuple<ArcsMat<NB,N,T>, ArcsMat<M,N,T>> LQR(const ArcsMat<M,N,T>& A, const ArcsMat<MB,NB,TB>& B, const ArcsMat<MQ,NQ,TQ>& Q, const ArcsMat<MR,NR,TR>& R){
+		ArcsMat<NB,N,T> K;
+		ArcsMat<M,N,T> X;
+		LQR(A, B, Q, R, K, X);
+		return {K, X};
+	}
+
+	//! @brief 離散系の最適レギュレータ(LQR)の状態フィードバックゲインを求める関数 (引数渡し版)
+	//!        評価関数 J = Σ(x'Qx + u'Ru) を最小にする u[k] = -Kx[k] のゲイン K = (R + B'XB)^-1 B'XA を返す。
+	//! @tparam		M,MB,MQ,MR,MK,MX	行列の高さ
+	//! @tparam		N,NB,NQ,NR,NK,NX	行列の幅
+	//! @tparam		T,TB,TQ,TR,TK,TX	行列のデータ型
+	//! @param[in]	A	A行列
+	//! @param[in]	B	B行列
+	//! @param[in]	Q	状態の重み行列 (半正定対称)
+	//! @param[in]	R	入力の重み行列 (正定対称)
+	//! @param[out]	K	状態フィードバックゲイン
+	//! @param[out]	X	リカッチ方程式の安定化解
+	template<
+		size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double, size_t MQ, size_t NQ, typename TQ = double,
+		size_t MR, size_t NR, typename TR = double, size_t MK, size_t NK, typename TK = double, size_t MX, size_t NX, typename TX = double
+	>
+	static constexpr void DiscLQR(
+		const ArcsMat<M,N,T>& A, const ArcsMat<MB,NB,TB>& B, const ArcsMat<MQ,NQ,TQ>& Q, const ArcsMat<MR,NR,TR>& R,
+		ArcsMat<MK,NK,TK>& K, ArcsMat<MX,NX,TX>& X
+	){
+		static_assert(MK == NB, "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(NK == N,  "ArcsCtrl: Size Error");	// サイズチェック
+		DiscRiccati(A, B, Q, R, X);
+		const ArcsMat<NB,N,T> BX = ~B*X;
+		K = inv(ArcsMat<NB,NB,T>(lazy(R) + lazy(BX)*B))*BX*A;
+	}
+
+	//! @brief 離散系の最適レギュレータ(LQR)の状態フィードバックゲインを求める関数 (タプル返し版)
+	//! @tparam		M,MB,MQ,MR	行列の高さ
+	//! @tparam		N,NB,NQ,NR	行列の幅
+	//! @tparam		T,TB,TQ,TR	行列のデータ型
+	//! @param[in]	A	A行列
+	//! @param[in]	B	B行列
+	//! @param[in]	Q	状態の重み行列 (半正定対称)
+	//! @param[in]	R	入力の重み行列 (正定対称)
+	//! @return	(K, X)	状態フィードバックゲインとリカッチ方程式の安定化解のタプル
+	template<size_t M, size_t N, typename T = double, size_t MB, size_t NB, typename TB = double, size_t MQ, size_t NQ, typename TQ = double, size_t MR, size_t NR, typename TR = double>
+	static constexpr std::tuple<ArcsMat<NB,N,T>, ArcsMat<M,N,T>> DiscLQR(const ArcsMat<M,N,T>& A, const ArcsMat<MB,NB,TB>& B, const ArcsMat<MQ,NQ,TQ>& Q, const ArcsMat<MR,NR,TR>& R){
+		ArcsMat<NB,N,T> K;
+		ArcsMat<M,N,T> X;
+		DiscLQR(A, B, Q, R, K, X);
+		return {K, X};
+	}
+
+	//! @brief 連続系の定常カルマンフィルタのゲインを求める関数 (引数渡し版)
+	//!        dx = Ax + w, y = Cx + v (E[ww'] = Qn, E[vv'] = Rn) に対する推定器 dxh = Axh + L(y - Cxh) のゲイン L = PC'Rn^-1 を返す。
+	//!        Pは双対の連続リカッチ方程式 AP + PA' - PC'Rn^-1CP + Qn = 0 の安定化解 (推定誤差の共分散行列)。
+	//! @tparam		M,MC,MQ,MR,ML,MP	行列の高さ
+	//! @tparam		N,NC,NQ,NR,NL,NP	行列の幅
+	//! @tparam		T,TC,TQ,TR,TL,TP	行列のデータ型
+	//! @param[in]	A	A行列
+	//! @param[in]	C	C行列
+	//! @param[in]	Qn	プロセス雑音の共分散行列 (状態空間で表したもの)
+	//! @param[in]	Rn	観測雑音の共分散行列
+	//! @param[out]	L	カルマンゲイン
+	//! @param[out]	P	推定誤差の共分散行列
+	template<
+		size_t M, size_t N, typename T = double, size_t MC, size_t NC, typename TC = double, size_t MQ, size_t NQ, typename TQ = double,
+		size_t MR, size_t NR, typename TR = double, size_t ML, size_t NL, typename TL = double, size_t MP, size_t NP, typename TP = double
+	>
+	static constexpr void Kalman(
+		const ArcsMat<M,N,T>& A, const ArcsMat<MC,NC,TC>& C, const ArcsMat<MQ,NQ,TQ>& Qn, const ArcsMat<MR,NR,TR>& Rn,
+		ArcsMat<ML,NL,TL>& L, ArcsMat<MP,NP,TP>& P
+	){
+		static_assert(NC == N,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(ML == M,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(NL == MC, "ArcsCtrl: Size Error");	// サイズチェック
+		Riccati(ArcsMat<N,M,T>(~A), ArcsMat<NC,MC,TC>(~C), Qn, Rn, P);	// 双対なレギュレータ問題として解く
+		L = P*~C*inv(Rn);
+	}
+
+	//! @brief 連続系の定常カルマンフィルタのゲインを求める関数 (タプル返し版)
+	//! @tparam		M,MC,MQ,MR	行列の高さ
+	//! @tparam		N,NC,NQ,NR	行列の幅
+	//! @tparam		T,TC,TQ,TR	行列のデータ型
+	//! @param[in]	A	A行列
+	//! @param[in]	C	C行列
+	//! @param[in]	Qn	プロセス雑音の共分散行列 (状態空間で表したもの)
+	//! @param[in]	Rn	観測雑音の共分散行列
+	//! @return	(L, P)	カルマンゲインと推定誤差の共分散行列のタプル
+	template<size_t M, size_t N, typename T = double, size_t MC, size_t NC, typename TC = double, size_t MQ, size_t NQ, typename TQ = double, size_t MR, size_t NR, typename TR = double>
+	static constexpr std::tuple<ArcsMat<M,MC,T>, ArcsMat<M,N,T>> Kalman(const ArcsMat<M,N,T>& A, const ArcsMat<MC,NC,TC>& C, const ArcsMat<MQ,NQ,TQ>& Qn, const ArcsMat<MR,NR,TR>& Rn){
+		ArcsMat<M,MC,T> L;
+		ArcsMat<M,N,T> P;
+		Kalman(A, C, Qn, Rn, L, P);
+		return {L, P};
+	}
+
+	//! @brief 離散系の定常カルマンフィルタのゲインを求める関数 (引数渡し版)
+	//!        x[k+1] = Ax[k] + w[k], y[k] = Cx[k] + v[k] (E[ww'] = Qn, E[vv'] = Rn) に対する予測型の推定器
+	//!        xh[k+1] = Axh[k] + L(y[k] - Cxh[k]) のゲイン L = APC'(CPC' + Rn)^-1 を返す (MATLABの kalman の L と同じ)。
+	//!        Pは双対の離散リカッチ方程式の安定化解 (1段先予測の推定誤差の共分散行列)。
+	//! @tparam		M,MC,MQ,MR,ML,MP	行列の高さ
+	//! @tparam		N,NC,NQ,NR,NL,NP	行列の幅
+	//! @tparam		T,TC,TQ,TR,TL,TP	行列のデータ型
+	//! @param[in]	A	A行列
+	//! @param[in]	C	C行列
+	//! @param[in]	Qn	プロセス雑音の共分散行列 (状態空間で表したもの)
+	//! @param[in]	Rn	観測雑音の共分散行列
+	//! @param[out]	L	カルマンゲイン
+	//! @param[out]	P	推定誤差の共分散行列
+	template<
+		size_t M, size_t N, typename T = double, size_t MC, size_t NC, typename TC = double, size_t MQ, size_t NQ, typename TQ = double,
+		size_t MR, size_t NR, typename TR = double, size_t ML, size_t NL, typename TL = double, size_t MP, size_t NP, typename TP = double
+	>
+	static constexpr void DiscKalman(
+		const ArcsMat<M,N,T>& A, const ArcsMat<MC,NC,TC>& C, const ArcsMat<MQ,NQ,TQ>& Qn, const ArcsMat<MR,NR,TR>& Rn,
+		ArcsMat<ML,NL,TL>& L, ArcsMat<MP,NP,TP>& P
+	){
+		static_assert(NC == N,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(ML == M,  "ArcsCtrl: Size Error");	// サイズチェック
+		static_assert(NL == MC, "ArcsCtrl: Size Error");	// サイズチェック
+		DiscRiccati(ArcsMat<N,M,T>(~A), ArcsMat<NC,MC,TC>(~C), Qn, Rn, P);	// 双対なレギュレータ問題として解く
+		const ArcsMat<MC,N,T> CP = C*P;
+		L = A*~CP*inv(ArcsMat<MC,MC,T>(lazy(Rn) + lazy(CP)*~C));
+	}
+
+	//! @brief 離散系の定常カルマンフィルタのゲインを求める関数 (タプル返し版)
+	//! @tparam		M,MC,MQ,MR	行列の高さ
+	//! @tparam		N,NC,NQ,NR	行列の幅
+	//! @tparam		T,TC,TQ,TR	行列のデータ型
+	//! @param[in]	A	A行列
+	//! @param[in]	C	C行列
+	//! @param[in]	Qn	プロセス雑音の共分散行列 (状態空間で表したもの)
+	//! @param[in]	Rn	観測雑音の共分散行列
+	//! @return	(L, P)	カルマンゲインと推定誤差の共分散行列のタプル
+	template<size_t M, size_t N, typename T = double, size_t MC, size_t NC, typename TC = double, size_t MQ, size_t NQ, typename TQ = double, size_t MR, size_t NR, typename TR = double>
+	static constexpr std::tuple<ArcsMat<M,MC,T>, ArcsMat<M,N,T>> DiscKalman(const ArcsMat<M,N,T>& A, const ArcsMat<MC,NC,TC>& C, const ArcsMat<MQ,NQ,TQ>& Qn, const ArcsMat<MR,NR,TR>& Rn){
+		ArcsMat<M,MC,T> L;
+		ArcsMat<M,N,T> P;
+		DiscKalman(A, C, Qn, Rn, L, P);
+		return {L, P};
+	}
+
+//--------------------- ここから廃止予定
+
+	//! @brief 連続リアプノフ方程式 A*X + X*A^T + Q = 0 の解Xを求める関数(実数版, 引数で返す版)
+	//! @tparam		NN	行列の幅
+	//! @tparam		MM	行列の高さ
+	//! @param[in]	A	A行列
+	//! @param[in]	Q	Q行列
+	//! @param[out]	X	解Xの行列
+	template<size_t NN, size_t MM>
+	static constexpr void Lyapunov(const Matrix<NN,MM,double>& A, const Matrix<NN,MM,double>& Q, Matrix<NN,MM,double>& X){
+		static_assert(NN == MM);					// 正方行列のみ対応
+		constexpr auto I = Matrix<NN,NN>::eye();	// 単位行列
+		X = Matrix<1,NN*MM>::template vecinv<NN,MM>( -inv( Kronecker(I,A) + Kronecker(A,I) )*vec(Q) );	// A*X + X*A^T + Q = 0 をXについて解く
+	}
+	
+	//! @brief 連続リアプノフ方程式 A*X + X*A^T + Q = 0 の解Xを求める関数(実数版, 戻り値で返す版)
+	//! @tparam		NN	行列の幅
+	//! @tparam		MM	行列の高さ
+	//! @param[in]	A	A行列
+	//! @param[in]	Q	Q行列
+	//! @return		解Xの行列
+	template<size_t NN, size_t MM>
+	static constexpr Matrix<NN,MM,double> Lyapunov(const Matrix<NN,MM,double>& A, const Matrix<NN,MM,double>& Q){
+		Matrix<NN,MM,double> X;
+		Lyapunov(A, Q, X);
+		return X;
+	}
+	
+	//! @brief 可制御グラミアンを計算する関数(引数で返す版)
+	//! @tparam		NA	A行列の幅
+	//! @tparam		MA	A行列の高さ
+	//! @tparam		NB	b行列の幅
+	//! @param[in]	A	A行列
+	//! @param[in]	b	b行列
+	//! @param[out]	Wc	可制御グラミアン
+	template<size_t NA, size_t MA, size_t NB>
+	static constexpr void GramianCtrb(const Matrix<NA,MA>& A, const Matrix<NB,MA>& b, Matrix<NA,MA>& Wc){
+		Lyapunov(A, b*tp(b), Wc);
+	}
+	
+	//! @brief 可制御グラミアンを計算する関数(戻り値で返す版)
+	//! @tparam		NA	A行列の幅
+	//! @tparam		MA	A行列の高さ
+	//! @tparam		NB	b行列の幅
+	//! @param[in]	A	A行列
+	//! @param[in]	b	b行列
 	//! @return		可制御グラミアン
 	template<size_t NA, size_t MA, size_t NB>
 	static constexpr Matrix<NA,MA> GramianCtrb(const Matrix<NA,MA>& A, const Matrix<NB,MA>& b){
@@ -649,7 +1489,7 @@ class DiscStateSpace {
 	public:
 		//! @brief コンストラクタ(空コンストラクタ版)
 		DiscStateSpace(void) noexcept
-			: A(), B(), C(), D(), u(), x(), x_next(), y(), y_next()
+			: A(), B(), C(), D(), u(), x(), x_prev(), u_prev(), y(), y_next(), YValid(true), YnextValid(true)
 		{
 			PassedLog();
 		}
@@ -672,7 +1512,7 @@ class DiscStateSpace {
 			size_t MC, size_t NC, typename TC = double
 		>
 		DiscStateSpace(const ArcsMat<MA,NA,TA>& Ad, const ArcsMat<MB,NB,TB>& Bd, const ArcsMat<MC,NC,TC>& Cd) noexcept
-			: A(Ad), B(Bd), C(Cd), D(), u(), x(), x_next(), y(), y_next()
+			: A(Ad), B(Bd), C(Cd), D(), u(), x(), x_prev(), u_prev(), y(), y_next(), YValid(true), YnextValid(true)
 		{
 			static_assert(MA == NA, "ArcsCtrl: Size Error");// 正方行列チェック
 			static_assert(MA == N, "ArcsCtrl: Size Error");	// サイズチェック
@@ -705,7 +1545,7 @@ class DiscStateSpace {
 			size_t MC, size_t NC, typename TC = double, size_t MD, size_t ND, typename TD = double
 		>
 		DiscStateSpace(const ArcsMat<MA,NA,TA>& Ad, const ArcsMat<MB,NB,TB>& Bd, const ArcsMat<MC,NC,TC>& Cd, const ArcsMat<MD,ND,TD>& Dd) noexcept
-			: A(Ad), B(Bd), C(Cd), D(Dd), u(), x(), x_next(), y(), y_next()
+			: A(Ad), B(Bd), C(Cd), D(Dd), u(), x(), x_prev(), u_prev(), y(), y_next(), YValid(true), YnextValid(true)
 		{
 			static_assert(MA == NA, "ArcsCtrl: Size Error");// 正方行列チェック
 			static_assert(MA == N, "ArcsCtrl: Size Error");	// サイズチェック
@@ -722,7 +1562,8 @@ class DiscStateSpace {
 		//! @param[in]	r	右辺値
 		DiscStateSpace(DiscStateSpace&& r) noexcept
 			: A(std::move(r.A)), B(std::move(r.B)), C(std::move(r.C)), D(std::move(r.D)),
-			  u(std::move(r.u)), x(std::move(r.x)), x_next(std::move(r.x_next)), y(std::move(r.y)), y_next(std::move(r.y_next))
+			  u(std::move(r.u)), x(std::move(r.x)), x_prev(std::move(r.x_prev)), u_prev(std::move(r.u_prev)),
+			  y(std::move(r.y)), y_next(std::move(r.y_next)), YValid(r.YValid), YnextValid(r.YnextValid)
 		{
 			
 		}
@@ -736,9 +1577,12 @@ class DiscStateSpace {
 			D = std::move(r.D);
 			u = std::move(r.u);
 			x = std::move(r.x);
-			x_next = std::move(r.x_next);
+			x_prev = std::move(r.x_prev);
+			u_prev = std::move(r.u_prev);
 			y = std::move(r.y);
 			y_next = std::move(r.y_next);
+			YValid = r.YValid;
+			YnextValid = r.YnextValid;
 			return *this;
 		}
 
@@ -775,6 +1619,7 @@ class DiscStateSpace {
 			A = Ad;
 			B = Bd;
 			C = Cd;
+			InvalidateOutputs();	// 取得前の出力は新しい行列で計算し直す
 		}
 
 		//! @brief 離散系状態空間モデルのA,B,C,D行列を設定する関数
@@ -812,6 +1657,7 @@ class DiscStateSpace {
 			B = Bd;
 			C = Cd;
 			D = Dd;
+			InvalidateOutputs();	// 取得前の出力は新しい行列で計算し直す
 		}
 
 		//! @brief 状態空間モデルへの入力ベクトルを設定する関数
@@ -862,11 +1708,39 @@ class DiscStateSpace {
 		}
 		
 		//! @brief 状態空間モデルの応答を計算して状態ベクトルを更新する関数
+		//! 出力方程式は出力を取得するときに必要な方だけ計算する(GetOutput 系 → y = C*x + D*u, GetNextOutput 系 → C*x_next + D*u)。
+		//! 計算した出力は次の Update までキャッシュするので，個別の成分を何度取得しても出力方程式の計算は Update 1回につき高々1回ずつである。
+		//! なお，出力は最初に取得した時点の行列と状態で計算するので，Update の後で SetSystem や SetStateVector などを呼ぶと，
+		//! その後に取得する出力には新しい行列と状態が反映される(Update 時に出力まで計算していた以前の版とはこの点が異なる)。
 		void Update(void) noexcept {
-			x_next = A*x + B*u;			// 状態方程式
-			y = C*x + D*u;				// 出力方程式（教科書通りの正しい出力）
-			y_next = C*x_next + D*u;	// 出力方程式（次の時刻の出力ベクトルを先取りして得る場合）
-			x = x_next;					// 状態ベクトルを更新
+			x_prev = x;							// 出力方程式用に更新前の状態ベクトルと入力ベクトルを保持
+			u_prev = u;
+			x = lazy(A)*x_prev + lazy(B)*u_prev;// 状態方程式(式テンプレートで一時変数なしに計算)
+			InvalidateOutputs();				// 出力は取得時に計算し直す
+		}
+
+		//! @brief 入力ベクトルを設定して状態を更新し，出力ベクトルを返す関数 (SetInput → Update → GetOutput を一括実行)
+		//! 次の時刻の出力は計算しないので，Update と GetOutput を別々に呼ぶより軽い。
+		//! @tparam	MU	入力ベクトルの高さ
+		//! @tparam	NU	入力ベクトルの幅
+		//! @tparam	TU	入力ベクトルのデータ型
+		//! @param[in]	ui	入力ベクトル
+		//! @return	出力ベクトル
+		template<size_t MU, size_t NU, typename TU = double>
+		ArcsMat<O,1,T> Step(const ArcsMat<MU,NU,TU>& ui) noexcept {
+			SetInput(ui);
+			Update();
+			return CurrentOutput();
+		}
+
+		//! @brief 入力を設定して状態を更新し，出力を返す関数 (1入力1出力版)
+		//! @param[in]	u1	入力
+		//! @return	出力値
+		T Step1(const T& u1) noexcept {
+			static_assert(I == 1 && O == 1, "ArcsCtrl: Size Error");	// 1入力1出力系かチェック
+			u[1] = u1;
+			Update();
+			return CurrentOutput()[1];
 		}
 
 		//! @brief 状態空間モデルの出力ベクトルを取得する関数(引数渡し版)
@@ -878,13 +1752,13 @@ class DiscStateSpace {
 		void GetOutput(ArcsMat<MY,NY,TY>& yo) noexcept {
 			static_assert(MY == O, "ArcsCtrl: Output Size Error");	// サイズチェック
 			static_assert(NY == 1, "ArcsCtrl: Vector Error");		// サイズチェック
-			yo = y;
+			yo = CurrentOutput();
 		}
 		
 		//! @brief 状態空間モデルの出力ベクトルを取得する関数(戻り値返し版)
 		//! @return	出力ベクトル
 		ArcsMat<O,1> GetOutput(void) noexcept {
-			return y;
+			return CurrentOutput();
 		}
 		
 		//! @brief 状態空間モデルの出力ベクトルの内の、１つの成分のみを選択して取得する関数
@@ -892,34 +1766,36 @@ class DiscStateSpace {
 		//! @return	出力値
 		T GetOutput(const size_t i) noexcept {
 			arcs_assert(0 < i && i <= O);	// 範囲チェック
-			return y[i];
+			return CurrentOutput()[i];
 		}
 
 		//! @brief 状態空間モデルの出力を取得する関数(個別1出力版)
 		//! @return	出力値
 		T GetOutput1(void) noexcept {
 			static_assert(O == 1, "ArcsCtrl: Output Size Error");	// 1出力系かチェック
-			return y[1];
+			return CurrentOutput()[1];
 		}
 
 		//! @brief 状態空間モデルの出力を取得する関数(個別2出力版)
 		//! @return	出力値 (y1, y2) のタプル
 		std::tuple<T,T> GetOutput2(void) noexcept {
 			static_assert(O == 2, "ArcsCtrl: Output Size Error");	// 2出力系かチェック
-			return {y[1], y[2]};
+			const ArcsMat<O,1,T>& yc = CurrentOutput();
+			return {yc[1], yc[2]};
 		}
 
 		//! @brief 状態空間モデルの出力を取得する関数(個別3出力版)
 		//! @return	出力値 (y1, y2, y3) のタプル
 		std::tuple<T,T,T> GetOutput3(void) noexcept {
 			static_assert(O == 3, "ArcsCtrl: Output Size Error");	// 3出力系かチェック
-			return {y[1], y[2], y[3]};
+			const ArcsMat<O,1,T>& yc = CurrentOutput();
+			return {yc[1], yc[2], yc[3]};
 		}
 
 		//! @brief 状態空間モデルの次サンプルの出力ベクトルを先取りして取得する関数(戻り値返し版)
 		//! @return	出力ベクトル
 		ArcsMat<O,1> GetNextOutput(void) noexcept {
-			return y_next;
+			return NextOutput();
 		}
 		
 		//! @brief 状態空間モデルの次サンプルの出力ベクトルの内の、１つの成分のみを選択して先取りして取得する関数
@@ -927,28 +1803,30 @@ class DiscStateSpace {
 		//! @return	出力値
 		T GetNextOutput(const size_t i) noexcept {
 			arcs_assert(0 < i && i <= O);	// 範囲チェック
-			return y_next[i];
+			return NextOutput()[i];
 		}
 
 		//! @brief 状態空間モデルの次サンプルの出力を先取りして取得する関数(個別1出力版)
 		//! @return	出力値
 		T GetNextOutput1(void) noexcept {
 			static_assert(O == 1, "ArcsCtrl: Output Size Error");	// 1出力系かチェック
-			return y_next[1];
+			return NextOutput()[1];
 		}
 
 		//! @brief 状態空間モデルの次サンプルの出力を先取りして取得する関数(個別2出力版)
 		//! @return	出力値 (y1, y2) のタプル
 		std::tuple<T,T> GetNextOutput2(void) noexcept {
 			static_assert(O == 2, "ArcsCtrl: Output Size Error");	// 2出力系かチェック
-			return {y_next[1], y_next[2]};
+			const ArcsMat<O,1,T>& yn = NextOutput();
+			return {yn[1], yn[2]};
 		}
 
 		//! @brief 状態空間モデルの次サンプルの出力を先取りして取得する関数(個別3出力版)
 		//! @return	出力値
 		std::tuple<T,T,T> GetNextOutput3(void) noexcept {
 			static_assert(O == 3, "ArcsCtrl: Output Size Error");	// 3出力系かチェック
-			return {y_next[1], y_next[2], y_next[3]};
+			const ArcsMat<O,1,T>& yn = NextOutput();
+			return {yn[1], yn[2], yn[3]};
 		}
 		
 		//! @brief 状態ベクトルを任意の値にセットする関数
@@ -961,13 +1839,13 @@ class DiscStateSpace {
 			static_assert(MX == N, "ArcsCtrl: Size Error");		// サイズチェック
 			static_assert(NX == 1, "ArcsCtrl: Vector Error");	// サイズチェック
 			x = xi;
-			x_next =xi;
+			YnextValid = false;	// 次サンプルの出力は新しい状態ベクトルで計算し直す
 		}
 
 		//! @brief 状態ベクトルをクリアする関数
 		void ClearStateVector(void) noexcept {
 			x = ArcsMat<N,1>::zeros();
-			x_next = ArcsMat<N,1>::zeros();
+			YnextValid = false;	// 次サンプルの出力は新しい状態ベクトルで計算し直す
 		}
 
 	private:
@@ -979,9 +1857,307 @@ class DiscStateSpace {
 		ArcsMat<O,I,T> D;		//!< D行列
 		ArcsMat<I,1,T> u;		//!< 入力ベクトル
 		ArcsMat<N,1,T> x;		//!< 状態ベクトル
-		ArcsMat<N,1,T> x_next;	//!< 次の時刻の状態ベクトル
-		ArcsMat<O,1,T> y;		//!< 出力ベクトル
-		ArcsMat<O,1,T> y_next;	//!< 次の時刻の出力ベクトル
+		ArcsMat<N,1,T> x_prev;	//!< 更新前の状態ベクトル
+		ArcsMat<I,1,T> u_prev;	//!< 状態の更新に使った入力ベクトル
+		ArcsMat<O,1,T> y;		//!< 出力ベクトルのキャッシュ
+		ArcsMat<O,1,T> y_next;	//!< 次サンプルの出力ベクトルのキャッシュ
+		bool YValid;			//!< 出力ベクトルのキャッシュが有効かどうか
+		bool YnextValid;		//!< 次サンプルの出力ベクトルのキャッシュが有効かどうか
+
+		//! @brief 出力方程式を計算する関数
+		//! @param[in]	xs	状態ベクトル (更新前の x_prev なら現在の出力，更新後の x なら次の時刻の出力)
+		//! @return	出力ベクトル
+		ArcsMat<O,1,T> Output(const ArcsMat<N,1,T>& xs) const noexcept {
+			return lazy(C)*xs + lazy(D)*u_prev;
+		}
+
+		//! @brief 出力ベクトルを返す関数 (Update後の最初の取得時のみ計算する)
+		//! @return	出力ベクトル
+		const ArcsMat<O,1,T>& CurrentOutput(void) noexcept {
+			if(YValid == false){
+				y = Output(x_prev);
+				YValid = true;
+			}
+			return y;
+		}
+
+		//! @brief 次サンプルの出力ベクトルを返す関数 (Update後の最初の取得時のみ計算する)
+		//! @return	出力ベクトル
+		const ArcsMat<O,1,T>& NextOutput(void) noexcept {
+			if(YnextValid == false){
+				y_next = Output(x);
+				YnextValid = true;
+			}
+			return y_next;
+		}
+
+		//! @brief 出力ベクトルのキャッシュを無効にする関数
+		void InvalidateOutputs(void) noexcept {
+			YValid = false;
+			YnextValid = false;
+		}
+};
+
+//! @brief 離散系状態空間モデル一括計算クラス
+//! 同じ構造(次数・入出力数)の L 個の離散系状態空間モデル(多軸ロボットの各軸の制御器やプラントモデルなど)を，
+//! 行列の要素ごとに L 軸分を並べた Structure of Arrays 形式で保持し，1回のSIMD命令で全軸分をまとめて進める。
+//! 係数行列は軸ごとに異なっていても良い。各軸の計算順序は DiscStateSpace と同じなので，結果もビット単位で一致する。
+//! @tparam	N	次数
+//! @tparam I	入力信号の数 (デフォルト値 = 1)
+//! @tparam O	出力信号の数 (デフォルト値 = 1)
+//! @tparam	L	モデルの数(軸数, レーン数)
+template <size_t N, size_t I = 1, size_t O = 1, size_t L = 1>
+class DiscStateSpaceBatch {
+	public:
+		//! @brief コンストラクタ(空コンストラクタ版)
+		DiscStateSpaceBatch(void) noexcept
+			: A(), B(), C(), D(), u(), x(), x_prev(), u_prev()
+		{
+			static_assert(0 < L, "ArcsCtrl: Lane Size Error");
+			PassedLog();
+		}
+
+		//! @brief コンストラクタ(離散系A,B,C行列設定版, 全軸同じモデル)
+		//! @param[in]	Ad	離散系A行列
+		//! @param[in]	Bd	離散系B行列
+		//! @param[in]	Cd	C行列
+		DiscStateSpaceBatch(const ArcsMat<N,N>& Ad, const ArcsMat<N,I>& Bd, const ArcsMat<O,N>& Cd) noexcept
+			: DiscStateSpaceBatch()
+		{
+			SetSystem(Ad, Bd, Cd);
+		}
+
+		//! @brief コンストラクタ(離散系A,B,C,D行列設定版, 全軸同じモデル)
+		//! @param[in]	Ad	離散系A行列
+		//! @param[in]	Bd	離散系B行列
+		//! @param[in]	Cd	C行列
+		//! @param[in]	Dd	D行列
+		DiscStateSpaceBatch(const ArcsMat<N,N>& Ad, const ArcsMat<N,I>& Bd, const ArcsMat<O,N>& Cd, const ArcsMat<O,I>& Dd) noexcept
+			: DiscStateSpaceBatch()
+		{
+			SetSystem(Ad, Bd, Cd, Dd);
+		}
+
+		//! @brief ムーブコンストラクタ
+		//! @param[in]	r	右辺値
+		DiscStateSpaceBatch(DiscStateSpaceBatch&& r) noexcept
+			: A(r.A), B(r.B), C(r.C), D(r.D), u(r.u), x(r.x), x_prev(r.x_prev), u_prev(r.u_prev)
+		{
+			
+		}
+
+		//! @brief デストラクタ
+		~DiscStateSpaceBatch() noexcept {
+			PassedLog();
+		}
+
+		//! @brief 全軸の離散系状態空間モデルのA,B,C行列を同じ値に設定する関数
+		//! @param[in]	Ad	離散系A行列
+		//! @param[in]	Bd	離散系B行列
+		//! @param[in]	Cd	C行列
+		void SetSystem(const ArcsMat<N,N>& Ad, const ArcsMat<N,I>& Bd, const ArcsMat<O,N>& Cd) noexcept {
+			for(size_t l = 1; l <= L; ++l) SetSystem(l, Ad, Bd, Cd);
+		}
+
+		//! @brief 全軸の離散系状態空間モデルのA,B,C,D行列を同じ値に設定する関数
+		//! @param[in]	Ad	離散系A行列
+		//! @param[in]	Bd	離散系B行列
+		//! @param[in]	Cd	C行列
+		//! @param[in]	Dd	D行列
+		void SetSystem(const ArcsMat<N,N>& Ad, const ArcsMat<N,I>& Bd, const ArcsMat<O,N>& Cd, const ArcsMat<O,I>& Dd) noexcept {
+			for(size_t l = 1; l <= L; ++l) SetSystem(l, Ad, Bd, Cd, Dd);
+		}
+
+		//! @brief l軸目の離散系状態空間モデルのA,B,C行列を設定する関数
+		//! @param[in]	l	軸番号(1～L)
+		//! @param[in]	Ad	離散系A行列
+		//! @param[in]	Bd	離散系B行列
+		//! @param[in]	Cd	C行列
+		void SetSystem(const size_t l, const ArcsMat<N,N>& Ad, const ArcsMat<N,I>& Bd, const ArcsMat<O,N>& Cd) noexcept {
+			SetSystem(l, Ad, Bd, Cd, ArcsMat<O,I>::zeros());	// 直達項なし
+		}
+
+		//! @brief l軸目の離散系状態空間モデルのA,B,C,D行列を設定する関数
+		//! @param[in]	l	軸番号(1～L)
+		//! @param[in]	Ad	離散系A行列
+		//! @param[in]	Bd	離散系B行列
+		//! @param[in]	Cd	C行列
+		//! @param[in]	Dd	D行列
+		void SetSystem(const size_t l, const ArcsMat<N,N>& Ad, const ArcsMat<N,I>& Bd, const ArcsMat<O,N>& Cd, const ArcsMat<O,I>& Dd) noexcept {
+			arcs_assert(0 < l && l <= L);	// 範囲チェック
+			Scatter(Ad, A, l);
+			Scatter(Bd, B, l);
+			Scatter(Cd, C, l);
+			Scatter(Dd, D, l);
+		}
+
+		//! @brief 全軸の入力ベクトルを設定する関数
+		//! @param[in]	U	入力行列 (l列目が l軸目の入力ベクトル)
+		void SetInputs(const ArcsMat<I,L>& U) noexcept {
+			for(size_t l = 1; l <= L; ++l){
+				for(size_t i = 1; i <= I; ++i) u[i - 1][l - 1] = U(i,l);
+			}
+		}
+
+		//! @brief l軸目の入力ベクトルを設定する関数
+		//! @param[in]	l	軸番号(1～L)
+		//! @param[in]	ui	入力ベクトル
+		void SetInput(const size_t l, const ArcsMat<I,1>& ui) noexcept {
+			arcs_assert(0 < l && l <= L);	// 範囲チェック
+			for(size_t i = 1; i <= I; ++i) u[i - 1][l - 1] = ui[i];
+		}
+
+		//! @brief 全軸の入力を設定する関数(1入力版)
+		//! @param[in]	u1	入力ベクトル (l番目の要素が l軸目の入力)
+		void SetInput1(const ArcsMat<L,1>& u1) noexcept {
+			static_assert(I == 1, "ArcsCtrl: Input Size Error");	// 1入力系かチェック
+			for(size_t l = 1; l <= L; ++l) u[0][l - 1] = u1[l];
+		}
+
+		//! @brief 全軸の状態空間モデルの応答を計算して状態ベクトルを更新する関数
+		//! 出力方程式は出力を取得するときに必要な方だけ計算する。
+		void Update(void) noexcept {
+			x_prev = x;								// 出力方程式用に更新前の状態ベクトルと入力ベクトルを保持
+			u_prev = u;
+			MultiplyAdd(A, x_prev, B, u_prev, x);	// 状態方程式
+		}
+
+		//! @brief 全軸の出力ベクトルを取得する関数(引数渡し版)
+		//! @param[out]	Y	出力行列 (l列目が l軸目の出力ベクトル)
+		void GetOutputs(ArcsMat<O,L>& Y) const noexcept {
+			Gather(Output(x_prev), Y);
+		}
+
+		//! @brief 全軸の出力ベクトルを取得する関数(戻り値返し版)
+		//! @return	出力行列 (l列目が l軸目の出力ベクトル)
+		ArcsMat<O,L> GetOutputs(void) const noexcept {
+			ArcsMat<O,L> ret;
+			Gather(Output(x_prev), ret);
+			return ret;
+		}
+
+		//! @brief l軸目の出力ベクトルを取得する関数
+		//! @param[in]	l	軸番号(1～L)
+		//! @return	出力ベクトル
+		ArcsMat<O,1> GetOutput(const size_t l) const noexcept {
+			arcs_assert(0 < l && l <= L);	// 範囲チェック
+			const std::array<Lanes, O> y = Output(x_prev);
+			ArcsMat<O,1> ret;
+			for(size_t i = 1; i <= O; ++i) ret[i] = y[i - 1][l - 1];
+			return ret;
+		}
+
+		//! @brief 全軸の出力を取得する関数(1出力版)
+		//! @return	出力ベクトル (l番目の要素が l軸目の出力)
+		ArcsMat<L,1> GetOutput1(void) const noexcept {
+			static_assert(O == 1, "ArcsCtrl: Output Size Error");	// 1出力系かチェック
+			const std::array<Lanes, O> y = Output(x_prev);
+			ArcsMat<L,1> ret;
+			for(size_t l = 1; l <= L; ++l) ret[l] = y[0][l - 1];
+			return ret;
+		}
+
+		//! @brief 全軸の次サンプルの出力ベクトルを先取りして取得する関数
+		//! @return	出力行列 (l列目が l軸目の出力ベクトル)
+		ArcsMat<O,L> GetNextOutputs(void) const noexcept {
+			ArcsMat<O,L> ret;
+			Gather(Output(x), ret);
+			return ret;
+		}
+
+		//! @brief 全軸の次サンプルの出力を先取りして取得する関数(1出力版)
+		//! @return	出力ベクトル (l番目の要素が l軸目の出力)
+		ArcsMat<L,1> GetNextOutput1(void) const noexcept {
+			static_assert(O == 1, "ArcsCtrl: Output Size Error");	// 1出力系かチェック
+			const std::array<Lanes, O> y_next = Output(x);
+			ArcsMat<L,1> ret;
+			for(size_t l = 1; l <= L; ++l) ret[l] = y_next[0][l - 1];
+			return ret;
+		}
+
+		//! @brief l軸目の状態ベクトルを任意の値にセットする関数
+		//! @param[in]	l	軸番号(1～L)
+		//! @param[in]	xi	任意の値を持つ状態ベクトル
+		void SetStateVector(const size_t l, const ArcsMat<N,1>& xi) noexcept {
+			arcs_assert(0 < l && l <= L);	// 範囲チェック
+			for(size_t i = 1; i <= N; ++i){
+				x[i - 1][l - 1] = xi[i];
+			}
+		}
+
+		//! @brief 全軸の状態ベクトルをクリアする関数
+		void ClearStateVector(void) noexcept {
+			for(size_t i = 0; i < N; ++i) x[i].fill(0);
+		}
+
+	private:
+		DiscStateSpaceBatch(const DiscStateSpaceBatch&) = delete;					//!< コピーコンストラクタ使用禁止
+		const DiscStateSpaceBatch& operator=(const DiscStateSpaceBatch&) = delete;	//!< コピー代入演算子使用禁止
+
+		using Sm = ArcsMatrixKernel::SimdMax;					//!< 軸方向の計算に使うSIMD型
+		static constexpr size_t LP = (L + Sm::W - 1)/Sm::W*Sm::W;	//!< SIMD幅の倍数に切り上げた軸数(余りのレーンは零のまま計算する)
+		using Lanes = std::array<double, LP>;					//!< 全軸分の1要素
+
+		//! @brief 行列を l軸目のレーンに書き込む関数
+		//! @param[in]	U	行列
+		//! @param[out]	Y	Structure of Arrays 形式の行列 (列優先)
+		//! @param[in]	l	軸番号(1～L)
+		template<size_t M, size_t K>
+		static void Scatter(const ArcsMat<M,K>& U, std::array<Lanes, M*K>& Y, const size_t l){
+			for(size_t j = 1; j <= K; ++j){
+				for(size_t i = 1; i <= M; ++i) Y[(j - 1)*M + i - 1][l - 1] = U(i,j);
+			}
+		}
+
+		//! @brief 全軸のベクトルを行列に読み出す関数
+		//! @param[in]	v	Structure of Arrays 形式のベクトル
+		//! @param[out]	Y	行列 (l列目が l軸目のベクトル)
+		template<size_t M>
+		static void Gather(const std::array<Lanes, M>& v, ArcsMat<M,L>& Y){
+			for(size_t l = 1; l <= L; ++l){
+				for(size_t i = 1; i <= M; ++i) Y(i,l) = v[i - 1][l - 1];
+			}
+		}
+
+		//! @brief 全軸分の Y = P*p + Q*q を計算する関数 (P*p と Q*q を別々に積算してから足すのは DiscStateSpace と同じ順序)
+		//! @param[in]	P, p	1項目の行列(M×K)とベクトル
+		//! @param[in]	Q, q	2項目の行列(M×J)とベクトル
+		//! @param[out]	Y	結果のベクトル
+		template<size_t M, size_t K, size_t J>
+		static void MultiplyAdd(
+			const std::array<Lanes, M*K>& P, const std::array<Lanes, K>& p,
+			const std::array<Lanes, M*J>& Q, const std::array<Lanes, J>& q,
+			std::array<Lanes, M>& Y
+		){
+			for(size_t i = 0; i < M; ++i){
+				for(size_t l = 0; l < LP; l += Sm::W){
+					typename Sm::V accP = Sm::Zero(), accQ = Sm::Zero();
+					#pragma GCC unroll 16
+					for(size_t k = 0; k < K; ++k) accP = Sm::MulAdd(accP, Sm::Load(&P[k*M + i][l]), Sm::Load(&p[k][l]));
+					#pragma GCC unroll 16
+					for(size_t j = 0; j < J; ++j) accQ = Sm::MulAdd(accQ, Sm::Load(&Q[j*M + i][l]), Sm::Load(&q[j][l]));
+					Sm::Store(&Y[i][l], Sm::Add(accP, accQ));
+				}
+			}
+		}
+
+		alignas(64) std::array<Lanes, N*N> A;	//!< 離散系A行列 (要素ごとに全軸分)
+		alignas(64) std::array<Lanes, N*I> B;	//!< 離散系B行列
+		alignas(64) std::array<Lanes, O*N> C;	//!< C行列
+		alignas(64) std::array<Lanes, O*I> D;	//!< D行列
+		alignas(64) std::array<Lanes, I> u;		//!< 入力ベクトル
+		alignas(64) std::array<Lanes, N> x;		//!< 状態ベクトル
+		alignas(64) std::array<Lanes, N> x_prev;//!< 更新前の状態ベクトル
+		alignas(64) std::array<Lanes, I> u_prev;//!< 状態の更新に使った入力ベクトル
+
+		//! @brief 全軸分の出力方程式を計算する関数
+		//! @param[in]	xs	状態ベクトル (更新前の x_prev なら現在の出力，更新後の x なら次の時刻の出力)
+		//! @return	出力ベクトル
+		std::array<Lanes, O> Output(const std::array<Lanes, N>& xs) const noexcept {
+			alignas(64) std::array<Lanes, O> ret;
+			MultiplyAdd(C, xs, D, u_prev, ret);
+			return ret;
+		}
 };
 
 //! @brief 離散系伝達関数(パルス伝達関数)クラス
@@ -1135,6 +2311,449 @@ class DiscTransFunc {
 		DiscStateSpace<D,1,1> Sys;	// SISO離散系状態空間モデル
 };
 
+//! @brief 転置直接形II型の離散系伝達関数(パルス伝達関数)クラス
+//! DiscTransFunc と同じ伝達関数を，可制御正準系の密な行列ではなく転置直接形II型で実現する。
+//! 1サンプルあたりの計算量は分母次数 D に比例する(DiscTransFunc は D^2 に比例)。
+//! ただし係数の感度は可制御正準系と同様に高いので，高次で遮断周波数の低いフィルタには DiscBiquadCascade を使うこと。
+//! @tparam N	分子次数
+//! @tparam	D	分母次数
+//! @tparam	T	データ型 (デフォルト値 = double)
+template <size_t N, size_t D, typename T = double>
+class DiscTransFuncTDF2 {
+	public:
+		//! @brief コンストラクタ(空コンストラクタ版)
+		DiscTransFuncTDF2(void) noexcept
+			: b(), a(), s(), u(0), y(0), y_next(0)
+		{
+			static_assert(N <= D);	// プロパーかどうかのチェック
+			static_assert(0 < D, "ArcsCtrl: Size Error");
+		}
+
+		//! @brief コンストラクタ
+		//! @tparam	MN, NN, TN	分子係数ベクトルの高さ, 幅, データ型
+		//! @tparam	MD, ND, TD	分母係数ベクトルの高さ, 幅, データ型
+		//! @param[in]	Num		分子係数ベクトル (nN*z^N + ... + n1*z + n0) → Num = {nN, ... , n1, n0}
+		//! @param[in]	Den		分母係数ベクトル (dD*z^D + ... + d2*z^2 + d1*z + d0) → Den = {dD, ... , d2, d1, d0}
+		template<size_t MN, size_t NN, typename TN = double, size_t MD, size_t ND, typename TD = double>
+		DiscTransFuncTDF2(const ArcsMat<MN,NN,TN>& Num, const ArcsMat<MD,ND,TD>& Den) noexcept
+			: DiscTransFuncTDF2()
+		{
+			SetSystem(Num, Den);
+		}
+
+		//! @brief ムーブコンストラクタ
+		//! @param[in]	r	演算子右側
+		DiscTransFuncTDF2(DiscTransFuncTDF2&& r) noexcept
+			: b(r.b), a(r.a), s(r.s), u(r.u), y(r.y), y_next(r.y_next)
+		{
+
+		}
+
+		//! @brief デストラクタ
+		~DiscTransFuncTDF2() noexcept {
+
+		}
+
+		//! @brief 伝達関数の係数を設定する関数
+		//! @tparam	MN, NN, TN	分子係数ベクトルの高さ, 幅, データ型
+		//! @tparam	MD, ND, TD	分母係数ベクトルの高さ, 幅, データ型
+		//! @param[in]	Num		分子係数ベクトル
+		//! @param[in]	Den		分母係数ベクトル
+		template<size_t MN, size_t NN, typename TN = double, size_t MD, size_t ND, typename TD = double>
+		void SetSystem(const ArcsMat<MN,NN,TN>& Num, const ArcsMat<MD,ND,TD>& Den) noexcept {
+			static_assert(MN == N + 1, "ArcsCtrl: Size Error");		// サイズチェック
+			static_assert(NN == 1,     "ArcsCtrl: Vector Error");	// 縦ベクトルチェック
+			static_assert(MD == D + 1, "ArcsCtrl: Size Error");		// サイズチェック
+			static_assert(ND == 1,     "ArcsCtrl: Vector Error");	// 縦ベクトルチェック
+			arcs_assert(Den[1] != 0);	// 分母の最上位係数が零でないかチェック
+
+			// z^-D を掛けて z^-1 の多項式 (b0 + b1*z^-1 + ... + bD*z^-D)/(1 + a1*z^-1 + ... + aD*z^-D) に並べ替える
+			for(size_t k = 0; k <= D; ++k){
+				b[k] = D - k <= N ? static_cast<T>(Num[N + 1 - (D - k)]/Den[1]) : 0;	// 分子の次数が低い分の先頭は零
+				a[k] = static_cast<T>(Den[k + 1]/Den[1]);
+			}
+		}
+
+		//! @brief 伝達関数への入力を設定する関数
+		//! @param[in]	ui	入力
+		void SetInput(const T& ui) noexcept {
+			u = ui;
+		}
+
+		//! @brief 伝達関数の応答を計算して内部の状態を更新する関数
+		void Update(void) noexcept {
+			y = b[0]*u + s[0];	// 出力方程式（教科書通りの正しい出力）
+			for(size_t k = 1; k < D; ++k) s[k - 1] = b[k]*u - a[k]*y + s[k];	// 状態の更新
+			s[D - 1] = b[D]*u - a[D]*y;
+			y_next = b[0]*u + s[0];	// 出力方程式（次の時刻の出力を先取りして得る場合）
+		}
+
+		//! @brief 伝達関数の出力を取得する関数
+		//! @return	出力値
+		T GetOutput(void) const noexcept {
+			return y;
+		}
+
+		//! @brief 伝達関数の次サンプルの出力を先取りして取得する関数
+		//! @return	出力値
+		T GetNextOutput(void) const noexcept {
+			return y_next;
+		}
+
+		//! @brief 伝達関数の応答を取得する関数 (入力→状態更新→出力を一括実行)
+		//! @param[in]	ui	入力
+		//! @return 出力値
+		T GetResponse(const T& ui) noexcept {
+			SetInput(ui);	// 入力
+			Update();		// 状態更新
+			return y;		// 出力
+		}
+
+		//! @brief 伝達関数の次サンプルの応答を先取りして取得する関数 (入力→状態更新→出力を一括実行)
+		//! @param[in]	ui	入力
+		//! @return 出力値
+		T GetNextResponse(const T& ui) noexcept {
+			SetInput(ui);	// 入力
+			Update();		// 状態更新
+			return y_next;	// 出力
+		}
+
+		//! @brief 状態をクリアする関数
+		void ClearStateVector(void) noexcept {
+			s.fill(0);
+		}
+
+	private:
+		DiscTransFuncTDF2(const DiscTransFuncTDF2&) = delete;					//!< コピーコンストラクタ使用禁止
+		const DiscTransFuncTDF2& operator=(const DiscTransFuncTDF2&) = delete;	//!< コピー代入演算子使用禁止
+		std::array<T, D + 1> b;	//!< 分子係数 (z^-1 の昇べき順)
+		std::array<T, D + 1> a;	//!< 分母係数 (z^-1 の昇べき順, a[0] = 1)
+		std::array<T, D> s;		//!< 遅延器の状態
+		T u;					//!< 入力
+		T y;					//!< 出力
+		T y_next;				//!< 次の時刻の出力
+};
+
+//! @brief 2次セクション縦続形の離散系フィルタクラス
+//! 伝達関数を (b0 + b1*z^-1 + b2*z^-2)/(1 + a1*z^-1 + a2*z^-2) の2次セクション S 個の積で表し，各セクションを転置直接形II型で計算する。
+//! 極が2個ずつに分かれるので，高次で遮断周波数の低いフィルタでも係数の丸めによる極の移動が小さく，数値的に安定である。
+//! 1次のセクションは b2 = a2 = 0 とすれば良い。
+//! @tparam	S	セクション数
+//! @tparam	T	データ型 (デフォルト値 = double)
+template <size_t S, typename T = double>
+class DiscBiquadCascade {
+	public:
+		//! @brief コンストラクタ(空コンストラクタ版, 全セクションが素通し)
+		DiscBiquadCascade(void) noexcept
+			: c(), s1(), s2(), u(0), y(0), y_next(0)
+		{
+			static_assert(0 < S, "ArcsCtrl: Size Error");
+			for(size_t i = 0; i < S; ++i) c[i] = {1, 0, 0, 0, 0};
+		}
+
+		//! @brief コンストラクタ
+		//! @param[in]	SOS	2次セクション行列 (i行目が i番目のセクションの係数 [b0 b1 b2 a0 a1 a2])
+		explicit DiscBiquadCascade(const ArcsMat<S,6>& SOS) noexcept
+			: DiscBiquadCascade()
+		{
+			SetSystem(SOS);
+		}
+
+		//! @brief ムーブコンストラクタ
+		//! @param[in]	r	演算子右側
+		DiscBiquadCascade(DiscBiquadCascade&& r) noexcept
+			: c(r.c), s1(r.s1), s2(r.s2), u(r.u), y(r.y), y_next(r.y_next)
+		{
+
+		}
+
+		//! @brief デストラクタ
+		~DiscBiquadCascade() noexcept {
+
+		}
+
+		//! @brief 全セクションの係数を設定する関数
+		//! @param[in]	SOS	2次セクション行列 (i行目が i番目のセクションの係数 [b0 b1 b2 a0 a1 a2])
+		void SetSystem(const ArcsMat<S,6>& SOS) noexcept {
+			for(size_t i = 1; i <= S; ++i){
+				SetSection(i, ArcsMat<3,1>{SOS(i,1), SOS(i,2), SOS(i,3)}, ArcsMat<3,1>{SOS(i,4), SOS(i,5), SOS(i,6)});
+			}
+		}
+
+		//! @brief i番目のセクションの係数を設定する関数
+		//! @param[in]	i	セクション番号(1～S)
+		//! @param[in]	Num	分子係数ベクトル {b0, b1, b2}
+		//! @param[in]	Den	分母係数ベクトル {a0, a1, a2}
+		void SetSection(const size_t i, const ArcsMat<3,1>& Num, const ArcsMat<3,1>& Den) noexcept {
+			arcs_assert(0 < i && i <= S);	// 範囲チェック
+			arcs_assert(Den[1] != 0);		// 分母の最上位係数が零でないかチェック
+			c[i - 1] = {
+				static_cast<T>(Num[1]/Den[1]), static_cast<T>(Num[2]/Den[1]), static_cast<T>(Num[3]/Den[1]),
+				static_cast<T>(Den[2]/Den[1]), static_cast<T>(Den[3]/Den[1])
+			};
+		}
+
+		//! @brief i番目のセクションの係数を連続系の2次(または1次)の伝達関数から双一次変換で設定する関数
+		//! @param[in]	i	セクション番号(1～S)
+		//! @param[in]	Num	連続系の分子係数ベクトル {n2, n1, n0}
+		//! @param[in]	Den	連続系の分母係数ベクトル {d2, d1, d0}
+		//! @param[in]	Ts	[s] サンプリング周期
+		//! @param[in]	wp	[rad/s] プリワーピング周波数 (0 ならプリワーピングしない, デフォルト値 = 0)
+		void SetContinuousSection(const size_t i, const ArcsMat<3,1>& Num, const ArcsMat<3,1>& Den, const double Ts, const double wp = 0) noexcept {
+			const auto [b, a] = BilinearSection(Num, Den, Ts, wp);
+			SetSection(i, b, a);
+		}
+
+		//! @brief フィルタへの入力を設定する関数
+		//! @param[in]	ui	入力
+		void SetInput(const T& ui) noexcept {
+			u = ui;
+		}
+
+		//! @brief フィルタの応答を計算して内部の状態を更新する関数
+		void Update(void) noexcept {
+			T v = u, vn = u;	// セクションの入力と，次の時刻の入力
+			for(size_t i = 0; i < S; ++i){
+				const auto& [b0, b1, b2, a1, a2] = c[i];
+				const T w = b0*v + s1[i];			// セクションの出力
+				s1[i] = b1*v - a1*w + s2[i];		// 状態の更新
+				s2[i] = b2*v - a2*w;
+				vn = b0*vn + s1[i];					// 次の時刻のセクションの出力(入力が現在値のまま保持される場合)
+				v = w;
+			}
+			y = v;			// 出力（教科書通りの正しい出力）
+			y_next = vn;	// 次の時刻の出力を先取りして得る場合
+		}
+
+		//! @brief フィルタの出力を取得する関数
+		//! @return	出力値
+		T GetOutput(void) const noexcept {
+			return y;
+		}
+
+		//! @brief フィルタの次サンプルの出力を先取りして取得する関数
+		//! @return	出力値
+		T GetNextOutput(void) const noexcept {
+			return y_next;
+		}
+
+		//! @brief フィルタの応答を取得する関数 (入力→状態更新→出力を一括実行)
+		//! @param[in]	ui	入力
+		//! @return 出力値
+		T GetResponse(const T& ui) noexcept {
+			SetInput(ui);	// 入力
+			Update();		// 状態更新
+			return y;		// 出力
+		}
+
+		//! @brief フィルタの次サンプルの応答を先取りして取得する関数 (入力→状態更新→出力を一括実行)
+		//! @param[in]	ui	入力
+		//! @return 出力値
+		T GetNextResponse(const T& ui) noexcept {
+			SetInput(ui);	// 入力
+			Update();		// 状態更新
+			return y_next;	// 出力
+		}
+
+		//! @brief 状態をクリアする関数
+		void ClearStateVector(void) noexcept {
+			s1.fill(0);
+			s2.fill(0);
+		}
+
+	private:
+		DiscBiquadCascade(const DiscBiquadCascade&) = delete;					//!< コピーコンストラクタ使用禁止
+		const DiscBiquadCascade& operator=(const DiscBiquadCascade&) = delete;	//!< コピー代入演算子使用禁止
+		std::array<std::array<T, 5>, S> c;	//!< セクションごとの係数 {b0, b1, b2, a1, a2} (a0 = 1 に正規化済み)
+		std::array<T, S> s1;	//!< セクションごとの遅延器1の状態
+		std::array<T, S> s2;	//!< セクションごとの遅延器2の状態
+		T u;					//!< 入力
+		T y;					//!< 出力
+		T y_next;				//!< 次の時刻の出力
+};
+
+//! @brief 2次セクション縦続形の離散系フィルタ一括計算クラス
+//! 同じセクション数の L チャネル分のフィルタ(多軸のノッチフィルタやセンサ信号のローパスフィルタなど)を，
+//! 係数・状態ごとに L チャネル分を並べた Structure of Arrays 形式で保持し，1回のSIMD命令で全チャネル分をまとめて進める。
+//! 係数はチャネルごとに異なっていても良い。T = float とすると単精度で計算し，倍精度の2倍のチャネルを1命令で処理する。
+//! (単精度は遮断周波数がサンプリング周波数に比べて極端に低いと精度が落ちるので注意)
+//! @tparam	S	セクション数
+//! @tparam	L	チャネル数(レーン数)
+//! @tparam	T	データ型 (float か double, デフォルト値 = double)
+template <size_t S, size_t L, typename T = double>
+class DiscBiquadCascadeBatch {
+	public:
+		//! @brief コンストラクタ(空コンストラクタ版, 全セクションが素通し)
+		DiscBiquadCascadeBatch(void) noexcept
+			: b0(), b1(), b2(), na1(), na2(), s1(), s2(), u(), y(), y_next()
+		{
+			static_assert(0 < S, "ArcsCtrl: Size Error");
+			static_assert(0 < L, "ArcsCtrl: Lane Size Error");
+			static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "ArcsCtrl: Type Error");
+			for(size_t i = 0; i < S; ++i) b0[i].fill(1);
+		}
+
+		//! @brief ムーブコンストラクタ
+		//! @param[in]	r	演算子右側
+		DiscBiquadCascadeBatch(DiscBiquadCascadeBatch&& r) noexcept
+			: b0(r.b0), b1(r.b1), b2(r.b2), na1(r.na1), na2(r.na2), s1(r.s1), s2(r.s2), u(r.u), y(r.y), y_next(r.y_next)
+		{
+
+		}
+
+		//! @brief デストラクタ
+		~DiscBiquadCascadeBatch() noexcept {
+
+		}
+
+		//! @brief 全チャネルの全セクションの係数を同じ値に設定する関数
+		//! @param[in]	SOS	2次セクション行列 (i行目が i番目のセクションの係数 [b0 b1 b2 a0 a1 a2])
+		void SetSystem(const ArcsMat<S,6>& SOS) noexcept {
+			for(size_t l = 1; l <= L; ++l) SetSystem(l, SOS);
+		}
+
+		//! @brief l チャネル目の全セクションの係数を設定する関数
+		//! @param[in]	l	チャネル番号(1～L)
+		//! @param[in]	SOS	2次セクション行列 (i行目が i番目のセクションの係数 [b0 b1 b2 a0 a1 a2])
+		void SetSystem(const size_t l, const ArcsMat<S,6>& SOS) noexcept {
+			for(size_t i = 1; i <= S; ++i){
+				SetSection(l, i, ArcsMat<3,1>{SOS(i,1), SOS(i,2), SOS(i,3)}, ArcsMat<3,1>{SOS(i,4), SOS(i,5), SOS(i,6)});
+			}
+		}
+
+		//! @brief l チャネル目の i番目のセクションの係数を設定する関数
+		//! @param[in]	l	チャネル番号(1～L)
+		//! @param[in]	i	セクション番号(1～S)
+		//! @param[in]	Num	分子係数ベクトル {b0, b1, b2}
+		//! @param[in]	Den	分母係数ベクトル {a0, a1, a2}
+		void SetSection(const size_t l, const size_t i, const ArcsMat<3,1>& Num, const ArcsMat<3,1>& Den) noexcept {
+			arcs_assert(0 < l && l <= L);	// 範囲チェック
+			arcs_assert(0 < i && i <= S);	// 範囲チェック
+			arcs_assert(Den[1] != 0);		// 分母の最上位係数が零でないかチェック
+			b0[i - 1][l - 1] = static_cast<T>(Num[1]/Den[1]);
+			b1[i - 1][l - 1] = static_cast<T>(Num[2]/Den[1]);
+			b2[i - 1][l - 1] = static_cast<T>(Num[3]/Den[1]);
+			na1[i - 1][l - 1] = static_cast<T>(-Den[2]/Den[1]);	// 積和だけで計算できるように符号を反転して保持
+			na2[i - 1][l - 1] = static_cast<T>(-Den[3]/Den[1]);
+		}
+
+		//! @brief l チャネル目の i番目のセクションの係数を連続系の2次(または1次)の伝達関数から双一次変換で設定する関数
+		//! @param[in]	l	チャネル番号(1～L)
+		//! @param[in]	i	セクション番号(1～S)
+		//! @param[in]	Num	連続系の分子係数ベクトル {n2, n1, n0}
+		//! @param[in]	Den	連続系の分母係数ベクトル {d2, d1, d0}
+		//! @param[in]	Ts	[s] サンプリング周期
+		//! @param[in]	wp	[rad/s] プリワーピング周波数 (0 ならプリワーピングしない, デフォルト値 = 0)
+		void SetContinuousSection(const size_t l, const size_t i, const ArcsMat<3,1>& Num, const ArcsMat<3,1>& Den, const double Ts, const double wp = 0) noexcept {
+			const auto [b, a] = BilinearSection(Num, Den, Ts, wp);
+			SetSection(l, i, b, a);
+		}
+
+		//! @brief 全チャネルの入力を設定する関数
+		//! @tparam	TU	入力ベクトルのデータ型 (T と同じ型にすると変換が要らない)
+		//! @param[in]	U	入力ベクトル (l番目の要素が l チャネル目の入力)
+		template<typename TU = double>
+		void SetInputs(const ArcsMat<L,1,TU>& U) noexcept {
+			for(size_t l = 1; l <= L; ++l) u[l - 1] = static_cast<T>(U[l]);
+		}
+
+		//! @brief l チャネル目の入力を設定する関数
+		//! @param[in]	l	チャネル番号(1～L)
+		//! @param[in]	ui	入力
+		void SetInput(const size_t l, const T& ui) noexcept {
+			arcs_assert(0 < l && l <= L);	// 範囲チェック
+			u[l - 1] = ui;
+		}
+
+		//! @brief 全チャネルのフィルタの応答を計算して内部の状態を更新する関数
+		void Update(void) noexcept {
+			for(size_t l = 0; l < LP; l += Sm::W){
+				typename Sm::V v = Sm::Load(&u[l]), vn = v;	// セクションの入力と，次の時刻の入力
+				for(size_t i = 0; i < S; ++i){
+					const typename Sm::V B0 = Sm::Load(&b0[i][l]), B1 = Sm::Load(&b1[i][l]), B2 = Sm::Load(&b2[i][l]);
+					const typename Sm::V NA1 = Sm::Load(&na1[i][l]), NA2 = Sm::Load(&na2[i][l]);
+					const typename Sm::V S1 = Sm::Load(&s1[i][l]), S2 = Sm::Load(&s2[i][l]);
+					const typename Sm::V w = Sm::MulAdd(S1, B0, v);							// セクションの出力
+					const typename Sm::V S1n = Sm::MulAdd(Sm::MulAdd(S2, B1, v), NA1, w);	// 状態の更新
+					const typename Sm::V S2n = Sm::MulAdd(Sm::MulAdd(Sm::Zero(), B2, v), NA2, w);
+					vn = Sm::MulAdd(S1n, B0, vn);	// 次の時刻のセクションの出力(入力が現在値のまま保持される場合)
+					v = w;
+					Sm::Store(&s1[i][l], S1n);
+					Sm::Store(&s2[i][l], S2n);
+				}
+				Sm::Store(&y[l], v);		// 出力（教科書通りの正しい出力）
+				Sm::Store(&y_next[l], vn);	// 次の時刻の出力を先取りして得る場合
+			}
+		}
+
+		//! @brief 全チャネルの出力を取得する関数(引数渡し版)
+		//! @tparam	TY	出力ベクトルのデータ型 (T と同じ型にすると変換が要らない)
+		//! @param[out]	Y	出力ベクトル (l番目の要素が l チャネル目の出力)
+		template<typename TY = double>
+		void GetOutputs(ArcsMat<L,1,TY>& Y) const noexcept {
+			for(size_t l = 1; l <= L; ++l) Y[l] = static_cast<TY>(y[l - 1]);
+		}
+
+		//! @brief 全チャネルの出力を取得する関数(戻り値返し版)
+		//! @return	出力ベクトル (l番目の要素が l チャネル目の出力)
+		ArcsMat<L,1> GetOutputs(void) const noexcept {
+			ArcsMat<L,1> ret;
+			GetOutputs(ret);
+			return ret;
+		}
+
+		//! @brief l チャネル目の出力を取得する関数
+		//! @param[in]	l	チャネル番号(1～L)
+		//! @return	出力値
+		T GetOutput(const size_t l) const noexcept {
+			arcs_assert(0 < l && l <= L);	// 範囲チェック
+			return y[l - 1];
+		}
+
+		//! @brief 全チャネルの次サンプルの出力を先取りして取得する関数
+		//! @return	出力ベクトル (l番目の要素が l チャネル目の出力)
+		ArcsMat<L,1> GetNextOutputs(void) const noexcept {
+			ArcsMat<L,1> ret;
+			for(size_t l = 1; l <= L; ++l) ret[l] = y_next[l - 1];
+			return ret;
+		}
+
+		//! @brief l チャネル目の次サンプルの出力を先取りして取得する関数
+		//! @param[in]	l	チャネル番号(1～L)
+		//! @return	出力値
+		T GetNextOutput(const size_t l) const noexcept {
+			arcs_assert(0 < l && l <= L);	// 範囲チェック
+			return y_next[l - 1];
+		}
+
+		//! @brief 全チャネルの状態をクリアする関数
+		void ClearStateVector(void) noexcept {
+			for(size_t i = 0; i < S; ++i){
+				s1[i].fill(0);
+				s2[i].fill(0);
+			}
+		}
+
+	private:
+		DiscBiquadCascadeBatch(const DiscBiquadCascadeBatch&) = delete;					//!< コピーコンストラクタ使用禁止
+		const DiscBiquadCascadeBatch& operator=(const DiscBiquadCascadeBatch&) = delete;//!< コピー代入演算子使用禁止
+
+		using Sm = ArcsMatrixKernel::SimdFit<T, L>;					//!< チャネル方向の計算に使うSIMD型 (チャネル数以下の幅で一番広いもの)
+		static constexpr size_t LP = (L + Sm::W - 1)/Sm::W*Sm::W;	//!< SIMD幅の倍数に切り上げたチャネル数(余りのレーンは零のまま計算する)
+		using Lanes = std::array<T, LP>;							//!< 全チャネル分の1要素
+
+		alignas(64) std::array<Lanes, S> b0;	//!< 分子係数 b0 (セクションごとに全チャネル分)
+		alignas(64) std::array<Lanes, S> b1;	//!< 分子係数 b1
+		alignas(64) std::array<Lanes, S> b2;	//!< 分子係数 b2
+		alignas(64) std::array<Lanes, S> na1;	//!< 分母係数 -a1
+		alignas(64) std::array<Lanes, S> na2;	//!< 分母係数 -a2
+		alignas(64) std::array<Lanes, S> s1;	//!< 遅延器1の状態
+		alignas(64) std::array<Lanes, S> s2;	//!< 遅延器2の状態
+		alignas(64) Lanes u;		//!< 入力
+		alignas(64) Lanes y;		//!< 出力
+		alignas(64) Lanes y_next;	//!< 次の時刻の出力
+};
+
 //! @brief 連続系状態空間モデルクラス
 //! @tparam	N	次数
 //! @tparam I	入力信号の数 (デフォルト値 = 1)
@@ -1375,6 +2994,24 @@ class StateSpace {
 			DiscSys.Update();
 		}
 
+		//! @brief 入力ベクトルを設定して状態を更新し，出力ベクトルを返す関数 (SetInput → Update → GetOutput を一括実行)
+		//! @tparam	MU	入力ベクトルの高さ
+		//! @tparam	NU	入力ベクトルの幅
+		//! @tparam	TU	入力ベクトルのデータ型
+		//! @param[in]	ui	入力ベクトル
+		//! @return	出力ベクトル
+		template<size_t MU, size_t NU, typename TU = double>
+		ArcsMat<O,1,T> Step(const ArcsMat<MU,NU,TU>& ui) noexcept {
+			return DiscSys.Step(ui);
+		}
+
+		//! @brief 入力を設定して状態を更新し，出力を返す関数 (1入力1出力版)
+		//! @param[in]	u1	入力
+		//! @return	出力値
+		T Step1(const T& u1) noexcept {
+			return DiscSys.Step1(u1);
+		}
+
 		//! @brief 状態空間モデルの出力ベクトルを取得する関数(引数渡し版)
 		//! @tparam	MY	出力ベクトルの高さ
 		//! @tparam	NY	出力ベクトルの幅
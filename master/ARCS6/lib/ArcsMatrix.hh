@@ -3,7 +3,7 @@
 //!
 //! 行列に関係する様々な演算を実行するクラス
 //!
-//! @date 2024/08/08
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2024 Yokokura, Yuki
@@ -27,6 +27,10 @@
 #include <array>
 #include <complex>
 #include <cstdint>
+#include <limits>
+#include "ArcsMatrixKernel.hh"
+#include "ArcsMatrixMath.hh"
+#include "ArcsMatrixExpr.hh"
 
 // ARCS組込み用マクロ
 #ifdef ARCS_IN
@@ -103,9 +107,9 @@ class ArcsMat {
 		}
 		
 		//! @brief コンストラクタ(任意初期値版)
-		//! @tparam	R	演算子右側の要素の型
+		//! @tparam	R	演算子右側の要素の型 (遅延評価式は除く)
 		//! @param[in]	InitValue	行列要素の初期値
-		template<typename R>
+		template<typename R, typename = std::enable_if_t<!ArcsMatrixExpr::IsExpr<R>>>
 		constexpr explicit ArcsMat(const R InitValue) noexcept
 			: Nindex(0), Mindex(0), Status(ArcsMatrix::MatStatus::AMT_NA), Data({0})
 		{
@@ -184,6 +188,19 @@ class ArcsMat {
 			}
 		}
 		
+		//! @brief コンストラクタ(遅延評価式版)
+		//! 式のすべての要素を1回のループで計算して行列を生成する
+		//! @tparam	E	式の型
+		//! @param[in]	right	遅延評価式
+		template<typename E>
+		constexpr ArcsMat(const ArcsMatrixExpr::Base<E,M,N,T>& right) noexcept
+			: Nindex(0), Mindex(0), Status(ArcsMatrix::MatStatus::AMT_NA), Data({0})
+		{
+			for(size_t i = 1; i <= N; ++i){
+				for(size_t j = 1; j <= M; ++j) (*this)(j,i) = right(j,i);
+			}
+		}
+		
 		//! @brief 行列コピー代入演算子(サイズと型が同じ同士の行列の場合)
 		//! @param[in] right 演算子の右側
 		//! @return 結果
@@ -208,6 +225,26 @@ class ArcsMat {
 			return (*this);
 		}
 		
+		//! @brief 行列代入演算子(遅延評価式の場合)
+		//! 式のすべての要素を1回のループで計算して直接代入する
+		//! (代入先の行列を転置して参照している式の場合だけは一時行列を経由する)
+		//! @tparam	E, P, Q	式の型, 式の結果の行列の高さ, 幅
+		//! @param[in] right 演算子の右側
+		//! @return 結果
+		template<typename E, size_t P, size_t Q>
+		constexpr ArcsMat<M,N,T>& operator=(const ArcsMatrixExpr::Base<E,P,Q,T>& right) noexcept {
+			static_assert(M == P, "ArcsMat: Size Error");	// 行列のサイズチェック
+			static_assert(N == Q, "ArcsMat: Size Error");	// 行列のサイズチェック
+			if(right.IsAliased(this)){
+				const ArcsMat<M,N,T> Temp(right);	// 転置で自分自身を参照しているときは一時行列で計算してから，
+				return (*this) = Temp;				// コピーする
+			}
+			for(size_t i = 1; i <= N; ++i){
+				for(size_t j = 1; j <= M; ++j) (*this)(j,i) = right(j,i);
+			}
+			return (*this);
+		}
+		
 		//! @brief ムーブコンストラクタ
 		//! @param[in]	right	演算子右側
 		constexpr ArcsMat(ArcsMat<M,N,T>&& right) noexcept
@@ -348,13 +385,17 @@ class ArcsMat {
 		//! @return 結果
 		template<typename R>
 		constexpr ArcsMat<M,N,T> operator+(const R& right) const{
-			static_assert(ArcsMatrix::IsApplicable<R>, "ArcsMat: Type Error");	// 対応可能型チェック
-			ArcsMat<M,N,T> ret;
-			for(size_t i = 1; i <= N; ++i){
-				for(size_t j = 1; j <= M; ++j) ret(j,i) = (*this)(j,i) + static_cast<T>(right);
-				// 上記は次とほぼ同等→ ret.Data[i][j] = Data[i][j] + right;
+			if constexpr(ArcsMatrixExpr::IsExpr<R>){
+				return ArcsMatrixExpr::Ref<M,N,T>(*this) + right;	// 右側が遅延評価式の場合は1回のループで計算
+			}else{
+				static_assert(ArcsMatrix::IsApplicable<R>, "ArcsMat: Type Error");	// 対応可能型チェック
+				ArcsMat<M,N,T> ret;
+				for(size_t i = 1; i <= N; ++i){
+					for(size_t j = 1; j <= M; ++j) ret(j,i) = (*this)(j,i) + static_cast<T>(right);
+					// 上記は次とほぼ同等→ ret.Data[i][j] = Data[i][j] + right;
+				}
+				return ret;
 			}
-			return ret;
 		}
 		
 		//! @brief 行列減算演算子(行列＝行列－行列の場合)
@@ -380,13 +421,17 @@ class ArcsMat {
 		//! @return 結果
 		template<typename R>
 		constexpr ArcsMat<M,N,T> operator-(const R& right) const{
-			static_assert(ArcsMatrix::IsApplicable<R>, "ArcsMat: Type Error");	// 対応可能型チェック
-			ArcsMat<M,N,T> ret;
-			for(size_t i = 1; i <= N; ++i){
-				for(size_t j = 1; j <= M; ++j) ret(j,i) = (*this)(j,i) - static_cast<T>(right);
-				// 上記は次とほぼ同等→ ret.Data[i][j] = Data[i][j] - right;
+			if constexpr(ArcsMatrixExpr::IsExpr<R>){
+				return ArcsMatrixExpr::Ref<M,N,T>(*this) - right;	// 右側が遅延評価式の場合は1回のループで計算
+			}else{
+				static_assert(ArcsMatrix::IsApplicable<R>, "ArcsMat: Type Error");	// 対応可能型チェック
+				ArcsMat<M,N,T> ret;
+				for(size_t i = 1; i <= N; ++i){
+					for(size_t j = 1; j <= M; ++j) ret(j,i) = (*this)(j,i) - static_cast<T>(right);
+					// 上記は次とほぼ同等→ ret.Data[i][j] = Data[i][j] - right;
+				}
+				return ret;
 			}
-			return ret;
 		}
 		
 		//! @brief 行列乗算演算子(行列＝行列＊行列の場合)
@@ -398,6 +443,14 @@ class ArcsMat {
 			static_assert(N == P, "ArcsMat: Size Error");	// 行列のサイズチェック
 			static_assert(ArcsMatrix::IsApplicable<R>, "ArcsMat: Type Error");	// 対応可能型チェック
 			ArcsMat<M,Q,T> ret;
+			if constexpr(ArcsMatrixKernel::IsKernelApplicable<M,T,R>){
+				// 実行時のdouble型の小規模行列はSIMDカーネルで計算 (コンパイル時評価のときは下記のループを使う)
+				if(__builtin_is_constant_evaluated() == false){
+					static_assert(sizeof(Data) == sizeof(T)*M*N, "ArcsMat: Storage Layout Error");	// 列優先で隙間無く並んでいることの確認
+					ArcsMatrixKernel::Multiply<M,N,Q>(&Data[0][0], &(right.ReadOnlyRef()[0][0]), &ret(1,1));
+					return ret;
+				}
+			}
 			for(size_t k = 1; k <= Q; ++k){
 				for(size_t i = 1; i <= N; ++i){
 					for(size_t j = 1; j <= M; ++j) ret(j,k) += (*this)(j,i)*static_cast<T>( right(i,k) );
@@ -472,7 +525,11 @@ class ArcsMat {
 		//! @return 結果
 		template<typename R>
 		constexpr ArcsMat<M,N,T>& operator*=(const R& right){
-			(*this) = (*this)*right;	// 既に定義済みの乗算演算子を利用
+			if constexpr(ArcsMatrixExpr::IsExpr<R>){
+				(*this) = ArcsMatrixExpr::Ref<M,N,T>(*this)*right;	// 右側が遅延評価式の場合
+			}else{
+				(*this) = (*this)*right;	// 既に定義済みの乗算演算子を利用
+			}
 			return (*this);
 		}
 		
@@ -646,7 +703,7 @@ class ArcsMat {
 			size_t ret = 0;
 			for(size_t i = 1; i <= N; ++i){
 				for(size_t j = 1; j <= M; ++j){
-					if( std::abs(eps) < std::abs( (*this)(j,i) )) ++ret;
+					if( ArcsMatrixMath::Abs(eps) < ArcsMatrixMath::Abs( (*this)(j,i) )) ++ret;
 				}
 			}
 			return ret;
@@ -882,7 +939,7 @@ class ArcsMat {
 		constexpr void Zeroing(const T eps = ArcsMat<M,N,T>::EPSILON){
 			for(size_t i = 1; i <= N; ++i){
 				for(size_t j = 1; j <= M; ++j){
-					if(std::abs( (*this)(j,i) ) < std::real(eps)) (*this)(j,i) = 0;
+					if(ArcsMatrixMath::Abs( (*this)(j,i) ) < std::real(eps)) (*this)(j,i) = 0;
 				}
 			}
 		}
@@ -896,9 +953,9 @@ class ArcsMat {
 					if constexpr(ArcsMatrix::IsComplex<T>){
 						//if(std::abs( std::real((*this)(j,i)) ) < std::real(eps)) ((*this)(j,i)).real(0);
 						//if(std::abs( std::imag((*this)(j,i)) ) < std::real(eps)) ((*this)(j,i)).imag(0);
-						if(std::abs( (*this)(j,i) ) < std::real(eps)) (*this)(j,i) = 0;
+						if(ArcsMatrixMath::Abs( (*this)(j,i) ) < std::real(eps)) (*this)(j,i) = 0;
 					}else{
-						if(std::abs( (*this)(j,i) ) < eps) (*this)(j,i) = 0;
+						if(ArcsMatrixMath::Abs( (*this)(j,i) ) < eps) (*this)(j,i) = 0;
 					}
 				}
 			}
@@ -1148,11 +1205,14 @@ class ArcsMat {
 		//! @param[in]	m1	指定行1
 		//! @param[in]	m2	指定行2
 		static constexpr void swaprow(ArcsMat<M,N,T>& UY, const size_t m1, const size_t m2){
-			ArcsMat<1,N,T> p, q;	// バッファ用ベクトル
-			p = getrow(UY, m1);		// m1行目を抽出
-			q = getrow(UY, m2);		// m2行目を抽出
-			setrow(UY, p, m2);		// m2行目に書き込み
-			setrow(UY, q, m1);		// m1行目に書き込み
+			arcs_assert(0 < m1 && m1 <= M);	// サイズチェック
+			arcs_assert(0 < m2 && m2 <= M);	// サイズチェック
+			// LU分解のピボット選択で頻繁に呼ばれるので，バッファ用ベクトルを介さずに要素ごとに入れ替える
+			for(size_t i = 1; i <= N; ++i){
+				const T buff = UY(m1,i);
+				UY(m1,i) = UY(m2,i);
+				UY(m2,i) = buff;
+			}
 		}
 		
 		//! @brief 指定した行と行を入れ替える関数 (戻り値渡し版)
@@ -1777,7 +1837,7 @@ class ArcsMat {
 				for(size_t j = 1; j <= M; ++j){	// 縦方向探索
 					if constexpr(ArcsMatrix::IsComplex<T>){
 						// 複素数版のとき
-						if( std::abs(U(k,l)) < std::abs(U(j,i)) ){
+						if( ArcsMatrixMath::Abs(U(k,l)) < ArcsMatrixMath::Abs(U(j,i)) ){
 							k = j;
 							l = i;
 						}
@@ -1810,7 +1870,7 @@ class ArcsMat {
 				for(size_t j = 1; j <= M; ++j){	// 縦方向探索
 					if constexpr(ArcsMatrix::IsComplex<T>){
 						// 複素数版のとき
-						if( std::abs(U(k,l)) > std::abs(U(j,i)) ){
+						if( ArcsMatrixMath::Abs(U(k,l)) > ArcsMatrixMath::Abs(U(j,i)) ){
 							k = j;
 							l = i;
 						}
@@ -2019,7 +2079,7 @@ class ArcsMat {
 			static_assert(M == P, "ArcsMat: Size Error");	// 行列のサイズチェック
 			static_assert(N == Q, "ArcsMat: Size Error");	// 行列のサイズチェック
 			for(size_t i = 1; i <= N; ++i){
-				for(size_t j = 1; j <= M; ++j) Y(j,i) = static_cast<R>( std::sqrt( U(j,i) ) );
+				for(size_t j = 1; j <= M; ++j) Y(j,i) = static_cast<R>( ArcsMatrixMath::Sqrt( U(j,i) ) );
 			}
 		}
 		
@@ -2063,7 +2123,7 @@ class ArcsMat {
 			static_assert(M == P, "ArcsMat: Size Error");	// 行列のサイズチェック
 			static_assert(N == Q, "ArcsMat: Size Error");	// 行列のサイズチェック
 			for(size_t i = 1; i <= N; ++i){
-				for(size_t j = 1; j <= M; ++j) Y(j,i) = static_cast<R>( std::abs( U(j,i) ) );
+				for(size_t j = 1; j <= M; ++j) Y(j,i) = static_cast<R>( ArcsMatrixMath::Abs( U(j,i) ) );
 			}
 		}
 
@@ -2238,11 +2298,11 @@ class ArcsMat {
 				if constexpr(M == 1 || N == 1){
 					// ベクトル版
 					ArcsMat<M,N,R> v = ArcsMat<M,N,T>::abs(U);
-					ret = std::sqrt( ArcsMat<M,N,R>::sum( v & v ) );
+					ret = ArcsMatrixMath::Sqrt( ArcsMat<M,N,R>::sum( v & v ) );
 				}else{
 					// 行列版
 					const auto [W, S, V] = ArcsMat<M,N,T>::SVD(U);
-					ret = std::abs( ArcsMat<M,N,T>::max(S) );
+					ret = ArcsMatrixMath::Abs( ArcsMat<M,N,T>::max(S) );
 				}
 			}else if constexpr(NRM == ArcsMatrix::NormType::AMT_L1){
 				// 絶対値ノルム(1-ノルム)が指定されたとき
@@ -2357,11 +2417,11 @@ class ArcsMat {
 			for(size_t i = 1; i <= N; ++i){
 				// i列目の中での最大値を探す
 				k = i;									// 対角要素の縦位置で初期化
-				max_buff = static_cast<double>( std::abs(X(i,i)) );			// 対角要素の値で初期化
+				max_buff = static_cast<double>( ArcsMatrixMath::Abs(X(i,i)) );			// 対角要素の値で初期化
 				for(size_t j = i + 1; j <= M; ++j){
-					if(max_buff < static_cast<double>( std::abs(X(j,i)) )){	// スキャン中における最大値か判定
+					if(max_buff < static_cast<double>( ArcsMatrixMath::Abs(X(j,i)) )){	// スキャン中における最大値か判定
 						k = j;							// 最大値の候補の縦位置
-						max_buff = static_cast<double>( std::abs(X(j,i)) );	// 最大値の候補であればその値を記憶
+						max_buff = static_cast<double>( ArcsMatrixMath::Abs(X(j,i)) );	// 最大値の候補であればその値を記憶
 					}
 				}
 
@@ -2373,7 +2433,7 @@ class ArcsMat {
 				}
 
 				// LU分解のコア部分
-				if( std::abs( X(i,i) ) < EPSILON ){
+				if( ArcsMatrixMath::Abs( X(i,i) ) < EPSILON ){
 					// 対角要素が零なら，i列目においてはLU分解は完了
 				}else{
 					for(size_t j = i + 1; j <= M; ++j){
@@ -2462,7 +2522,7 @@ class ArcsMat {
 			
 			const auto I = ArcsMat<MH,NH,TH>::eye();	// [C++20移行時にconstexprに改修]
 			auto vHv = ~v*v;
-			if( std::abs(vHv[1]) != 0 ){
+			if( ArcsMatrixMath::Abs(vHv[1]) != 0 ){
 				H = I - 2.0*v*~v/vHv[1];
 			}else{
 				H = I - 2.0*v*~v;
@@ -2513,10 +2573,10 @@ class ArcsMat {
 				// 単位行列部分の生成を実数と複素数で変える
 				if constexpr(ArcsMatrix::IsComplex<T>){
 					// 複素数の場合
-					v = a + std::exp( std::complex( 0.0, std::arg(a[1])) )*std::sqrt( (~a*a)[1] )*e;
+					v = a + std::exp( std::complex( 0.0, std::arg(a[1])) )*ArcsMatrixMath::Sqrt( (~a*a)[1] )*e;
 				}else{
 					// 実数の場合
-					v = a + ArcsMat<M,N,T>::sgn(a[1])*std::sqrt( (~a*a)[1] )*e;
+					v = a + ArcsMat<M,N,T>::sgn(a[1])*ArcsMatrixMath::Sqrt( (~a*a)[1] )*e;
 				}
 				
 				ArcsMat<M,1,T>::Householder(v, H, k - 1);	// ハウスホルダー行列を生成
@@ -2550,8 +2610,9 @@ class ArcsMat {
 		}
 
 		//! @brief SVD特異値分解(引数渡し版)
+		//!        片側Jacobi法 (Hestenes法) で列同士を直交化して A V = U Σ を求める。特異値は降順に並ぶ。
 		//! 注意：複素数で非正方行列の場合ではMATLABとは異なる解を出力する
-		//! @tparam LoopMax	ループ打ち切り最大回数 デフォルト値 = 100*max(M,N)
+		//! @tparam LoopMax	掃引回数の最大値 デフォルト値 = 100*max(M,N)
 		//! @tparam	MU, NU, TU, MS, NS, TS, MV, NV, TV	U,Σ,V行列の高さ, 幅, 要素の型
 		//! @param[in]	A	入力行列
 		//! @param[out]	U	U行列
@@ -2573,43 +2634,14 @@ class ArcsMat {
 			static_assert(ArcsMatrix::IsApplicable<TS>, "ArcsMat: Type Error");	// 対応可能型チェック
 			static_assert(ArcsMatrix::IsApplicable<TV>, "ArcsMat: Type Error");	// 対応可能型チェック
 			
-			// 初期化
-			ArcsMat<N,M,T> Snm;
-			ArcsMat<M,M,T> Qm;
-			ArcsMat<N,N,T> Qn;
-			U = ArcsMat<M,M,T>::eye();
-			V = ArcsMat<N,N,T>::eye();
-			S = A;
-			T E = 0, F = 0;
-			
-			// ループ打ち切り最大回数に達するまでループ
-			for(size_t i = 0; i < LoopMax; ++i){
-				// MATLABに準拠するために縦長か横長かで漸化式の順序を変える
-				if constexpr( N <= M ){
-					// 正方および縦長の場合
-					ArcsMat<M,N,T>::QR(S, Qm, S);
-					ArcsMat<N,M,T>::QR(~S, Qn, Snm);
-					S = ~Snm;
-				}else{
-					// 横長の場合
-					ArcsMat<N,M,T>::QR(~S, Qn, Snm);
-					S = ~Snm;
-					ArcsMat<M,N,T>::QR(S, Qm, S);
-				}
-				U = U*Qm;
-				V = V*Qn;
-				E = ArcsMat<N,M,T>::template norm<ArcsMatrix::NormType::AMT_LINF>( ArcsMat<N,M,T>::gettriup(Snm) );
-				F = ArcsMat<std::min(M,N),1,T>::template norm<ArcsMatrix::NormType::AMT_LINF>( ArcsMat<N,M,T>::getdiag(Snm)  );
-				if(std::abs(E - F) < EPSILON) break;		// 誤差がイプシロンを下回ったらループ打ち切り
-				//printf("%zu: %f\n", i, std::abs(E - F));	// 誤差確認用コード
-			}
-			
-			// 符号修正
-			for(size_t k = 1; k <= std::min(M,N); ++k){
-				if( std::real(sgn( S(k,k) )) < 0){
-					S(k,k) = -S(k,k);
-					ArcsMat<M,M,T>::setcolumn(U, -ArcsMat<M,M,T>::getcolumn(U, k), k);
-				}
+			if constexpr(N <= M){
+				// 正方および縦長の場合は A の列を直交化する
+				ArcsMat<M,N,T>::JacobiSVD<LoopMax>(A, U, S, V);
+			}else{
+				// 横長の場合は A' = V Σ' U' として計算してから入れ替える
+				ArcsMat<N,M,T> St;
+				ArcsMat<N,M,T>::template JacobiSVD<LoopMax>(~A, V, St, U);
+				S = ~St;
 			}
 
 			// Aが正方で且つ複素数の場合には、MATLABに準拠させるための等価変換を実行
@@ -2623,6 +2655,124 @@ class ArcsMat {
 			}
 		}
 
+		//! @brief 片側Jacobi法による縦長行列の特異値分解 (内部用引数渡し版のみ)
+		//!        列の組 (p,q) 毎に2×2のJacobi回転を右から掛けて，全ての列が直交するまで掃引する。
+		//!        直交化後の列のノルムが特異値，正規化した列が左特異ベクトルとなり，残りの列は直交補空間で補う。
+		//! @tparam LoopMax	掃引回数の最大値
+		//! @tparam	MU, NU, TU, MS, NS, TS, MV, NV, TV	U,Σ,V行列の高さ, 幅, 要素の型
+		//! @param[in]	A	入力行列 (M ≧ N)
+		//! @param[out]	U	U行列
+		//! @param[out]	S	Σ行列
+		//! @param[out]	V	V行列
+		template<
+			size_t LoopMax,
+			size_t MU, size_t NU, typename TU = double, size_t MS, size_t NS, typename TS = double,
+			size_t MV, size_t NV, typename TV = double
+		>
+		static constexpr void JacobiSVD(const ArcsMat<M,N,T>& A, ArcsMat<MU,NU,TU>& U, ArcsMat<MS,NS,TS>& S, ArcsMat<MV,NV,TV>& V){
+			static_assert(N <= M, "ArcsMat: Size Error");	// 縦長行列チェック
+			constexpr double eps = std::numeric_limits<double>::epsilon();
+			ArcsMat<M,N,T> B = A;
+			V = ArcsMat<N,N,T>::eye();
+
+			// 1. 列が互いに直交するまで掃引する
+			for(size_t l = 0; l < LoopMax; ++l){
+				bool rotated = false;
+				for(size_t p = 1; p < N; ++p) for(size_t q = p + 1; q <= N; ++q){
+					double a = 0, b = 0;
+					T g = 0;
+					for(size_t i = 1; i <= M; ++i){
+						a += ArcsMat<M,N,T>::abs2(B(i,p));
+						b += ArcsMat<M,N,T>::abs2(B(i,q));
+						g += ArcsMat<M,N,T>::conjsc(B(i,p))*B(i,q);
+					}
+					const double ag = ArcsMatrixMath::Sqrt(ArcsMat<M,N,T>::abs2(g));
+					if(ag <= eps*ArcsMatrixMath::Sqrt(a*b) || ag == 0) continue;
+					rotated = true;
+
+					// [b_p b_q] ← [b_p b_q][c  s*e; -s*conj(e)  c] (e = g/|g|) で b_p'b_q = 0 にする
+					const double z = (b - a)/(2*ag);
+					const double t = (z < 0 ? -1.0 : 1.0)/(ArcsMatrixMath::Abs(z) + ArcsMatrixMath::Sqrt(1 + z*z));
+					const double c = 1/ArcsMatrixMath::Sqrt(1 + t*t), sn = c*t;
+					const T e = g/ag;
+					for(size_t i = 1; i <= M; ++i){
+						const T bp = B(i,p), bq = B(i,q);
+						B(i,p) = c*bp - sn*ArcsMat<M,N,T>::conjsc(e)*bq;
+						B(i,q) = sn*e*bp + c*bq;
+					}
+					for(size_t i = 1; i <= N; ++i){
+						const T vp = V(i,p), vq = V(i,q);
+						V(i,p) = c*vp - sn*ArcsMat<M,N,T>::conjsc(e)*vq;
+						V(i,q) = sn*e*vp + c*vq;
+					}
+				}
+				if(!rotated) break;
+			}
+
+			// 2. 列のノルムが特異値，降順に並べ替える
+			std::array<double,N> sv = {0};
+			for(size_t j = 1; j <= N; ++j){
+				double a = 0;
+				for(size_t i = 1; i <= M; ++i) a += ArcsMat<M,N,T>::abs2(B(i,j));
+				sv[j-1] = ArcsMatrixMath::Sqrt(a);
+			}
+			for(size_t j = 1; j < N; ++j){
+				size_t k = j;
+				for(size_t i = j + 1; i <= N; ++i) if(sv[k-1] < sv[i-1]) k = i;
+				if(k == j) continue;
+				const double st = sv[j-1];
+				sv[j-1] = sv[k-1];
+				sv[k-1] = st;
+				for(size_t i = 1; i <= M; ++i){
+					const T bt = B(i,j);
+					B(i,j) = B(i,k);
+					B(i,k) = bt;
+				}
+				for(size_t i = 1; i <= N; ++i){
+					const T vt = V(i,j);
+					V(i,j) = V(i,k);
+					V(i,k) = vt;
+				}
+			}
+
+			// 3. 非零特異値の列を正規化して左特異ベクトルとし，残りはグラム・シュミット法で直交補空間から補う
+			S.FillAllZero();
+			U.FillAllZero();
+			const double tol = static_cast<double>(M)*eps*sv[0];
+			size_t r = 0;	// 数値的な階数
+			for(size_t j = 1; j <= N; ++j){
+				S(j,j) = sv[j-1];
+				if(sv[j-1] <= tol || sv[j-1] == 0) break;
+				for(size_t i = 1; i <= M; ++i) U(i,j) = B(i,j)/sv[j-1];
+				++r;
+			}
+			for(size_t j = r + 1; j <= M; ++j){
+				// 既存の列との成分が最も小さい単位ベクトルを選んで直交化する
+				size_t kbest = 1;
+				double best = -1;
+				for(size_t k = 1; k <= M; ++k){
+					double w = 1;
+					for(size_t i = 1; i < j; ++i) w -= ArcsMat<M,N,T>::abs2(U(k,i));
+					if(best < w){
+						best = w;
+						kbest = k;
+					}
+				}
+				for(size_t i = 1; i <= M; ++i) U(i,j) = static_cast<T>(i == kbest);
+				for(size_t n = 0; n < 2; ++n){	// 2回直交化して精度を確保
+					for(size_t i = 1; i < j; ++i){
+						T d = 0;
+						for(size_t k = 1; k <= M; ++k) d += ArcsMat<M,N,T>::conjsc(U(k,i))*U(k,j);
+						for(size_t k = 1; k <= M; ++k) U(k,j) -= d*U(k,i);
+					}
+				}
+				double nrm = 0;
+				for(size_t k = 1; k <= M; ++k) nrm += ArcsMat<M,N,T>::abs2(U(k,j));
+				nrm = ArcsMatrixMath::Sqrt(nrm);
+				for(size_t k = 1; k <= M; ++k) U(k,j) /= nrm;
+			}
+		}
+
 		//! @brief SVD特異値分解(タプル返し版)
 		//! @param[in]	A	入力行列
 		//! @return	(U, S, V)	(U行列, Σ行列, V行列)のタプル
@@ -2738,10 +2888,25 @@ class ArcsMat {
 			// 　Ld = c
 			// と書けるので、そこまでの計算をすると下記のコードとなる。
 			const auto [L, U, P] = ArcsMat<M,N,T>::LUP(A);
-			const auto c = P*b;
+			ArcsMat<M,N,T>::linsolve_lu(L, U, P*b, x);
+		}
+		
+		//! @brief LUP分解済みの係数行列で LUx = c の形の線形方程式をxについて解く関数 (内部用引数渡し版のみ)
+		//! @tparam	MC, NC, TC, MX, NX, TX	cとxの高さ, 幅, 要素の型
+		//! @param[in]	L	下三角行列(対角が1)
+		//! @param[in]	U	上三角行列
+		//! @param[in]	c	置換後の係数ベクトル c = Pb
+		//! @param[out]	x	解ベクトル
+		template<size_t MC, size_t NC, typename TC = double, size_t MX, size_t NX, typename TX = double>
+		static constexpr void linsolve_lu(const ArcsMat<M,N,T>& L, const ArcsMat<M,N,T>& U, const ArcsMat<MC,NC,TC>& c, ArcsMat<MX,NX,TX>& x){
+			static_assert(M == N,  "ArcsMat: Size Error");		// 正方行列チェック
+			static_assert(MC == M,  "ArcsMat: Size Error");		// 行列のサイズチェック
+			static_assert(MX == N,  "ArcsMat: Size Error");		// 行列のサイズチェック
+			static_assert(NC == 1, "ArcsMat: Vector Error");	// 縦ベクトルチェック
+			static_assert(NX == 1, "ArcsMat: Vector Error");	// 縦ベクトルチェック
 			ArcsMat<M,1,T> d;
 
-			// 次に、Ld = c の d について解く。Lは下三角行列で対角が1なので、下記の前進代入法で求まる。
+			// Ld = c の d について解く。Lは下三角行列で対角が1なので、下記の前進代入法で求まる。
 			T buff = 0;			// 行方向加算用のバッファ
 			d[1] = c[1];		// 1行目は答えがそのまま現れる
 			for(size_t i = 2; i <= M; ++i){
@@ -2776,10 +2941,12 @@ class ArcsMat {
 			static_assert(ArcsMatrix::IsApplicable<TB>, "ArcsMat: Type Error");	// 対応可能型チェック
 			static_assert(ArcsMatrix::IsApplicable<TX>, "ArcsMat: Type Error");	// 対応可能型チェック
 
-			// 列ごとに線形方程式を解く
+			// LUP分解は1回だけ行って，列ごとに前進代入と後退代入で線形方程式を解く
+			const auto [L, U, P] = ArcsMat<M,N,T>::LUP(A);
+			const auto C = P*B;
 			ArcsMat<MX,1,TX> x;
 			for(size_t i = 1; i <= NB; ++i){
-				ArcsMat<M,N,T>::linsolve_vec(A, ArcsMat<MB,NB,TB>::getcolumn(B, i), x);
+				ArcsMat<M,N,T>::linsolve_lu(L, U, ArcsMat<M,NB,T>::getcolumn(C, i), x);
 				ArcsMat<MX,NX,TX>::setcolumn(X, x, i);
 			}
 		}
@@ -3025,25 +3192,55 @@ class ArcsMat {
 			static_assert(ArcsMatrix::IsApplicable<TP>, "ArcsMat: Type Error");	// 対応可能型チェック
 			static_assert(ArcsMatrix::IsApplicable<TH>, "ArcsMat: Type Error");	// 対応可能型チェック
 
-			ArcsMat<M,N,T> W;
-			ArcsMat<M,1,T> h, u, v;
+			// ハウスホルダー反射 W = I - βvv' を左右から直接作用させて H ← WHW', P ← PW' とする (O(n^3))
 			P = ArcsMat<M,N,T>::eye();
 			H = A;
-			for(size_t k = 1; k <= M - 2; ++k){
-				h = ArcsMat<M,1,T>::shiftup( ArcsMat<M,N,T>::getcolumn(H, k), k);
+			std::array<T,M> v = {0};
+			for(size_t k = 1; k + 2 <= M; ++k){
+				// 第k列の対角より2つ以上下を消す反射ベクトルを作る
+				double xnorm = 0;
+				for(size_t i = k + 1; i <= M; ++i) xnorm += ArcsMat<M,N,T>::abs2(H(i,k));
+				xnorm = ArcsMatrixMath::Sqrt(xnorm);
+				if(xnorm == 0) continue;
+				T alpha = -xnorm;	// 反射後の H(k+1,k)
 				if constexpr(ArcsMatrix::IsComplex<T>){
-					u[1] = -std::exp( std::complex( 0.0, std::arg(h[1])) )*std::sqrt( (~h*h)[1] );
+					if(ArcsMatrixMath::Abs(H(k+1,k)) != 0) alpha = -H(k+1,k)/ArcsMatrixMath::Abs(H(k+1,k))*xnorm;
 				}else{
-					if(std::abs(h[1]) < EPSILON){
-						u[1] = -std::sqrt( (~h*h)[1] );
-					}else{
-						u[1] = -ArcsMat<M,N,T>::sgn(h[1])*std::sqrt( (~h*h)[1] );
+					if(H(k+1,k) < 0) alpha = xnorm;
+				}
+				double vv = 0;
+				for(size_t i = k + 1; i <= M; ++i){
+					v[i-1] = H(i,k);
+					if(i == k + 1) v[i-1] -= alpha;
+					vv += ArcsMat<M,N,T>::abs2(v[i-1]);
+				}
+				if(vv == 0) continue;
+				const double beta = 2.0/vv;
+
+				// 左から作用 H ← WH
+				for(size_t j = k; j <= N; ++j){
+					T w = 0;
+					for(size_t i = k + 1; i <= M; ++i) w += ArcsMat<M,N,T>::conjsc(v[i-1])*H(i,j);
+					w *= beta;
+					for(size_t i = k + 1; i <= M; ++i) H(i,j) -= w*v[i-1];
+				}
+
+				// 右から作用 H ← HW', P ← PW'
+				for(size_t i = 1; i <= M; ++i){
+					T w = 0, wp = 0;
+					for(size_t j = k + 1; j <= N; ++j){
+						w  += H(i,j)*v[j-1];
+						wp += P(i,j)*v[j-1];
+					}
+					w *= beta;
+					wp *= beta;
+					for(size_t j = k + 1; j <= N; ++j){
+						H(i,j) -= w*ArcsMat<M,N,T>::conjsc(v[j-1]);
+						P(i,j) -= wp*ArcsMat<M,N,T>::conjsc(v[j-1]);
 					}
 				}
-				v = h - u;
-				ArcsMat<M,1,T>::Householder(v, W, k);
-				H = W*H*~W;
-				P = P*~W;
+				H(k+1,k) = alpha;
+				for(size_t i = k + 2; i <= M; ++i) H(i,k) = 0;
 			}
 		}
 		
@@ -3057,7 +3254,9 @@ class ArcsMat {
 			return {P, H};
 		}
 
-		//! @brief 複素Schur分解(引数渡し版)
+		//! @brief Schur分解(引数渡し版)
+		//!        実数出力の場合はMATLABと同様に実Schur分解 (RealSchur) となり，Sは疑似上三角行列となる。
+		//!        複素数出力の場合はヘッセンベルグ化とWilkinsonシフト付きの陰的シングルシフトQR法による複素Schur分解となり，Sは上三角行列となる。
 		//!        この関数はMATLABとは異なる解を出力する、ただしもちろん、A = USU' は成立
 		//! @tparam	MU, NU, TU, MS, NS, TS 	入出力行列の高さ, 幅, 要素の型
 		//! @param[in]	A	入力行列
@@ -3073,32 +3272,82 @@ class ArcsMat {
 			static_assert(ArcsMatrix::IsApplicable<T>, "ArcsMat: Type Error");	// 対応可能型チェック
 			static_assert(ArcsMatrix::IsApplicable<TU>, "ArcsMat: Type Error");	// 対応可能型チェック
 			static_assert(ArcsMatrix::IsApplicable<TS>, "ArcsMat: Type Error");	// 対応可能型チェック
-			
-			// ヘッセンベルグ分解を用いた複素シュール分解
-			const auto I = ArcsMat<M,N,T>::eye();		// [C++20移行時にconstexprに改修]
-			auto [P, H] = ArcsMat<M,N,T>::Hessenberg(A);
-			size_t k = M;
-			U = P;
-			S = H;
-			T a = 0;
-			ArcsMat<M,N,T> W, Q, R, V;
-			while(1 < k){
-				k = (ArcsMat<M,N,T>::getdiag(S, -1)).GetNumOfNonZero() + 1;
-				if(1 < k){
-					a = ( S(k-1,k-1) + S(k,k) + std::sqrt( std::pow(S(k-1,k-1) + S(k,k), 2) - 4.0*(S(k-1,k-1)*S(k,k) - (S(k-1,k)*S(k,k-1))) ) )/2.0;
-					W.FillAllZero();
-					ArcsMat<M,N,T>::copymatrix(S - a*I,1,k,1,k, W,1,1);
-					ArcsMat<M,N,T>::QR(W, Q, R);
-					V = I;
-					ArcsMat<M,N,T>::copymatrix(Q,1,k,1,k, V,1,1);
-					U = U*V;
-					S = ~V*S*V;
-					S.ZeroingTriLo();
+			static_assert(ArcsMatrix::IsComplex<TU> == ArcsMatrix::IsComplex<TS>, "ArcsMat: Type Error");	// U, S は両方とも実数か複素数
+
+			if constexpr(!ArcsMatrix::IsComplex<TS>){
+				// 実数の場合は実Schur分解
+				ArcsMat<M,N,T>::RealSchur(A, U, S);
+			}else{
+				// 複素数の場合はヘッセンベルグ化してから陰的シングルシフトQR法
+				ArcsMat<MS,NS,TS>::Hessenberg(ArcsMat<MS,NS,TS>(A), U, S);
+				constexpr double eps = std::numeric_limits<double>::epsilon();
+				size_t p = M;		// 未収束部分の右下の位置
+				size_t iter = 0;	// 現在のブロックでの反復回数
+				while(1 < p){
+					// 副対角の小さな要素を探して未収束ブロック l～p を決める
+					size_t l = p;
+					for(; 1 < l; --l){
+						if(ArcsMatrixMath::Abs(S(l,l-1)) <= eps*(ArcsMatrixMath::Abs(S(l-1,l-1)) + ArcsMatrixMath::Abs(S(l,l)))){
+							S(l,l-1) = 0;
+							break;
+						}
+					}
+					if(l == p){
+						--p;		// 1×1ブロックが収束
+						iter = 0;
+						continue;
+					}
+					arcs_assert(iter < 30*M);	// 収束しない場合
+					++iter;
+
+					// 右下2×2の固有値のうち S(p,p) に近い方をシフトとする (Wilkinsonシフト，10回毎に例外シフト)
+					const TS h = (S(p-1,p-1) - S(p,p))/2.0;
+					const TS bc = S(p-1,p)*S(p,p-1);
+					const TS r = ArcsMatrixMath::Sqrt(h*h + bc);
+					const TS den = ArcsMatrixMath::Abs(h + r) < ArcsMatrixMath::Abs(h - r) ? h - r : h + r;
+					TS mu = S(p,p);
+					if(ArcsMatrixMath::Abs(den) != 0) mu -= bc/den;
+					if(iter % 10 == 0) mu = S(p,p) + 0.75*ArcsMatrixMath::Abs(S(p,p-1));
+
+					// ギブンス回転でバルジを追い出す
+					TS x = S(l,l) - mu, y = S(l+1,l);
+					for(size_t k = l; k < p; ++k){
+						if(l < k){
+							x = S(k,k-1);
+							y = S(k+1,k-1);
+						}
+						const double ax = ArcsMatrixMath::Abs(x), ay = ArcsMatrixMath::Abs(y);
+						if(ay == 0) continue;
+						double c = 0;
+						TS sn = std::conj(y)/ay;
+						if(ax != 0){
+							const double nrm = std::hypot(ax, ay);
+							c = ax/nrm;
+							sn = x/ax*std::conj(y)/nrm;
+						}
+						for(size_t j = (l < k ? k - 1 : l); j <= N; ++j){
+							const TS t1 = S(k,j), t2 = S(k+1,j);
+							S(k,j)   = c*t1 + sn*t2;
+							S(k+1,j) = -std::conj(sn)*t1 + c*t2;
+						}
+						if(l < k) S(k+1,k-1) = 0;
+						for(size_t i = 1; i <= std::min(k + 2, p); ++i){
+							const TS t1 = S(i,k), t2 = S(i,k+1);
+							S(i,k)   = t1*c + t2*std::conj(sn);
+							S(i,k+1) = -t1*sn + t2*c;
+						}
+						for(size_t i = 1; i <= M; ++i){
+							const TU t1 = U(i,k), t2 = U(i,k+1);
+							U(i,k)   = t1*c + t2*std::conj(sn);
+							U(i,k+1) = -t1*sn + t2*c;
+						}
+					}
 				}
+				for(size_t j = 1; j <= N; ++j) for(size_t i = j + 1; i <= M; ++i) S(i,j) = 0;
 			}
 		}
 
-		//! @brief 複素Schur分解(タプル返し版)
+		//! @brief Schur分解(タプル返し版)
 		//!        この関数はMATLABとは異なる解を出力する、ただしもちろん、A = USU' は成立
 		//! @param[in]	A	入力行列
 		//! @return	(ユニタリ行列U, 上三角行列または疑似上三角行列S)のタプル
@@ -3107,6 +3356,154 @@ class ArcsMat {
 			ArcsMat<M,N,T>::Schur(A, U, S);
 			return {U, S};
 		}
+
+		//! @brief 実Schur分解(引数渡し版)
+		//!        ハウスホルダー変換によるヘッセンベルグ化とFrancisのダブルシフトQR法により，
+		//!        A = USU' となる直交行列Uと疑似上三角行列S(対角に1×1と2×2のブロックが並ぶ)を O(n^3) で求める。
+		//!        2×2ブロックは複素共役固有値の対のみで S(k+1,k) ≠ 0 で判別でき，それ以外の副対角要素は厳密に零となる。
+		//!        この関数はMATLABとは異なる解を出力する場合がある、ただしもちろん、A = USU' は成立
+		//! @tparam	MU, NU, TU, MS, NS, TS 	出力行列の高さ, 幅, 要素の型
+		//! @param[in]	A	入力行列(実数のみ)
+		//! @param[out]	U	直交行列
+		//! @param[out]	S	疑似上三角行列
+		template<size_t MU, size_t NU, typename TU = double, size_t MS, size_t NS, typename TS = double>
+		static constexpr void RealSchur(const ArcsMat<M,N,T>& A, ArcsMat<MU,NU,TU>& U, ArcsMat<MS,NS,TS>& S){
+			static_assert(M == N, "ArcsMat: Size Error");	// 正方行列チェック
+			static_assert(MU == M, "ArcsMat: Size Error");	// 行列のサイズチェック
+			static_assert(NU == N, "ArcsMat: Size Error");	// 行列のサイズチェック
+			static_assert(MS == M, "ArcsMat: Size Error");	// 行列のサイズチェック
+			static_assert(NS == N, "ArcsMat: Size Error");	// 行列のサイズチェック
+			static_assert(!ArcsMatrix::IsComplex<T>, "ArcsMat: Type Error (Not Real)");	// 実数のみ対応
+			static_assert(!ArcsMatrix::IsComplex<TU>, "ArcsMat: Type Error (Not Real)");// 実数のみ対応
+			static_assert(!ArcsMatrix::IsComplex<TS>, "ArcsMat: Type Error (Not Real)");// 実数のみ対応
+
+			// 1. ハウスホルダー変換によるヘッセンベルグ化
+			ArcsMat<M,N,T>::Hessenberg(A, U, S);
+
+			// 2. Francisのダブルシフト QR 法 (減次しながら右下から順に収束させる)
+			constexpr T eps = std::numeric_limits<T>::epsilon();
+			size_t p = M;		// 未収束部分の右下の位置
+			size_t iter = 0;	// 現在のブロックでの反復回数
+			while(2 < p){
+				// 副対角の小さな要素を探して未収束ブロック l～p を決める
+				size_t l = p;
+				for(; 1 < l; --l){
+					const T s = ArcsMatrixMath::Abs(S(l-1,l-1)) + ArcsMatrixMath::Abs(S(l,l));
+					if(ArcsMatrixMath::Abs(S(l,l-1)) <= eps*s){
+						S(l,l-1) = 0;
+						break;
+					}
+				}
+				if(l == p){
+					--p;		// 1×1ブロックが収束
+					iter = 0;
+					continue;
+				}
+				if(l + 1 == p){
+					p -= 2;		// 2×2ブロックが収束
+					iter = 0;
+					continue;
+				}
+				arcs_assert(iter < 30*M);	// 収束しない場合
+				++iter;
+
+				// ダブルシフト (10回毎に例外シフト)
+				T s = S(p-1,p-1) + S(p,p);
+				T t = S(p-1,p-1)*S(p,p) - S(p-1,p)*S(p,p-1);
+				if(iter % 10 == 0){
+					const T e = ArcsMatrixMath::Abs(S(p,p-1)) + ArcsMatrixMath::Abs(S(p-1,p-2));
+					s = 1.5*e;
+					t = e*e;
+				}
+				T x = S(l,l)*S(l,l) + S(l,l+1)*S(l+1,l) - s*S(l,l) + t;
+				T y = S(l+1,l)*(S(l,l) + S(l+1,l+1) - s);
+				T z = S(l+1,l)*S(l+2,l+1);
+
+				// バルジを追い出す
+				for(size_t k = l; k + 1 <= p; ++k){
+					const size_t r = (k + 2 <= p) ? 3 : 2;	// 反射の大きさ
+					const T xn = ArcsMatrixMath::Sqrt(x*x + y*y + (r == 3 ? z*z : 0));
+					if(xn != 0){
+						const T alpha = x < 0 ? xn : -xn;
+						const T h[3] = {x - alpha, y, r == 3 ? z : 0};
+						const T beta = 2/(h[0]*h[0] + h[1]*h[1] + h[2]*h[2]);
+						for(size_t j = (l < k ? k - 1 : l); j <= N; ++j){
+							T w = 0;
+							for(size_t i = 0; i < r; ++i) w += h[i]*S(k+i,j);
+							w *= beta;
+							for(size_t i = 0; i < r; ++i) S(k+i,j) -= w*h[i];
+						}
+						for(size_t i = 1; i <= std::min(k + 3, p); ++i){
+							T w = 0;
+							for(size_t j = 0; j < r; ++j) w += S(i,k+j)*h[j];
+							w *= beta;
+							for(size_t j = 0; j < r; ++j) S(i,k+j) -= w*h[j];
+						}
+						for(size_t i = 1; i <= M; ++i){
+							T w = 0;
+							for(size_t j = 0; j < r; ++j) w += U(i,k+j)*h[j];
+							w *= beta;
+							for(size_t j = 0; j < r; ++j) U(i,k+j) -= w*h[j];
+						}
+						if(l < k){
+							S(k,k-1) = alpha;
+							for(size_t i = 1; i < r; ++i) S(k+i,k-1) = 0;
+						}
+					}
+					if(k + 1 < p){
+						x = S(k+1,k);
+						y = S(k+2,k);
+						if(k + 2 < p) z = S(k+3,k);
+					}
+				}
+			}
+
+			// 3. 残った副対角要素を整理する (2×2ブロックの下の要素は厳密に零)
+			for(size_t k = 2; k <= M; ++k){
+				if(ArcsMatrixMath::Abs(S(k,k-1)) <= eps*(ArcsMatrixMath::Abs(S(k-1,k-1)) + ArcsMatrixMath::Abs(S(k,k)))) S(k,k-1) = 0;
+			}
+			for(size_t j = 1; j <= N; ++j) for(size_t i = j + 2; i <= M; ++i) S(i,j) = 0;
+
+			// 4. 実固有値を持つ2×2ブロックは回転で上三角化して，2×2ブロックを複素共役固有値の対だけにする
+			for(size_t k = 1; k + 1 <= M; ++k){
+				if(S(k+1,k) == 0) continue;
+				const T h = (S(k,k) - S(k+1,k+1))/2;
+				const T q = h*h + S(k,k+1)*S(k+1,k);
+				if(q < 0){
+					++k;	// 複素共役固有値の2×2ブロックはそのまま
+					continue;
+				}
+				const T z = h + (h < 0 ? -ArcsMatrixMath::Sqrt(q) : ArcsMatrixMath::Sqrt(q));	// λ - S(k+1,k+1) (桁落ちしない方)
+				const T r = ArcsMatrixMath::Sqrt(z*z + S(k+1,k)*S(k+1,k));
+				const T c = z/r, sn = S(k+1,k)/r;							// 固有ベクトル (z, S(k+1,k)) 方向の回転
+				for(size_t j = k; j <= N; ++j){
+					const T t1 = S(k,j), t2 = S(k+1,j);
+					S(k,j)   =  c*t1 + sn*t2;
+					S(k+1,j) = -sn*t1 + c*t2;
+				}
+				for(size_t i = 1; i <= M; ++i){
+					if(i <= k + 1){
+						const T t1 = S(i,k), t2 = S(i,k+1);
+						S(i,k)   = t1*c + t2*sn;
+						S(i,k+1) = -t1*sn + t2*c;
+					}
+					const T u1 = U(i,k), u2 = U(i,k+1);
+					U(i,k)   = u1*c + u2*sn;
+					U(i,k+1) = -u1*sn + u2*c;
+				}
+				S(k+1,k) = 0;
+			}
+		}
+
+		//! @brief 実Schur分解(タプル返し版)
+		//!        この関数はMATLABとは異なる解を出力する場合がある、ただしもちろん、A = USU' は成立
+		//! @param[in]	A	入力行列(実数のみ)
+		//! @return	(直交行列U, 疑似上三角行列S)のタプル
+		static constexpr std::tuple<ArcsMat<M,N,T>, ArcsMat<M,N,T>> RealSchur(const ArcsMat<M,N,T>& A){
+			ArcsMat<M,N,T> U, S;
+			ArcsMat<M,N,T>::RealSchur(A, U, S);
+			return {U, S};
+		}
 		
 		//! @brief 固有値を返す関数(引数渡し版)
 		//! @tparam	MV, NV, TV	出力行列の高さ, 幅, 要素の型
@@ -3120,9 +3517,28 @@ class ArcsMat {
 			static_assert(ArcsMatrix::IsApplicable<T>, "ArcsMat: Type Error");				// 対応可能型チェック
 			static_assert(ArcsMatrix::IsComplex<TV>, "ArcsMat: Type Error (Not Complex)");	// 出力は複素数型のみ対応
 
-			const ArcsMat<M,M,TV> U = A;
-			const auto [W, S] = ArcsMat<M,N,TV>::Schur(U);	// シュール分解を実行
-			v = ArcsMat<M,M,TV>::getdiag(S);				// シュール分解の対角要素が固有値
+			if constexpr(!ArcsMatrix::IsComplex<T>){
+				// 実数の場合は実Schur分解の1×1ブロックが実固有値，2×2ブロックが複素共役固有値の対
+				ArcsMat<M,N,T> U, S;
+				ArcsMat<M,N,T>::RealSchur(A, U, S);
+				for(size_t k = 1; k <= M; ++k){
+					if(k < M && S(k+1,k) != 0){
+						const T h = (S(k,k) - S(k+1,k+1))/2;
+						const T im = ArcsMatrixMath::Sqrt(-(h*h + S(k,k+1)*S(k+1,k)));
+						const T re = (S(k,k) + S(k+1,k+1))/2;
+						v[k]   = TV(re,  im);
+						v[k+1] = TV(re, -im);
+						++k;
+					}else{
+						v[k] = S(k,k);
+					}
+				}
+			}else{
+				// 複素数の場合は複素Schur分解の対角要素が固有値
+				ArcsMat<M,N,T> U, S;
+				ArcsMat<M,N,T>::Schur(A, U, S);
+				v = ArcsMat<M,M,T>::getdiag(S);
+			}
 		}
 
 		//! @brief 固有値を返す関数(戻り値返し版)
@@ -3152,17 +3568,77 @@ class ArcsMat {
 			static_assert(ArcsMatrix::IsComplex<TV>, "ArcsMat: Type Error (Not Complex)");	// 出力は複素数型のみ対応
 			static_assert(ArcsMatrix::IsComplex<TD>, "ArcsMat: Type Error (Not Complex)");	// 出力は複素数型のみ対応
 
-			// シュール分解による固有値と固有ベクトルの計算
-			const ArcsMat<M,M,TV> Ax = A;			// 予め複素行列として読み込み
-			const auto l = ArcsMat<M,M,TV>::eig(A);	// シュール分解で固有値を先に求める
-			ArcsMat<M,1,TV>::diag(l, D);			// 固有値を対角に持つ対角行列を生成
-			const auto I = ArcsMat<M,M,TV>::eye();	// [C++20移行時にconstexprに改修]
-			ArcsMat<M,M,TV> Q, R;
+			// 1. 複素Schur分解 A = USU' (Sは上三角行列) を求める
+			ArcsMat<M,M,TV> U, S;
+			if constexpr(!ArcsMatrix::IsComplex<T>){
+				// 実数の場合は実Schur分解の2×2ブロックを複素ギブンス回転で上三角化する (MATLABでいうrsf2csf)
+				ArcsMat<M,N,T> Ur, Sr;
+				ArcsMat<M,N,T>::RealSchur(A, Ur, Sr);
+				U = ArcsMat<M,M,TV>(Ur);
+				S = ArcsMat<M,M,TV>(Sr);
+				for(size_t k = 1; k < M; ++k){
+					if(Sr(k+1,k) == 0) continue;
+					const T h = (Sr(k,k) - Sr(k+1,k+1))/2;
+					const TV l(Sr(k+1,k+1) + h, ArcsMatrixMath::Sqrt(-(h*h + Sr(k,k+1)*Sr(k+1,k))));	// 虚部が正の固有値
+					const TV x = l - S(k+1,k+1), y = S(k+1,k);	// 固有ベクトル方向
+					const double nrm = ArcsMatrixMath::Sqrt(std::norm(x) + std::norm(y));
+					const TV g1 = x/nrm, g2 = y/nrm;			// 回転 G = [g1 -conj(g2); g2 conj(g1)]
+					for(size_t j = k; j <= N; ++j){
+						const TV t1 = S(k,j), t2 = S(k+1,j);
+						S(k,j)   = std::conj(g1)*t1 + std::conj(g2)*t2;
+						S(k+1,j) = -g2*t1 + g1*t2;
+					}
+					for(size_t i = 1; i <= M; ++i){
+						if(i <= k + 1){
+							const TV t1 = S(i,k), t2 = S(i,k+1);
+							S(i,k)   = t1*g1 + t2*g2;
+							S(i,k+1) = -t1*std::conj(g2) + t2*std::conj(g1);
+						}
+						const TV u1 = U(i,k), u2 = U(i,k+1);
+						U(i,k)   = u1*g1 + u2*g2;
+						U(i,k+1) = -u1*std::conj(g2) + u2*std::conj(g1);
+					}
+					S(k+1,k) = 0;
+					++k;
+				}
+			}else{
+				ArcsMat<M,N,T>::Schur(A, U, S);
+			}
+
+			// 2. 上三角行列Sの固有ベクトルを後退代入で求めて，Uを掛けて元に戻す
+			double smin = 0;	// 分母が零になるのを避けるための最小値 (重根の場合)
+			for(size_t j = 1; j <= N; ++j) for(size_t i = 1; i <= j; ++i) smin = std::max(smin, ArcsMatrixMath::Abs(S(i,j)));
+			smin = std::max(smin*std::numeric_limits<double>::epsilon(), std::numeric_limits<double>::min());
+			ArcsMat<M,1,TV> y;
+			D.FillAllZero();
 			for(size_t k = 1; k <= M; ++k){
-					//(~(Ax - l[k]*I)).Disp("% 8.4f");
-				ArcsMat<M,M,TV>::QR( ~(Ax - l[k]*I), Q, R );
-					//Q.Disp("% 8.4f");
-				ArcsMat<M,M,TV>::setvvector(V, ArcsMat<M,M,TV>::getvvector(Q, 1, M), 1, k);
+				const TV l = S(k,k);
+				y.FillAllZero();
+				y[k] = 1;
+				for(size_t i = k - 1; 0 < i; --i){
+					TV w = 0;
+					for(size_t j = i + 1; j <= k; ++j) w += S(i,j)*y[j];
+					TV den = S(i,i) - l;
+					if(ArcsMatrixMath::Abs(den) < smin) den = smin;
+					y[i] = -w/den;
+				}
+
+				// 2ノルムを1にして，絶対値最大の要素が正の実数になるように位相を揃える
+				double nrm = 0, amax = 0;
+				TV ph = 1;
+				for(size_t i = 1; i <= M; ++i){
+					TV x = 0;
+					for(size_t j = 1; j <= k; ++j) x += U(i,j)*y[j];
+					V(i,k) = x;
+					nrm += std::norm(x);
+					if(amax < ArcsMatrixMath::Abs(x)){
+						amax = ArcsMatrixMath::Abs(x);
+						ph = std::conj(x)/amax;
+					}
+				}
+				nrm = ArcsMatrixMath::Sqrt(nrm);
+				for(size_t i = 1; i <= M; ++i) V(i,k) *= ph/nrm;
+				D(k,k) = l;
 			}
 		}
 
@@ -3353,7 +3829,9 @@ class ArcsMat {
 		}
 		
 		//! @brief 行列指数関数 (引数渡し版)
-		//! @tparam	K	パデ近似の次数 (デフォルト値 = 13)
+		//! Higham(2005, 2009)のスケーリング＆スクエアリング法により，ノルムに応じてパデ近似の次数を
+		//! 1, 2, 3, 5, 7, 9, 13次の中から選び，必要な場合だけスケーリングする。
+		//! @tparam	K	パデ近似の最高次数 (デフォルト値 = 13, K以下で一番高い上記の次数までを使用)
 		//! @tparam	MY, NY, TY 出力ベクトルの高さ, 幅, 要素の型
 		//! @param[in]	U	入力行列
 		//! @param[out]	Y	出力行列
@@ -3366,40 +3844,99 @@ class ArcsMat {
 			static_assert(ArcsMatrix::IsApplicable<TY>, "ArcsMat: Type Error");	// 対応可能型チェック
 			static_assert(0 < K, "ArcsMat: Setting Error");	// パデ近似の次数は1次以上
 
-			// L∞ノルムでスケーリング
-			int e = 0;
-			std::frexp(ArcsMat<M,N,T>::norm<ArcsMatrix::NormType::AMT_LINF>(U), &e);
-			ArcsMat<M,N,T> A;
-			if(0 < e){
-				A = std::pow(0.5, e + 1)*U;
-			}else{
-				e = 0;
-				A = 0.5*U;
+			// パデ近似の次数と，その次数で倍精度の誤差に収まる1-ノルムの上限 θm (Higham 2005, Table 2.3)
+			constexpr size_t NUM_PADE = 7;
+			constexpr std::array<size_t, NUM_PADE> Degree = {1, 2, 3, 5, 7, 9, 13};
+			constexpr std::array<double, NUM_PADE> Theta = {
+				3.650024139523051e-8, 5.317232856892575e-4, 1.495585217958292e-2, 2.539398330063230e-1,
+				9.504178996162932e-1, 2.097847961257068e0,  5.371920351148152e0
+			};
+			size_t imax = 0;	// 使用可能な最高次数の番号
+			for(size_t i = 0; i < NUM_PADE; ++i) if(Degree[i] <= K) imax = i;
+
+			// ノルムが十分小さければスケーリングせずに済む一番低い次数で計算
+			const double Unorm = ArcsMat<M,N,T>::norm<ArcsMatrix::NormType::AMT_L1>(U);
+			for(size_t i = 0; i <= imax; ++i){
+				if(Unorm <= Theta[i]){
+					ArcsMat<M,N,T>::expm_pade(U, Degree[i], Y);
+					return;
+				}
 			}
 
-			// 指数行列のパデ近似の計算
+			// ノルムが θm 以下になるように 1/2^s でスケーリング (s = ceil(log2(‖U‖/θm)))
+			int s = 0;
+			if(ArcsMatrixMath::Frexp(Unorm/Theta[imax], &s) == 0.5) --s;	// ちょうど2の冪乗のときは1つ少なくて済む
+			ArcsMat<M,N,T>::expm_pade(static_cast<T>(ArcsMatrixMath::Ldexp(1.0, -s))*U, Degree[imax], Y);
+
+			// スケールを元に戻す
+			for(int i = 0; i < s; ++i) Y *= Y;
+		}
+		
+		//! @brief 行列指数関数のパデ近似 exp(A) ≒ (V - U)^-1 (V + U) を計算する関数 (内部用引数渡し版のみ)
+		//! U は奇数次の項，V は偶数次の項で，m = 13次のときは行列積6回，それ以外は (m + 1)/2 + 1 回で計算する。
+		//! @tparam	MY, NY, TY 出力ベクトルの高さ, 幅, 要素の型
+		//! @param[in]	A	入力行列
+		//! @param[in]	m	パデ近似の次数 (1, 2, 3, 5, 7, 9, 13 のいずれか)
+		//! @param[out]	Y	出力行列
+		template<size_t MY, size_t NY, typename TY = double>
+		static constexpr void expm_pade(const ArcsMat<M,N,T>& A, const size_t m, ArcsMat<MY,NY,TY>& Y){
+			// パデ近似の係数 b0, b1, ..., bm (Higham 2005, 整数で厳密に表現できる形)
+			constexpr std::array<std::array<double, 14>, 7> Coef = {{
+				{2, 1},
+				{12, 6, 1},
+				{120, 60, 12, 1},
+				{30240, 15120, 3360, 420, 30, 1},
+				{17297280, 8648640, 1995840, 277200, 25200, 1512, 56, 1},
+				{17643225600, 8821612800, 2075673600, 302702400, 30270240, 2162160, 110880, 3960, 90, 1},
+				{64764752532480000, 32382376266240000, 7771770303897600, 1187353796428800, 129060195264000,
+				 10559470521600, 670442572800, 33522128640, 1323241920, 40840800, 960960, 16380, 182, 1}
+			}};
 			const auto I = ArcsMat<M,N,T>::eye();	// 単位行列の生成
-			ArcsMat<M,N,T> L = I, R = I, X = I, cX;
-			T c = 1;
-			bool signflag = false;					// 係数の符号生成用フラグ
-			int coefsign = -1;						// 係数の符号
-			for(size_t i = 1; i <= K; ++i){
-				c = c*static_cast<T>(K - i + 1) / static_cast<T>(i*(2*K - i + 1));	// 指数行列のパデ近似係数の計算
-				X = A*X;									// A^Mの計算
-				cX = c*X;									// cM*A^Mの計算
-				R += cX;									// R = I + c1*A + c2*A*A + c3*A*A*A + ... + cM*A^M ←パデ近似の分子
-				coefsign = 2*static_cast<int>(signflag) - 1;// 係数の符号
-				L += static_cast<T>(coefsign)*cX;			// L = I + c1*A + c2*A*A + c3*A*A*A + ... + cM*A^M ←パデ近似の分母
-				signflag = !signflag;						// 係数の符号生成用フラグ
+			ArcsMat<M,N,T> Uo, Ve;					// 奇数次の項と偶数次の項
+
+			if(m == 13){
+				// 13次のときは A^2, A^4, A^6 だけを作って A^8 以上は A^6 との積で括る
+				const auto& b = Coef[6];
+				const auto c = [&b](const size_t k){ return static_cast<T>(b[k]); };
+				const ArcsMat<M,N,T> A2 = A*A;
+				const ArcsMat<M,N,T> A4 = A2*A2;
+				const ArcsMat<M,N,T> A6 = A2*A4;
+				const ArcsMat<M,N,T> W1 = ArcsMatrix::lazy(A6)*c(13) + ArcsMatrix::lazy(A4)*c(11) + ArcsMatrix::lazy(A2)*c(9);
+				const ArcsMat<M,N,T> W2 = ArcsMatrix::lazy(A6)*c(7) + ArcsMatrix::lazy(A4)*c(5) + ArcsMatrix::lazy(A2)*c(3) + ArcsMatrix::lazy(I)*c(1);
+				const ArcsMat<M,N,T> Z1 = ArcsMatrix::lazy(A6)*c(12) + ArcsMatrix::lazy(A4)*c(10) + ArcsMatrix::lazy(A2)*c(8);
+				Uo = ArcsMatrix::lazy(A)*(ArcsMatrix::lazy(A6)*W1 + W2);
+				Ve = ArcsMatrix::lazy(A6)*Z1 + ArcsMatrix::lazy(A6)*c(6) + ArcsMatrix::lazy(A4)*c(4) + ArcsMatrix::lazy(A2)*c(2) + ArcsMatrix::lazy(I)*c(0);
+			}else{
+				// それ以外のときは A^2 を掛けながら偶数乗を作って積算
+				size_t j = 0;	// 係数表の番号
+				for(const size_t d : {1, 2, 3, 5, 7, 9}){
+					if(d == m) break;
+					++j;
+				}
+				arcs_assert(j < 6);	// 対応していない次数が指定されたらエラー
+				const auto& b = Coef[j];
+				ArcsMat<M,N,T> A2, A2k = I;	// A^2 と A^(2k)
+				ArcsMat<M,N,T> Wo;			// 奇数次の項を A で括ったもの
+				for(size_t k = 0; 2*k <= m; ++k){
+					if(k == 1){
+						A2 = A*A;
+						A2k = A2;
+					}else if(1 < k){
+						A2k = A2k*A2;
+					}
+					Ve += ArcsMatrix::lazy(A2k)*static_cast<T>(b[2*k]);
+					if(2*k + 1 <= m) Wo += ArcsMatrix::lazy(A2k)*static_cast<T>(b[2*k + 1]);
+				}
+				Uo = A*Wo;
 			}
-			ArcsMat<M,N,T>::linsolve(L, R, Y);		// パデ近似 Y = L/R → 行列パデ近似 Y = inv(L)*R → 線形方程式表示 LY = R
 
-			// スケールを元に戻す
-			for(size_t i = 0; i < static_cast<size_t>(e) + 1; ++i) Y *= Y;
+			// 1回のLU分解で (V - U) Y = V + U を解く
+			const ArcsMat<M,N,T> D = ArcsMatrix::lazy(Ve) - Uo, P = ArcsMatrix::lazy(Ve) + Uo;
+			ArcsMat<M,N,T>::linsolve(D, P, Y);
 		}
 		
 		//! @brief 行列指数関数 (戻り値返し版)
-		//! @tparam	K	パデ近似の次数 (デフォルト値 = 13)
+		//! @tparam	K	パデ近似の最高次数 (デフォルト値 = 13)
 		//! @param[in]	U	入力行列
 		//! @return	出力行列
 		template<size_t K = 13>
@@ -3435,18 +3972,40 @@ class ArcsMat {
 			T ret = 1;
 			if constexpr(ArcsMatrix::IsComplex<T>){
 				// 複素数型の場合
-				if(std::abs(u) < EPSILON){
+				if(ArcsMatrixMath::Abs(u) < EPSILON){
 					ret = std::complex(0.0, 0.0);	// ゼロ割回避
 				}else{
-					ret = u/std::abs(u);			// 複素数に拡張された符号関数
+					ret = u/ArcsMatrixMath::Abs(u);	// 複素数に拡張された符号関数
 				}
 			}else{
 				// 実数型の場合
-				ret = std::copysign(1, u);
+				ret = ArcsMatrixMath::CopySign(1, u);
 			}
 			return ret;
 		}
 
+		//! @brief 複素共役 (実数型ではそのまま返す)
+		//! @param[in]	u	入力
+		//! @return	共役結果
+		static constexpr T conjsc(const T u){
+			if constexpr(ArcsMatrix::IsComplex<T>){
+				return T(u.real(), -u.imag());
+			}else{
+				return u;
+			}
+		}
+
+		//! @brief 絶対値の2乗
+		//! @param[in]	u	入力
+		//! @return	|u|^2
+		static constexpr double abs2(const T u){
+			if constexpr(ArcsMatrix::IsComplex<T>){
+				return u.real()*u.real() + u.imag()*u.imag();
+			}else{
+				return static_cast<double>(u)*static_cast<double>(u);
+			}
+		}
+
 };
 
 namespace ArcsMatrix {
@@ -4815,6 +5374,27 @@ namespace ArcsMatrix {
 		return ArcsMat<M,N,T>::Schur(A);
 	}
 
+	//! @brief 実Schur分解(引数渡し版)
+	//!        この関数はMATLABとは異なる解を出力する場合がある、ただしもちろん、A = USU' は成立
+	//! @tparam	M, N, T, MU, NU, TU, MS, NS, TS 	入出力行列の高さ, 幅, 要素の型
+	//! @param[in]	A	入力行列(実数のみ)
+	//! @param[out]	U	直交行列
+	//! @param[out]	S	疑似上三角行列
+	template<size_t M, size_t N, typename T = double, size_t MU, size_t NU, typename TU = double, size_t MS, size_t NS, typename TS = double>
+	constexpr void RealSchur(const ArcsMat<M,N,T>& A, ArcsMat<MU,NU,TU>& U, ArcsMat<MS,NS,TS>& S){
+		ArcsMat<M,N,T>::RealSchur(A, U, S);
+	}
+
+	//! @brief 実Schur分解(タプル返し版)
+	//!        この関数はMATLABとは異なる解を出力する場合がある、ただしもちろん、A = USU' は成立
+	//! @tparam	M, N, T	入出力行列の高さ, 幅, 要素の型
+	//! @param[in]	A	入力行列(実数のみ)
+	//! @return	(直交行列U, 疑似上三角行列S)のタプル
+	template<size_t M, size_t N, typename T = double>
+	constexpr std::tuple<ArcsMat<M,N,T>, ArcsMat<M,N,T>> RealSchur(const ArcsMat<M,N,T>& A){
+		return ArcsMat<M,N,T>::RealSchur(A);
+	}
+
 	//! @brief 固有値を返す関数
 	//! @tparam	M, N, T, MV, NV, TV	入出力行列の高さ, 幅, 要素の型
 	//! @param[in]	A	入力行列
@@ -4930,7 +5510,7 @@ namespace ArcsMatrix {
 	}
 
 	//! @brief 行列指数関数 (引数渡し版)
-	//! @tparam	K	パデ近似の次数 (デフォルト値 = 13)
+	//! @tparam	K	パデ近似の最高次数 (デフォルト値 = 13)
 	//! @tparam	M, N, T, MY, NY, TY 入出力行列の高さ, 幅, 要素の型
 	//! @param[in]	U	入力行列
 	//! @param[out]	Y	出力行列
@@ -4940,7 +5520,7 @@ namespace ArcsMatrix {
 	}
 		
 	//! @brief 行列指数関数 (戻り値返し版)
-	//! @tparam	K	パデ近似の次数 (デフォルト値 = 13)
+	//! @tparam	K	パデ近似の最高次数 (デフォルト値 = 13)
 	//! @tparam	M, N, T	入出力行列の高さ, 幅, 要素の型
 	//! @param[in]	U	入力行列
 	//! @return	出力行列
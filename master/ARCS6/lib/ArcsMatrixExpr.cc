@@ -0,0 +1,14 @@
+//! @file ArcsMatrixExpr.cc
+//! @brief ARCS-Matrix 遅延評価式テンプレート
+//!
+//! ArcsMatの和・差・スカラー倍・転置などを式のまま保持して，代入時に1回のループで評価する。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "ArcsMatrixExpr.hh"
+
+// テンプレートクラスのため，実体もヘッダ側に実装。
@@ -0,0 +1,269 @@
+//! @file ArcsMatrixExpr.hh
+//! @brief ARCS-Matrix 遅延評価式テンプレート
+//!
+//! ArcsMatの演算子は演算子1つ毎に結果の行列を一時オブジェクトとして生成するが，
+//! ArcsMatrix::lazy() で包んだ行列から始まる式は，演算子の時点では計算せずに式の構造だけを保持し，
+//! ArcsMatへの代入時(または構築時)に全要素を1回のループでまとめて計算する。
+//! 行列積の部分だけは代入前に ArcsMat の乗算演算子(小規模行列ではSIMDカーネル)で計算しておき，
+//! 和・差・スカラー倍・アダマール積/除算・転置はその結果と融合して計算する。
+//!
+//! 使用例： x = lazy(A)*x + lazy(B)*u;
+//!
+//! @par 使用上の注意
+//! - 式の左端の行列を lazy() で包むこと。左端が普通のArcsMatの場合は従来通りの即時評価となる。
+//!   (ただし「行列 ± 式」と「行列 += 式」などの複合代入は式として扱う。「行列 * 式」は使用不可)
+//! - 式オブジェクトは式の途中の一時オブジェクトを参照するので，auto変数に保持せずにその文の中でArcsMatへ代入すること。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef ARCSMATRIXEXPR
+#define ARCSMATRIXEXPR
+
+#include <cstddef>
+#include <complex>
+#include <type_traits>
+
+// ARCS名前空間
+namespace ARCS {
+
+template <size_t M, size_t N, typename T> class ArcsMat;	// ArcsMatの前方宣言
+
+// ArcsMatrix遅延評価式定義
+namespace ArcsMatrixExpr {
+	//! @brief 複素数型チェック用メタ関数
+	template<typename TT> struct IsComplexV : std::false_type {};
+	template<typename TT> struct IsComplexV<std::complex<TT>> : std::true_type {};
+
+	//! @brief 式の基底クラス (CRTP)
+	//! @tparam	E	派生した式の型
+	//! @tparam	M, N, T	式の結果の行列の高さ, 幅, 要素の型
+	template<typename E, size_t M, size_t N, typename T>
+	class Base {
+		public:
+			//! @brief 式の要素を計算する関数
+			//! @param[in]	m	縦方向の要素番号( "1" 始まり)
+			//! @param[in]	n	横方向の要素番号( "1" 始まり)
+			//! @return	要素の値
+			constexpr T operator()(const size_t m, const size_t n) const{
+				return static_cast<const E&>(*this).At(m, n);
+			}
+
+			//! @brief 転置(またはエルミート転置)を通して行列 p を参照しているかを返す関数
+			//! (代入先と同じ行列を転置して参照していると，1回のループで上書きしながら読むことになるので一時行列が必要)
+			//! @param[in]	p	代入先の行列のアドレス
+			//! @return	true = 参照している
+			constexpr bool IsAliased(const void* p) const{
+				return static_cast<const E&>(*this).Aliased(p);
+			}
+	};
+
+	//! @brief 遅延評価式かどうかのチェック用メタ関数
+	template<typename TT, typename = void> struct IsExprV : std::false_type {};
+	template<typename TT> struct IsExprV<TT, std::void_t<decltype(TT::BY_VALUE)>> : std::true_type {};
+	template<typename TT> inline constexpr bool IsExpr = IsExprV<TT>::value;
+
+	//! @brief 式の子要素の保持方法 (行列参照は値で，それ以外の式は参照で保持する)
+	template<typename E> using Hold = std::conditional_t<E::BY_VALUE, const E, const E&>;
+
+	//! @brief 行列参照 (式の末端)
+	//! @tparam	M, N, T	行列の高さ, 幅, 要素の型
+	template<size_t M, size_t N, typename T>
+	class Ref : public Base<Ref<M,N,T>, M, N, T> {
+		public:
+			static constexpr bool BY_VALUE = true;	//!< 値で保持する
+			constexpr explicit Ref(const ArcsMat<M,N,T>& U) noexcept : Mat(U) {}
+			constexpr T At(const size_t m, const size_t n) const{ return Mat(m, n); }
+			constexpr bool Refers(const void* p) const{ return static_cast<const void*>(&Mat) == p; }
+			constexpr bool Aliased(const void*) const{ return false; }
+			constexpr const ArcsMat<M,N,T>& Get(void) const{ return Mat; }
+		private:
+			const ArcsMat<M,N,T>& Mat;	//!< 参照先の行列
+	};
+
+	//! @brief 単項マイナス
+	template<typename E, size_t M, size_t N, typename T>
+	class Neg : public Base<Neg<E,M,N,T>, M, N, T> {
+		public:
+			static constexpr bool BY_VALUE = false;	//!< 参照で保持する
+			constexpr explicit Neg(const E& e) noexcept : Arg(e) {}
+			constexpr T At(const size_t m, const size_t n) const{ return -Arg.At(m, n); }
+			constexpr bool Refers(const void* p) const{ return Arg.Refers(p); }
+			constexpr bool Aliased(const void* p) const{ return Arg.Aliased(p); }
+		private:
+			Hold<E> Arg;	//!< 引数の式
+	};
+
+	//! @brief 転置 (複素数型の場合はエルミート転置)
+	template<typename E, size_t M, size_t N, typename T>
+	class Trans : public Base<Trans<E,M,N,T>, M, N, T> {
+		public:
+			static constexpr bool BY_VALUE = false;	//!< 参照で保持する
+			constexpr explicit Trans(const E& e) noexcept : Arg(e) {}
+			constexpr T At(const size_t m, const size_t n) const{
+				if constexpr(IsComplexV<T>::value){
+					return std::conj(Arg.At(n, m));
+				}else{
+					return Arg.At(n, m);
+				}
+			}
+			constexpr bool Refers(const void* p) const{ return Arg.Refers(p); }
+			constexpr bool Aliased(const void* p) const{ return Arg.Refers(p); }
+		private:
+			Hold<E> Arg;	//!< 引数の式
+	};
+
+	//! @brief 要素毎の二項演算の定義
+	struct OpAdd { template<typename T> static constexpr T Apply(const T& a, const T& b){ return a + b; } };	//!< 加算
+	struct OpSub { template<typename T> static constexpr T Apply(const T& a, const T& b){ return a - b; } };	//!< 減算
+	struct OpMul { template<typename T> static constexpr T Apply(const T& a, const T& b){ return a*b; } };	//!< 乗算
+	struct OpDiv { template<typename T> static constexpr T Apply(const T& a, const T& b){ return a/b; } };	//!< 除算
+
+	//! @brief 要素毎の二項演算 (行列 op 行列)
+	template<typename Op, typename L, typename R, size_t M, size_t N, typename T>
+	class Binary : public Base<Binary<Op,L,R,M,N,T>, M, N, T> {
+		public:
+			static constexpr bool BY_VALUE = false;	//!< 参照で保持する
+			constexpr Binary(const L& l, const R& r) noexcept : Left(l), Right(r) {}
+			constexpr T At(const size_t m, const size_t n) const{ return Op::Apply(Left.At(m, n), Right.At(m, n)); }
+			constexpr bool Refers(const void* p) const{ return Left.Refers(p) || Right.Refers(p); }
+			constexpr bool Aliased(const void* p) const{ return Left.Aliased(p) || Right.Aliased(p); }
+		private:
+			Hold<L> Left;	//!< 左側の式
+			Hold<R> Right;	//!< 右側の式
+	};
+
+	//! @brief スカラーとの二項演算 (行列 op スカラー，スカラー op 行列)
+	//! @tparam	ScalarLeft	true = スカラーが左側
+	template<typename Op, bool ScalarLeft, typename E, size_t M, size_t N, typename T>
+	class Scalar : public Base<Scalar<Op,ScalarLeft,E,M,N,T>, M, N, T> {
+		public:
+			static constexpr bool BY_VALUE = false;	//!< 参照で保持する
+			constexpr Scalar(const E& e, const T& s) noexcept : Arg(e), Value(s) {}
+			constexpr T At(const size_t m, const size_t n) const{
+				if constexpr(ScalarLeft){
+					return Op::Apply(Value, Arg.At(m, n));
+				}else{
+					return Op::Apply(Arg.At(m, n), Value);
+				}
+			}
+			constexpr bool Refers(const void* p) const{ return Arg.Refers(p); }
+			constexpr bool Aliased(const void* p) const{ return Arg.Aliased(p); }
+		private:
+			Hold<E> Arg;	//!< 行列側の式
+			const T Value;	//!< スカラー値
+	};
+
+	//! @brief 式を行列として評価する関数 (行列参照の場合はそのまま参照を返す)
+	template<size_t M, size_t N, typename T>
+	constexpr const ArcsMat<M,N,T>& Evaluate(const Ref<M,N,T>& e){
+		return e.Get();
+	}
+
+	//! @brief 式を行列として評価する関数 (一般の式の場合は行列を生成する)
+	template<typename E, size_t M, size_t N, typename T>
+	constexpr ArcsMat<M,N,T> Evaluate(const Base<E,M,N,T>& e){
+		return ArcsMat<M,N,T>(e);
+	}
+
+	//! @brief 行列積
+	//! 構築時に ArcsMat の乗算演算子(小規模行列ではSIMDカーネル)で計算して結果を保持し，
+	//! 外側の要素毎の演算とは代入時に融合する。
+	template<size_t M, size_t Q, typename T>
+	class Prod : public Base<Prod<M,Q,T>, M, Q, T> {
+		public:
+			static constexpr bool BY_VALUE = false;	//!< 参照で保持する
+			template<typename L, typename R, size_t N>
+			constexpr Prod(const Base<L,M,N,T>& l, const Base<R,N,Q,T>& r)
+				: Result(Evaluate(static_cast<const L&>(l))*Evaluate(static_cast<const R&>(r)))
+			{
+
+			}
+			constexpr T At(const size_t m, const size_t n) const{ return Result(m, n); }
+			constexpr bool Refers(const void*) const{ return false; }	// 計算済みなので代入先とは無関係
+			constexpr bool Aliased(const void*) const{ return false; }
+		private:
+			const ArcsMat<M,Q,T> Result;	//!< 行列積の結果
+	};
+
+	//! @brief 演算子で使う非推定文脈用の型 (スカラー側の型を行列の要素の型に合わせるため)
+	template<typename TT> struct Identity { using type = TT; };
+
+	//! @brief 単項マイナス演算子
+	template<typename E, size_t M, size_t N, typename T>
+	constexpr Neg<E,M,N,T> operator-(const Base<E,M,N,T>& e){
+		return Neg<E,M,N,T>(static_cast<const E&>(e));
+	}
+
+	//! @brief 転置演算子 (複素数型の場合はエルミート転置)
+	template<typename E, size_t M, size_t N, typename T>
+	constexpr Trans<E,N,M,T> operator~(const Base<E,M,N,T>& e){
+		return Trans<E,N,M,T>(static_cast<const E&>(e));
+	}
+
+	//! @brief 要素毎の二項演算子の定義用マクロ (式 op 式，式 op 行列)
+	#define ARCSMATEXPR_BINARY_OPERATOR(OPSYM, OPTYPE) \
+		template<typename L, typename R, size_t M, size_t N, size_t P, size_t Q, typename T> \
+		constexpr Binary<OPTYPE,L,R,M,N,T> operator OPSYM(const Base<L,M,N,T>& l, const Base<R,P,Q,T>& r){ \
+			static_assert(M == P, "ArcsMat: Size Error");	/* 行列のサイズチェック */ \
+			static_assert(N == Q, "ArcsMat: Size Error");	/* 行列のサイズチェック */ \
+			return Binary<OPTYPE,L,R,M,N,T>(static_cast<const L&>(l), static_cast<const R&>(r)); \
+		} \
+		template<typename L, size_t M, size_t N, size_t P, size_t Q, typename T> \
+		constexpr Binary<OPTYPE,L,Ref<P,Q,T>,M,N,T> operator OPSYM(const Base<L,M,N,T>& l, const ArcsMat<P,Q,T>& r){ \
+			static_assert(M == P, "ArcsMat: Size Error");	/* 行列のサイズチェック */ \
+			static_assert(N == Q, "ArcsMat: Size Error");	/* 行列のサイズチェック */ \
+			return Binary<OPTYPE,L,Ref<P,Q,T>,M,N,T>(static_cast<const L&>(l), Ref<P,Q,T>(r)); \
+		}
+	ARCSMATEXPR_BINARY_OPERATOR(+, OpAdd)	// 加算
+	ARCSMATEXPR_BINARY_OPERATOR(-, OpSub)	// 減算
+	ARCSMATEXPR_BINARY_OPERATOR(&, OpMul)	// アダマール積
+	ARCSMATEXPR_BINARY_OPERATOR(%, OpDiv)	// アダマール除算
+	#undef ARCSMATEXPR_BINARY_OPERATOR
+
+	//! @brief 行列乗算演算子 (式＊式)
+	template<typename L, typename R, size_t M, size_t N, size_t P, size_t Q, typename T>
+	constexpr Prod<M,Q,T> operator*(const Base<L,M,N,T>& l, const Base<R,P,Q,T>& r){
+		static_assert(N == P, "ArcsMat: Size Error");	// 行列のサイズチェック
+		return Prod<M,Q,T>(l, r);
+	}
+
+	//! @brief 行列乗算演算子 (式＊行列)
+	template<typename L, size_t M, size_t N, size_t P, size_t Q, typename T>
+	constexpr Prod<M,Q,T> operator*(const Base<L,M,N,T>& l, const ArcsMat<P,Q,T>& r){
+		static_assert(N == P, "ArcsMat: Size Error");	// 行列のサイズチェック
+		return Prod<M,Q,T>(l, Ref<P,Q,T>(r));
+	}
+
+	//! @brief スカラーとの演算子 (式＊スカラー，スカラー＊式，式／スカラー)
+	template<typename E, size_t M, size_t N, typename T>
+	constexpr Scalar<OpMul,false,E,M,N,T> operator*(const Base<E,M,N,T>& e, const typename Identity<T>::type& s){
+		return Scalar<OpMul,false,E,M,N,T>(static_cast<const E&>(e), s);
+	}
+	template<typename E, size_t M, size_t N, typename T>
+	constexpr Scalar<OpMul,true,E,M,N,T> operator*(const typename Identity<T>::type& s, const Base<E,M,N,T>& e){
+		return Scalar<OpMul,true,E,M,N,T>(static_cast<const E&>(e), s);
+	}
+	template<typename E, size_t M, size_t N, typename T>
+	constexpr Scalar<OpDiv,false,E,M,N,T> operator/(const Base<E,M,N,T>& e, const typename Identity<T>::type& s){
+		return Scalar<OpDiv,false,E,M,N,T>(static_cast<const E&>(e), s);
+	}
+}
+
+namespace ArcsMatrix {
+	//! @brief 行列を遅延評価式の末端として包む関数
+	//! 例えば x = lazy(A)*x + lazy(B)*u; のように書くと，和は代入時に1回のループで計算される。
+	//! @tparam	M, N, T	行列の高さ, 幅, 要素の型
+	//! @param[in]	U	行列
+	//! @return	式の末端
+	template<size_t M, size_t N, typename T>
+	constexpr ArcsMatrixExpr::Ref<M,N,T> lazy(const ArcsMat<M,N,T>& U){
+		return ArcsMatrixExpr::Ref<M,N,T>(U);
+	}
+}
+}
+
+#endif
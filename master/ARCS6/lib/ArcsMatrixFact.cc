@@ -0,0 +1,14 @@
+//! @file ArcsMatrixFact.cc
+//! @brief ARCS-Matrix 行列分解オブジェクト
+//!
+//! LU分解・QR分解・コレスキー分解の結果を保持して，同じ係数行列で繰り返し O(n^2) で解く。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "ArcsMatrixFact.hh"
+
+// テンプレートクラスのため，実体もヘッダ側に実装。
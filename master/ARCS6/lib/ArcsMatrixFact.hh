@@ -0,0 +1,623 @@
+//! @file ArcsMatrixFact.hh
+//! @brief ARCS-Matrix 行列分解オブジェクト
+//!
+//! ArcsMat::linsolve() や inv() は呼び出す毎に係数行列を O(n^3) で分解し直すが，
+//! 同じ係数行列で繰り返し解く場合(オブザーバゲインの更新，ゆっくり変化する慣性行列の逆動力学など)は，
+//! 分解結果を保持しておけば2回目以降は前進代入と後退代入だけの O(n^2) で解ける。
+//! ここでは分解結果を保持するクラスとして LUfact，QRfact，Cholfact を定義する。
+//! また，係数行列が少しずつ変化する場合のために，分解し直さずに O(n^2) で分解結果を修正するランク1更新も備える。
+//!
+//! 使用例：
+//! 	LUfact<N> dA(A);		// ここで1回だけ O(n^3) で分解
+//! 	x1 = dA.Solve(b1);		// 以降は O(n^2)
+//! 	x2 = dA.Solve(b2);
+//! 	dA.Update(u, v);		// A ← A + u*v' に対応する分解結果へ O(n^2) で修正
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef ARCSMATRIXFACT
+#define ARCSMATRIXFACT
+
+#include <cstddef>
+#include <cmath>
+#include <complex>
+#include <array>
+#include "ArcsMatrix.hh"
+
+// ARCS名前空間
+namespace ARCS {
+
+// ArcsMatrix行列分解の内部用関数定義
+namespace ArcsMatrixFact {
+	//! @brief スカラーの複素共役を返す関数 (実数の場合はそのまま返す)
+	//! @param[in]	u	入力
+	//! @return	複素共役
+	template<typename T>
+	constexpr T Conj(const T u){
+		if constexpr(ArcsMatrix::IsComplex<T>){
+			return std::conj(u);
+		}else{
+			return u;
+		}
+	}
+
+	//! @brief スカラーの絶対値の2乗を返す関数
+	//! @param[in]	u	入力
+	//! @return	絶対値の2乗
+	template<typename T>
+	constexpr double Abs2(const T u){
+		if constexpr(ArcsMatrix::IsComplex<T>){
+			return std::norm(u);
+		}else{
+			return static_cast<double>(u*u);
+		}
+	}
+
+	//! @brief G = [c s; -conj(s) c] として G*[a; b] = [r; 0] となるギブンス回転を求める関数
+	//! @param[in]	a, b	回転対象の2要素
+	//! @param[out]	c	回転の余弦 (実数)
+	//! @param[out]	s	回転の正弦
+	//! @return	回転後の1要素目 r
+	template<typename T>
+	constexpr T Givens(const T a, const T b, double& c, T& s){
+		const double aa = std::sqrt(Abs2(a));
+		if(aa == 0){
+			c = 0;
+			s = 1;
+			return b;
+		}
+		const double rho = std::sqrt(Abs2(a) + Abs2(b));
+		const T phase = a/aa;
+		c = aa/rho;
+		s = phase*Conj(b)/rho;
+		return phase*rho;
+	}
+}
+
+// ArcsMatrix行列分解クラス定義
+namespace ArcsMatrix {
+	//! @brief 部分ピボット選択付きLU分解の保持クラス PA = LU
+	//! @tparam	N	係数行列の大きさ (正方行列)
+	//! @tparam	T	要素の型
+	template<size_t N, typename T = double>
+	class LUfact {
+		public:
+			static constexpr double GROWTH_MAX = 1e2;	//!< ランク1更新後のLの要素の絶対値がこれを超えたら分解し直す
+
+			//! @brief 空コンストラクタ (Factorize() を呼ぶまで特異行列として扱う)
+			constexpr LUfact(void) noexcept
+				: A(), LU(), Perm(), PermCount(0)
+			{
+				static_assert(ArcsMatrix::IsApplicable<T>, "ArcsMat: Type Error");	// 対応可能型チェック
+				for(size_t i = 0; i < N; ++i) Perm[i] = i + 1;
+			}
+
+			//! @brief コンストラクタ
+			//! @param[in]	Ain	係数行列
+			constexpr explicit LUfact(const ArcsMat<N,N,T>& Ain) noexcept
+				: A(Ain), LU(), Perm(), PermCount(0)
+			{
+				static_assert(ArcsMatrix::IsApplicable<T>, "ArcsMat: Type Error");	// 対応可能型チェック
+				Decompose();
+			}
+
+			//! @brief 係数行列を設定してLU分解する関数 O(n^3)
+			//! @param[in]	Ain	係数行列
+			constexpr void Factorize(const ArcsMat<N,N,T>& Ain){
+				A = Ain;
+				Decompose();
+			}
+
+			//! @brief AX = B を X について解く関数(引数渡し版) O(n^2)
+			//! @tparam	NB	B, X の幅
+			//! @param[in]	B	右辺
+			//! @param[out]	X	解
+			template<size_t NB>
+			constexpr void Solve(const ArcsMat<N,NB,T>& B, ArcsMat<N,NB,T>& X) const{
+				for(size_t j = 1; j <= NB; ++j){
+					// 行を入れ替えながらコピー (c = Pb)
+					for(size_t i = 1; i <= N; ++i) X(i,j) = B(Perm[i-1],j);
+
+					// Ld = c の前進代入 (Lの対角は1, 列方向に連続アクセス)
+					for(size_t k = 1; k < N; ++k){
+						const T d = X(k,j);
+						for(size_t i = k + 1; i <= N; ++i) X(i,j) -= LU(i,k)*d;
+					}
+
+					// Ux = d の後退代入 (列方向に連続アクセス)
+					for(size_t k = N; 0 < k; --k){
+						X(k,j) /= LU(k,k);
+						const T x = X(k,j);
+						for(size_t i = 1; i < k; ++i) X(i,j) -= LU(i,k)*x;
+					}
+				}
+			}
+
+			//! @brief AX = B を X について解く関数(戻り値返し版) O(n^2)
+			//! @tparam	NB	B の幅
+			//! @param[in]	B	右辺
+			//! @return	解
+			template<size_t NB>
+			constexpr ArcsMat<N,NB,T> Solve(const ArcsMat<N,NB,T>& B) const{
+				ArcsMat<N,NB,T> X;
+				Solve(B, X);
+				return X;
+			}
+
+			//! @brief 係数行列を A ← A + u*v' とランク1更新して，LU分解の結果も O(n^2) で修正する関数
+			//!        (Bennettの方法。u の符号を反転すればダウンデートになる)
+			//!        ピボット選択をしない修正なので，Lの要素が GROWTH_MAX を超えるか対角要素が零になった場合は分解し直す。
+			//! @param[in]	u, v	更新ベクトル
+			constexpr void Update(const ArcsMat<N,1,T>& u, const ArcsMat<N,1,T>& v){
+				// 元の係数行列も更新しておく (分解し直すとき用)
+				for(size_t j = 1; j <= N; ++j){
+					const T vj = ArcsMatrixFact::Conj(v[j]);
+					for(size_t i = 1; i <= N; ++i) A(i,j) += u[i]*vj;
+				}
+
+				// PA + (Pu)v' = LU + xy^T として，対角から順に L と U を修正する
+				ArcsMat<N,1,T> x, y;
+				for(size_t i = 1; i <= N; ++i){
+					x[i] = u[Perm[i-1]];
+					y[i] = ArcsMatrixFact::Conj(v[i]);
+				}
+				for(size_t k = 1; k <= N; ++k){
+					const T alpha = LU(k,k);
+					const T beta = alpha + x[k]*y[k];
+					if(beta == static_cast<T>(0)){
+						Decompose();	// 修正後の対角要素が零になる場合は分解し直す
+						return;
+					}
+					LU(k,k) = beta;
+					for(size_t j = k + 1; j <= N; ++j){
+						const T ukj = LU(k,j);
+						LU(k,j) = ukj + x[k]*y[j];
+						y[j] = (alpha*y[j] - y[k]*ukj)/beta;
+					}
+					for(size_t i = k + 1; i <= N; ++i){
+						const T lik = LU(i,k);
+						LU(i,k) = (alpha*lik + y[k]*x[i])/beta;
+						x[i] -= x[k]*lik;
+						if(GROWTH_MAX < std::abs(LU(i,k))){
+							Decompose();	// 要素が大きくなりすぎたら部分ピボット選択付きで分解し直す
+							return;
+						}
+					}
+				}
+			}
+
+			//! @brief 行列式の値を返す関数 O(n)
+			//! @return	行列式
+			constexpr T GetDeterminant(void) const{
+				T ret = PermCount % 2 == 0 ? 1 : -1;	// 行の入れ替えが奇数回なら符号を反転
+				for(size_t k = 1; k <= N; ++k) ret *= LU(k,k);
+				return ret;
+			}
+
+			//! @brief 逆行列を返す関数 O(n^3)
+			//! @return	逆行列
+			constexpr ArcsMat<N,N,T> GetInverse(void) const{
+				return Solve(ArcsMat<N,N,T>::eye());
+			}
+
+			//! @brief LU分解の結果を返す関数 (MATLABの [L,U,P] = lu(A) と同じ)
+			//! @param[out]	L	下三角行列 (対角が1)
+			//! @param[out]	U	上三角行列
+			//! @param[out]	P	置換行列
+			constexpr void GetFactors(ArcsMat<N,N,T>& L, ArcsMat<N,N,T>& U, ArcsMat<N,N,T>& P) const{
+				L.FillAllZero();
+				U.FillAllZero();
+				P.FillAllZero();
+				for(size_t j = 1; j <= N; ++j){
+					for(size_t i = 1; i <= j; ++i) U(i,j) = LU(i,j);
+					for(size_t i = j + 1; i <= N; ++i) L(i,j) = LU(i,j);
+					L(j,j) = 1;
+					P(j,Perm[j-1]) = 1;
+				}
+			}
+
+			//! @brief 分解した係数行列を返す関数 (ランク1更新も反映済み)
+			//! @return	係数行列
+			constexpr const ArcsMat<N,N,T>& GetMatrix(void) const{
+				return A;
+			}
+
+			//! @brief 係数行列が特異かどうかを返す関数
+			//! @return	true = 特異 (Uの対角要素に零がある)
+			constexpr bool IsSingular(void) const{
+				for(size_t k = 1; k <= N; ++k){
+					if(LU(k,k) == static_cast<T>(0)) return true;
+				}
+				return false;
+			}
+
+		private:
+			//! @brief 保持している係数行列 A を部分ピボット選択付きでLU分解する関数 (列優先のright-looking版)
+			constexpr void Decompose(void){
+				LU = A;
+				PermCount = 0;
+				for(size_t i = 0; i < N; ++i) Perm[i] = i + 1;
+				for(size_t k = 1; k <= N; ++k){
+					// k列目の対角以下で絶対値が最大の行を探す
+					size_t p = k;
+					double pmax = std::abs(LU(k,k));
+					for(size_t i = k + 1; i <= N; ++i){
+						if(pmax < std::abs(LU(i,k))){
+							p = i;
+							pmax = std::abs(LU(i,k));
+						}
+					}
+
+					// 対角要素が最大となるように行丸ごと入れ替え
+					if(p != k){
+						for(size_t j = 1; j <= N; ++j){
+							const T buff = LU(k,j);
+							LU(k,j) = LU(p,j);
+							LU(p,j) = buff;
+						}
+						const size_t pbuff = Perm[k-1];
+						Perm[k-1] = Perm[p-1];
+						Perm[p-1] = pbuff;
+						++PermCount;
+					}
+					if(pmax == 0) continue;	// 列がすべて零なら，k列目においてはLU分解は完了
+
+					// Lのk列目を求めて，右下の部分行列から引く
+					for(size_t i = k + 1; i <= N; ++i) LU(i,k) /= LU(k,k);
+					for(size_t j = k + 1; j <= N; ++j){
+						const T ukj = LU(k,j);
+						for(size_t i = k + 1; i <= N; ++i) LU(i,j) -= LU(i,k)*ukj;
+					}
+				}
+			}
+
+			ArcsMat<N,N,T> A;			//!< 係数行列 (分解し直すとき用)
+			ArcsMat<N,N,T> LU;			//!< LU分解の結果 (対角より下がL，対角以上がU)
+			std::array<size_t,N> Perm;	//!< 行の置換 (PAのi行目 = Aの Perm[i-1] 行目)
+			size_t PermCount;			//!< 行の入れ替え回数
+	};
+
+	//! @brief Householder法によるQR分解の保持クラス A = QR (正方行列・縦長行列用)
+	//! @tparam	M, N	係数行列の高さ, 幅 (N ≦ M)
+	//! @tparam	T	要素の型
+	template<size_t M, size_t N, typename T = double>
+	class QRfact {
+		public:
+			//! @brief 空コンストラクタ
+			constexpr QRfact(void) noexcept
+				: Q(), R()
+			{
+				static_assert(N <= M, "ArcsMat: Size Error");	// 正方行列・縦長行列チェック
+				static_assert(ArcsMatrix::IsApplicable<T>, "ArcsMat: Type Error");	// 対応可能型チェック
+			}
+
+			//! @brief コンストラクタ
+			//! @param[in]	A	係数行列
+			constexpr explicit QRfact(const ArcsMat<M,N,T>& A) noexcept
+				: Q(), R()
+			{
+				static_assert(N <= M, "ArcsMat: Size Error");	// 正方行列・縦長行列チェック
+				static_assert(ArcsMatrix::IsApplicable<T>, "ArcsMat: Type Error");	// 対応可能型チェック
+				Factorize(A);
+			}
+
+			//! @brief 係数行列を設定してQR分解する関数 O(m^2 n)
+			//!        密なハウスホルダー行列は作らずに，反射をRとQに直接作用させる。
+			//! @param[in]	A	係数行列
+			constexpr void Factorize(const ArcsMat<M,N,T>& A){
+				Q = ArcsMat<M,M,T>::eye();
+				R = A;
+				ArcsMat<M,1,T> v;
+				for(size_t k = 1; k <= std::min(M - 1, N); ++k){
+					// k列目の対角以下を零にする反射ベクトル v を求める
+					double xnorm2 = 0;
+					for(size_t i = k; i <= M; ++i) xnorm2 += ArcsMatrixFact::Abs2(R(i,k));
+					if(xnorm2 == 0) continue;
+					const double xnorm = std::sqrt(xnorm2);
+					T alpha = -xnorm;
+					if constexpr(ArcsMatrix::IsComplex<T>){
+						if(std::abs(R(k,k)) != 0) alpha = -R(k,k)/std::abs(R(k,k))*xnorm;
+					}else{
+						if(R(k,k) < 0) alpha = xnorm;
+					}
+					for(size_t i = k; i <= M; ++i) v[i] = R(i,k);
+					v[k] -= alpha;
+					const double vnorm2 = xnorm2 - 2.0*std::real(ArcsMatrixFact::Conj(alpha)*R(k,k)) + xnorm2;
+					if(vnorm2 == 0) continue;
+
+					// R ← (I - 2vv'/v'v) R
+					R(k,k) = alpha;
+					for(size_t i = k + 1; i <= M; ++i) R(i,k) = 0;
+					for(size_t j = k + 1; j <= N; ++j){
+						T w = 0;
+						for(size_t i = k; i <= M; ++i) w += ArcsMatrixFact::Conj(v[i])*R(i,j);
+						w *= 2.0/vnorm2;
+						for(size_t i = k; i <= M; ++i) R(i,j) -= v[i]*w;
+					}
+
+					// Q ← Q (I - 2vv'/v'v)
+					for(size_t i = 1; i <= M; ++i){
+						T w = 0;
+						for(size_t l = k; l <= M; ++l) w += Q(i,l)*v[l];
+						w *= 2.0/vnorm2;
+						for(size_t l = k; l <= M; ++l) Q(i,l) -= w*ArcsMatrixFact::Conj(v[l]);
+					}
+				}
+			}
+
+			//! @brief AX = B を X について解く関数(引数渡し版) O(mn)
+			//!        縦長行列の場合は最小二乗解となる。
+			//! @tparam	NB	B, X の幅
+			//! @param[in]	B	右辺
+			//! @param[out]	X	解
+			template<size_t NB>
+			constexpr void Solve(const ArcsMat<M,NB,T>& B, ArcsMat<N,NB,T>& X) const{
+				for(size_t j = 1; j <= NB; ++j){
+					// d = Q'b の上からN行分のみを計算 (Qの列方向に連続アクセス)
+					for(size_t k = 1; k <= N; ++k){
+						T d = 0;
+						for(size_t i = 1; i <= M; ++i) d += ArcsMatrixFact::Conj(Q(i,k))*B(i,j);
+						X(k,j) = d;
+					}
+
+					// Rx = d の後退代入
+					for(size_t k = N; 0 < k; --k){
+						X(k,j) /= R(k,k);
+						const T x = X(k,j);
+						for(size_t i = 1; i < k; ++i) X(i,j) -= R(i,k)*x;
+					}
+				}
+			}
+
+			//! @brief AX = B を X について解く関数(戻り値返し版) O(mn)
+			//! @tparam	NB	B の幅
+			//! @param[in]	B	右辺
+			//! @return	解
+			template<size_t NB>
+			constexpr ArcsMat<N,NB,T> Solve(const ArcsMat<M,NB,T>& B) const{
+				ArcsMat<N,NB,T> X;
+				Solve(B, X);
+				return X;
+			}
+
+			//! @brief 係数行列を A ← A + u*v' とランク1更新して，QR分解の結果もギブンス回転で O(m^2) で修正する関数
+			//!        (u の符号を反転すればダウンデートになる)
+			//! @param[in]	u	更新ベクトル (高さM)
+			//! @param[in]	v	更新ベクトル (高さN)
+			constexpr void Update(const ArcsMat<M,1,T>& u, const ArcsMat<N,1,T>& v){
+				// w = Q'u
+				ArcsMat<M,1,T> w;
+				for(size_t k = 1; k <= M; ++k){
+					T d = 0;
+					for(size_t i = 1; i <= M; ++i) d += ArcsMatrixFact::Conj(Q(i,k))*u[i];
+					w[k] = d;
+				}
+
+				// 下から順に w を零にして w = [r 0 ... 0]' にする (Rは上ヘッセンベルグ行列になる)
+				double c = 0;
+				T s = 0;
+				for(size_t k = M - 1; 0 < k; --k){
+					w[k] = ArcsMatrixFact::Givens(w[k], w[k+1], c, s);
+					w[k+1] = 0;
+					RotateRows(k, k, c, s);
+					RotateQ(k, c, s);
+				}
+
+				// R の1行目に r*v' を加える
+				for(size_t j = 1; j <= N; ++j) R(1,j) += w[1]*ArcsMatrixFact::Conj(v[j]);
+
+				// 上ヘッセンベルグ行列を上から順に上三角行列に戻す
+				for(size_t k = 1; k <= std::min(M - 1, N); ++k){
+					const T r = ArcsMatrixFact::Givens(R(k,k), R(k+1,k), c, s);
+					RotateRows(k, k + 1, c, s);
+					R(k,k) = r;
+					R(k+1,k) = 0;
+					RotateQ(k, c, s);
+				}
+			}
+
+			//! @brief ユニタリ行列 Q を返す関数
+			//! @return	Q (M×M)
+			constexpr const ArcsMat<M,M,T>& GetQ(void) const{
+				return Q;
+			}
+
+			//! @brief 上三角行列 R を返す関数
+			//! @return	R (M×N)
+			constexpr const ArcsMat<M,N,T>& GetR(void) const{
+				return R;
+			}
+
+		private:
+			//! @brief R の k行目と k+1行目に G = [c s; -conj(s) c] を左から掛ける関数
+			//! @param[in]	k	行番号
+			//! @param[in]	j1	開始列
+			//! @param[in]	c, s	ギブンス回転
+			constexpr void RotateRows(const size_t k, const size_t j1, const double c, const T s){
+				for(size_t j = j1; j <= N; ++j){
+					const T r1 = R(k,j), r2 = R(k+1,j);
+					R(k,j)   = c*r1 + s*r2;
+					R(k+1,j) = c*r2 - ArcsMatrixFact::Conj(s)*r1;
+				}
+			}
+
+			//! @brief Q の k列目と k+1列目に G' を右から掛ける関数
+			//! @param[in]	k	列番号
+			//! @param[in]	c, s	ギブンス回転
+			constexpr void RotateQ(const size_t k, const double c, const T s){
+				for(size_t i = 1; i <= M; ++i){
+					const T q1 = Q(i,k), q2 = Q(i,k+1);
+					Q(i,k)   = c*q1 + ArcsMatrixFact::Conj(s)*q2;
+					Q(i,k+1) = c*q2 - s*q1;
+				}
+			}
+
+			ArcsMat<M,M,T> Q;	//!< ユニタリ行列
+			ArcsMat<M,N,T> R;	//!< 上三角行列
+	};
+
+	//! @brief コレスキー分解の保持クラス A = R'R (エルミート正定値行列用, MATLABの chol と同じく R は上三角)
+	//! @tparam	N	係数行列の大きさ (正方行列)
+	//! @tparam	T	要素の型
+	template<size_t N, typename T = double>
+	class Cholfact {
+		public:
+			//! @brief 空コンストラクタ
+			constexpr Cholfact(void) noexcept
+				: R(), PosDef(false)
+			{
+				static_assert(ArcsMatrix::IsApplicable<T>, "ArcsMat: Type Error");	// 対応可能型チェック
+			}
+
+			//! @brief コンストラクタ
+			//! @param[in]	A	係数行列 (エルミート正定値行列，上三角部分のみ使用)
+			constexpr explicit Cholfact(const ArcsMat<N,N,T>& A) noexcept
+				: R(), PosDef(false)
+			{
+				static_assert(ArcsMatrix::IsApplicable<T>, "ArcsMat: Type Error");	// 対応可能型チェック
+				Factorize(A);
+			}
+
+			//! @brief 係数行列を設定してコレスキー分解する関数 O(n^3/3)
+			//! @param[in]	A	係数行列 (エルミート正定値行列，上三角部分のみ使用)
+			//! @return	true = 正定値で分解できた
+			constexpr bool Factorize(const ArcsMat<N,N,T>& A){
+				R.FillAllZero();
+				PosDef = false;
+				for(size_t j = 1; j <= N; ++j){
+					// j列目の非対角要素 (Rの列方向に連続アクセス)
+					for(size_t i = 1; i < j; ++i){
+						T buff = A(i,j);
+						for(size_t k = 1; k < i; ++k) buff -= ArcsMatrixFact::Conj(R(k,i))*R(k,j);
+						R(i,j) = buff/R(i,i);
+					}
+
+					// j列目の対角要素
+					double d = std::real(A(j,j));
+					for(size_t k = 1; k < j; ++k) d -= ArcsMatrixFact::Abs2(R(k,j));
+					if(d <= 0) return false;	// 正定値でない場合
+					R(j,j) = std::sqrt(d);
+				}
+				PosDef = true;
+				return true;
+			}
+
+			//! @brief AX = B を X について解く関数(引数渡し版) O(n^2)
+			//! @tparam	NB	B, X の幅
+			//! @param[in]	B	右辺
+			//! @param[out]	X	解
+			template<size_t NB>
+			constexpr void Solve(const ArcsMat<N,NB,T>& B, ArcsMat<N,NB,T>& X) const{
+				for(size_t j = 1; j <= NB; ++j){
+					// R'y = b の前進代入 (Rの列方向に連続アクセス)
+					for(size_t i = 1; i <= N; ++i){
+						T buff = B(i,j);
+						for(size_t k = 1; k < i; ++k) buff -= ArcsMatrixFact::Conj(R(k,i))*X(k,j);
+						X(i,j) = buff/R(i,i);
+					}
+
+					// Rx = y の後退代入
+					for(size_t k = N; 0 < k; --k){
+						X(k,j) /= R(k,k);
+						const T x = X(k,j);
+						for(size_t i = 1; i < k; ++i) X(i,j) -= R(i,k)*x;
+					}
+				}
+			}
+
+			//! @brief AX = B を X について解く関数(戻り値返し版) O(n^2)
+			//! @tparam	NB	B の幅
+			//! @param[in]	B	右辺
+			//! @return	解
+			template<size_t NB>
+			constexpr ArcsMat<N,NB,T> Solve(const ArcsMat<N,NB,T>& B) const{
+				ArcsMat<N,NB,T> X;
+				Solve(B, X);
+				return X;
+			}
+
+			//! @brief 係数行列を A ← A + x*x' とランク1更新して，コレスキー分解の結果も O(n^2) で修正する関数
+			//! @param[in]	x	更新ベクトル
+			constexpr void Update(const ArcsMat<N,1,T>& x){
+				ArcsMat<N,1,T> w = x;
+				for(size_t k = 1; k <= N; ++k){
+					const double rkk = std::real(R(k,k));
+					const double r = std::sqrt(rkk*rkk + ArcsMatrixFact::Abs2(w[k]));
+					const double c = r/rkk;
+					const T s = w[k]/rkk;
+					R(k,k) = r;
+					for(size_t i = k + 1; i <= N; ++i){
+						// L = R' の (i,k) 要素として回転する
+						const T lik = (ArcsMatrixFact::Conj(R(k,i)) + ArcsMatrixFact::Conj(s)*w[i])/c;
+						w[i] = c*w[i] - s*lik;
+						R(k,i) = ArcsMatrixFact::Conj(lik);
+					}
+				}
+			}
+
+			//! @brief 係数行列を A ← A - x*x' とランク1ダウンデートして，コレスキー分解の結果も O(n^2) で修正する関数
+			//!        ダウンデート後に正定値でなくなる場合は何もせずに false を返す。
+			//! @param[in]	x	更新ベクトル
+			//! @return	true = ダウンデートできた
+			constexpr bool Downdate(const ArcsMat<N,1,T>& x){
+				const ArcsMat<N,N,T> Rprev = R;	// 失敗したとき用
+				ArcsMat<N,1,T> w = x;
+				for(size_t k = 1; k <= N; ++k){
+					const double rkk = std::real(R(k,k));
+					const double r2 = rkk*rkk - ArcsMatrixFact::Abs2(w[k]);
+					if(r2 <= 0){
+						R = Rprev;	// 正定値でなくなる場合は元に戻す
+						return false;
+					}
+					const double r = std::sqrt(r2);
+					const double c = r/rkk;
+					const T s = w[k]/rkk;
+					R(k,k) = r;
+					for(size_t i = k + 1; i <= N; ++i){
+						// L = R' の (i,k) 要素として双曲線回転する
+						const T lik = (ArcsMatrixFact::Conj(R(k,i)) - ArcsMatrixFact::Conj(s)*w[i])/c;
+						w[i] = c*w[i] - s*lik;
+						R(k,i) = ArcsMatrixFact::Conj(lik);
+					}
+				}
+				return true;
+			}
+
+			//! @brief 行列式の値を返す関数 O(n)
+			//! @return	行列式 (正の実数)
+			constexpr double GetDeterminant(void) const{
+				double ret = 1;
+				for(size_t k = 1; k <= N; ++k) ret *= ArcsMatrixFact::Abs2(R(k,k));
+				return ret;
+			}
+
+			//! @brief 逆行列を返す関数 O(n^3)
+			//! @return	逆行列
+			constexpr ArcsMat<N,N,T> GetInverse(void) const{
+				return Solve(ArcsMat<N,N,T>::eye());
+			}
+
+			//! @brief 上三角行列 R を返す関数 (MATLABの R = chol(A) と同じ)
+			//! @return	R
+			constexpr const ArcsMat<N,N,T>& GetR(void) const{
+				return R;
+			}
+
+			//! @brief 係数行列が正定値で分解できたかどうかを返す関数
+			//! @return	true = 正定値
+			constexpr bool IsPositiveDefinite(void) const{
+				return PosDef;
+			}
+
+		private:
+			ArcsMat<N,N,T> R;	//!< 上三角行列
+			bool PosDef;		//!< 正定値フラグ
+	};
+}
+}
+
+#endif
@@ -0,0 +1,15 @@
+//! @file ArcsMatrixKernel.cc
+//! @brief ARCS-Matrix 小規模行列乗算カーネル
+//!
+//! 制御で頻出する小さいサイズ(2～16次程度)の行列＊行列/行列＊ベクトルを，
+//! SIMDレジスタにブロッキングして計算するカーネル群。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "ArcsMatrixKernel.hh"
+
+// テンプレート関数のため，実体もヘッダ側に実装。
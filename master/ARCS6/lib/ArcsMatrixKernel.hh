@@ -0,0 +1,353 @@
+//! @file ArcsMatrixKernel.hh
+//! @brief ARCS-Matrix 小規模行列乗算カーネル
+//!
+//! 制御で頻出する小さいサイズ(2～16次程度)の行列＊行列/行列＊ベクトルを，
+//! SIMDレジスタにブロッキングして計算するカーネル群。
+//! 列優先(縦方向に連続)のデータ配置を前提に，行方向をSIMDで並列化し，
+//! AVX-512 → AVX → SSE2/NEON → スカラー の順で使える一番広いレジスタから割り当てる。
+//!
+//! @par 厳密モードと高速モード
+//! - 厳密モード(デフォルト)では，各要素を i = 1, 2, ..., N の順に1本のアキュムレータで積算する。
+//!   積和はFMA命令があればFMA(丸め1回)，無ければ乗算→加算(丸め2回)で明示的に計算するので，コンパイラの最適化で
+//!   丸め方が変わることがなく，既定のコンパイルオプション(-ffp-contract=fast)でFMAに縮約される従来の3重ループと
+//!   ビット単位で同一の結果になる。
+//! - ARCSMAT_FAST_KERNEL を定義してコンパイルすると高速モードとなり，i の偶数番目と奇数番目を別々のアキュムレータで
+//!   積算して最後に足し合わせる。積和の依存関係の連鎖が半分になるので速くなるが，加算の順序が変わるため
+//!   結果は従来版と最下位ビットで異なることがある。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef ARCSMATRIXKERNEL
+#define ARCSMATRIXKERNEL
+
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__AVX__) || defined(__SSE2__)
+	#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	#include <arm_neon.h>
+#endif
+
+// ARCS名前空間
+namespace ARCS {
+
+// ArcsMatrix行列乗算カーネル定義
+namespace ArcsMatrixKernel {
+	#ifdef ARCSMAT_FAST_KERNEL
+		inline constexpr bool STRICT = false;	//!< 厳密モードフラグ (false = FMAによる高速モード)
+	#else
+		inline constexpr bool STRICT = true;	//!< 厳密モードフラグ (true = 従来版とビット単位で同一の結果)
+	#endif
+	inline constexpr size_t MAX_ROWS = 64;		//!< カーネルを使う行列の高さの上限(これを超える場合は従来のループ)
+	inline constexpr size_t MAX_BLOCKS = 4;		//!< 同時に保持するアキュムレータレジスタの数
+
+	//! @brief スカラー版(どのISAでも使用可能, 端数行の処理用)
+	struct SimdScalar {
+		using V = double;
+		static constexpr size_t W = 1;
+		static V Zero(void){ return 0; }
+		static V Set1(const double a){ return a; }
+		static V Load(const double* p){ return *p; }
+		static void Store(double* p, const V a){ *p = a; }
+		static V Add(const V a, const V b){ return a + b; }
+		static V MulAdd(const V acc, const V a, const V b){
+			#if defined(__FMA__) || defined(__ARM_FEATURE_FMA)
+				return __builtin_fma(a, b, acc);
+			#else
+				volatile V ab = a*b;	// 最適化で丸め方が変わらないように乗算結果を一旦丸める
+				return acc + ab;
+			#endif
+		}
+	};
+
+	#if defined(__SSE2__)
+	//! @brief SSE2版(2並列)
+	struct Simd128 {
+		using V = __m128d;
+		static constexpr size_t W = 2;
+		static V Zero(void){ return _mm_setzero_pd(); }
+		static V Set1(const double a){ return _mm_set1_pd(a); }
+		static V Load(const double* p){ return _mm_loadu_pd(p); }
+		static void Store(double* p, const V a){ _mm_storeu_pd(p, a); }
+		static V Add(const V a, const V b){ return _mm_add_pd(a, b); }
+		static V MulAdd(const V acc, const V a, const V b){
+			#ifdef __FMA__
+				return _mm_fmadd_pd(a, b, acc);
+			#else
+				return _mm_add_pd(acc, _mm_mul_pd(a, b));
+			#endif
+		}
+	};
+	#elif defined(__ARM_NEON) && defined(__aarch64__)
+	//! @brief NEON版(2並列)
+	struct Simd128 {
+		using V = float64x2_t;
+		static constexpr size_t W = 2;
+		static V Zero(void){ return vdupq_n_f64(0); }
+		static V Set1(const double a){ return vdupq_n_f64(a); }
+		static V Load(const double* p){ return vld1q_f64(p); }
+		static void Store(double* p, const V a){ vst1q_f64(p, a); }
+		static V Add(const V a, const V b){ return vaddq_f64(a, b); }
+		static V MulAdd(const V acc, const V a, const V b){ return vfmaq_f64(acc, a, b); }
+	};
+	#endif
+
+	#if defined(__AVX__)
+	//! @brief AVX/AVX2版(4並列)
+	struct Simd256 {
+		using V = __m256d;
+		static constexpr size_t W = 4;
+		static V Zero(void){ return _mm256_setzero_pd(); }
+		static V Set1(const double a){ return _mm256_set1_pd(a); }
+		static V Load(const double* p){ return _mm256_loadu_pd(p); }
+		static void Store(double* p, const V a){ _mm256_storeu_pd(p, a); }
+		static V Add(const V a, const V b){ return _mm256_add_pd(a, b); }
+		static V MulAdd(const V acc, const V a, const V b){
+			#ifdef __FMA__
+				return _mm256_fmadd_pd(a, b, acc);
+			#else
+				return _mm256_add_pd(acc, _mm256_mul_pd(a, b));
+			#endif
+		}
+	};
+	#endif
+
+	#if defined(__AVX512F__)
+	//! @brief AVX-512版(8並列)
+	struct Simd512 {
+		using V = __m512d;
+		static constexpr size_t W = 8;
+		static V Zero(void){ return _mm512_setzero_pd(); }
+		static V Set1(const double a){ return _mm512_set1_pd(a); }
+		static V Load(const double* p){ return _mm512_loadu_pd(p); }
+		static void Store(double* p, const V a){ _mm512_storeu_pd(p, a); }
+		static V Add(const V a, const V b){ return _mm512_add_pd(a, b); }
+		static V MulAdd(const V acc, const V a, const V b){ return _mm512_fmadd_pd(a, b, acc); }
+	};
+	#endif
+
+	#if defined(__AVX512F__)
+		using SimdMax = Simd512;	//!< 使える一番広いSIMD型
+	#elif defined(__AVX__)
+		using SimdMax = Simd256;	//!< 使える一番広いSIMD型
+	#elif defined(__SSE2__) || (defined(__ARM_NEON) && defined(__aarch64__))
+		using SimdMax = Simd128;	//!< 使える一番広いSIMD型
+	#else
+		using SimdMax = SimdScalar;	//!< 使える一番広いSIMD型
+	#endif
+
+	//! @brief 単精度スカラー版(どのISAでも使用可能)
+	struct SimdScalarF {
+		using V = float;
+		static constexpr size_t W = 1;
+		static V Zero(void){ return 0; }
+		static V Set1(const float a){ return a; }
+		static V Load(const float* p){ return *p; }
+		static void Store(float* p, const V a){ *p = a; }
+		static V Add(const V a, const V b){ return a + b; }
+		static V MulAdd(const V acc, const V a, const V b){
+			#if defined(__FMA__) || defined(__ARM_FEATURE_FMA)
+				return __builtin_fmaf(a, b, acc);
+			#else
+				volatile V ab = a*b;	// 最適化で丸め方が変わらないように乗算結果を一旦丸める
+				return acc + ab;
+			#endif
+		}
+	};
+
+	#if defined(__SSE2__)
+	//! @brief 単精度SSE版(4並列)
+	struct Simd128F {
+		using V = __m128;
+		static constexpr size_t W = 4;
+		static V Zero(void){ return _mm_setzero_ps(); }
+		static V Set1(const float a){ return _mm_set1_ps(a); }
+		static V Load(const float* p){ return _mm_loadu_ps(p); }
+		static void Store(float* p, const V a){ _mm_storeu_ps(p, a); }
+		static V Add(const V a, const V b){ return _mm_add_ps(a, b); }
+		static V MulAdd(const V acc, const V a, const V b){
+			#ifdef __FMA__
+				return _mm_fmadd_ps(a, b, acc);
+			#else
+				return _mm_add_ps(acc, _mm_mul_ps(a, b));
+			#endif
+		}
+	};
+	#elif defined(__ARM_NEON) && defined(__aarch64__)
+	//! @brief 単精度NEON版(4並列)
+	struct Simd128F {
+		using V = float32x4_t;
+		static constexpr size_t W = 4;
+		static V Zero(void){ return vdupq_n_f32(0); }
+		static V Set1(const float a){ return vdupq_n_f32(a); }
+		static V Load(const float* p){ return vld1q_f32(p); }
+		static void Store(float* p, const V a){ vst1q_f32(p, a); }
+		static V Add(const V a, const V b){ return vaddq_f32(a, b); }
+		static V MulAdd(const V acc, const V a, const V b){ return vfmaq_f32(acc, a, b); }
+	};
+	#endif
+
+	#if defined(__AVX__)
+	//! @brief 単精度AVX/AVX2版(8並列)
+	struct Simd256F {
+		using V = __m256;
+		static constexpr size_t W = 8;
+		static V Zero(void){ return _mm256_setzero_ps(); }
+		static V Set1(const float a){ return _mm256_set1_ps(a); }
+		static V Load(const float* p){ return _mm256_loadu_ps(p); }
+		static void Store(float* p, const V a){ _mm256_storeu_ps(p, a); }
+		static V Add(const V a, const V b){ return _mm256_add_ps(a, b); }
+		static V MulAdd(const V acc, const V a, const V b){
+			#ifdef __FMA__
+				return _mm256_fmadd_ps(a, b, acc);
+			#else
+				return _mm256_add_ps(acc, _mm256_mul_ps(a, b));
+			#endif
+		}
+	};
+	#endif
+
+	#if defined(__AVX512F__)
+	//! @brief 単精度AVX-512版(16並列)
+	struct Simd512F {
+		using V = __m512;
+		static constexpr size_t W = 16;
+		static V Zero(void){ return _mm512_setzero_ps(); }
+		static V Set1(const float a){ return _mm512_set1_ps(a); }
+		static V Load(const float* p){ return _mm512_loadu_ps(p); }
+		static void Store(float* p, const V a){ _mm512_storeu_ps(p, a); }
+		static V Add(const V a, const V b){ return _mm512_add_ps(a, b); }
+		static V MulAdd(const V acc, const V a, const V b){ return _mm512_fmadd_ps(a, b, acc); }
+	};
+	#endif
+
+	#if defined(__AVX512F__)
+		using SimdMaxF = Simd512F;	//!< 使える一番広い単精度SIMD型
+	#elif defined(__AVX__)
+		using SimdMaxF = Simd256F;	//!< 使える一番広い単精度SIMD型
+	#elif defined(__SSE2__) || (defined(__ARM_NEON) && defined(__aarch64__))
+		using SimdMaxF = Simd128F;	//!< 使える一番広い単精度SIMD型
+	#else
+		using SimdMaxF = SimdScalarF;	//!< 使える一番広い単精度SIMD型
+	#endif
+
+	//! @brief 候補 Sm, Sn... の中から幅が L 以下で一番広いSIMD型を選ぶテンプレート (候補は広い順, 最後の候補は必ず選べる)
+	template<size_t L, typename Sm, typename... Sn>
+	struct SimdFitImpl {
+		using type = Sm;
+	};
+	template<size_t L, typename Sm, typename Sn0, typename... Sn>
+	struct SimdFitImpl<L, Sm, Sn0, Sn...> {
+		using type = std::conditional_t<Sm::W <= L, Sm, typename SimdFitImpl<L, Sn0, Sn...>::type>;
+	};
+
+	//! @brief 要素数 L 以下の幅で一番広いSIMD型 (L要素の配列を1本ずつ処理するときに余りのレーンを減らすため)
+	//! @tparam	T	データ型 (float か double)
+	//! @tparam	L	要素数
+	template<typename T, size_t L>
+	using SimdFit = typename std::conditional_t<std::is_same_v<T, float>,
+	#if defined(__AVX512F__)
+		SimdFitImpl<L, Simd512F, Simd256F, Simd128F, SimdScalarF>, SimdFitImpl<L, Simd512, Simd256, Simd128, SimdScalar>
+	#elif defined(__AVX__)
+		SimdFitImpl<L, Simd256F, Simd128F, SimdScalarF>, SimdFitImpl<L, Simd256, Simd128, SimdScalar>
+	#elif defined(__SSE2__) || (defined(__ARM_NEON) && defined(__aarch64__))
+		SimdFitImpl<L, Simd128F, SimdScalarF>, SimdFitImpl<L, Simd128, SimdScalar>
+	#else
+		SimdFitImpl<L, SimdScalarF>, SimdFitImpl<L, SimdScalar>
+	#endif
+	>::type;
+
+	//! @brief 結果の1列のうち，行 R0 から B*W 行分をレジスタB本にブロッキングして計算する関数
+	//! @tparam	Sm	SIMD型, B ブロック数, M, N 左側行列の高さと幅, S 厳密モードフラグ
+	//! @param[in]	A	左側行列の先頭ポインタ(列優先)
+	//! @param[in]	b	右側行列の該当列の先頭ポインタ
+	//! @param[out]	y	結果の該当列の先頭ポインタ
+	//! @param[in]	R0	開始行(0始まり)
+	template<typename Sm, size_t B, size_t M, size_t N, bool S>
+	inline void ColumnBlock(const double* A, const double* b, double* y, const size_t R0){
+		typename Sm::V acc[B];
+		for(size_t r = 0; r < B; ++r) acc[r] = Sm::Zero();
+		if constexpr(S){
+			// 厳密モード：従来の3重ループと同じ順序で積算
+			#pragma GCC unroll 16
+			for(size_t i = 0; i < N; ++i){
+				const typename Sm::V bi = Sm::Set1(b[i]);	// 右側の要素をブロードキャストして，
+				for(size_t r = 0; r < B; ++r){
+					acc[r] = Sm::MulAdd(acc[r], Sm::Load(A + i*M + R0 + r*Sm::W), bi);	// 左側の列と掛けて積算
+				}
+			}
+		}else{
+			// 高速モード：偶数番目と奇数番目を別々に積算して依存関係の連鎖を短くする
+			typename Sm::V acc2[B];
+			for(size_t r = 0; r < B; ++r) acc2[r] = Sm::Zero();
+			#pragma GCC unroll 8
+			for(size_t i = 0; i + 1 < N; i += 2){
+				const typename Sm::V bi1 = Sm::Set1(b[i]);
+				const typename Sm::V bi2 = Sm::Set1(b[i + 1]);
+				for(size_t r = 0; r < B; ++r){
+					acc[r]  = Sm::MulAdd(acc[r],  Sm::Load(A + i*M + R0 + r*Sm::W), bi1);
+					acc2[r] = Sm::MulAdd(acc2[r], Sm::Load(A + (i + 1)*M + R0 + r*Sm::W), bi2);
+				}
+			}
+			if constexpr(N % 2 == 1){
+				const typename Sm::V bi = Sm::Set1(b[N - 1]);	// 端数列
+				for(size_t r = 0; r < B; ++r) acc[r] = Sm::MulAdd(acc[r], Sm::Load(A + (N - 1)*M + R0 + r*Sm::W), bi);
+			}
+			for(size_t r = 0; r < B; ++r) acc[r] = Sm::Add(acc[r], acc2[r]);
+		}
+		for(size_t r = 0; r < B; ++r) Sm::Store(y + R0 + r*Sm::W, acc[r]);
+	}
+
+	//! @brief 結果の1列のうち，行 R0 以降を広いSIMD型から順に割り当てて計算する関数
+	//! @tparam	M, N 左側行列の高さと幅, R0 開始行, S 厳密モードフラグ, Sm 今回のSIMD型, Sn 残りの(より狭い)SIMD型
+	//! @param[in]	A	左側行列の先頭ポインタ(列優先)
+	//! @param[in]	b	右側行列の該当列の先頭ポインタ
+	//! @param[out]	y	結果の該当列の先頭ポインタ
+	template<size_t M, size_t N, size_t R0, bool S, typename Sm, typename... Sn>
+	inline void ColumnRows(const double* A, const double* b, double* y){
+		if constexpr(R0 < M){
+			constexpr size_t NB = (M - R0)/Sm::W;	// このSIMD型で埋められるレジスタ数
+			if constexpr(0 < NB){
+				constexpr size_t B = NB < MAX_BLOCKS ? NB : MAX_BLOCKS;
+				ColumnBlock<Sm, B, M, N, S>(A, b, y, R0);
+				ColumnRows<M, N, R0 + B*Sm::W, S, Sm, Sn...>(A, b, y);	// 同じSIMD型で続きを計算
+			}else if constexpr(0 < sizeof...(Sn)){
+				ColumnRows<M, N, R0, S, Sn...>(A, b, y);	// 端数行は狭いSIMD型で計算
+			}
+		}
+	}
+
+	//! @brief 行列乗算カーネル C = A*B (すべて列優先, double型)
+	//! @tparam	M, N, Q	左側行列の高さ, 左側行列の幅(=右側行列の高さ), 右側行列の幅, S 厳密モードフラグ
+	//! @param[in]	A	左側行列 (M×N) の先頭ポインタ
+	//! @param[in]	B	右側行列 (N×Q) の先頭ポインタ
+	//! @param[out]	C	結果 (M×Q) の先頭ポインタ
+	template<size_t M, size_t N, size_t Q, bool S = STRICT>
+	inline void Multiply(const double* A, const double* B, double* C){
+		for(size_t k = 0; k < Q; ++k){
+			#if defined(__AVX512F__)
+				ColumnRows<M, N, 0, S, Simd512, Simd256, Simd128, SimdScalar>(A, B + k*N, C + k*M);
+			#elif defined(__AVX__)
+				ColumnRows<M, N, 0, S, Simd256, Simd128, SimdScalar>(A, B + k*N, C + k*M);
+			#elif defined(__SSE2__) || (defined(__ARM_NEON) && defined(__aarch64__))
+				ColumnRows<M, N, 0, S, Simd128, SimdScalar>(A, B + k*N, C + k*M);
+			#else
+				ColumnRows<M, N, 0, S, SimdScalar>(A, B + k*N, C + k*M);
+			#endif
+		}
+	}
+
+	//! @brief カーネルを使うかどうかの判定
+	//! @tparam	M	左側行列の高さ, T, R 左側と右側の要素の型
+	template<size_t M, typename T, typename R>
+	inline constexpr bool IsKernelApplicable = std::is_same_v<T, double> && std::is_same_v<R, double> && 2 <= M && M <= MAX_ROWS;
+}
+}
+
+#endif
+
@@ -0,0 +1,14 @@
+//! @file ArcsMatrixLarge.cc
+//! @brief ARCS-Matrix 大規模行列クラス
+//!
+//! 要素をヒープ上に確保し，キャッシュブロッキングとスレッドプールによる並列化で大きな行列を計算する。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "ArcsMatrixLarge.hh"
+
+// テンプレートクラスのため，実体もヘッダ側に実装。
@@ -0,0 +1,885 @@
+//! @file ArcsMatrixLarge.hh
+//! @brief ARCS-Matrix 大規模行列クラス
+//!
+//! ArcsMat は要素を std::array で自動変数領域に確保するので，数百要素を超えるような行列
+//! (ニューラルネットの重み行列，データセット，LyapunovKron のクロネッカー積の係数行列など)では
+//! スタックが溢れる恐れがあり，単純な3重ループの演算ではキャッシュにも載らない。
+//! ここでは，要素をヒープ上の64バイト境界(キャッシュライン)に列優先で確保する ArcsLargeMat を定義し，
+//! キャッシュブロッキングした行列積・転置・LU分解・コレスキー分解を備える。
+//! さらに，ArcsMatrixLarge::SetThreadPool() でスレッドプールを設定すると，大きな演算は並列に計算する。
+//! (デフォルトは単一スレッドなので，ヘッダを読み込んだだけでは制御用スレッドの動作は何も変わらない)
+//!
+//! ArcsMat と同じ列優先の配置なので，ArcsMat との相互変換はメモリの一括コピーのみで済む。
+//! ただし，加算の順序が ArcsMat の演算とは異なるので，結果は最下位ビットで一致しないことがある。
+//! また，要素をヒープに確保するので constexpr には対応していない。オフライン計算や学習用である。
+//!
+//! 使用例：
+//! 	ThreadPool Pool(4);
+//! 	ArcsMatrixLarge::SetThreadPool(&Pool);	// 並列計算を有効化 (省略すると単一スレッド)
+//! 	ArcsLargeMat<512,512> A, B;
+//! 	ArcsLargeMat<512,512> C = A*B;
+//! 	ArcsLargeMat<512,1> x = linsolve(A, b);
+//! 	ArcsMat<4,4> Asmall = Clarge.ToArcsMat();	// 小さい行列は ArcsMat との間で相互変換可能
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef ARCSMATRIXLARGE
+#define ARCSMATRIXLARGE
+
+#include <cstddef>
+#include <cstdio>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <new>
+#include <algorithm>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include "ArcsMatrix.hh"
+#include "ArcsMatrixKernel.hh"
+#include "ThreadPool.hh"
+
+// ARCS名前空間
+namespace ARCS {
+
+// ArcsMatrix大規模行列の内部用関数定義
+namespace ArcsMatrixLarge {
+	inline constexpr size_t ALIGNMENT = 64;				//!< [byte] 要素の先頭アドレスのアライメント(キャッシュライン)
+	inline constexpr size_t BLOCK_M = 128;				//!< 行列積のキャッシュブロッキングの行数
+	inline constexpr size_t BLOCK_K = 256;				//!< 行列積のキャッシュブロッキングの積算方向の長さ
+	inline constexpr size_t BLOCK_N = 4;				//!< 行列積のマイクロカーネルの列数
+	inline constexpr size_t BLOCK_LU = 64;				//!< ブロックLU分解のパネル幅
+	inline constexpr size_t BLOCK_TP = 32;				//!< 転置のタイルの大きさ
+	inline constexpr size_t PARALLEL_MIN = 64*64*64;	//!< 並列化する最小の演算量(積和の回数)
+	inline ThreadPool* Pool = nullptr;					//!< 並列計算に使うスレッドプール(nullptr = 単一スレッド)
+
+	//! @brief 並列計算に使うスレッドプールを設定する関数
+	//! @param[in]	p	スレッドプールへのポインタ (nullptr で単一スレッドに戻す)
+	inline void SetThreadPool(ThreadPool* p){
+		Pool = p;
+	}
+
+	//! @brief 範囲 [0, Num) を演算量に応じて並列または逐次に処理する関数
+	//! @param[in]	Num		範囲の大きさ
+	//! @param[in]	Work	全体の演算量(これが PARALLEL_MIN 未満なら逐次処理)
+	//! @param[in]	Func	分割範囲 [b, e) を処理する関数オブジェクト
+	template<typename F>
+	inline void ParallelFor(const size_t Num, const size_t Work, F&& Func){
+		if(Pool != nullptr && PARALLEL_MIN <= Work && 1 < Num){
+			Pool->ParallelFor(0, Num, Func);
+		}else{
+			Func(0, Num);
+		}
+	}
+
+	//! @brief アライメントされた要素領域を解放するデリータ
+	template<typename T>
+	struct AlignedDeleter {
+		void operator()(T* p) const {
+			::operator delete[](p, std::align_val_t(ALIGNMENT));
+		}
+	};
+
+	//! @brief アライメントされた要素領域を確保して零で初期化する関数
+	//! @param[in]	Num	要素数
+	//! @return	先頭ポインタ
+	template<typename T>
+	inline T* AlignedAlloc(const size_t Num){
+		T* p = static_cast<T*>(::operator new[](sizeof(T)*Num, std::align_val_t(ALIGNMENT)));
+		std::uninitialized_fill_n(p, Num, static_cast<T>(0));
+		return p;
+	}
+
+	//! @brief スカラーの複素共役を返す関数 (実数の場合はそのまま返す)
+	//! @param[in]	u	入力
+	//! @return	複素共役
+	template<typename T>
+	inline T Conj(const T u){
+		if constexpr(ArcsMatrix::IsComplex<T>){
+			return std::conj(u);
+		}else{
+			return u;
+		}
+	}
+
+	using SimdMax = ArcsMatrixKernel::SimdMax;		//!< 行列積のマイクロカーネルに使うSIMD型
+	inline constexpr size_t MICRO_M = 2*SimdMax::W;	//!< 行列積のマイクロカーネルの行数(SIMDレジスタ2本分)
+
+	//! @brief C(MICRO_M×BLOCK_N) ±= A(MICRO_M×kc)*B(kc×BLOCK_N) を全部レジスタに保持して計算するマイクロカーネル (double型)
+	//! @tparam	Sub	true = 減算, false = 加算
+	//! @param[in]	kc	積算方向の長さ
+	//! @param[in]	A, lda	左側行列の先頭ポインタと列の間隔
+	//! @param[in]	B, ldb	右側行列の先頭ポインタと列の間隔
+	//! @param[in,out]	C, ldc	結果の先頭ポインタと列の間隔
+	template<bool Sub>
+	inline void MicroKernel(const size_t kc, const double* A, const size_t lda, const double* B, const size_t ldb, double* C, const size_t ldc){
+		using Sm = SimdMax;
+		typename Sm::V acc[BLOCK_N][2];
+		for(size_t j = 0; j < BLOCK_N; ++j){
+			acc[j][0] = Sm::Zero();
+			acc[j][1] = Sm::Zero();
+		}
+		for(size_t p = 0; p < kc; ++p){
+			const typename Sm::V a0 = Sm::Load(A + p*lda);			// 左側の列の上半分と，
+			const typename Sm::V a1 = Sm::Load(A + p*lda + Sm::W);	// 下半分を読み込んで，
+			#pragma GCC unroll 4
+			for(size_t j = 0; j < BLOCK_N; ++j){
+				const typename Sm::V b = Sm::Set1(Sub ? -B[p + j*ldb] : B[p + j*ldb]);	// 右側の要素をブロードキャストして，
+				acc[j][0] = Sm::MulAdd(acc[j][0], a0, b);	// 掛けて積算
+				acc[j][1] = Sm::MulAdd(acc[j][1], a1, b);
+			}
+		}
+		for(size_t j = 0; j < BLOCK_N; ++j){
+			double* c = C + j*ldc;
+			Sm::Store(c,         Sm::Add(Sm::Load(c),         acc[j][0]));
+			Sm::Store(c + Sm::W, Sm::Add(Sm::Load(c + Sm::W), acc[j][1]));
+		}
+	}
+
+	//! @brief C(mr×nr) ±= A(mr×kc)*B(kc×nr) を計算する汎用カーネル (端数部分と double型以外用)
+	//! @tparam	Sub	true = 減算, false = 加算
+	//! @param[in]	mr, nr, kc	結果の高さ, 幅, 積算方向の長さ
+	//! @param[in]	A, lda	左側行列の先頭ポインタと列の間隔
+	//! @param[in]	B, ldb	右側行列の先頭ポインタと列の間隔
+	//! @param[in,out]	C, ldc	結果の先頭ポインタと列の間隔
+	template<bool Sub, typename T>
+	inline void EdgeKernel(const size_t mr, const size_t nr, const size_t kc, const T* A, const size_t lda, const T* B, const size_t ldb, T* C, const size_t ldc){
+		for(size_t j = 0; j < nr; ++j){
+			T* c = C + j*ldc;
+			for(size_t p = 0; p < kc; ++p){
+				const T b = Sub ? -B[p + j*ldb] : B[p + j*ldb];
+				const T* a = A + p*lda;
+				for(size_t i = 0; i < mr; ++i) c[i] += a[i]*b;	// 列優先なので縦方向に連続アクセス
+			}
+		}
+	}
+
+	//! @brief C(:, n0:n1-1) ±= A*B(:, n0:n1-1) をキャッシュブロッキングして計算する関数 (単一スレッド)
+	//! @tparam	Sub	true = 減算, false = 加算
+	//! @param[in]	m, k	結果の高さ, 積算方向の長さ
+	//! @param[in]	n0, n1	計算する結果の列の範囲 [n0, n1) (0始まり)
+	//! @param[in]	A, lda	左側行列(m×k)の先頭ポインタと列の間隔
+	//! @param[in]	B, ldb	右側行列(k×n)の先頭ポインタと列の間隔
+	//! @param[in,out]	C, ldc	結果(m×n)の先頭ポインタと列の間隔
+	template<bool Sub, typename T>
+	inline void GemmSerial(
+		const size_t m, const size_t n0, const size_t n1, const size_t k,
+		const T* A, const size_t lda, const T* B, const size_t ldb, T* C, const size_t ldc
+	){
+		for(size_t pc = 0; pc < k; pc += BLOCK_K){
+			const size_t kc = std::min(BLOCK_K, k - pc);
+			for(size_t ic = 0; ic < m; ic += BLOCK_M){
+				// 左側の BLOCK_M×BLOCK_K のブロックをキャッシュに載せたまま，右側の列を順に流す
+				const size_t mc = std::min(BLOCK_M, m - ic);
+				const T* Ab = A + pc*lda + ic;
+				const T* Bb = B + pc;
+				size_t j = n0;
+				for(; j + BLOCK_N <= n1; j += BLOCK_N){
+					size_t i = 0;
+					if constexpr(std::is_same_v<T, double>){
+						for(; i + MICRO_M <= mc; i += MICRO_M){
+							MicroKernel<Sub>(kc, Ab + i, lda, Bb + j*ldb, ldb, C + j*ldc + ic + i, ldc);
+						}
+					}
+					if(i < mc) EdgeKernel<Sub>(mc - i, BLOCK_N, kc, Ab + i, lda, Bb + j*ldb, ldb, C + j*ldc + ic + i, ldc);	// 端数行
+				}
+				if(j < n1) EdgeKernel<Sub>(mc, n1 - j, kc, Ab, lda, Bb + j*ldb, ldb, C + j*ldc + ic, ldc);	// 端数列
+			}
+		}
+	}
+
+	//! @brief C ±= A*B を計算する関数 (演算量が大きくスレッドプールが設定されていれば列方向に分割して並列計算)
+	//! @tparam	Sub	true = 減算, false = 加算
+	//! @param[in]	m, n, k	結果の高さ, 幅, 積算方向の長さ
+	//! @param[in]	A, lda	左側行列(m×k)の先頭ポインタと列の間隔
+	//! @param[in]	B, ldb	右側行列(k×n)の先頭ポインタと列の間隔
+	//! @param[in,out]	C, ldc	結果(m×n)の先頭ポインタと列の間隔
+	template<bool Sub, typename T>
+	inline void Gemm(
+		const size_t m, const size_t n, const size_t k,
+		const T* A, const size_t lda, const T* B, const size_t ldb, T* C, const size_t ldc
+	){
+		ParallelFor((n + BLOCK_N - 1)/BLOCK_N, m*n*k, [&](const size_t b, const size_t e){
+			GemmSerial<Sub>(m, b*BLOCK_N, std::min(e*BLOCK_N, n), k, A, lda, B, ldb, C, ldc);
+		});
+	}
+
+	//! @brief Y = U' をタイルごとに計算する関数 (Cj = true のときは共役転置)
+	//! @param[in]	m, n	入力行列の高さ, 幅
+	//! @param[in]	U	入力行列(m×n)の先頭ポインタ
+	//! @param[out]	Y	出力行列(n×m)の先頭ポインタ
+	template<bool Cj, typename T>
+	inline void Transpose(const size_t m, const size_t n, const T* U, T* Y){
+		ParallelFor((n + BLOCK_TP - 1)/BLOCK_TP, m*n, [&](const size_t b, const size_t e){
+			for(size_t jb = b*BLOCK_TP; jb < std::min(e*BLOCK_TP, n); jb += BLOCK_TP){
+				const size_t je = std::min(jb + BLOCK_TP, n);
+				for(size_t ib = 0; ib < m; ib += BLOCK_TP){
+					// 入力と出力のタイルが両方ともキャッシュに載る大きさで入れ替える
+					const size_t ie = std::min(ib + BLOCK_TP, m);
+					for(size_t i = ib; i < ie; ++i){
+						for(size_t j = jb; j < je; ++j) Y[j + i*n] = Cj ? Conj(U[i + j*m]) : U[i + j*m];
+					}
+				}
+			}
+		});
+	}
+
+	//! @brief 部分ピボット選択付きのブロックLU分解 P*A = L*U を計算する関数
+	//!        パネル(BLOCK_LU 列)ごとに分解してから，残りの小行列をブロック行列積で一括更新する。
+	//! @param[in]	n	行列の大きさ
+	//! @param[in,out]	A	入力行列(n×n, 列優先)の先頭ポインタ，出力は狭義下三角にL(対角は1)，上三角にU
+	//! @param[out]	Perm	並べ替え(Perm[i] = 元の行番号, 0始まり)
+	//! @return	行の入れ替え回数
+	template<typename T>
+	inline size_t LUP(const size_t n, T* A, size_t* Perm){
+		size_t Swaps = 0;
+		for(size_t i = 0; i < n; ++i) Perm[i] = i;
+		for(size_t k0 = 0; k0 < n; k0 += BLOCK_LU){
+			const size_t kb = std::min(BLOCK_LU, n - k0);
+			const size_t r0 = k0 + kb;
+
+			// 1. パネル A(k0:n-1, k0:r0-1) を部分ピボット選択付きで分解
+			for(size_t k = k0; k < r0; ++k){
+				T* ak = A + k*n;
+				size_t p = k;
+				double amax = std::abs(ak[k]);
+				for(size_t i = k + 1; i < n; ++i){
+					if(amax < std::abs(ak[i])){
+						amax = std::abs(ak[i]);
+						p = i;
+					}
+				}
+				if(p != k){
+					for(size_t j = 0; j < n; ++j) std::swap(A[k + j*n], A[p + j*n]);	// 行全体を入れ替え
+					std::swap(Perm[k], Perm[p]);
+					++Swaps;
+				}
+				if(amax == 0) continue;	// 特異の場合は消去を飛ばす
+				const T akk = ak[k];
+				for(size_t i = k + 1; i < n; ++i) ak[i] /= akk;
+				for(size_t j = k + 1; j < r0; ++j){
+					T* aj = A + j*n;
+					const T ukj = aj[k];
+					for(size_t i = k + 1; i < n; ++i) aj[i] -= ak[i]*ukj;
+				}
+			}
+			if(n <= r0) break;
+
+			// 2. U12 = L11^-1 * A12 (単位下三角の前進代入，列ごとに独立なので並列化)
+			ParallelFor(n - r0, kb*kb*(n - r0), [&](const size_t b, const size_t e){
+				for(size_t j = r0 + b; j < r0 + e; ++j){
+					T* aj = A + j*n;
+					for(size_t k = k0; k < r0; ++k){
+						const T u = aj[k];
+						const T* lk = A + k*n;
+						for(size_t i = k + 1; i < r0; ++i) aj[i] -= lk[i]*u;
+					}
+				}
+			});
+
+			// 3. A22 -= L21*U12 (計算量の大部分はここなのでブロック行列積で計算)
+			Gemm<true>(n - r0, n - r0, kb, A + k0*n + r0, n, A + r0*n + k0, n, A + r0*n + r0, n);
+		}
+		return Swaps;
+	}
+
+	//! @brief LU分解の結果を使って A*X = B を解く関数 (B は X で上書きされる)
+	//! @param[in]	n, nb	係数行列の大きさ, 右辺の列数
+	//! @param[in]	LU		LU分解の結果の先頭ポインタ
+	//! @param[in]	Perm	並べ替え
+	//! @param[in,out]	B	右辺(n×nb)の先頭ポインタ，出力は解
+	template<typename T>
+	inline void LUSolve(const size_t n, const size_t nb, const T* LU, const size_t* Perm, T* B){
+		ParallelFor(nb, n*n*nb, [&](const size_t b, const size_t e){
+			std::unique_ptr<T[], AlignedDeleter<T>> x(AlignedAlloc<T>(n));
+			for(size_t j = b; j < e; ++j){
+				T* bj = B + j*n;
+				for(size_t i = 0; i < n; ++i) x[i] = bj[Perm[i]];	// 並べ替えて，
+				for(size_t k = 0; k < n; ++k){
+					// 前進代入 (列優先なので列ごとに引く)
+					const T xk = x[k];
+					const T* lk = LU + k*n;
+					for(size_t i = k + 1; i < n; ++i) x[i] -= lk[i]*xk;
+				}
+				for(size_t k = n; 0 < k--;){
+					// 後退代入
+					const T* uk = LU + k*n;
+					x[k] /= uk[k];
+					const T xk = x[k];
+					for(size_t i = 0; i < k; ++i) x[i] -= uk[i]*xk;
+				}
+				std::copy_n(x.get(), n, bj);
+			}
+		});
+	}
+}
+
+//! @brief ARCS-Matrix 大規模行列クラス
+//! @tparam M	行列の高さ
+//! @tparam	N	行列の幅
+//! @tparam T	データ型(デフォルトはdouble型)
+template <size_t M, size_t N, typename T = double>
+class ArcsLargeMat {
+	public:
+		//! @brief コンストラクタ(零行列)
+		ArcsLargeMat(void)
+			: Data(ArcsMatrixLarge::AlignedAlloc<T>(M*N))
+		{
+			static_assert(0 < M && 0 < N, "ArcsLargeMat: Size Zero Error");	// サイズゼロの行列は禁止
+			static_assert(ArcsMatrix::IsApplicable<T>, "ArcsLargeMat: Type Error");	// 対応可能型チェック
+		}
+
+		//! @brief コンストラクタ(任意初期値版)
+		//! @param[in]	InitValue	行列要素の初期値
+		explicit ArcsLargeMat(const T InitValue)
+			: ArcsLargeMat()
+		{
+			FillAll(InitValue);
+		}
+
+		//! @brief コンストラクタ(初期化リスト版, ArcsMat と同じく行優先で並べる)
+		//! @param[in]	InitList	初期化リスト
+		ArcsLargeMat(const std::initializer_list<T> InitList)
+			: ArcsLargeMat()
+		{
+			const T* ListVal = InitList.begin();
+			const size_t Num = std::min(InitList.size(), M*N);
+			for(size_t k = 0; k < Num; ++k) Data[(k % N)*M + k/N] = ListVal[k];
+		}
+
+		//! @brief コンストラクタ(ArcsMat からの変換)
+		//! @param[in]	U	変換元の行列
+		explicit ArcsLargeMat(const ArcsMat<M,N,T>& U)
+			: Data(ArcsMatrixLarge::AlignedAlloc<T>(M*N))
+		{
+			std::copy_n(&(U.ReadOnlyRef()[0][0]), M*N, Data.get());	// どちらも列優先なので一括コピー
+		}
+
+		//! @brief コピーコンストラクタ
+		//! @param[in]	right	右辺値
+		ArcsLargeMat(const ArcsLargeMat<M,N,T>& right)
+			: Data(ArcsMatrixLarge::AlignedAlloc<T>(M*N))
+		{
+			std::copy_n(right.Data.get(), M*N, Data.get());
+		}
+
+		//! @brief ムーブコンストラクタ (要素領域の所有権を移すのみ)
+		//! @param[in]	right	右辺値
+		ArcsLargeMat(ArcsLargeMat<M,N,T>&& right) noexcept
+			: Data(std::move(right.Data))
+		{
+			// 移動元は要素領域を持たなくなるので，代入以外には使わないこと
+		}
+
+		//! @brief デストラクタ
+		~ArcsLargeMat() = default;
+
+		//! @brief 行列代入演算子
+		//! @param[in]	right	右辺値
+		//! @return	結果
+		ArcsLargeMat<M,N,T>& operator=(const ArcsLargeMat<M,N,T>& right){
+			if(this != &right){
+				if(!Data) Data.reset(ArcsMatrixLarge::AlignedAlloc<T>(M*N));	// 移動元だった場合は確保し直す
+				std::copy_n(right.Data.get(), M*N, Data.get());
+			}
+			return *this;
+		}
+
+		//! @brief 行列ムーブ代入演算子 (要素領域を交換するのみ)
+		//! @param[in]	right	右辺値
+		//! @return	結果
+		ArcsLargeMat<M,N,T>& operator=(ArcsLargeMat<M,N,T>&& right) noexcept {
+			Data.swap(right.Data);
+			return *this;
+		}
+
+		//! @brief ArcsMat からの代入演算子
+		//! @param[in]	right	右辺値
+		//! @return	結果
+		ArcsLargeMat<M,N,T>& operator=(const ArcsMat<M,N,T>& right){
+			if(!Data) Data.reset(ArcsMatrixLarge::AlignedAlloc<T>(M*N));
+			std::copy_n(&(right.ReadOnlyRef()[0][0]), M*N, Data.get());
+			return *this;
+		}
+
+		//! @brief ArcsMat へ変換する関数 (引数渡し版)
+		//! @param[out]	Y	変換先の行列
+		void ToArcsMat(ArcsMat<M,N,T>& Y) const {
+			std::copy_n(Data.get(), M*N, &Y(1,1));	// どちらも列優先なので一括コピー
+		}
+
+		//! @brief ArcsMat へ変換する関数 (戻り値返し版, ArcsMat は自動変数領域に確保されるので小さい行列のみに使うこと)
+		//! @return	変換後の行列
+		ArcsMat<M,N,T> ToArcsMat(void) const {
+			ArcsMat<M,N,T> ret;
+			ToArcsMat(ret);
+			return ret;
+		}
+
+		//! @brief 縦ベクトル添字演算子(縦ベクトルのm番目の要素の値を返す)
+		//! @param[in]	m	縦方向の要素番号( "1" 始まり)
+		//! @return	要素の値
+		T operator[](const size_t m) const {
+			static_assert(N == 1, "ArcsLargeMat: Vector Error");	// 縦ベクトルチェック
+			return Data[m - 1];
+		}
+
+		//! @brief 縦ベクトル添字演算子(縦ベクトルのm番目の要素に値を設定する)
+		//! @param[in]	m	縦方向の要素番号( "1" 始まり)
+		//! @return	要素への参照
+		T& operator[](const size_t m){
+			static_assert(N == 1, "ArcsLargeMat: Vector Error");	// 縦ベクトルチェック
+			return Data[m - 1];
+		}
+
+		//! @brief 行列括弧演算子(行列の(m,n)要素の値を返す。サイズチェック無し版)
+		//! @param[in]	m	m行目(縦方向の位置)
+		//! @param[in]	n	n列目(横方向の位置)
+		//! @return	要素の値
+		T operator()(const size_t m, const size_t n) const {
+			return Data[(n - 1)*M + m - 1];
+		}
+
+		//! @brief 行列括弧演算子(行列の(m,n)要素に値を設定する。サイズチェック無し版)
+		//! @param[in]	m	m行目(縦方向の位置)
+		//! @param[in]	n	n列目(横方向の位置)
+		//! @return	要素への参照
+		T& operator()(const size_t m, const size_t n){
+			return Data[(n - 1)*M + m - 1];
+		}
+
+		//! @brief 単項プラス演算子
+		//! @return 結果
+		ArcsLargeMat<M,N,T> operator+(void) const {
+			return *this;
+		}
+
+		//! @brief 単項マイナス演算子
+		//! @return 結果
+		ArcsLargeMat<M,N,T> operator-(void) const {
+			ArcsLargeMat<M,N,T> ret;
+			for(size_t i = 0; i < M*N; ++i) ret.Data[i] = -Data[i];
+			return ret;
+		}
+
+		//! @brief 行列加算演算子 (行列＋行列の場合)
+		//! @param[in]	right	右辺値
+		//! @return 結果
+		ArcsLargeMat<M,N,T> operator+(const ArcsLargeMat<M,N,T>& right) const {
+			ArcsLargeMat<M,N,T> ret(*this);
+			ret += right;
+			return ret;
+		}
+
+		//! @brief 行列減算演算子 (行列－行列の場合)
+		//! @param[in]	right	右辺値
+		//! @return 結果
+		ArcsLargeMat<M,N,T> operator-(const ArcsLargeMat<M,N,T>& right) const {
+			ArcsLargeMat<M,N,T> ret(*this);
+			ret -= right;
+			return ret;
+		}
+
+		//! @brief 行列加算代入演算子 (行列＋行列の場合, 一時領域を確保しない)
+		//! @param[in]	right	右辺値
+		//! @return 結果
+		ArcsLargeMat<M,N,T>& operator+=(const ArcsLargeMat<M,N,T>& right){
+			const T* r = right.Data.get();
+			for(size_t i = 0; i < M*N; ++i) Data[i] += r[i];
+			return *this;
+		}
+
+		//! @brief 行列減算代入演算子 (行列－行列の場合, 一時領域を確保しない)
+		//! @param[in]	right	右辺値
+		//! @return 結果
+		ArcsLargeMat<M,N,T>& operator-=(const ArcsLargeMat<M,N,T>& right){
+			const T* r = right.Data.get();
+			for(size_t i = 0; i < M*N; ++i) Data[i] -= r[i];
+			return *this;
+		}
+
+		//! @brief 行列乗算代入演算子 (行列＊スカラーの場合)
+		//! @param[in]	right	右辺値
+		//! @return 結果
+		ArcsLargeMat<M,N,T>& operator*=(const T& right){
+			for(size_t i = 0; i < M*N; ++i) Data[i] *= right;
+			return *this;
+		}
+
+		//! @brief 行列乗算演算子 (行列＊スカラーの場合)
+		//! @param[in]	right	右辺値
+		//! @return 結果
+		ArcsLargeMat<M,N,T> operator*(const T& right) const {
+			ArcsLargeMat<M,N,T> ret(*this);
+			ret *= right;
+			return ret;
+		}
+
+		//! @brief 行列除算演算子 (行列／スカラーの場合)
+		//! @param[in]	right	右辺値
+		//! @return 結果
+		ArcsLargeMat<M,N,T> operator/(const T& right) const {
+			ArcsLargeMat<M,N,T> ret(*this);
+			for(size_t i = 0; i < M*N; ++i) ret.Data[i] /= right;
+			return ret;
+		}
+
+		//! @brief 行列乗算演算子 (行列＊行列の場合, キャッシュブロッキングした行列積)
+		//! @tparam	Q	右側行列の幅
+		//! @param[in]	right	右辺値
+		//! @return 結果
+		template<size_t Q>
+		ArcsLargeMat<M,Q,T> operator*(const ArcsLargeMat<N,Q,T>& right) const {
+			ArcsLargeMat<M,Q,T> ret;
+			ArcsLargeMat<M,N,T>::mult(*this, right, ret);
+			return ret;
+		}
+
+		//! @brief アダマール積演算子 (行列の要素ごとの乗算)
+		//! @param[in]	right	右辺値
+		//! @return 結果
+		ArcsLargeMat<M,N,T> operator&(const ArcsLargeMat<M,N,T>& right) const {
+			ArcsLargeMat<M,N,T> ret(*this);
+			for(size_t i = 0; i < M*N; ++i) ret.Data[i] *= right.Data[i];
+			return ret;
+		}
+
+		//! @brief アダマール除算演算子 (行列の要素ごとの除算)
+		//! @param[in]	right	右辺値
+		//! @return 結果
+		ArcsLargeMat<M,N,T> operator%(const ArcsLargeMat<M,N,T>& right) const {
+			ArcsLargeMat<M,N,T> ret(*this);
+			for(size_t i = 0; i < M*N; ++i) ret.Data[i] /= right.Data[i];
+			return ret;
+		}
+
+		//! @brief 転置演算子 (複素数型の場合はエルミート転置)
+		//! @return 結果
+		ArcsLargeMat<N,M,T> operator~(void) const {
+			ArcsLargeMat<N,M,T> ret;
+			ArcsMatrixLarge::Transpose<ArcsMatrix::IsComplex<T>>(M, N, Data.get(), ret.GetData());
+			return ret;
+		}
+
+		//! @brief 行列乗算演算子 (スカラー＊行列の場合)
+		//! @param[in]	left	左辺値
+		//! @param[in]	right	右辺値
+		//! @return 結果
+		friend ArcsLargeMat<M,N,T> operator*(const T& left, const ArcsLargeMat<M,N,T>& right){
+			return right*left;
+		}
+
+		//! @brief 行列の要素を表示
+		//! @param[in] format	表示形式 (%1.3e とか %5.3f とか printfと同じ)
+		void Disp(const std::string& format) const {
+			for(size_t j = 1; j <= M; ++j){
+				printf("[ ");
+				for(size_t i = 1; i <= N; ++i){
+					if constexpr(ArcsMatrix::IsComplex<T>){
+						// 複素数型の場合
+						printf(format.c_str(), (*this)(j,i).real());
+						printf((*this)(j,i).imag() < 0 ? " -" : " +");
+						printf(format.c_str(), std::abs((*this)(j,i).imag()));
+						printf("i");	// 虚数単位記号
+					}else{
+						// それ以外の場合
+						printf(format.c_str(), static_cast<double>((*this)(j,i)));
+					}
+					printf(" ");
+				}
+				printf("]\n");
+			}
+			printf("\n");
+		}
+
+		//! @brief 行列のサイズを表示
+		void DispSize(void) const {
+			printf("[ Height: %zu  x  Width: %zu ]\n\n", M, N);
+		}
+
+		//! @brief 要素の先頭ポインタを返す関数 (列優先, 64バイト境界)
+		//! @return	先頭ポインタ
+		T* GetData(void){
+			return Data.get();
+		}
+
+		//! @brief 要素の先頭ポインタを返す関数 (読み込み専用版)
+		//! @return	先頭ポインタ
+		const T* GetData(void) const {
+			return Data.get();
+		}
+
+		//! @brief 全要素を指定した値で埋める関数
+		//! @param[in]	u	埋める値
+		void FillAll(const T u){
+			std::fill_n(Data.get(), M*N, u);
+		}
+
+		//! @brief 全要素を零で埋める関数
+		void FillAllZero(void){
+			FillAll(0);
+		}
+
+		//! @brief m×n 零行列を返す関数
+		//! @return 結果
+		static ArcsLargeMat<M,N,T> zeros(void){
+			return ArcsLargeMat<M,N,T>();
+		}
+
+		//! @brief m×n 1行列を返す関数
+		//! @return 結果
+		static ArcsLargeMat<M,N,T> ones(void){
+			return ArcsLargeMat<M,N,T>(static_cast<T>(1));
+		}
+
+		//! @brief n×n 単位行列を返す関数
+		//! @return 結果
+		static ArcsLargeMat<M,N,T> eye(void){
+			ArcsLargeMat<M,N,T> ret;
+			for(size_t i = 0; i < std::min(M, N); ++i) ret.Data[i*M + i] = 1;
+			return ret;
+		}
+
+		//! @brief 行列積 Y = A*B を計算する関数 (引数渡し版, 出力の領域を使い回せる)
+		//! @tparam	Q	右側行列の幅
+		//! @param[in]	A	左側行列
+		//! @param[in]	B	右側行列
+		//! @param[out]	Y	出力行列
+		template<size_t Q>
+		static void mult(const ArcsLargeMat<M,N,T>& A, const ArcsLargeMat<N,Q,T>& B, ArcsLargeMat<M,Q,T>& Y){
+			Y.FillAllZero();
+			ArcsMatrixLarge::Gemm<false>(M, Q, N, A.GetData(), M, B.GetData(), N, Y.GetData(), M);
+		}
+
+		//! @brief 転置行列を返す関数 (引数渡し版)
+		//! @param[in]	U	入力行列
+		//! @param[out]	Y	出力行列
+		static void tp(const ArcsLargeMat<M,N,T>& U, ArcsLargeMat<N,M,T>& Y){
+			ArcsMatrixLarge::Transpose<false>(M, N, U.GetData(), Y.GetData());
+		}
+
+		//! @brief 転置行列を返す関数 (戻り値渡し版)
+		//! @param[in]	U	入力行列
+		//! @return	出力行列
+		static ArcsLargeMat<N,M,T> tp(const ArcsLargeMat<M,N,T>& U){
+			ArcsLargeMat<N,M,T> ret;
+			ArcsLargeMat<M,N,T>::tp(U, ret);
+			return ret;
+		}
+
+		//! @brief 行列のノルムを返す関数(戻り値渡し版のみ, 2-ノルムはベクトルのみ対応)
+		//! @tparam	NRM	ノルムのタイプ (デフォルト値 = AMT_L2)
+		//! @param[in]	U	入力行列
+		//! @return	結果
+		template<ArcsMatrix::NormType NRM = ArcsMatrix::NormType::AMT_L2>
+		static double norm(const ArcsLargeMat<M,N,T>& U){
+			const T* u = U.GetData();
+			double ret = 0;
+			if constexpr(NRM == ArcsMatrix::NormType::AMT_L2){
+				// ユークリッドノルム(行列の2-ノルムは特異値分解が必要なので大規模行列では未対応)
+				static_assert(M == 1 || N == 1, "ArcsLargeMat: Vector Error");
+				for(size_t i = 0; i < M*N; ++i) ret += std::norm(u[i]);
+				ret = std::sqrt(ret);
+			}else if constexpr(NRM == ArcsMatrix::NormType::AMT_L1){
+				// 絶対値ノルム(列の絶対値和の最大値)
+				for(size_t j = 0; j < N; ++j){
+					double s = 0;
+					for(size_t i = 0; i < M; ++i) s += std::abs(u[i + j*M]);
+					ret = std::max(ret, s);
+				}
+			}else{
+				// 無限大ノルム(行の絶対値和の最大値, 列優先なので列ごとに足し込む)
+				std::unique_ptr<double[], ArcsMatrixLarge::AlignedDeleter<double>> s(ArcsMatrixLarge::AlignedAlloc<double>(M));
+				for(size_t j = 0; j < N; ++j){
+					for(size_t i = 0; i < M; ++i) s[i] += std::abs(u[i + j*M]);
+				}
+				ret = *std::max_element(s.get(), s.get() + M);
+			}
+			return ret;
+		}
+
+		//! @brief 部分ピボット選択付きブロックLU分解 (引数渡し版)
+		//! @param[in]	A	入力行列
+		//! @param[out]	L	下三角行列(対角は1)
+		//! @param[out]	U	上三角行列
+		//! @param[out]	P	並べ替え行列 (P*A = L*U)
+		static void LUP(const ArcsLargeMat<M,N,T>& A, ArcsLargeMat<M,N,T>& L, ArcsLargeMat<M,N,T>& U, ArcsLargeMat<M,N,T>& P){
+			static_assert(M == N, "ArcsLargeMat: Size Error");	// 正方行列チェック
+			std::unique_ptr<size_t[]> Perm(new size_t[N]);
+			U = A;
+			ArcsMatrixLarge::LUP(N, U.GetData(), Perm.get());
+			L.FillAllZero();
+			P.FillAllZero();
+			for(size_t j = 0; j < N; ++j){
+				L(j + 1, j + 1) = 1;
+				for(size_t i = j + 1; i < N; ++i){
+					L(i + 1, j + 1) = U(i + 1, j + 1);	// 狭義下三角をLへ移す
+					U(i + 1, j + 1) = 0;
+				}
+				P(j + 1, Perm[j] + 1) = 1;
+			}
+		}
+
+		//! @brief AX = B の形の線形方程式をXについて解く関数 (引数渡し版, 正方行列のみ)
+		//! @tparam	NB	右辺の列数
+		//! @param[in]	A	係数行列
+		//! @param[in]	B	右辺の行列
+		//! @param[out]	X	解の行列
+		template<size_t NB>
+		static void linsolve(const ArcsLargeMat<M,N,T>& A, const ArcsLargeMat<M,NB,T>& B, ArcsLargeMat<N,NB,T>& X){
+			static_assert(M == N, "ArcsLargeMat: Size Error");	// 正方行列チェック
+			ArcsLargeMat<M,N,T> LU(A);
+			std::unique_ptr<size_t[]> Perm(new size_t[N]);
+			ArcsMatrixLarge::LUP(N, LU.GetData(), Perm.get());	// ブロックLU分解してから，
+			X = B;
+			ArcsMatrixLarge::LUSolve(N, NB, LU.GetData(), Perm.get(), X.GetData());	// 前進代入と後退代入
+		}
+
+		//! @brief AX = B の形の線形方程式をXについて解く関数 (戻り値返し版, 正方行列のみ)
+		//! @tparam	NB	右辺の列数
+		//! @param[in]	A	係数行列
+		//! @param[in]	B	右辺の行列
+		//! @return	解の行列
+		template<size_t NB>
+		static ArcsLargeMat<N,NB,T> linsolve(const ArcsLargeMat<M,N,T>& A, const ArcsLargeMat<M,NB,T>& B){
+			ArcsLargeMat<N,NB,T> ret;
+			ArcsLargeMat<M,N,T>::linsolve(A, B, ret);
+			return ret;
+		}
+
+		//! @brief 逆行列を返す関数 (引数渡し版)
+		//! @param[in]	A	入力行列
+		//! @param[out]	Y	出力行列
+		static void inv(const ArcsLargeMat<M,N,T>& A, ArcsLargeMat<M,N,T>& Y){
+			ArcsLargeMat<M,N,T>::linsolve(A, ArcsLargeMat<M,N,T>::eye(), Y);
+		}
+
+		//! @brief 逆行列を返す関数 (戻り値返し版)
+		//! @param[in]	A	入力行列
+		//! @return	出力行列
+		static ArcsLargeMat<M,N,T> inv(const ArcsLargeMat<M,N,T>& A){
+			ArcsLargeMat<M,N,T> ret;
+			ArcsLargeMat<M,N,T>::inv(A, ret);
+			return ret;
+		}
+
+		//! @brief 行列式の値を返す関数
+		//! @param[in]	A	入力行列
+		//! @return	結果
+		static T det(const ArcsLargeMat<M,N,T>& A){
+			static_assert(M == N, "ArcsLargeMat: Size Error");	// 正方行列チェック
+			ArcsLargeMat<M,N,T> LU(A);
+			std::unique_ptr<size_t[]> Perm(new size_t[N]);
+			const size_t Swaps = ArcsMatrixLarge::LUP(N, LU.GetData(), Perm.get());
+			T ret = Swaps % 2 == 0 ? 1 : -1;
+			for(size_t i = 0; i < N; ++i) ret *= LU.Data[i*N + i];	// Uの対角要素の積
+			return ret;
+		}
+
+		//! @brief コレスキー分解 A = R'*R (引数渡し版, 正定値エルミート行列のみ)
+		//! @param[in]	A	入力行列
+		//! @param[out]	R	上三角行列
+		//! @return	true = 正定値, false = 正定値でない(分解失敗)
+		static bool Cholesky(const ArcsLargeMat<M,N,T>& A, ArcsLargeMat<M,N,T>& R){
+			static_assert(M == N, "ArcsLargeMat: Size Error");	// 正方行列チェック
+			R.FillAllZero();
+			T* r = R.GetData();
+			const T* a = A.GetData();
+			for(size_t j = 0; j < N; ++j){
+				T* rj = r + j*N;
+				for(size_t i = 0; i <= j; ++i){
+					// R(i,j) = (A(i,j) - R(0:i-1,i)'*R(0:i-1,j))/R(i,i) (列優先なので縦方向に連続な内積)
+					const T* ri = r + i*N;
+					T s = a[i + j*N];
+					for(size_t k = 0; k < i; ++k) s -= ArcsMatrixLarge::Conj(ri[k])*rj[k];
+					if(i < j){
+						rj[i] = s/ri[i];
+					}else{
+						const double d = std::real(s);
+						if(d <= 0) return false;	// 正定値でない
+						rj[j] = std::sqrt(d);
+					}
+				}
+			}
+			return true;
+		}
+
+		//! @brief コレスキー分解 A = R'*R (戻り値返し版)
+		//! @param[in]	A	入力行列
+		//! @return	上三角行列
+		static ArcsLargeMat<M,N,T> Cholesky(const ArcsLargeMat<M,N,T>& A){
+			ArcsLargeMat<M,N,T> R;
+			ArcsLargeMat<M,N,T>::Cholesky(A, R);
+			return R;
+		}
+
+	private:
+		std::unique_ptr<T[], ArcsMatrixLarge::AlignedDeleter<T>> Data;	//!< データ格納用変数 (列優先, 64バイト境界)
+};
+
+// グローバル版関数の定義
+namespace ArcsMatrix {
+	//! @brief 転置行列を返す関数(戻り値渡し版)
+	//! @tparam	M, N, T	入力行列の高さ, 幅, 要素の型
+	//! @param[in]	U	入力行列
+	//! @return	Y	出力行列
+	template<size_t M, size_t N, typename T = double>
+	inline ArcsLargeMat<N,M,T> tp(const ArcsLargeMat<M,N,T>& U){
+		return ArcsLargeMat<M,N,T>::tp(U);
+	}
+
+	//! @brief 行列のノルムを返す関数(戻り値渡し版のみ)
+	//! @tparam	NRM	ノルムのタイプ, M, N, T	入力行列の高さ, 幅, 要素の型
+	//! @param[in]	U	入力行列
+	//! @return	結果
+	template<ArcsMatrix::NormType NRM = ArcsMatrix::NormType::AMT_L2, size_t M, size_t N, typename T = double>
+	inline double norm(const ArcsLargeMat<M,N,T>& U){
+		return ArcsLargeMat<M,N,T>::template norm<NRM>(U);
+	}
+
+	//! @brief AX = Bの形の線形方程式をXについて解く関数(戻り値返し版)
+	//! @tparam	M, N, T, NB	係数行列の高さ, 幅, 要素の型, 右辺の列数
+	//! @param[in]	A	係数行列(正方行列)
+	//! @param[in]	B	右辺の行列
+	//! @return	X	解の行列
+	template<size_t M, size_t N, typename T = double, size_t NB>
+	inline ArcsLargeMat<N,NB,T> linsolve(const ArcsLargeMat<M,N,T>& A, const ArcsLargeMat<M,NB,T>& B){
+		return ArcsLargeMat<M,N,T>::linsolve(A, B);
+	}
+
+	//! @brief 逆行列を返す関数(戻り値返し版)
+	//! @tparam	M, N, T	入力行列の高さ, 幅, 要素の型
+	//! @param[in]	A	入力行列
+	//! @return	Y	出力行列
+	template<size_t M, size_t N, typename T = double>
+	inline ArcsLargeMat<M,N,T> inv(const ArcsLargeMat<M,N,T>& A){
+		return ArcsLargeMat<M,N,T>::inv(A);
+	}
+
+	//! @brief 行列式の値を返す関数
+	//! @tparam	M, N, T	入力行列の高さ, 幅, 要素の型
+	//! @param[in]	A	入力行列
+	//! @return	結果
+	template<size_t M, size_t N, typename T = double>
+	inline T det(const ArcsLargeMat<M,N,T>& A){
+		return ArcsLargeMat<M,N,T>::det(A);
+	}
+
+	//! @brief コレスキー分解(戻り値返し版)
+	//! @tparam	M, N, T	入力行列の高さ, 幅, 要素の型
+	//! @param[in]	A	入力行列
+	//! @return	上三角行列
+	template<size_t M, size_t N, typename T = double>
+	inline ArcsLargeMat<M,N,T> Cholesky(const ArcsLargeMat<M,N,T>& A){
+		return ArcsLargeMat<M,N,T>::Cholesky(A);
+	}
+}
+}
+
+#endif
+
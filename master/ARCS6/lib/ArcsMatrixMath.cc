@@ -0,0 +1,14 @@
+//! @file ArcsMatrixMath.cc
+//! @brief ARCS-Matrix コンパイル時評価可能なスカラー数学関数
+//!
+//! コンパイル時評価のときは四則演算だけで書いた実装を使い，実行時は std の関数を呼ぶ関数群。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "ArcsMatrixMath.hh"
+
+// インライン関数のため，実体もヘッダ側に実装。
@@ -0,0 +1,175 @@
+//! @file ArcsMatrixMath.hh
+//! @brief ARCS-Matrix コンパイル時評価可能なスカラー数学関数
+//!
+//! std::sqrt や std::frexp などは規格上 constexpr ではなく，コンパイル時に評価できるのはGCCが組み込み関数として
+//! 畳み込める場合に限られる(-fno-builtin やGCC以外のコンパイラではコンパイルエラーになる)。
+//! ここでは，コンパイル時評価のときは四則演算だけで書いた実装を使い，実行時は従来通り std の関数を呼ぶ関数群を定義する。
+//! これにより，ConstParams の定数から作ったプラントの離散化・平衡化・リアプノフ方程式の解などを
+//! static constexpr な行列としてコンパイル時に計算できる。
+//! (実行時の動作と結果は std の関数を直接呼んでいた従来版と同一)
+//!
+//! @par コンパイル時版の精度
+//! - Abs, Frexp, Ldexp, CopySign は厳密(丸め無し)。ただし CopySign は -0.0 を +0.0 として扱う。
+//! - Sqrt はニュートン法の後に厳密な残差で最終桁を補正するので，正しく丸められた std::sqrt と同じ値になる。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef ARCSMATRIXMATH
+#define ARCSMATRIXMATH
+
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <type_traits>
+
+// ARCS名前空間
+namespace ARCS {
+
+// ArcsMatrixスカラー数学関数定義
+namespace ArcsMatrixMath {
+	template<typename TT> struct IsComplexV : std::false_type {};
+	template<typename TT> struct IsComplexV<std::complex<TT>> : std::true_type {};
+	template<typename TT> inline constexpr bool IsComplex = IsComplexV<TT>::value;	//!< 複素数型かどうか
+
+	//! @brief 2の冪乗倍を返す関数 (コンパイル時評価用, 2倍/半分の繰り返しなので厳密)
+	//! @param[in]	x	入力
+	//! @param[in]	e	指数
+	//! @return	x*2^e
+	constexpr double ConstLdexp(double x, int e){
+		for(; 64 <= e; e -= 64) x *= 18446744073709551616.0;		// 2^64
+		for(; e <= -64; e += 64) x *= 5.421010862427522170037e-20;	// 2^-64
+		for(; 0 < e; --e) x *= 2;
+		for(; e < 0; ++e) x /= 2;
+		return x;
+	}
+
+	//! @brief 仮数部と指数部に分解する関数 (コンパイル時評価用)
+	//! @param[in]	x	入力
+	//! @param[out]	e	指数 (x = 戻り値*2^e)
+	//! @return	仮数部 (0.5 <= |戻り値| < 1, ただし x が 0, 無限大, NaN の場合は x そのもの)
+	constexpr double ConstFrexp(double x, int* e){
+		*e = 0;
+		if(x == 0 || x != x || x - x != 0) return x;	// 0, NaN, 無限大はそのまま
+		const double a = x < 0 ? -x : x;
+		double m = a;
+		for(; 18446744073709551616.0 <= m; *e += 64) m *= 5.421010862427522170037e-20;	// 大きい場合は 2^64 ずつ縮める
+		for(; m < 5.421010862427522170037e-20; *e -= 64) m *= 18446744073709551616.0;	// 小さい場合は 2^64 ずつ広げる
+		for(; 1 <= m; ++*e) m /= 2;
+		for(; m < 0.5; --*e) m *= 2;
+		return x < 0 ? -m : m;
+	}
+
+	//! @brief 平方根を返す関数 (コンパイル時評価用, 正しく丸めた値)
+	//! @param[in]	x	入力
+	//! @return	平方根
+	constexpr double ConstSqrt(const double x){
+		if(x != x || x < 0) return std::numeric_limits<double>::quiet_NaN();
+		if(x == 0 || x - x != 0) return x;	// ±0, 無限大はそのまま
+
+		// x = m*2^e (0.25 <= m < 1, e は偶数) に分解して，sqrt(m) を求めてから 2^(e/2) 倍する
+		int e = 0;
+		double m = ConstFrexp(x, &e);
+		if(e % 2 != 0){
+			m /= 2;
+			++e;
+		}
+
+		// ニュートン法 (2次収束なので最大相対誤差13%の1次近似からでも4回で倍精度に達する。余裕を見て5回)
+		double y = 0.41731 + 0.59016*m;	// [0.25, 1) での1次近似
+		for(int i = 0; i < 5; ++i) y = 0.5*(y + m/y);
+
+		// 厳密な残差 r = m - y^2 で最終桁を補正 (y^2 = p + q をDekkerの方法で誤差無く求める)
+		constexpr double u = 1.1102230246251565e-16;	// 2^-53 (y ∈ [0.5, 1) の1ulp)
+		for(int i = 0; i < 2; ++i){
+			constexpr double Split = 134217729.0;	// 2^27 + 1
+			const double c = Split*y;
+			const double yh = c - (c - y), yl = y - yh;
+			const double p = y*y;
+			const double q = ((yh*yh - p) + 2*yh*yl) + yl*yl;
+			const double r = (m - p) - q;
+			if(y*u < r){
+				y += u;	// 真値が y + u/2 より大きければ1つ上へ
+			}else if(r <= -y*u){
+				y -= (y == 0.5 ? u/2 : u);	// 真値が y - u/2 より小さければ1つ下へ
+			}else{
+				break;
+			}
+		}
+		return ConstLdexp(y, e/2);
+	}
+
+	//! @brief 絶対値を返す関数
+	//! @param[in]	u	入力
+	//! @return	絶対値
+	template<typename T>
+	constexpr auto Abs(const T u){
+		if constexpr(IsComplex<T>){
+			return std::abs(u);
+		}else if constexpr(std::is_floating_point_v<T>){
+			if(__builtin_is_constant_evaluated()){
+				return u < 0 ? -u : (u == 0 ? static_cast<T>(0) : u);	// -0.0 は +0.0 にする
+			}
+			return std::abs(u);
+		}else{
+			return u < 0 ? -u : u;
+		}
+	}
+
+	//! @brief 平方根を返す関数
+	//! @param[in]	u	入力
+	//! @return	平方根
+	template<typename T>
+	constexpr auto Sqrt(const T u){
+		if constexpr(IsComplex<T>){
+			return std::sqrt(u);
+		}else{
+			using R = decltype(std::sqrt(u));
+			if(__builtin_is_constant_evaluated()){
+				return static_cast<R>(ConstSqrt(static_cast<double>(u)));
+			}
+			return std::sqrt(u);
+		}
+	}
+
+	//! @brief 仮数部と指数部に分解する関数
+	//! @param[in]	x	入力
+	//! @param[out]	e	指数 (x = 戻り値*2^e)
+	//! @return	仮数部 (0.5 <= |戻り値| < 1)
+	constexpr double Frexp(const double x, int* e){
+		if(__builtin_is_constant_evaluated()){
+			return ConstFrexp(x, e);
+		}
+		return std::frexp(x, e);
+	}
+
+	//! @brief 2の冪乗倍を返す関数
+	//! @param[in]	x	入力
+	//! @param[in]	e	指数
+	//! @return	x*2^e
+	constexpr double Ldexp(const double x, const int e){
+		if(__builtin_is_constant_evaluated()){
+			return ConstLdexp(x, e);
+		}
+		return std::ldexp(x, e);
+	}
+
+	//! @brief 絶対値が x で符号が y の値を返す関数
+	//! @param[in]	x	絶対値の元
+	//! @param[in]	y	符号の元
+	//! @return	結果
+	constexpr double CopySign(const double x, const double y){
+		if(__builtin_is_constant_evaluated()){
+			const double a = x < 0 ? -x : x;
+			return y < 0 ? -a : a;	// コンパイル時は -0.0 を区別しない
+		}
+		return std::copysign(x, y);
+	}
+}
+}
+
+#endif
+
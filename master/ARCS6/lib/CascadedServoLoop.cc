@@ -0,0 +1,14 @@
+//! @file CascadedServoLoop.cc
+//! @brief 多軸カスケードサーボループクラス
+//!
+//! 位置制御(P) → 速度制御(PI) → 電流指令 のカスケード構成を，N軸分まとめて1つのループで計算するクラス。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "CascadedServoLoop.hh"
+
+// テンプレートクラスのため，実体もヘッダ側に実装。
@@ -0,0 +1,291 @@
+//! @file CascadedServoLoop.hh
+//! @brief 多軸カスケードサーボループクラス
+//!
+//! 位置制御(P) → 速度制御(PI) → 電流指令 のカスケード構成を，N軸分まとめて1つのループで計算するクラス。
+//! - ゲイン，リミット，状態変数を軸ごとの配列で持つ(SoA形式)ので，全軸の更新が1本のループになりベクトル化される。
+//!   軸ごとにフィードバック値を読み込む場合は，読み込んだ直後に1軸版の Update を呼べば良い。
+//! - 速度制御器の積分器には逆算法(バックカリキュレーション)のアンチワインドアップを掛ける。
+//! - 位置制御器の出力には速度フィードフォワード，速度制御器の出力には電流フィードフォワードを足せる。
+//! - 無効にした軸は測定電流をそのまま電流指令として出し，積分器をそれに追従させておくので，有効にしたときに電流指令が跳ばない。
+//! - 速度指令と電流指令のリミットの初期値は無限大(リミット無し)なので，実機では必ず SetLimits で設定すること。
+//!
+//! @par 電流制御について
+//! 電流制御ループはサーボアンプ側で閉じているので，このクラスは電流指令までを計算する。
+//! 測定電流は無効時の追従(バンプレス切り替え)にのみ使う。
+//!
+//! @par 離散化について
+//! 積分器は PIcontroller のデフォルトと同じく後退オイラー法で離散化している。
+//! 逆算法のゲイン Kaw を Kvi/Kvp にすると，PIcontroller のリミット偏差フィードバック版と同じ特性になる。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef CASCADEDSERVOLOOP
+#define CASCADEDSERVOLOOP
+
+#include <cassert>
+#include <array>
+#include <algorithm>
+#include <limits>
+#include "ArcsMatrix.hh"
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+	#include "ARCSeventlog.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+	#define PassedLog()
+	#define EventLog(a)
+	#define EventLogVar(a)
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief 多軸カスケードサーボループクラス
+//! @tparam	N	軸数
+//! @tparam	T	データ型 (デフォルトはdouble型)
+template <size_t N, typename T = double>
+class CascadedServoLoop {
+	static_assert(0 < N, "CascadedServoLoop: Size Error");
+	public:
+		//! @brief コンストラクタ
+		//! @param[in]	SmplTime	[s] 制御周期
+		explicit CascadedServoLoop(const T SmplTime)
+			: Ts(SmplTime), Kpp(), Kvp(), Kvi(), Kaw(), VelLimit(), CurLimit(), Enable(),
+			  PosRef(), VelFF(), CurFF(), Pos(), Vel(), Cur(), Xi(), VelRef(), CurRef()
+		{
+			VelLimit.fill(std::numeric_limits<T>::infinity());	// SetLimits を呼び忘れても指令がゼロに張り付かないように，
+			CurLimit.fill(std::numeric_limits<T>::infinity());	// 初期値はリミット無しとしておく
+			Enable.fill(1);
+			ClearStateVars();
+			PassedLog();
+		}
+
+		//! @brief ムーブコンストラクタ
+		//! @param[in]	r	右辺値
+		CascadedServoLoop(CascadedServoLoop&& r)
+			: Ts(r.Ts), Kpp(r.Kpp), Kvp(r.Kvp), Kvi(r.Kvi), Kaw(r.Kaw), VelLimit(r.VelLimit), CurLimit(r.CurLimit), Enable(r.Enable),
+			  PosRef(r.PosRef), VelFF(r.VelFF), CurFF(r.CurFF), Pos(r.Pos), Vel(r.Vel), Cur(r.Cur), Xi(r.Xi), VelRef(r.VelRef), CurRef(r.CurRef)
+		{
+
+		}
+
+		//! @brief デストラクタ
+		~CascadedServoLoop(){
+			PassedLog();
+		}
+
+		//! @brief ゲインを設定する関数
+		//! @param[in]	i	軸番号 (1～N)
+		//! @param[in]	PosP	[1/s] 位置比例ゲイン
+		//! @param[in]	VelP	速度比例ゲイン
+		//! @param[in]	VelI	速度積分ゲイン
+		//! @param[in]	AntiWindup	逆算法のゲイン (0 でアンチワインドアップ無し)
+		void SetGains(const size_t i, const T PosP, const T VelP, const T VelI, const T AntiWindup){
+			arcs_assert(0 < i && i <= N);
+			Kpp[i - 1] = PosP;
+			Kvp[i - 1] = VelP;
+			Kvi[i - 1] = VelI;
+			Kaw[i - 1] = AntiWindup;
+		}
+
+		//! @brief ゲインを設定する関数 (逆算法のゲインは Kvi/Kvp とする版)
+		//! @param[in]	i	軸番号 (1～N)
+		//! @param[in]	PosP	[1/s] 位置比例ゲイン
+		//! @param[in]	VelP	速度比例ゲイン
+		//! @param[in]	VelI	速度積分ゲイン
+		void SetGains(const size_t i, const T PosP, const T VelP, const T VelI){
+			arcs_assert(0 < VelP);	// Kvi/Kvp を計算するのでゼロ割チェック
+			SetGains(i, PosP, VelP, VelI, VelI/VelP);
+		}
+
+		//! @brief リミットを設定する関数
+		//! 設定しない場合はリミット無し(無限大)となる。
+		//! @param[in]	i	軸番号 (1～N)
+		//! @param[in]	VelMax	[rad/s] 速度指令の上限 (下限は -VelMax)
+		//! @param[in]	CurMax	[A] 電流指令の上限 (下限は -CurMax)
+		void SetLimits(const size_t i, const T VelMax, const T CurMax){
+			arcs_assert(0 < i && i <= N);
+			arcs_assert(0 <= VelMax && 0 <= CurMax);
+			VelLimit[i - 1] = VelMax;
+			CurLimit[i - 1] = CurMax;
+		}
+
+		//! @brief 制御周期を再設定する関数
+		//! @param[in]	SmplTime	[s] 制御周期
+		void SetSmplTime(const T SmplTime){
+			Ts = SmplTime;
+		}
+
+		//! @brief 軸を有効/無効にする関数
+		//! 無効の間は測定電流をそのまま電流指令として出し，積分器をそれに追従させる。
+		//! @param[in]	i	軸番号 (1～N)
+		//! @param[in]	Flag	true = 有効，false = 無効
+		void SetEnable(const size_t i, const bool Flag){
+			arcs_assert(0 < i && i <= N);
+			Enable[i - 1] = Flag ? 1 : 0;
+		}
+
+		//! @brief 指令値とフィードフォワードを設定する関数
+		//! @param[in]	i	軸番号 (1～N)
+		//! @param[in]	PosCmd	[rad] 位置指令
+		//! @param[in]	VelFeedFwd	[rad/s] 速度フィードフォワード
+		//! @param[in]	CurFeedFwd	[A] 電流フィードフォワード
+		void SetReference(const size_t i, const T PosCmd, const T VelFeedFwd = 0, const T CurFeedFwd = 0){
+			arcs_assert(0 < i && i <= N);
+			PosRef[i - 1] = PosCmd;
+			VelFF[i - 1] = VelFeedFwd;
+			CurFF[i - 1] = CurFeedFwd;
+		}
+
+		//! @brief 全軸の指令値とフィードフォワードをベクトルで設定する関数
+		//! @param[in]	PosCmd	[rad] 位置指令ベクトル
+		//! @param[in]	VelFeedFwd	[rad/s] 速度フィードフォワードベクトル
+		//! @param[in]	CurFeedFwd	[A] 電流フィードフォワードベクトル
+		void SetReferences(const ArcsMat<N,1,T>& PosCmd, const ArcsMat<N,1,T>& VelFeedFwd, const ArcsMat<N,1,T>& CurFeedFwd){
+			for(size_t j = 0; j < N; ++j){
+				PosRef[j] = PosCmd[j + 1];
+				VelFF[j] = VelFeedFwd[j + 1];
+				CurFF[j] = CurFeedFwd[j + 1];
+			}
+		}
+
+		//! @brief フィードバック値を設定する関数
+		//! @param[in]	i	軸番号 (1～N)
+		//! @param[in]	Theta	[rad] 位置
+		//! @param[in]	Omega	[rad/s] 速度
+		//! @param[in]	Iq		[A] q軸電流
+		void SetFeedback(const size_t i, const T Theta, const T Omega, const T Iq){
+			arcs_assert(0 < i && i <= N);
+			Pos[i - 1] = Theta;
+			Vel[i - 1] = Omega;
+			Cur[i - 1] = Iq;
+		}
+
+		//! @brief 全軸のフィードバック値をベクトルで設定する関数
+		//! @param[in]	Theta	[rad] 位置ベクトル
+		//! @param[in]	Omega	[rad/s] 速度ベクトル
+		//! @param[in]	Iq		[A] q軸電流ベクトル
+		void SetFeedbacks(const ArcsMat<N,1,T>& Theta, const ArcsMat<N,1,T>& Omega, const ArcsMat<N,1,T>& Iq){
+			for(size_t j = 0; j < N; ++j){
+				Pos[j] = Theta[j + 1];
+				Vel[j] = Omega[j + 1];
+				Cur[j] = Iq[j + 1];
+			}
+		}
+
+		//! @brief フィードバック値をモータから読み込む関数
+		//! @tparam	M	モータの型 (GetTheta, GetOmega, GetIqCurrent を持つ型，AcMotor など)
+		//! @param[in]	i	軸番号 (1～N)
+		//! @param[in]	Motor	モータ
+		template<typename M>
+		void SetFeedback(const size_t i, const M& Motor){
+			SetFeedback(i, static_cast<T>(Motor.GetTheta()), static_cast<T>(Motor.GetOmega()), static_cast<T>(Motor.GetIqCurrent()));
+		}
+
+		//! @brief 全軸の制御器を1サンプル分更新する関数
+		//! 全軸を1本のループで計算する。分岐は選択に置き換わるので，ループはそのままベクトル化される。
+		//! 指令値とフィードバック値をベクトルでまとめて設定する場合に向く。
+		void Update(void){
+			const T h = Ts;	// 配列への書き込みと重ならないことが分かるように局所変数に置く
+			for(size_t j = 0; j < N; ++j) UpdateAxis(j, h);
+		}
+
+		//! @brief 1軸分の制御器を1サンプル分更新する関数
+		//! 軸ごとにフィードバック値を設定した直後に呼ぶ場合はこちらを使う。
+		//! (1軸ずつ書き込んだ直後の配列をまとめて読むと，ストアフォワーディングが効かずに全軸版の方が遅くなるため)
+		//! @param[in]	i	軸番号 (1～N)
+		void Update(const size_t i){
+			arcs_assert(0 < i && i <= N);
+			UpdateAxis(i - 1, Ts);
+		}
+
+		//! @brief 電流指令を返す関数
+		//! @param[in]	i	軸番号 (1～N)
+		//! @return	[A] 電流指令
+		T GetCurrentRef(const size_t i) const {
+			arcs_assert(0 < i && i <= N);
+			return CurRef[i - 1];
+		}
+
+		//! @brief 全軸の電流指令をベクトルで返す関数
+		//! @param[out]	y	[A] 電流指令ベクトル
+		void GetCurrentRefs(ArcsMat<N,1,T>& y) const {
+			for(size_t j = 0; j < N; ++j) y[j + 1] = CurRef[j];
+		}
+
+		//! @brief 速度指令(位置制御器の出力)を返す関数
+		//! @param[in]	i	軸番号 (1～N)
+		//! @return	[rad/s] 速度指令
+		T GetVelocityRef(const size_t i) const {
+			arcs_assert(0 < i && i <= N);
+			return VelRef[i - 1];
+		}
+
+		//! @brief 速度制御器の積分器の値を返す関数
+		//! @param[in]	i	軸番号 (1～N)
+		//! @return	[A] 積分器の値
+		T GetIntegral(const size_t i) const {
+			arcs_assert(0 < i && i <= N);
+			return Xi[i - 1];
+		}
+
+		//! @brief すべての状態変数のリセット
+		void ClearStateVars(void){
+			Xi.fill(0);
+			VelRef.fill(0);
+			CurRef.fill(0);
+		}
+
+	private:
+		CascadedServoLoop(const CascadedServoLoop&) = delete;					//!< コピーコンストラクタ使用禁止
+		const CascadedServoLoop& operator=(const CascadedServoLoop&) = delete;	//!< 代入演算子使用禁止
+
+		T Ts;						//!< [s] 制御周期
+		std::array<T, N> Kpp;		//!< [1/s] 位置比例ゲイン
+		std::array<T, N> Kvp;		//!< 速度比例ゲイン
+		std::array<T, N> Kvi;		//!< 速度積分ゲイン
+		std::array<T, N> Kaw;		//!< 逆算法のゲイン
+		std::array<T, N> VelLimit;	//!< [rad/s] 速度指令のリミット
+		std::array<T, N> CurLimit;	//!< [A] 電流指令のリミット
+		std::array<T, N> Enable;	//!< 有効フラグ (ベクトル化のため他の配列と同じ型で 1 か 0 を持つ)
+		std::array<T, N> PosRef;	//!< [rad] 位置指令
+		std::array<T, N> VelFF;		//!< [rad/s] 速度フィードフォワード
+		std::array<T, N> CurFF;		//!< [A] 電流フィードフォワード
+		std::array<T, N> Pos;		//!< [rad] 位置
+		std::array<T, N> Vel;		//!< [rad/s] 速度
+		std::array<T, N> Cur;		//!< [A] 測定電流
+		std::array<T, N> Xi;		//!< [A] 速度制御器の積分器の値
+		std::array<T, N> VelRef;	//!< [rad/s] 速度指令
+		std::array<T, N> CurRef;	//!< [A] 電流指令
+
+		//! @brief 1軸分の制御器の計算
+		//! @param[in]	j	配列の要素番号 (0～N-1)
+		//! @param[in]	h	[s] 制御周期
+		void UpdateAxis(const size_t j, const T h){
+			// 位置制御 (P + 速度フィードフォワード，速度リミット付き)
+			const T wr = std::min(std::max(Kpp[j]*(PosRef[j] - Pos[j]) + VelFF[j], -VelLimit[j]), VelLimit[j]);
+
+			// 速度制御 (PI + 電流フィードフォワード，電流リミット付き)
+			// 積分器の値に依らない項を先にまとめておき，積分器の値から次の積分器の値までの依存の連鎖を短くする
+			const T e = wr - Vel[j];
+			const T dxi = h*Kvi[j]*e;						// 後退オイラー法の積分の増分
+			const T v = Xi[j] + (Kvp[j]*e + CurFF[j] + dxi);	// リミット前の電流指令
+			const T u = std::min(std::max(v, -CurLimit[j]), CurLimit[j]);
+
+			// 有効なら逆算法で積分器を戻し，無効なら測定電流を出して積分器を追従させる
+			const bool On = Enable[j] != 0;
+			VelRef[j] = wr;
+			CurRef[j] = On ? u : Cur[j];
+			Xi[j] = On ? Xi[j] + dxi + h*Kaw[j]*(u - v) : Cur[j] - Kvp[j]*e - CurFF[j];
+		}
+};
+}
+
+#endif
+
@@ -3,7 +3,7 @@
 //!
 //! std::arrayやMatrixの値をCSVファイルとして読み書きしたりするクラス
 //!
-//! @date 2020/05/24
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2020 Yokokura, Yuki
@@ -19,6 +19,7 @@
 #include <memory>
 #include <string>
 #include <fstream>
+#include <functional>
 #include "Matrix.hh"
 
 // ARCS組込み用マクロ
@@ -129,6 +130,7 @@ class CsvManipulator {
 		}
 		
 		//! @brief 2次元std::arrayをCSVファイルに書き出す関数(スマートポインタ＆書き出すサイズを指定する版)
+		//! 所有権ごと受け取るので，別スレッドにデータを引き渡して書き出す用途にも使える。
 		//! @tparam	E	浮動小数点数の表現方法(デフォルトは指数表記)
 		//! @tparam N	配列の横幅
 		//! @tparam	M	配列の縦の長さ
@@ -136,8 +138,12 @@ class CsvManipulator {
 		//! @param[in]	FileName	ファイル名
 		//! @param[in]	NN	書き出す横幅
 		//! @param[in]	MM	書き出す縦の長さ
+		//! @param[in]	Progress	進捗通知用の関数オブジェクト(引数は0～1の進捗率, 不要ならnullptr)
 		template <CsvExpression E = CsvExpression::EXPONENTIAL, size_t N, size_t M>
-		static void SaveFile(std::unique_ptr< std::array<std::array<double, N>, M> >&& Data, const std::string& FileName, size_t NN, size_t MM){	
+		static void SaveFile(
+			std::unique_ptr< std::array<std::array<double, N>, M> >&& Data, const std::string& FileName, size_t NN, size_t MM,
+			const std::function<void(double)>& Progress = nullptr
+		){
 			std::ofstream fout(FileName.c_str(), std::ios::out | std::ios::trunc);	// ファイル出力ストリーム
 			CheckError(fout);		// エラーチェック
 			SetExpression<E>(fout);	// 浮動小数点数の表現設定
@@ -150,8 +156,11 @@ class CsvManipulator {
 						fout << ',';	// コンマで区切る
 					}
 				}
-				fout << std::endl;		// 改行
+				fout << '\n';			// 改行(行毎のフラッシュはしない)
+				if(Progress != nullptr && j % PROGRESS_ROWS == 0) Progress(static_cast<double>(j)/static_cast<double>(MM));	// 進捗通知
 			}
+			fout.flush();		// 最後にまとめてフラッシュ
+			if(Progress != nullptr) Progress(1);	// 完了通知
 		}
 		
 		//! @brief CSVファイルから2次元std::arrayに読み込む関数
@@ -231,6 +240,8 @@ class CsvManipulator {
 		CsvManipulator(const CsvManipulator&) = delete;					//!< コピーコンストラクタ使用禁止
 		const CsvManipulator& operator=(const CsvManipulator&) = delete;//!< 代入演算子使用禁止
 		
+		static constexpr size_t PROGRESS_ROWS = 1024;	//!< [行] 進捗通知の間隔
+		
 		//! @brief ファイル書き込みエラーのチェック
 		//! @param[in]	fileout	ファイル出力ストリーム
 		static void CheckError(const std::ofstream& fileout){
@@ -0,0 +1,14 @@
+//! @file DelayLine.cc
+//! @brief 固定長遅延線クラス
+//!
+//! 遅延器 G(s)=e^(-s*Td) を，制御周期の整数倍に限らない任意の遅延時間で実現するクラス。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "DelayLine.hh"
+
+// テンプレートクラスのため，実体もヘッダ側に実装。
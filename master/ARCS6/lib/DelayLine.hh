@@ -0,0 +1,251 @@
+//! @file DelayLine.hh
+//! @brief 固定長遅延線クラス
+//!
+//! 遅延器 G(s)=e^(-s*Td) を，制御周期の整数倍に限らない任意の遅延時間で実現するクラス。
+//! - 容量はテンプレート引数で与え，2の冪乗長のリングバッファをマスクで添字付けするので，動的確保も添字の場合分けもしない。
+//! - 端数の遅延は3次のラグランジュ補間(FIR)か，1次のティラン補間(全域通過IIR)で実現する。
+//! - 主出力とは別に，任意の遅延時間の値を複数取り出せる(マルチタップ)。
+//! - オフラインシミュレーション用に，入力ベクトルをまとめて処理するブロック処理版もある。
+//!
+//! @par 補間方法の使い分け
+//! - ラグランジュ補間は振幅特性が高域で少し落ちるが，状態を持たないので遅延時間を毎サンプル変えても過渡が出ない。
+//! - ティラン補間は振幅特性が平坦(全域通過)だが，状態を持つので遅延時間を急に変えると過渡が出る。
+//!   また遅延時間は0.5サンプル以上とする(それより短いと1サンプル遅延の係数が不安定側に寄る)。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef DELAYLINE
+#define DELAYLINE
+
+#include <cassert>
+#include <cmath>
+#include <array>
+#include <algorithm>
+#include <tuple>
+#include "ArcsMatrix.hh"
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+	#include "ARCSeventlog.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+	#define PassedLog()
+	#define EventLog(a)
+	#define EventLogVar(a)
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief 端数の遅延の補間方法の定義
+enum class DelayInterp {
+	DLY_LAGRANGE,	//!< 3次のラグランジュ補間 (FIR, 状態なし)
+	DLY_THIRAN		//!< 1次のティラン補間 (全域通過IIR)
+};
+
+//! @brief 固定長遅延線クラス
+//! @tparam	C	[サンプル] 最大遅延時間
+//! @tparam	I	端数の遅延の補間方法 (デフォルトはラグランジュ補間)
+//! @tparam	T	データ型 (デフォルトはdouble型)
+template <size_t C, DelayInterp I = DelayInterp::DLY_LAGRANGE, typename T = double>
+class DelayLine {
+	public:
+		static constexpr size_t BLK = 64;	//!< ブロック処理の1回あたりのサンプル数
+
+		//! @brief コンストラクタ
+		DelayLine()
+			: Buffer(), w(0), n(0), Integer(true), h(), a(0), yz(0)
+		{
+			PassedLog();
+		}
+
+		//! @brief コンストラクタ(遅延時間設定版)
+		//! @param[in]	D	[サンプル] 遅延時間 (0～C，端数可)
+		explicit DelayLine(const double D)
+			: Buffer(), w(0), n(0), Integer(true), h(), a(0), yz(0)
+		{
+			SetDelay(D);
+			PassedLog();
+		}
+
+		//! @brief ムーブコンストラクタ
+		//! @param[in]	r	右辺値
+		DelayLine(DelayLine&& r)
+			: Buffer(std::move(r.Buffer)), w(r.w), n(r.n), Integer(r.Integer), h(r.h), a(r.a), yz(r.yz)
+		{
+
+		}
+
+		//! @brief デストラクタ
+		~DelayLine(){
+			PassedLog();
+		}
+
+		//! @brief 遅延時間を制御周期の整数倍で設定する関数
+		//! @param[in]	Delay	[サンプル] 遅延時間 (最大遅延時間を越える場合は最大遅延時間に制限)
+		void SetDelayTime(const size_t Delay){
+			n = std::min(Delay, C);
+			Integer = true;
+		}
+
+		//! @brief 遅延時間を秒で設定する関数
+		//! @param[in]	Td	[s] 遅延時間
+		//! @param[in]	Ts	[s] 制御周期
+		void SetDelayTime(const double Td, const double Ts){
+			SetDelay(Td/Ts);
+		}
+
+		//! @brief 遅延時間をサンプル数(端数可)で設定する関数
+		//! @param[in]	D	[サンプル] 遅延時間 (0～C に制限，NaN は不可。アサートが戻った場合は 0 として扱う)
+		void SetDelay(const double D){
+			arcs_assert(!std::isnan(D));
+			const double Dl = std::isnan(D) ? 0.0 : std::clamp(D, 0.0, static_cast<double>(C));	// NaN のまま整数に変換すると未定義動作
+			const size_t Di = static_cast<size_t>(Dl);
+			if(static_cast<double>(Di) == Dl){
+				SetDelayTime(Di);	// 整数なら補間しない
+				return;
+			}
+			Integer = false;
+			if constexpr(I == DelayInterp::DLY_LAGRANGE){
+				std::tie(n, h) = LagrangeCoeff(Dl);
+			}else{
+				// 1次ティラン補間 y[k] = a*x[k-n] + x[k-n-1] - a*y[k-1]，端数 d は 0.5～1.5 に取ると最も良い
+				const double Dt = std::max(Dl, 0.5);
+				n = static_cast<size_t>(Dt - 0.5);
+				const double d = Dt - static_cast<double>(n);
+				a = static_cast<T>((1.0 - d)/(1.0 + d));
+			}
+		}
+
+		//! @brief 遅延線の先頭に入力を詰める関数 (主出力は計算しない)
+		//! @param[in]	u	入力信号
+		void Push(const T& u){
+			Buffer[w & MASK] = u;
+			++w;	// 符号なし整数の桁あふれで一周しても，長さが2の冪乗なのでマスクすれば連続になる
+		}
+
+		//! @brief 入力を詰めて，設定した遅延時間だけ遅れた出力を返す関数
+		//! @param[in]	u	入力信号
+		//! @return	出力信号
+		T GetSignal(const T& u){
+			Push(u);
+			if(Integer) return Tap(n);
+			if constexpr(I == DelayInterp::DLY_LAGRANGE){
+				return h[0]*Tap(n) + h[1]*Tap(n + 1) + h[2]*Tap(n + 2) + h[3]*Tap(n + 3);
+			}else{
+				yz = a*Tap(n) + Tap(n + 1) - a*yz;
+				return yz;
+			}
+		}
+
+		//! @brief 入力ベクトルをまとめて遅延させる関数 (オフラインシミュレーション用のブロック処理版)
+		//! GetSignal を要素ごとに順に呼ぶのと同じ結果になる。ラグランジュ補間と整数遅延では，
+		//! 区間ごとに遅延線から連続した作業領域に写してから積和を取るので，内側のループがベクトル化される。
+		//! @tparam	M	入力ベクトルの高さ
+		//! @tparam	N	入力ベクトルの幅
+		//! @param[in]	u	入力ベクトル (列優先の順に時系列として扱う)
+		//! @param[out]	y	出力ベクトル
+		template<size_t M, size_t N>
+		void GetSignals(const ArcsMat<M,N,T>& u, ArcsMat<M,N,T>& y){
+			static_assert(M == 1 || N == 1, "DelayLine: Vector Only");
+			constexpr size_t K = M*N;
+			const T* const up = &(u.ReadOnlyRef()[0][0]);
+			T* const yp = &y(1,1);
+			if constexpr(I == DelayInterp::DLY_THIRAN){
+				if(!Integer){
+					for(size_t k = 0; k < K; ++k) yp[k] = GetSignal(up[k]);	// 再帰型なので1サンプルずつ
+					return;
+				}
+			}
+			const size_t m = Integer ? 0 : 3;	// 補間に使う余分なタップ数
+			std::array<T, BLK + 3> Work;		// 遅延線から写した連続領域
+			for(size_t k0 = 0; k0 < K; k0 += BLK){
+				const size_t L = std::min(BLK, K - k0);
+				for(size_t k = 0; k < L; ++k) Buffer[(w + k) & MASK] = up[k0 + k];	// 区間の入力をまとめて詰める
+				w += L;
+				const size_t Start = w - L - n - m;	// 作業領域の先頭に対応する書き込み番号
+				T* const yb = yp + k0;
+				if(Integer){
+					for(size_t k = 0; k < L; ++k) yb[k] = Buffer[(Start + k) & MASK];	// 整数遅延なら直接写す
+				}else{
+					for(size_t j = 0; j < L + m; ++j) Work[j] = Buffer[(Start + j) & MASK];
+					for(size_t k = 0; k < L; ++k) yb[k] = h[0]*Work[k + 3] + h[1]*Work[k + 2] + h[2]*Work[k + 1] + h[3]*Work[k];
+				}
+			}
+		}
+
+		//! @brief 最新の入力から整数サンプルだけ遅れた値を取り出す関数 (マルチタップ用)
+		//! @param[in]	Delay	[サンプル] 遅延時間 (0～C)
+		//! @return	遅延した値
+		T GetTap(const size_t Delay) const {
+			arcs_assert(Delay <= C);
+			return Tap(Delay);
+		}
+
+		//! @brief 最新の入力から端数を含むサンプル数だけ遅れた値を取り出す関数 (マルチタップ用，ラグランジュ補間)
+		//! @param[in]	D	[サンプル] 遅延時間 (0～C)
+		//! @return	遅延した値
+		T GetFractionalTap(const double D) const {
+			arcs_assert(0 <= D && D <= static_cast<double>(C));
+			const auto [m, c] = LagrangeCoeff(D);
+			return c[0]*Tap(m) + c[1]*Tap(m + 1) + c[2]*Tap(m + 2) + c[3]*Tap(m + 3);
+		}
+
+		//! @brief 遅延メモリをゼロクリアする関数
+		void ClearDelayMemory(void){
+			Buffer.fill(0);
+			yz = 0;
+		}
+
+	private:
+		DelayLine(const DelayLine&) = delete;					//!< コピーコンストラクタ使用禁止
+		const DelayLine& operator=(const DelayLine&) = delete;	//!< 代入演算子使用禁止
+
+		//! @brief x 以上の最小の2の冪乗を返す関数
+		static constexpr size_t NextPow2(const size_t x){
+			size_t ret = 1;
+			while(ret < x) ret *= 2;
+			return ret;
+		}
+
+		static constexpr size_t LEN = NextPow2(C + 4 + BLK);	//!< リングバッファの長さ (補間の余分なタップとブロック処理の1回分を含む)
+		static constexpr size_t MASK = LEN - 1;				//!< 添字のマスク
+
+		std::array<T, LEN> Buffer;	//!< リングバッファ
+		size_t w;					//!< 書き込み番号 (次に書き込む位置)
+		size_t n;					//!< [サンプル] 主出力の最初のタップの遅延時間
+		bool Integer;				//!< 整数遅延かどうか
+		std::array<T, 4> h;			//!< ラグランジュ補間の係数
+		T a;						//!< ティラン補間の係数
+		T yz;						//!< ティラン補間の1サンプル前の出力
+
+		//! @brief 最新の入力から Delay サンプル遅れた値を返す関数
+		T Tap(const size_t Delay) const {
+			return Buffer[(w - 1 - Delay) & MASK];
+		}
+
+		//! @brief 3次のラグランジュ補間の係数を計算する関数
+		//! 遅延時間 D の前後2タップずつ(D の近くが0未満になる場合は0から4タップ)を使う。
+		//! @param[in]	D	[サンプル] 遅延時間
+		//! @return	{最初のタップの遅延時間, 係数}
+		static std::tuple<size_t, std::array<T, 4>> LagrangeCoeff(const double D){
+			const size_t m = D < 1 ? 0 : static_cast<size_t>(D) - 1;
+			const double d = D - static_cast<double>(m);	// 最初のタップから測った遅延 (0～2)
+			const std::array<T, 4> c = {
+				static_cast<T>(-(d - 1)*(d - 2)*(d - 3)/6),
+				static_cast<T>(d*(d - 2)*(d - 3)/2),
+				static_cast<T>(-d*(d - 1)*(d - 3)/2),
+				static_cast<T>(d*(d - 1)*(d - 2)/6)
+			};
+			return {m, c};
+		}
+};
+}
+
+#endif
+
@@ -14,6 +14,8 @@
 #ifndef DIFFERENTIATOR
 #define DIFFERENTIATOR
 
+#include <cstddef>
+
 namespace ARCS {	// ARCS名前空間
 	//! @brief  擬似微分器クラス
 	class Differentiator {
@@ -28,6 +30,7 @@ namespace ARCS {	// ARCS名前空間
 			// コンストラクタ Bandwidth；[rad/s] 帯域，SmplTime；[s] 制御周期
 			~Differentiator();					// デストラクタ
 			double GetSignal(double u);			// 出力信号の取得 u；入力信号
+			void GetSignals(const double* u, double* y, const size_t K);	// 出力信号の一括取得 u；入力信号の配列，y；出力信号の配列，K；サンプル数
 			void SetBandwidth(double Bandwidth);// 擬似微分の帯域の再設定 Bandwidth；[rad/s] 帯域
 			void SetSmplTime(double SmplTime);	// 制御周期の再設定 SmplTime；[s] 制御周期
 			void ClearStateVars(void);			// すべての状態変数のリセット
@@ -49,6 +49,37 @@ double Differentiator2::GetSignal(double u){
 	return y;
 }
 
+void Differentiator2::GetSignals(const double* u, double* y, const size_t K){
+	// 出力信号の一括取得 u；入力信号の配列，y；出力信号の配列，K；サンプル数 (u と y は同じ配列でも良い)
+	// GetSignal を K 回呼ぶのと同じ式で計算するので結果はビット単位で一致する。
+	// 係数の計算をループの外に出し，状態変数を局所変数に置いたまま漸化式を回す。
+	const double k1 = 4.0*Q*Ts, k2 = 2.0*w*Ts*Ts, k3 = Q*Ts*Ts*Ts*w*w;	// 係数
+	const double den = 4.0*Q*Ts + 2.0*w*Ts*Ts + Q*Ts*Ts*Ts*w*w;
+	const double k0 = 4.0*Q*Ts*w*w;
+	double u1 = uZ1, u2 = uZ2, u3 = uZ3, y1 = yZ1, y2 = yZ2, y3 = yZ3;
+	for(size_t k = 0; k < K; ++k){
+		const double uk = u[k];
+		double yk = k0*(u3-u2-u1+uk)
+		   -k1*(y3-y2-y1)
+		   -k2*(-y3-y2+y1)
+		   -k3*(y3+3.0*y2+3.0*y1);
+		yk = yk * 1.0/den;
+		y[k] = yk;
+		u3 = u2;
+		u2 = u1;
+		u1 = uk;
+		y3 = y2;
+		y2 = y1;
+		y1 = yk;
+	}
+	uZ1 = u1;
+	uZ2 = u2;
+	uZ3 = u3;
+	yZ1 = y1;
+	yZ2 = y2;
+	yZ3 = y3;
+}
+
 void Differentiator2::SetBandwidth(double Bandwidth){
 	// 擬似微分の帯域の再設定 Bandwidth；[rad/s] 帯域
 	w=Bandwidth;
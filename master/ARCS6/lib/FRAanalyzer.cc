@@ -0,0 +1,14 @@
+//! @file FRAanalyzer.cc
+//! @brief FRA用周波数応答解析器
+//!
+//! Frequency Response Analysis の入出力信号を制御ループの中で逐次相関して，ボード線図の表を作るクラス。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "FRAanalyzer.hh"
+
+// テンプレートクラスのため，実体もヘッダ側に実装。
@@ -0,0 +1,237 @@
+//! @file FRAanalyzer.hh
+//! @brief FRA用周波数応答解析器
+//!
+//! Frequency Response Analysis の入出力信号を制御ループの中で逐次相関して，ボード線図の表を作るクラス。
+//! - 周波数ステップ正弦波(FRAgenerator)では，1周波数ずつ入力と出力を単一ビンのDFTで相関し，
+//!   周波数が切り替わった時点でその周波数のゲインと位相を表に追加する。
+//! - チャープ信号(ChirpGenerator)では，対数等間隔に並べた複数のビンで入力と出力の全区間を同時に相関し，
+//!   最後に各ビンの出力/入力の比からゲインと位相を求める。
+//! - 記録するのは周波数ごとの相関値と表だけなので，メモリ量は周波数の数に比例し，サンプル数に依らない。
+//! - 周波数ステップ正弦波では，周波数が切り替わった直後の過渡応答を相関に含めないように，
+//!   各周波数の最初の何周期かを読み捨てられる(積分周期からその分を引いた整数周期で相関する)。
+//!
+//! @par 相関の計算について
+//! 各ビンの e^{jωkTs} は，cos(ωTs), sin(ωTs) による回転を毎サンプル掛ける直交発振器で作る。
+//! ゲルツェルのアルゴリズムと同じく1サンプルあたり三角関数を呼ばずに済み，入力と出力で同じ発振器を共有できる。
+//! 発振器の振幅や位相の丸め誤差は入力と出力の両方に同じだけ乗るので，比を取ると打ち消される。
+//! バイアス(直流分)は，区間内の平均値を差し引いてから相関した値に直して取り除く。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef FRAANALYZER
+#define FRAANALYZER
+
+#include <cassert>
+#include <cmath>
+#include <array>
+#include <tuple>
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+	#include "ARCSeventlog.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+	#define PassedLog()
+	#define EventLog(a)
+	#define EventLogVar(a)
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief FRA用周波数応答解析器
+//! @tparam	NF	ボード線図の表の最大の点数 (= ビンの最大数)
+template <size_t NF = 256>
+class FRAanalyzer {
+	static_assert(0 < NF, "FRAanalyzer: Size Error");
+	public:
+		//! @brief コンストラクタ
+		//! @param[in]	SmplTime	[s] サンプリング周期
+		//! @param[in]	SettlingPeriods	[-] 周波数ステップ正弦波で各周波数の最初に読み捨てる周期数 (デフォルト値 = 0)
+		explicit FRAanalyzer(const double SmplTime, const double SettlingPeriods = 0)
+			: Ts(SmplTime), Nsettle(SettlingPeriods), Nskip(0), Nb(0), Ns(0), Su(0), Sy(0), Fb(), C(), S(), Cw(), Sw(), Ur(), Ui(), Yr(), Yi(), Sc(), Ss(), Np(0), Table()
+		{
+			PassedLog();
+		}
+
+		//! @brief デストラクタ
+		~FRAanalyzer(){
+			PassedLog();
+		}
+
+		//! @brief 周波数ステップ正弦波の入出力を1サンプル分相関する関数
+		//! FRAgenerator の周波数が変わったら，それまでの周波数の結果を表に追加して，新しい周波数の相関を始める。
+		//! FRAの動作中(FRAgenerator::IsRunning() が true の間)だけ呼び，終わったら Finish() を呼ぶこと。
+		//! @param[in]	Freq	[Hz] 周波数 (FRAgenerator の出力)
+		//! @param[in]	Input	入力信号 (プラントに加えた信号)
+		//! @param[in]	Output	出力信号 (プラントの応答)
+		void Update(const double Freq, const double Input, const double Output){
+			if(Nb != 1 || Freq != Fb[0]){
+				Finish();			// 前の周波数の結果を表に追加して，
+				SetBin(0, Freq);	// 新しい周波数のビンを用意する
+				Nb = 1;
+				Nskip = static_cast<size_t>(std::ceil(Nsettle/(Freq*Ts)));	// 過渡応答の分だけ読み捨てるサンプル数
+			}
+			if(0 < Nskip){
+				--Nskip;
+				return;
+			}
+			UpdateBins(Input, Output);
+		}
+
+		//! @brief チャープ信号の解析用に，対数等間隔のビンを設定する関数
+		//! @param[in]	FreqMin	[Hz] 最小周波数
+		//! @param[in]	FreqMax	[Hz] 最大周波数
+		//! @param[in]	NumBins	ビンの数 (2以上)
+		void SetBins(const double FreqMin, const double FreqMax, const size_t NumBins){
+			arcs_assert(1 < NumBins && NumBins <= NF);		// ビンの数のチェック
+			arcs_assert(0 < FreqMin && FreqMin < FreqMax);	// 周波数のチェック
+			Finish();
+			const double r = std::log(FreqMax/FreqMin)/static_cast<double>(NumBins - 1);
+			for(size_t j = 0; j < NumBins; ++j) SetBin(j, FreqMin*std::exp(r*static_cast<double>(j)));
+			Nb = NumBins;
+		}
+
+		//! @brief 設定したすべてのビンについて入出力を1サンプル分相関する関数
+		//! @param[in]	Input	入力信号 (プラントに加えた信号)
+		//! @param[in]	Output	出力信号 (プラントの応答)
+		void UpdateBins(const double Input, const double Output){
+			// ビンごとの配列(SoA形式)について1本のループで計算するのでベクトル化される
+			for(size_t j = 0; j < Nb; ++j){
+				const double c = C[j], s = S[j];
+				Ur[j] += Input*c;
+				Ui[j] += Input*s;
+				Yr[j] += Output*c;
+				Yi[j] += Output*s;
+				Sc[j] += c;
+				Ss[j] += s;
+				C[j] = c*Cw[j] - s*Sw[j];	// 発振器を ωTs だけ回す
+				S[j] = s*Cw[j] + c*Sw[j];
+			}
+			Su += Input;
+			Sy += Output;
+			++Ns;
+		}
+
+		//! @brief 相関中のすべてのビンのゲインと位相を表に追加して，相関をやり直す関数
+		//! 相関していない(サンプルが無い)ときは何もしない。
+		void Finish(void){
+			if(Ns == 0) return;
+			const double n = static_cast<double>(Ns);
+			for(size_t j = 0; j < Nb && Np < NF; ++j){	// 表が一杯のときはそれ以上追加しない
+				// 直流分を除いた入力と出力のDFT　U = Σ(u - ū)e^{-jθ}, Y = Σ(y - ȳ)e^{-jθ}
+				const double Ure = Ur[j] - Su/n*Sc[j], Uim = -(Ui[j] - Su/n*Ss[j]);
+				const double Yre = Yr[j] - Sy/n*Sc[j], Yim = -(Yi[j] - Sy/n*Ss[j]);
+
+				// 周波数応答 H = Y/U のゲインと位相
+				const double Gain = 10.0*std::log10((Yre*Yre + Yim*Yim)/(Ure*Ure + Uim*Uim));
+				double Phase = std::atan2(Yim*Ure - Yre*Uim, Yre*Ure + Yim*Uim)*180.0/M_PI;
+				if(0 < Np){
+					// 1つ前の点との差が ±180 [deg] 以内になるように位相を繋ぐ
+					const double Prev = Table[Np - 1][2];
+					Phase -= 360.0*std::round((Phase - Prev)/360.0);
+				}
+				Table[Np] = {Fb[j], Gain, Phase};
+				++Np;
+			}
+			for(size_t j = 0; j < Nb; ++j) SetBin(j, Fb[j]);	// 同じ周波数で相関をやり直せるように初期化
+			Su = 0;
+			Sy = 0;
+			Ns = 0;
+		}
+
+		//! @brief ボード線図の表の点数を返す関数
+		//! @return	点数 (周波数が1つ終わるごとに増える)
+		size_t GetNumOfPoints(void) const {
+			return Np;
+		}
+
+		//! @brief ボード線図の表の1点を返す関数(引数で返す版)
+		//! @param[in]	k		点の番号 (0～GetNumOfPoints()-1)
+		//! @param[out]	Freq	[Hz] 周波数
+		//! @param[out]	Gain	[dB] ゲイン
+		//! @param[out]	Phase	[deg] 位相
+		void GetPoint(const size_t k, double& Freq, double& Gain, double& Phase) const {
+			arcs_assert(k < Np);	// 範囲チェック
+			Freq = Table[k][0];
+			Gain = Table[k][1];
+			Phase = Table[k][2];
+		}
+
+		//! @brief ボード線図の表の1点を返す関数(タプルで返す版)
+		//! @param[in]	k	点の番号 (0～GetNumOfPoints()-1)
+		//! @return	{周波数 [Hz], ゲイン [dB], 位相 [deg]} のタプル
+		std::tuple<double, double, double> GetPoint(const size_t k) const {
+			double Freq, Gain, Phase;
+			GetPoint(k, Freq, Gain, Phase);
+			return {Freq, Gain, Phase};
+		}
+
+		//! @brief ボード線図の表を返す関数
+		//! CsvManipulator::SaveFile(Table, FileName, 3, GetNumOfPoints()) でそのままCSVファイルに書き出せる。
+		//! @return	{周波数 [Hz], ゲイン [dB], 位相 [deg]} を1行とする表
+		const std::array<std::array<double, 3>, NF>& GetBodeTable(void) const {
+			return Table;
+		}
+
+		//! @brief ボード線図の表と相関中の値をすべて消去する関数
+		void ClearBodeTable(void){
+			Nskip = 0;
+			Nb = 0;
+			Ns = 0;
+			Su = 0;
+			Sy = 0;
+			Np = 0;
+		}
+
+	private:
+		FRAanalyzer(const FRAanalyzer&) = delete;					//!< コピーコンストラクタ使用禁止
+		const FRAanalyzer& operator=(const FRAanalyzer&) = delete;	//!< 代入演算子使用禁止
+
+		double Ts;					//!< [s] サンプリング周期
+		double Nsettle;				//!< [-] 周波数ステップ正弦波で各周波数の最初に読み捨てる周期数
+		size_t Nskip;				//!< 読み捨てる残りのサンプル数
+		size_t Nb;					//!< 相関中のビンの数
+		size_t Ns;					//!< 相関したサンプル数
+		double Su;					//!< 入力の総和
+		double Sy;					//!< 出力の総和
+		std::array<double, NF> Fb;	//!< [Hz] ビンの周波数
+		std::array<double, NF> C;	//!< 発振器の余弦
+		std::array<double, NF> S;	//!< 発振器の正弦
+		std::array<double, NF> Cw;	//!< 1サンプルあたりの回転の余弦 cos(ωTs)
+		std::array<double, NF> Sw;	//!< 1サンプルあたりの回転の正弦 sin(ωTs)
+		std::array<double, NF> Ur;	//!< 入力と余弦の相関
+		std::array<double, NF> Ui;	//!< 入力と正弦の相関
+		std::array<double, NF> Yr;	//!< 出力と余弦の相関
+		std::array<double, NF> Yi;	//!< 出力と正弦の相関
+		std::array<double, NF> Sc;	//!< 余弦の総和 (直流分の除去用)
+		std::array<double, NF> Ss;	//!< 正弦の総和 (直流分の除去用)
+		size_t Np;					//!< ボード線図の表の点数
+		std::array<std::array<double, 3>, NF> Table;	//!< ボード線図の表 {周波数 [Hz], ゲイン [dB], 位相 [deg]}
+
+		//! @brief ビンの周波数を設定して相関値を初期化する関数
+		//! @param[in]	j		配列の要素番号
+		//! @param[in]	Freq	[Hz] ビンの周波数
+		void SetBin(const size_t j, const double Freq){
+			Fb[j] = Freq;
+			C[j] = 1;
+			S[j] = 0;
+			Cw[j] = std::cos(2.0*M_PI*Freq*Ts);
+			Sw[j] = std::sin(2.0*M_PI*Freq*Ts);
+			Ur[j] = 0;
+			Ui[j] = 0;
+			Yr[j] = 0;
+			Yi[j] = 0;
+			Sc[j] = 0;
+			Ss[j] = 0;
+		}
+};
+}
+
+#endif
+
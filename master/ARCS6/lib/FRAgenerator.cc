@@ -28,7 +28,7 @@ FRAgenerator::FRAgenerator(
 	const double TimeSta		// [s] FRA開始時刻
 )
 	: Fmin(FreqMin), Fmax(FreqMax), Fstep(FreqStep), Ni(NumIntg), Au(Ampl), Bu(Bias), Tsta(TimeSta),
-	  isEnd(false), f(Fmin), tini(0), tauclmb(0)
+	  isEnd(false), isRun(false), f(Fmin), tini(0), tauclmb(0)
 {
 	PassedLog();
 }
@@ -47,6 +47,7 @@ void FRAgenerator::GetSignal(const double Time, double& Freq, double& Output){
 	
 	if(Tsta <= Time && isEnd == false){		// FRA開始時刻を過ぎて，且つ最大周波数以下であれば，
 		Output = Au*cos(2.0*M_PI*f*(t - tini)) + Bu;	 // [A] FRA信号を生成
+		isRun = true;
 		
 		if (Ni/f <= t - tini){ 	// Ni回必要な時間になるまでf[Hz]を加える。Ni回終わったら....
 			if(f <= Fmax){		// 最大周波数以下なら次の周波数へ移行
@@ -58,6 +59,7 @@ void FRAgenerator::GetSignal(const double Time, double& Freq, double& Output){
 		}
 	}else{
 		Output = Bu;	// FRA非動作時はバイアス値を出力
+		isRun = false;
 	}
 	
 	Freq = f;		// [Hz] 周波数を出力
@@ -106,3 +108,10 @@ void FRAgenerator::GetSignalWithFricComp(const double Time, const double Velocit
 void FRAgenerator::SetCoulombFriction(const double ClmbFric){
 	tauclmb = ClmbFric;
 }
+
+//! @brief 直前のFRA信号出力が正弦波だったかを返す関数
+//! FRAanalyzer に入出力を渡すかどうかの判定に使う。
+//! @return	true = FRA動作中，false = FRA開始前か終了後
+bool FRAgenerator::IsRunning(void) const {
+	return isRun;
+}
@@ -35,6 +35,7 @@ class FRAgenerator {
 		std::tuple<double, double> GetSignal(const double Time);		//!< FRA信号出力関数(タプルで返す版)
 		void GetSignalWithFricComp(const double Time, const double Velocity, double& Freq, double& ObsrvOut, double& DriveOut);	//!< FRA信号出力関数(クーロン摩擦補償付き)
 		void SetCoulombFriction(const double ClmbFric);					//!< クーロン摩擦トルクを設定する関数
+		bool IsRunning(void) const;										//!< 直前のFRA信号出力が正弦波だったかを返す関数
 		
 	private:
 		FRAgenerator(const FRAgenerator&) = delete;						//!< コピーコンストラクタ使用禁止
@@ -47,6 +48,7 @@ class FRAgenerator {
 		const double Bu;	//!< [-] バイアス
 		const double Tsta;	//!< [s] FRA開始時刻
 		bool isEnd;			//!< FRA終了フラグ
+		bool isRun;			//!< FRA動作中フラグ (直前の出力が正弦波なら true)
 		double f;			//!< [Hz]現在の周波数	
 		double tini;		//!< [s] 各周波数ごとの初期時刻
 		double tauclmb;		//!< [Nm] クーロン摩擦トルク
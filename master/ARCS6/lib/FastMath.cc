@@ -0,0 +1,14 @@
+//! @file FastMath.cc
+//! @brief 制御ループ用の高速な超越関数
+//!
+//! 制御周期ごとに呼ぶ exp, tanh, シグモイド, sin, cos, atan2 を，libm を呼ばずに多項式近似で計算する関数群。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "FastMath.hh"
+
+// インライン関数のため，実体もヘッダ側に実装。
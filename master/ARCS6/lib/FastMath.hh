@@ -0,0 +1,460 @@
+//! @file FastMath.hh
+//! @brief 制御ループ用の高速な超越関数
+//!
+//! 制御周期ごとに呼ぶ exp, tanh, シグモイド, sin, cos, atan2 を，libm を呼ばずに多項式近似で計算する関数群。
+//! - 分岐を使わず四則演算と比較による選択だけで書いてあるので，ArcsMat の要素ごとの版(小文字の関数)や
+//!   配列を回すループの中では，コンパイラの自動ベクトル化によりSIMD命令で複数の要素が同時に計算される(Atan2 を除く)。
+//! - スカラー版(大文字の関数)はすべて constexpr で，コンパイル時にも同じ値を計算できる。
+//! - SinCos は引数の縮約を1回だけ行って sin と cos を同時に求めるので，dq変換などで同じ角度の sin と cos を使う場合に速い。
+//! - 精度はテンプレート引数の FastMath::Accuracy で選ぶ。
+//!   DOUBLE は倍精度で数ulpの誤差，SINGLE は単精度並みの誤差で多項式の次数が半分程度になる。
+//!
+//! @par 精度 (サンプル 057 で libm と比較した最大誤差，ulp は倍精度の最終桁の単位)
+//! | 関数      | DOUBLE | SINGLE               | 入力範囲                              |
+//! |-----------|--------|----------------------|---------------------------------------|
+//! | Exp       | 1 ulp  | 相対誤差 7e-9        | 全域 (-708 未満は 0, 709.78 超は ∞)   |
+//! | Tanh      | 4 ulp  | 相対誤差 2e-8        | 全域                                  |
+//! | Sigmoid   | 4 ulp  | 相対誤差 7e-9        | 全域                                  |
+//! | Sin, Cos  | 2 ulp  | 絶対誤差 6e-11       | 絶対値 1e6 [rad] 以下                 |
+//! | Atan2     | 1 ulp  | 絶対誤差 2e-9 [rad]  | 全域 (±∞, ±0 の扱いも libm と同じ)    |
+//! - Atan2 以外は -0.0 を +0.0 として扱い，非正規化数の結果は 0 に丸める。NaN を入れた場合の結果は NaN。
+//! - Atan2 は -0.0 の符号も見る(atan2(-0.0, -1) = -π)。ただしコンパイル時の定数評価では符号ビットを読めないので，-0.0 は +0.0 として扱う。
+//! - sin, cos は π/2 を3分割したCody-Waite法で縮約するので，|x| が 1e6 を超えると誤差が大きくなる。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef FASTMATH
+#define FASTMATH
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include "ArcsMatrix.hh"
+#include "ArcsMatrixMath.hh"
+
+// ARCS名前空間
+namespace ARCS {
+
+// 高速超越関数定義
+namespace FastMath {
+	//! @brief 精度の定義
+	enum class Accuracy {
+		DOUBLE,	//!< 倍精度 (数ulpの誤差)
+		SINGLE	//!< 単精度並み (単精度の丸め誤差 6e-8 以下, 多項式の次数が低いので速い)
+	};
+
+	inline constexpr double ROUND_MAGIC = 6755399441055744.0;	//!< 1.5*2^52 (足して引くと最も近い整数に丸められる)
+	inline constexpr double LOG2E = 1.44269504088896338700e+00;	//!< 1/ln2
+	inline constexpr double LN2_HI = 6.93147180369123816490e-01;	//!< ln2の上位 (下位ビットが0なので整数倍が厳密)
+	inline constexpr double LN2_LO = 1.90821492927058770002e-10;	//!< ln2の下位
+	inline constexpr double EXP_MAX = 709.782712893383973096;		//!< これを超えると exp は無限大
+	inline constexpr double EXP_MIN = -708.0;						//!< これ未満では exp を 0 とする
+	inline constexpr double TANH_MAX = 20;							//!< これを超えると tanh は倍精度で ±1
+	inline constexpr double TWO_OVER_PI = 6.36619772367581382433e-01;	//!< 2/π
+	inline constexpr double PIO2_1 = 1.57079632673412561417e+00;	//!< π/2の1番目の33ビット
+	inline constexpr double PIO2_2 = 6.07710050630396597660e-11;	//!< π/2の2番目の33ビット
+	inline constexpr double PIO2_3 = 2.02226624871116645580e-21;	//!< π/2の3番目の33ビット
+	inline constexpr double PIO2_HI = 1.57079632679489655800e+00;	//!< π/2の上位
+	inline constexpr double PIO2_LO = 6.12323399573676603587e-17;	//!< π/2の下位
+	inline constexpr double PI_HI = 3.14159265358979311600e+00;		//!< πの上位
+	inline constexpr double PI_LO = 1.22464679914735317720e-16;		//!< πの下位
+
+	//! @brief 最も近い整数に丸める関数 (1.5*2^52 を足して引く, |x| < 2^51 で有効)
+	//! @param[in]	x	入力
+	//! @return	丸めた値
+	constexpr double Round(const double x){
+		return (x + ROUND_MAGIC) - ROUND_MAGIC;
+	}
+
+	//! @brief 符号ビットが立っているかを返す関数 (-0.0 も負とみなす)
+	//! コンパイル時の定数評価では符号ビットを読めないので，-0.0 は +0.0 とみなす。
+	//! @param[in]	x	入力
+	//! @return	true = 符号ビットが立っている
+	constexpr bool SignBit(const double x){
+		if(__builtin_is_constant_evaluated()){
+			return x < 0;
+		}
+		uint64_t b = 0;
+		std::memcpy(&b, &x, sizeof(b));
+		return (b >> 63) != 0;
+	}
+
+	//! @brief 2の整数乗を返す関数 (-1022 <= n <= 1023)
+	//! 実行時は指数部のビットを直接作るので，ループの中でもベクトル化される。
+	//! @param[in]	n	指数 (整数値の浮動小数点数)
+	//! @return	2^n
+	constexpr double Pow2(const double n){
+		if(__builtin_is_constant_evaluated()){
+			if(n != n) return n;	// NaN はそのまま
+			return ArcsMatrixMath::ConstLdexp(1.0, static_cast<int>(n));
+		}
+		const double k = n + ROUND_MAGIC;	// 仮数部の下位ビットに n の2の補数表現が入る
+		uint64_t b = 0;
+		std::memcpy(&b, &k, sizeof(b));
+		b = (b << 52) + (static_cast<uint64_t>(1023) << 52);	// 指数部に n + 1023 を入れる
+		double y = 0;
+		std::memcpy(&y, &b, sizeof(y));
+		return y;
+	}
+
+	//! @brief exp の引数を縮約して e^r - 1 を求める関数 (内部用)
+	//! x = n*ln2 + r (|r| <= ln2/2) と分解して，e^x = 2^n*(1 + 戻り値) となる値を返す。
+	//! @tparam	A	精度
+	//! @param[in]	x	入力
+	//! @param[out]	n	2の指数
+	//! @return	e^r - 1
+	template<Accuracy A>
+	constexpr double ExpReduce(const double x, double& n){
+		n = Round(x*LOG2E);
+		const double r = (x - n*LN2_HI) - n*LN2_LO;
+		if constexpr(A == Accuracy::DOUBLE){
+			// 13次のテイラー展開 (打切り誤差 < 2^-58)
+			return r*(1.0 + r*(1.0/2 + r*(1.0/6 + r*(1.0/24 + r*(1.0/120 + r*(1.0/720 + r*(1.0/5040
+				+ r*(1.0/40320 + r*(1.0/362880 + r*(1.0/3628800 + r*(1.0/39916800 + r*(1.0/479001600 + r*(1.0/6227020800.0)))))))))))));
+		}else{
+			// 7次のテイラー展開 (打切り誤差 < 2^-27)
+			return r*(1.0 + r*(1.0/2 + r*(1.0/6 + r*(1.0/24 + r*(1.0/120 + r*(1.0/720 + r*(1.0/5040)))))));
+		}
+	}
+
+	//! @brief 指数関数
+	//! @tparam	A	精度
+	//! @param[in]	x	入力
+	//! @return	e^x
+	template<Accuracy A = Accuracy::DOUBLE>
+	constexpr double Exp(const double x){
+		const double xc = x < EXP_MIN ? EXP_MIN : (EXP_MAX < x ? EXP_MAX : x);
+		double n = 0;
+		const double p = ExpReduce<A>(xc, n);
+		const double y = (2.0 + 2.0*p)*Pow2(n - 1.0);	// n = 1024 でも溢れないように 2*2^(n-1) とする
+		return x < EXP_MIN ? 0.0 : (EXP_MAX < x ? std::numeric_limits<double>::infinity() : y);
+	}
+
+	//! @brief e^x - 1 を返す関数 (0付近でも相対誤差が小さい, |x| <= 700 で有効)
+	//! @tparam	A	精度
+	//! @param[in]	x	入力
+	//! @return	e^x - 1
+	template<Accuracy A = Accuracy::DOUBLE>
+	constexpr double Expm1(const double x){
+		double n = 0;
+		const double p = ExpReduce<A>(x, n);
+		const double s = Pow2(n);
+		return s*p + (s - 1.0);	// 2^n*(1 + p) - 1 (n = 0 のときは p そのもの)
+	}
+
+	//! @brief 双曲線正接関数
+	//! @tparam	A	精度
+	//! @param[in]	x	入力
+	//! @return	tanh(x)
+	template<Accuracy A = Accuracy::DOUBLE>
+	constexpr double Tanh(const double x){
+		const double xc = x < -TANH_MAX ? -TANH_MAX : (TANH_MAX < x ? TANH_MAX : x);
+		const double em = Expm1<A>(2.0*xc);
+		return em/(em + 2.0);	// (e^2x - 1)/(e^2x + 1)
+	}
+
+	//! @brief シグモイド関数
+	//! @tparam	A	精度
+	//! @param[in]	x	入力
+	//! @return	1/(1 + e^-x)
+	template<Accuracy A = Accuracy::DOUBLE>
+	constexpr double Sigmoid(const double x){
+		return 1.0/(1.0 + Exp<A>(-x));
+	}
+
+	//! @brief 正弦関数と余弦関数を同時に計算する関数(引数渡し版)
+	//! @tparam	A	精度
+	//! @param[in]	x	[rad] 入力
+	//! @param[out]	s	sin(x)
+	//! @param[out]	c	cos(x)
+	template<Accuracy A = Accuracy::DOUBLE>
+	constexpr void SinCos(const double x, double& s, double& c){
+		// x = n*π/2 + r (|r| <= π/4) に縮約
+		const double n = Round(x*TWO_OVER_PI);
+		const double r = ((x - n*PIO2_1) - n*PIO2_2) - n*PIO2_3;
+		const double z = r*r;
+
+		// |r| <= π/4 での sin(r), cos(r) の多項式近似
+		double sr = 0, cr = 0;
+		if constexpr(A == Accuracy::DOUBLE){
+			// 13次と14次のミニマックス近似 (fdlibm の係数, 打切り誤差 < 2^-58)
+			constexpr double S1 = -1.66666666666666324348e-01, S2 =  8.33333333332248946124e-03, S3 = -1.98412698298579493134e-04;
+			constexpr double S4 =  2.75573137070700676789e-06, S5 = -2.50507602534068634195e-08, S6 =  1.58969099521155010221e-10;
+			constexpr double C1 =  4.16666666666666019037e-02, C2 = -1.38888888888741095749e-03, C3 =  2.48015872894767294178e-05;
+			constexpr double C4 = -2.75573143513906633035e-07, C5 =  2.08757232129817482790e-09, C6 = -1.13596475577881948265e-11;
+			sr = r + r*z*(S1 + z*(S2 + z*(S3 + z*(S4 + z*(S5 + z*S6)))));
+			const double hz = 0.5*z, w = 1.0 - hz;
+			cr = w + (((1.0 - w) - hz) + z*z*(C1 + z*(C2 + z*(C3 + z*(C4 + z*(C5 + z*C6))))));	// 1 - z/2 の丸め誤差を補正
+		}else{
+			// 9次と8次のミニマックス近似 (打切り誤差 < 2^-33)
+			constexpr double S1 = -0.166666666416265235595, S2 = 0.0083333293858894631756, S3 = -0.000198393348360966317347, S4 = 0.0000027183114939898219064;
+			constexpr double C0 = -0.499999997251031003120, C1 = 0.0416666233237390631894, C2 = -0.00138867637746099294692, C3 = 0.0000243904487962774090654;
+			sr = r + r*z*(S1 + z*(S2 + z*(S3 + z*S4)));
+			cr = 1.0 + z*C0 + z*z*(C1 + z*(C2 + z*C3));
+		}
+
+		// 象限 q = n mod 4 (-2 <= q <= 2) に応じて入れ替えと符号反転
+		const double q = n - 4.0*Round(0.25*n);
+		const bool odd = q == 1.0 || q == -1.0;
+		const double s0 = odd ? cr : sr, c0 = odd ? sr : cr;
+		s = (q == 2.0 || q == -2.0 || q == -1.0) ? -s0 : s0;	// 第3, 第4象限
+		c = (q == 2.0 || q == -2.0 || q == 1.0) ? -c0 : c0;	// 第2, 第3象限
+	}
+
+	//! @brief 正弦関数と余弦関数を同時に計算する関数(タプル返し版)
+	//! @tparam	A	精度
+	//! @param[in]	x	[rad] 入力
+	//! @return	(sin(x), cos(x))のタプル
+	template<Accuracy A = Accuracy::DOUBLE>
+	constexpr std::tuple<double, double> SinCos(const double x){
+		double s = 0, c = 0;
+		SinCos<A>(x, s, c);
+		return {s, c};
+	}
+
+	//! @brief 正弦関数
+	//! @tparam	A	精度
+	//! @param[in]	x	[rad] 入力
+	//! @return	sin(x)
+	template<Accuracy A = Accuracy::DOUBLE>
+	constexpr double Sin(const double x){
+		double s = 0, c = 0;
+		SinCos<A>(x, s, c);
+		return s;
+	}
+
+	//! @brief 余弦関数
+	//! @tparam	A	精度
+	//! @param[in]	x	[rad] 入力
+	//! @return	cos(x)
+	template<Accuracy A = Accuracy::DOUBLE>
+	constexpr double Cos(const double x){
+		double s = 0, c = 0;
+		SinCos<A>(x, s, c);
+		return c;
+	}
+
+	//! @brief 4象限の逆正接関数
+	//! 多項式が長く -O2 ではインライン展開されないので，ループの中で呼んでもベクトル化はされない(スカラーで libm より速い)。
+	//! @tparam	A	精度
+	//! @param[in]	y	分子
+	//! @param[in]	x	分母
+	//! @return	[rad] atan2(y, x) (-π ～ π)
+	template<Accuracy A = Accuracy::DOUBLE>
+	constexpr double Atan2(const double y, const double x){
+		// 0 <= t = num/den <= 1 に折り返す (両方とも無限大なら t = 1 として π/4 の倍数にする)
+		constexpr double INF = std::numeric_limits<double>::infinity();
+		const double ay = y < 0 ? -y : y, ax = x < 0 ? -x : x;
+		const bool swap = ax < ay, inf2 = ay == INF && ax == INF;
+		const double num = inf2 ? 1.0 : (swap ? ax : ay), den = inf2 ? 1.0 : (swap ? ay : ax);
+
+		// atan(t) = atan(c) + atan((t - c)/(1 + c*t)) で |u| <= 7/16 に縮約 (c = 0, 1/2, 1)
+		// t - c は Sterbenz の補題により厳密で，割り算は1回で済む
+		const bool r1 = 11.0*den <= 16.0*num && 0 < num, r0 = !r1 && 7.0*den <= 16.0*num && 0 < num;
+		const double hi = r1 ? 7.85398163397448278999e-01 : (r0 ? 4.63647609000806093515e-01 : 0.0);	// atan(c)の上位
+		const double lo = r1 ? 3.06161699786838301793e-17 : (r0 ? 2.26987774529616870924e-17 : 0.0);	// atan(c)の下位
+		// 分母だけが無限大のときに 0*∞ = NaN とならないように，c = 0 では掛け算をせずに選択する
+		const double d = r1 ? den + num : (r0 ? den + 0.5*num : den);
+		const double n = r1 ? num - den : (r0 ? num - 0.5*den : num);
+		const double u = d == 0 ? 0.0*num : n/d;	// 0/0 は 0 (NaN はそのまま伝搬)
+
+		// |u| <= 7/16 での atan(u) の多項式近似
+		const double z = u*u, w = z*z;
+		double s1 = 0, s2 = 0;
+		if constexpr(A == Accuracy::DOUBLE){
+			// 23次のミニマックス近似 (fdlibm の係数)
+			s1 = z*( 3.33333333333329318027e-01 + w*( 1.42857142725034663711e-01 + w*( 9.09088713343650656196e-02
+				+ w*( 6.66107313738753120669e-02 + w*( 4.97687799461593236017e-02 + w*1.62858201153657823623e-02)))));
+			s2 = w*(-1.99999999998764832476e-01 + w*(-1.11111104054623557880e-01 + w*(-7.69187620504482999495e-02
+				+ w*(-5.83357013379057348645e-02 + w*(-3.65315727442169155270e-02)))));
+		}else{
+			// 11次のミニマックス近似
+			s1 = z*(3.3333328366e-01 + w*(1.4253635705e-01 + w*6.1687607318e-02));
+			s2 = w*(-1.9999158382e-01 + w*(-1.0648017377e-01));
+		}
+		const double at = hi - ((u*(s1 + s2) - lo) - u);	// atan(t)
+
+		// 折り返しを元に戻す
+		// |y| > |x| なら π/2 ∓ atan(t)，第2, 第3象限(x = -0.0 を含む)なら π - 角度
+		// (π - (π/2 - atan(t)) は π/2 + atan(t) として直接足し，π/2 付近で丸めが2回重ならないようにする)
+		const bool xn = SignBit(x);
+		const double a2 = swap ? (PIO2_HI + (xn ? at : -at)) + PIO2_LO : (xn ? (PI_HI - at) + PI_LO : at);
+		return SignBit(y) ? -a2 : a2;	// y = -0.0 なら -0.0 または -π
+	}
+
+	//! @brief 行列の要素ごとにスカラー関数を計算する関数 (内部用)
+	//! 実行時は連続した配列として1本のループで回すので，関数が分岐無しならベクトル化される。
+	//! @tparam	M, N	行列の高さ, 幅
+	//! @tparam	F	スカラー関数の型
+	//! @param[in]	U	入力行列
+	//! @param[out]	Y	出力行列 (U と同じでも良い)
+	//! @param[in]	f	スカラー関数
+	template<size_t M, size_t N, typename F>
+	constexpr void Map(const ArcsMat<M,N>& U, ArcsMat<M,N>& Y, const F& f){
+		if(__builtin_is_constant_evaluated()){
+			for(size_t i = 1; i <= N; ++i){
+				for(size_t j = 1; j <= M; ++j) Y(j,i) = f( U(j,i) );
+			}
+			return;
+		}
+		const double* u = &(U.ReadOnlyRef()[0][0]);	// 列優先で縦方向に連続
+		double* y = &Y(1,1);
+		for(size_t k = 0; k < M*N; ++k) y[k] = f(u[k]);
+	}
+
+	//! @brief 行列要素の指数関数を計算する関数(引数渡し版)
+	//! @tparam	A	精度
+	//! @tparam	M, N	行列の高さ, 幅
+	//! @param[in]	U	入力行列
+	//! @param[out]	Y	出力行列
+	template<Accuracy A = Accuracy::DOUBLE, size_t M, size_t N>
+	constexpr void exp(const ArcsMat<M,N>& U, ArcsMat<M,N>& Y){
+		Map(U, Y, [](const double x){ return Exp<A>(x); });
+	}
+
+	//! @brief 行列要素の指数関数を計算する関数(戻り値渡し版)
+	//! @tparam	A	精度
+	//! @tparam	M, N	行列の高さ, 幅
+	//! @param[in]	U	入力行列
+	//! @return	出力行列
+	template<Accuracy A = Accuracy::DOUBLE, size_t M, size_t N>
+	constexpr ArcsMat<M,N> exp(const ArcsMat<M,N>& U){
+		ArcsMat<M,N> Y;
+		FastMath::exp<A>(U, Y);
+		return Y;
+	}
+
+	//! @brief 行列要素の双曲線正接関数を計算する関数(引数渡し版)
+	//! @tparam	A	精度
+	//! @tparam	M, N	行列の高さ, 幅
+	//! @param[in]	U	入力行列
+	//! @param[out]	Y	出力行列
+	template<Accuracy A = Accuracy::DOUBLE, size_t M, size_t N>
+	constexpr void tanh(const ArcsMat<M,N>& U, ArcsMat<M,N>& Y){
+		Map(U, Y, [](const double x){ return Tanh<A>(x); });
+	}
+
+	//! @brief 行列要素の双曲線正接関数を計算する関数(戻り値渡し版)
+	//! @tparam	A	精度
+	//! @tparam	M, N	行列の高さ, 幅
+	//! @param[in]	U	入力行列
+	//! @return	出力行列
+	template<Accuracy A = Accuracy::DOUBLE, size_t M, size_t N>
+	constexpr ArcsMat<M,N> tanh(const ArcsMat<M,N>& U){
+		ArcsMat<M,N> Y;
+		FastMath::tanh<A>(U, Y);
+		return Y;
+	}
+
+	//! @brief 行列要素のシグモイド関数を計算する関数(引数渡し版)
+	//! @tparam	A	精度
+	//! @tparam	M, N	行列の高さ, 幅
+	//! @param[in]	U	入力行列
+	//! @param[out]	Y	出力行列
+	template<Accuracy A = Accuracy::DOUBLE, size_t M, size_t N>
+	constexpr void sigmoid(const ArcsMat<M,N>& U, ArcsMat<M,N>& Y){
+		Map(U, Y, [](const double x){ return Sigmoid<A>(x); });
+	}
+
+	//! @brief 行列要素のシグモイド関数を計算する関数(戻り値渡し版)
+	//! @tparam	A	精度
+	//! @tparam	M, N	行列の高さ, 幅
+	//! @param[in]	U	入力行列
+	//! @return	出力行列
+	template<Accuracy A = Accuracy::DOUBLE, size_t M, size_t N>
+	constexpr ArcsMat<M,N> sigmoid(const ArcsMat<M,N>& U){
+		ArcsMat<M,N> Y;
+		FastMath::sigmoid<A>(U, Y);
+		return Y;
+	}
+
+	//! @brief 行列要素の正弦関数を計算する関数(引数渡し版)
+	//! @tparam	A	精度
+	//! @tparam	M, N	行列の高さ, 幅
+	//! @param[in]	U	入力行列
+	//! @param[out]	Y	出力行列
+	template<Accuracy A = Accuracy::DOUBLE, size_t M, size_t N>
+	constexpr void sin(const ArcsMat<M,N>& U, ArcsMat<M,N>& Y){
+		Map(U, Y, [](const double x){ return Sin<A>(x); });
+	}
+
+	//! @brief 行列要素の正弦関数を計算する関数(戻り値渡し版)
+	//! @tparam	A	精度
+	//! @tparam	M, N	行列の高さ, 幅
+	//! @param[in]	U	入力行列
+	//! @return	出力行列
+	template<Accuracy A = Accuracy::DOUBLE, size_t M, size_t N>
+	constexpr ArcsMat<M,N> sin(const ArcsMat<M,N>& U){
+		ArcsMat<M,N> Y;
+		FastMath::sin<A>(U, Y);
+		return Y;
+	}
+
+	//! @brief 行列要素の余弦関数を計算する関数(引数渡し版)
+	//! @tparam	A	精度
+	//! @tparam	M, N	行列の高さ, 幅
+	//! @param[in]	U	入力行列
+	//! @param[out]	Y	出力行列
+	template<Accuracy A = Accuracy::DOUBLE, size_t M, size_t N>
+	constexpr void cos(const ArcsMat<M,N>& U, ArcsMat<M,N>& Y){
+		Map(U, Y, [](const double x){ return Cos<A>(x); });
+	}
+
+	//! @brief 行列要素の余弦関数を計算する関数(戻り値渡し版)
+	//! @tparam	A	精度
+	//! @tparam	M, N	行列の高さ, 幅
+	//! @param[in]	U	入力行列
+	//! @return	出力行列
+	template<Accuracy A = Accuracy::DOUBLE, size_t M, size_t N>
+	constexpr ArcsMat<M,N> cos(const ArcsMat<M,N>& U){
+		ArcsMat<M,N> Y;
+		FastMath::cos<A>(U, Y);
+		return Y;
+	}
+
+	//! @brief 行列要素の正弦関数と余弦関数を同時に計算する関数(引数渡し版)
+	//! @tparam	A	精度
+	//! @tparam	M, N	行列の高さ, 幅
+	//! @param[in]	U	入力行列
+	//! @param[out]	S	正弦の出力行列
+	//! @param[out]	C	余弦の出力行列
+	template<Accuracy A = Accuracy::DOUBLE, size_t M, size_t N>
+	constexpr void sincos(const ArcsMat<M,N>& U, ArcsMat<M,N>& S, ArcsMat<M,N>& C){
+		if(__builtin_is_constant_evaluated()){
+			for(size_t i = 1; i <= N; ++i){
+				for(size_t j = 1; j <= M; ++j) SinCos<A>(U(j,i), S(j,i), C(j,i));
+			}
+			return;
+		}
+		const double* u = &(U.ReadOnlyRef()[0][0]);	// 列優先で縦方向に連続
+		double* s = &S(1,1);
+		double* c = &C(1,1);
+		for(size_t k = 0; k < M*N; ++k){
+			double sk = 0, ck = 0;	// 出力同士の重なりを気にせずにベクトル化されるように一旦ローカルで受ける
+			SinCos<A>(u[k], sk, ck);
+			s[k] = sk;
+			c[k] = ck;
+		}
+	}
+
+	//! @brief 行列要素の正弦関数と余弦関数を同時に計算する関数(タプル返し版)
+	//! @tparam	A	精度
+	//! @tparam	M, N	行列の高さ, 幅
+	//! @param[in]	U	入力行列
+	//! @return	(正弦の行列, 余弦の行列)のタプル
+	template<Accuracy A = Accuracy::DOUBLE, size_t M, size_t N>
+	constexpr std::tuple<ArcsMat<M,N>, ArcsMat<M,N>> sincos(const ArcsMat<M,N>& U){
+		ArcsMat<M,N> S, C;
+		FastMath::sincos<A>(U, S, C);
+		return {S, C};
+	}
+}
+}
+
+#endif
+
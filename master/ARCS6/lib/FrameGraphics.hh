@@ -13,7 +13,7 @@
 //! 画面バッファをPNG画像ファイルとして保存することも可能。
 //! WSL上などフレームバッファが存在しないときはダミーのバッファを作成してやり過ごし，PNGファイルで出力する。
 //!
-//! @date 2024/10/12
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2024 Yokokura, Yuki
@@ -32,6 +32,8 @@
 #include <cassert>
 #include <cstdint>
 #include <array>
+#include <memory>
+#include <functional>
 #include <string>
 #include <cstring>
 #include <cmath>
@@ -245,6 +247,15 @@ class FrameGraphics {
 		//! @brief PNG画像ファイルを保存する関数
 		//! @param[in]	FileName	PNG画像ファイル名
 		void SavePngImageFile(const std::string& FileName){
+			SavePngImageFile(FileName, Screen, nullptr);	// 画面バッファを書き出す
+		}
+		
+		//! @brief 指定した画像データをPNG画像ファイルとして保存する関数
+		//! 画像データは別途確保されたものを渡せるので，GetScreenSnapshotで取得した画像を別スレッドで書き出す用途に使える。
+		//! @param[in]	FileName	PNG画像ファイル名
+		//! @param[in]	Image		画像データ(画面バッファと同じ大きさ・並び)
+		//! @param[in]	Progress	進捗通知用の関数オブジェクト(引数は0～1の進捗率, 不要ならnullptr)
+		void SavePngImageFile(const std::string& FileName, const TF* Image, const std::function<void(double)>& Progress) const {
 			// PNG書き出しは32bit色深度のみ対応
 			if constexpr(DP == FGdepth::DEPTH_32BIT){
 				// 初期化処理
@@ -272,7 +283,10 @@ class FrameGraphics {
 				png_set_bgr(png_ptr);				// uint32_tデータの順序をABGRからARGBに変更
 				
 				// 画像書き出し
-				for(size_t y = 0; y < static_cast<size_t>(height); ++y) png_write_row(png_ptr, (png_bytep)(&(Screen[width*y])));
+				for(size_t y = 0; y < static_cast<size_t>(height); ++y){
+					png_write_row(png_ptr, (png_bytep)(&(Image[width*y])));	// 1行ずつ書き出し
+					if(Progress != nullptr && y % PROGRESS_ROWS == 0) Progress(static_cast<double>(y)/static_cast<double>(height));	// 進捗通知
+				}
 				
 				// 終了処理
 				png_free_data(png_ptr, info_ptr, PNG_FREE_ALL, -1);
@@ -281,6 +295,15 @@ class FrameGraphics {
 				png_ptr = nullptr;
 				fclose(fp); fp = nullptr;
 			}
+			if(Progress != nullptr) Progress(1);	// 完了通知
+		}
+		
+		//! @brief 画面バッファの複製を取得する関数
+		//! @return	画面バッファの複製へのスマートポインタ
+		std::unique_ptr<TF[]> GetScreenSnapshot(void) const {
+			std::unique_ptr<TF[]> ret = std::make_unique<TF[]>(length);
+			memcpy(ret.get(), Screen, size);
+			return ret;
 		}
 		
 		//! @brief フレームバッファを更新する関数
@@ -881,6 +904,8 @@ class FrameGraphics {
 		FrameGraphics(FrameGraphics&& r) = delete;						//!< ムーブコンストラクタ使用禁止
 		const FrameGraphics& operator=(const FrameGraphics&) = delete;	//!< 代入演算子使用禁止
 		
+		static constexpr size_t PROGRESS_ROWS = 64;	//!< [px] PNG書き出し時の進捗通知の間隔
+		
 		// 色の定義
 		static constexpr size_t NUM_COLOR_SET = 13;	//!< 定義する色の数  注意!!：enum FGcolors の要素数と同一にせよ！
 		
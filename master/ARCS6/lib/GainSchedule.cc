@@ -0,0 +1,14 @@
+//! @file GainSchedule.cc
+//! @brief ゲインスケジューリング用の離散系モデル表クラスと，バックグラウンド再離散化クラス
+//!
+//! パラメータに依存する連続系状態空間モデルを，実時間ループの外で離散化しておくクラス群。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "GainSchedule.hh"
+
+// テンプレートクラスのため，実体もヘッダ側に実装。
@@ -0,0 +1,316 @@
+//! @file GainSchedule.hh
+//! @brief ゲインスケジューリング用の離散系モデル表クラスと，バックグラウンド再離散化クラス
+//!
+//! 推定帯域や慣性などのパラメータに依存する連続系状態空間モデルを，実時間ループの外で離散化しておくクラス群。
+//! - GainScheduleTable : 初期化時にパラメータの格子点ごとに離散化しておき，実時間ループでは隣り合う2つの格子点の
+//!   離散系モデルを線形補間する。補間は各行列の要素数に比例する O(n^2) で，行列指数関数も数値積分も使わない。
+//! - ModelRediscretizer : 別スレッドで離散化しておき，実時間ループでは出来上がった離散系モデルを次の周期で差し替える。
+//!   受け渡しはロックフリーの3重バッファなので，実時間ループ側がブロックされることは無い。
+//!
+//! どちらも StateSpaceSystem::SetDiscrete で離散系モデルを差し替える。
+//!
+//! @par 状態変数の座標について
+//! パラメータが変わっても状態変数の意味が変わらないように，平衡化(BalanceReal)はせずに連続系モデルのまま離散化する。
+//! 格子点ごとに平衡化すると座標変換が格子点ごとに異なるので，補間も差し替えもできなくなるためである。
+//!
+//! 使用例：
+//! 	// 推定帯域 gdis = 10～1000 [rad/s] の外乱オブザーバを対数間隔の32点で離散化しておく
+//! 	static GainScheduleTable<2,2,1,32> Table([&](double gdis, ArcsMat<2,2>& A, ArcsMat<2,2>& B, ArcsMat<1,2>& C, ArcsMat<1,2>& D){ ... }, 10, 1000, Ts, SchedGrid::SCHED_LOG);
+//! 	Table.SetSystem(gdis, DOb);	// 実時間ループの中で呼んで良い
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef GAINSCHEDULE
+#define GAINSCHEDULE
+
+#include <cassert>
+#include <cstdint>
+#include <cmath>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <algorithm>
+#include "ArcsMatrix.hh"
+#include "ArcsControl.hh"
+#include "StateSpaceSystem.hh"
+#include "CPUSettings.hh"
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+	#include "ARCSeventlog.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+	#define PassedLog()
+	#define EventLog(a)
+	#define EventLogVar(a)
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief スケジューリングパラメータの格子の取り方の定義
+enum class SchedGrid {
+	SCHED_LINEAR,	//!< 等間隔
+	SCHED_LOG		//!< 対数等間隔 (帯域などの桁で変わるパラメータ向け)
+};
+
+//! @brief 離散系状態空間モデル (A,B,C,D行列の組)
+//! @tparam	N	次数
+//! @tparam I	入力信号の数
+//! @tparam O	出力信号の数
+template <size_t N, size_t I = 1, size_t O = 1>
+struct DiscreteModel {
+	ArcsMat<N,N> Ad;	//!< 離散系A行列
+	ArcsMat<N,I> Bd;	//!< 離散系B行列
+	ArcsMat<O,N> Cd;	//!< C行列
+	ArcsMat<O,I> Dd;	//!< D行列
+	double Param;		//!< このモデルのスケジューリングパラメータ
+
+	//! @brief コンストラクタ
+	DiscreteModel(void)
+		: Ad(), Bd(), Cd(), Dd(), Param(0)
+	{
+		
+	}
+
+	//! @brief 連続系モデルを返す関数の型 (パラメータ, A, B, C, D)
+	using ContinuousFunc = std::function<void(double, ArcsMat<N,N>&, ArcsMat<N,I>&, ArcsMat<O,N>&, ArcsMat<O,I>&)>;
+
+	//! @brief 連続系モデルを0次ホールドで離散化して設定する関数 (平衡化はしない)
+	//! @param[in]	Func	連続系モデルを返す関数
+	//! @param[in]	p		スケジューリングパラメータ
+	//! @param[in]	Ts		[s] サンプリング周期
+	void Discretize(const ContinuousFunc& Func, const double p, const double Ts){
+		ArcsMat<N,N> A;
+		ArcsMat<N,I> B;
+		ArcsMat<O,N> C;
+		ArcsMat<O,I> D;
+		Func(p, A, B, C, D);
+		ArcsControl::DiscretizeSystem(A, B, C, D, Ad, Bd, Cd, Dd, Ts);
+		Param = p;
+	}
+
+	//! @brief 状態空間モデルに設定する関数
+	//! @param[out]	Sys	設定先の状態空間モデル
+	void SetTo(StateSpaceSystem<N,I,O>& Sys) const {
+		Sys.SetDiscrete(Ad, Bd, Cd, Dd);
+	}
+};
+
+//! @brief ゲインスケジューリング用の離散系モデル表クラス
+//! @tparam	N	次数
+//! @tparam I	入力信号の数
+//! @tparam O	出力信号の数
+//! @tparam P	格子点の数
+template <size_t N, size_t I = 1, size_t O = 1, size_t P = 16>
+class GainScheduleTable {
+	static_assert(2 <= P, "GainScheduleTable: Grid Size Error");
+	public:
+		using ContinuousFunc = typename DiscreteModel<N,I,O>::ContinuousFunc;	//!< 連続系モデルを返す関数の型
+
+		//! @brief コンストラクタ (ここで全格子点の離散化をするので，実時間ループの外で生成すること)
+		//! @param[in]	Func	連続系モデルを返す関数 (パラメータ, A, B, C, D)
+		//! @param[in]	ParamMin	パラメータの最小値
+		//! @param[in]	ParamMax	パラメータの最大値
+		//! @param[in]	Ts		[s] サンプリング周期
+		//! @param[in]	Grid	格子の取り方 (デフォルトは等間隔)
+		GainScheduleTable(const ContinuousFunc& Func, const double ParamMin, const double ParamMax, const double Ts, const SchedGrid Grid = SchedGrid::SCHED_LINEAR)
+			: Models(), Pmin(ParamMin), Pmax(ParamMax), LogGrid(Grid == SchedGrid::SCHED_LOG), Smin(0), Sscale(0)
+		{
+			arcs_assert(ParamMin < ParamMax);
+			arcs_assert(!LogGrid || 0 < ParamMin);	// 対数等間隔なら正の範囲
+			Smin = LogGrid ? std::log(Pmin) : Pmin;
+			const double Smax = LogGrid ? std::log(Pmax) : Pmax;
+			Sscale = static_cast<double>(P - 1)/(Smax - Smin);
+			for(size_t k = 0; k < P; ++k) Models[k].Discretize(Func, GetGridPoint(k), Ts);
+			PassedLog();
+		}
+
+		//! @brief ムーブコンストラクタ
+		//! @param[in]	r	右辺値
+		GainScheduleTable(GainScheduleTable&& r)
+			: Models(std::move(r.Models)), Pmin(r.Pmin), Pmax(r.Pmax), LogGrid(r.LogGrid), Smin(r.Smin), Sscale(r.Sscale)
+		{
+
+		}
+
+		//! @brief デストラクタ
+		~GainScheduleTable(){
+			PassedLog();
+		}
+
+		//! @brief パラメータに対する離散系モデルを補間して返す関数 (範囲外のパラメータは範囲内に制限)
+		//! @param[in]	p	スケジューリングパラメータ (NaN は不可。アサートが戻った場合は最小値として扱う)
+		//! @param[out]	Model	補間した離散系モデル
+		void GetModel(const double p, DiscreteModel<N,I,O>& Model) const {
+			arcs_assert(!std::isnan(p));	// センサ異常などで NaN が来た場合
+			const double pl = std::isnan(p) ? Pmin : std::clamp(p, Pmin, Pmax);	// NaN のまま整数に変換すると未定義動作
+			const double s = ((LogGrid ? std::log(pl) : pl) - Smin)*Sscale;	// 格子番号に換算した位置 (0～P-1)
+			const size_t k = std::min(static_cast<size_t>(s), P - 2);
+			const double a = s - static_cast<double>(k);					// 区間内の位置 (0～1)
+			const DiscreteModel<N,I,O>& M0 = Models[k];
+			const DiscreteModel<N,I,O>& M1 = Models[k + 1];
+			Lerp(M0.Ad, M1.Ad, a, Model.Ad);
+			Lerp(M0.Bd, M1.Bd, a, Model.Bd);
+			Lerp(M0.Cd, M1.Cd, a, Model.Cd);
+			Lerp(M0.Dd, M1.Dd, a, Model.Dd);
+			Model.Param = pl;
+		}
+
+		//! @brief パラメータに対する離散系モデルを補間して状態空間モデルに設定する関数 (実時間ループの中で呼んで良い)
+		//! @param[in]	p	スケジューリングパラメータ
+		//! @param[out]	Sys	設定先の状態空間モデル
+		void SetSystem(const double p, StateSpaceSystem<N,I,O>& Sys) const {
+			DiscreteModel<N,I,O> Model;
+			GetModel(p, Model);
+			Model.SetTo(Sys);
+		}
+
+		//! @brief 格子点のパラメータを返す関数
+		//! @param[in]	k	格子番号 (0～P-1)
+		//! @return	パラメータ
+		double GetGridPoint(const size_t k) const {
+			arcs_assert(k < P);
+			if(k == P - 1) return Pmax;	// 端点は丸め誤差なしに一致させる
+			const double s = Smin + static_cast<double>(k)/Sscale;
+			return LogGrid ? std::exp(s) : s;
+		}
+
+	private:
+		GainScheduleTable(const GainScheduleTable&) = delete;					//!< コピーコンストラクタ使用禁止
+		const GainScheduleTable& operator=(const GainScheduleTable&) = delete;	//!< 代入演算子使用禁止
+
+		//! @brief 行列の要素ごとの線形補間 Y = X0 + a*(X1 - X0)
+		template<size_t R, size_t C>
+		static void Lerp(const ArcsMat<R,C>& X0, const ArcsMat<R,C>& X1, const double a, ArcsMat<R,C>& Y){
+			const double* const x0 = &(X0.ReadOnlyRef()[0][0]);
+			const double* const x1 = &(X1.ReadOnlyRef()[0][0]);
+			double* const y = &Y(1,1);
+			for(size_t j = 0; j < R*C; ++j) y[j] = x0[j] + a*(x1[j] - x0[j]);
+		}
+
+		std::array<DiscreteModel<N,I,O>, P> Models;	//!< 格子点ごとの離散系モデル
+		double Pmin;	//!< パラメータの最小値
+		double Pmax;	//!< パラメータの最大値
+		bool LogGrid;	//!< 対数等間隔かどうか
+		double Smin;	//!< 格子の座標での最小値 (対数等間隔なら log(Pmin))
+		double Sscale;	//!< 格子の座標から格子番号への換算係数
+};
+
+//! @brief バックグラウンド再離散化クラス
+//! 実時間ループから要求されたパラメータの離散系モデルを別スレッドで計算して，次の周期で差し替えられるように渡す。
+//! 離散化の途中で次の要求が来た場合は，最新の要求のみを計算する。
+//! 実時間ループ側はアトミック変数を読み書きするだけで，ロックもシステムコールも使わない。
+//! その代わり再離散化スレッドは要求を POLL_PERIOD ごとに見回るので，差し替えまでに最大でその分だけ遅れる。
+//! 再離散化スレッドは生成元の実時間スレッドのポリシーとCPUコアを継承しないように，通常ポリシー(SCHED_OTHER)で実時間スレッドとは別のCPUコアで動かす。
+//! @tparam	N	次数
+//! @tparam I	入力信号の数
+//! @tparam O	出力信号の数
+template <size_t N, size_t I = 1, size_t O = 1>
+class ModelRediscretizer {
+	public:
+		using ContinuousFunc = typename DiscreteModel<N,I,O>::ContinuousFunc;	//!< 連続系モデルを返す関数の型
+
+		//! @brief コンストラクタ (初期パラメータで離散化してから，再離散化スレッドを起動する)
+		//! @param[in]	Func	連続系モデルを返す関数 (パラメータ, A, B, C, D)
+		//! @param[in]	InitParam	初期パラメータ
+		//! @param[in]	SmplTime	[s] サンプリング周期
+		//! @param[in]	CPUnum		再離散化スレッドに割り当てるCPUコア番号（実時間スレッドとは別にすること）
+		ModelRediscretizer(const ContinuousFunc& Func, const double InitParam, const double SmplTime, const unsigned int CPUnum = 0)
+			: Model(Func), Ts(SmplTime), Buffers(), Middle(MIDDLE), Back(BACK), Front(FRONT),
+			  ReqParam(InitParam), ReqCount(0), DoneCount(0), Quit(false), Worker()
+		{
+			static_assert(std::atomic<double>::is_always_lock_free, "ModelRediscretizer: double atomics must be lock-free");
+			Buffers[FRONT].Discretize(Model, InitParam, Ts);
+			Worker = std::thread(&ModelRediscretizer::WorkerLoop, this);
+			CPUSettings::SetCPUandPolicy(Worker.native_handle(), CPUnum, SCHED_OTHER);	// 通常ポリシーにして非実時間のCPUコアに割り当て
+			PassedLog();
+		}
+
+		//! @brief デストラクタ (再離散化スレッドを止める)
+		~ModelRediscretizer(){
+			Quit.store(true, std::memory_order_relaxed);
+			Worker.join();
+			PassedLog();
+		}
+
+		//! @brief 再離散化を要求する関数 (実時間ループの中で呼んで良い，ブロックしない)
+		//! @param[in]	p	スケジューリングパラメータ
+		void Request(const double p){
+			ReqParam.store(p, std::memory_order_relaxed);
+			ReqCount.fetch_add(1, std::memory_order_release);	// システムコールを呼ばないように，起床通知はせずに再離散化スレッド側の見回りに任せる
+		}
+
+		//! @brief 新しい離散系モデルが出来上がっていれば状態空間モデルを差し替える関数 (実時間ループの中で呼んで良い，ブロックしない)
+		//! @param[out]	Sys	差し替える状態空間モデル
+		//! @return	true = 差し替えた，false = 新しいモデルはまだ無い
+		bool Apply(StateSpaceSystem<N,I,O>& Sys){
+			if((Middle.load(std::memory_order_relaxed) & FRESH) == 0) return false;
+			Front = Middle.exchange(Front, std::memory_order_acq_rel) & INDEX;	// 出来上がったバッファと手元のバッファを入れ替える
+			Buffers[Front].SetTo(Sys);
+			return true;
+		}
+
+		//! @brief 最後に差し替えた離散系モデルを返す関数 (実時間ループ側から呼ぶこと)
+		//! @return	離散系モデル
+		const DiscreteModel<N,I,O>& GetModel(void) const {
+			return Buffers[Front];
+		}
+
+		//! @brief 要求した再離散化がすべて済んでいるかを返す関数
+		//! @return	true = 済んでいる
+		bool IsDone(void) const {
+			return DoneCount.load(std::memory_order_acquire) == ReqCount.load(std::memory_order_acquire);
+		}
+
+	private:
+		ModelRediscretizer(ModelRediscretizer&& r) = delete;						//!< ムーブコンストラクタ使用禁止
+		ModelRediscretizer(const ModelRediscretizer&) = delete;						//!< コピーコンストラクタ使用禁止
+		const ModelRediscretizer& operator=(const ModelRediscretizer&) = delete;	//!< 代入演算子使用禁止
+
+		static constexpr unsigned int FRONT = 0;	//!< 実時間ループ側が読んでいるバッファの初期番号
+		static constexpr unsigned int MIDDLE = 1;	//!< 受け渡し用のバッファの初期番号
+		static constexpr unsigned int BACK = 2;		//!< 再離散化スレッドが書いているバッファの初期番号
+		static constexpr unsigned int INDEX = 3;	//!< バッファ番号のマスク
+		static constexpr unsigned int FRESH = 4;	//!< 受け渡し用のバッファに新しいモデルがあることを示すビット
+		static constexpr auto POLL_PERIOD = std::chrono::milliseconds(1);	//!< 再離散化スレッドが要求を見回る周期
+
+		//! @brief 再離散化スレッドの処理ループ
+		void WorkerLoop(void){
+			uint64_t Done = 0;
+			while(Quit.load(std::memory_order_relaxed) == false){
+				const uint64_t Count = ReqCount.load(std::memory_order_acquire);
+				if(Count == Done){
+					std::this_thread::sleep_for(POLL_PERIOD);	// 要求が無ければ待つ
+					continue;
+				}
+				Buffers[Back].Discretize(Model, ReqParam.load(std::memory_order_relaxed), Ts);	// 最新の要求のみを離散化
+				Back = Middle.exchange(Back | FRESH, std::memory_order_acq_rel) & INDEX;		// 出来上がったバッファを受け渡し用と入れ替える
+				Done = Count;
+				DoneCount.store(Done, std::memory_order_release);
+			}
+		}
+
+		const ContinuousFunc Model;						//!< 連続系モデルを返す関数
+		const double Ts;								//!< [s] サンプリング周期
+		std::array<DiscreteModel<N,I,O>, 3> Buffers;	//!< 3重バッファ
+		std::atomic<unsigned int> Middle;				//!< 受け渡し用のバッファ番号と新しいモデルの有無
+		unsigned int Back;								//!< 再離散化スレッドが書いているバッファ番号 (再離散化スレッドのみが読み書き)
+		unsigned int Front;								//!< 実時間ループ側が読んでいるバッファ番号 (実時間ループ側のみが読み書き)
+		std::atomic<double> ReqParam;					//!< 要求されたパラメータ
+		std::atomic<uint64_t> ReqCount;					//!< 要求の回数
+		std::atomic<uint64_t> DoneCount;				//!< 離散化し終えた要求の回数
+		std::atomic<bool> Quit;							//!< 終了要求フラグ
+		std::thread Worker;								//!< 再離散化スレッド
+};
+}
+
+#endif
+
@@ -40,6 +40,23 @@ double HighPassFilter::GetSignal(double u){
 	return y;
 }
 
+void HighPassFilter::GetSignals(const double* u, double* y, const size_t K){
+	// 出力信号の一括取得 u；入力信号の配列，y；出力信号の配列，K；サンプル数 (u と y は同じ配列でも良い)
+	// GetSignal を K 回呼ぶのと同じ式で計算するので結果はビット単位で一致する。
+	// 係数の計算をループの外に出し，状態変数を局所変数に置いたまま漸化式を回す。
+	const double c = 1.0/(g*Ts+2.0), d = g*Ts-2.0;	// 係数
+	double u1 = uZ1, y1 = yZ1;
+	for(size_t k = 0; k < K; ++k){
+		const double uk = u[k];
+		const double yk = c*( 2.0*(uk-u1) - y1*d );
+		y[k] = yk;
+		u1 = uk;
+		y1 = yk;
+	}
+	uZ1 = u1;
+	yZ1 = y1;
+}
+
 void HighPassFilter::SetCutFreq(double CutFreq){
 	// 遮断周波数の再設定 CutFreq；[rad/s] 遮断周波数
 	g=CutFreq;		// [rad/s]	遮断周波数の再設定
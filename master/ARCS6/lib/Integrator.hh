@@ -12,6 +12,7 @@
 #define INTEGRATOR
 
 #include <cassert>
+#include <cstddef>
 
 // ARCS組込み用マクロ
 #ifdef ARCS_IN
@@ -103,6 +104,35 @@ class Integrator {
 			
 			return y;
 		}
+		
+		//! @brief 出力信号の一括取得 (GetSignal を K 回呼ぶのと同じ式で計算するので結果はビット単位で一致する)
+		//! @param[in]	u	入力信号の配列
+		//! @param[out]	y	出力信号の配列 (u と同じ配列でも良い)
+		//! @param[in]	K	サンプル数
+		void GetSignals(const double* u, double* y, const size_t K){
+			if(Ena == false){
+				for(size_t k = 0; k < K; ++k) y[k] = yZ1;	// 積分器停止指令の場合は積分値をそのまま出力
+				return;
+			}
+			const double h = Ts/2.0;	// 台形積分の係数
+			double u1 = uZ1, y1 = yZ1;	// 状態変数を局所変数に置いたまま漸化式を回す
+			for(size_t k = 0; k < K; ++k){
+				const double uk = u[k];
+				double yk;
+				if constexpr(T == IntegralType::FOWARD_EULER){
+					yk = Ts*u1 + y1;		// 前進オイラー(前進差分)
+				}else if constexpr(T == IntegralType::TRAPEZOIDAL){
+					yk = h*(uk + u1) + y1;	// 台形積分(双1次変換, Tustin変換)
+				}else{
+					yk = Ts*uk + y1;		// 後退オイラー(後退差分)
+				}
+				y[k] = yk;
+				u1 = uk;
+				y1 = yk;
+			}
+			uZ1 = u1;
+			yZ1 = y1;
+		}
 
 		//! @brief 制御周期の再設定
 		//! @param[in] SmplTime 制御周期[s]
@@ -41,6 +41,27 @@ double Integrator2::GetSignal(double u){
 	return y;
 }
 
+void Integrator2::GetSignals(const double* u, double* y, const size_t K){
+	// 出力信号の一括取得 u；入力信号の配列，y；出力信号の配列，K；サンプル数 (u と y は同じ配列でも良い)
+	// GetSignal を K 回呼ぶのと同じ式で計算するので結果はビット単位で一致する。
+	// 係数の計算をループの外に出し，状態変数を局所変数に置いたまま漸化式を回す。
+	const double c = (Ts*Ts)/4.0;	// 係数
+	double u1 = uZ1, u2 = uZ2, y1 = yZ1, y2 = yZ2;
+	for(size_t k = 0; k < K; ++k){
+		const double uk = u[k];
+		const double yk = c* ( uk + 2.0*u1 + u2) + 2.0*y1 - y2;
+		y[k] = yk;
+		u2 = u1;
+		u1 = uk;
+		y2 = y1;
+		y1 = yk;
+	}
+	uZ1 = u1;
+	uZ2 = u2;
+	yZ1 = y1;
+	yZ2 = y2;
+}
+
 void Integrator2::SetSmplTime(double SmplTime){
 	// 制御周期の再設定 SmplTime；[s] 制御周期
 	Ts=SmplTime;	// [s] 制御周期の再設定
@@ -14,6 +14,8 @@
 #ifndef INTEGRATOR2
 #define INTEGRATOR2
 
+#include <cstddef>
+
 namespace ARCS {	// ARCS名前空間
 	//! @brief 2次積分器クラス
 	class Integrator2 {
@@ -28,6 +30,7 @@ namespace ARCS {	// ARCS名前空間
 			explicit Integrator2(double SmplTime);	// コンストラクタ SmplTime；[s] 制御周期
 			~Integrator2();						// デストラクタ
 			double GetSignal(double u);			// 出力信号の取得 u；入力信号
+			void GetSignals(const double* u, double* y, const size_t K);	// 出力信号の一括取得 u；入力信号の配列，y；出力信号の配列，K；サンプル数
 			void SetSmplTime(double SmplTime);	// 制御周期の再設定 SmplTime；[s] 制御周期
 			void ClearStateVars(void);			// すべての状態変数のリセット
 	};
@@ -14,6 +14,8 @@
 #ifndef LOWPASSFILTER2
 #define LOWPASSFILTER2
 
+#include <cstddef>
+
 namespace ARCS {	// ARCS名前空間
 	//! @brief 2次低域通過濾波器クラス
 	class LowPassFilter2 {
@@ -33,6 +35,7 @@ namespace ARCS {	// ARCS名前空間
 			// コンストラクタ CutFreq；[rad/s] 遮断周波数，Sharp；鋭さ，SmplTime；[s] 制御周期
 			~LowPassFilter2();					// デストラクタ
 			double GetSignal(double u);			// 出力信号の取得 u；入力信号
+			void GetSignals(const double* u, double* y, const size_t K);	// 出力信号の一括取得 u；入力信号の配列，y；出力信号の配列，K；サンプル数
 			void SetCutFreq(double CutFreq);	// 遮断周波数の再設定 CutFreq；[rad/s] 遮断周波数
 			void SetSharpness(double Sharp);	// 鋭さの再設定 Sharp；鋭さ
 			void SetSmplTime(double SmplTime);	// 制御周期の再設定 SmplTime；[s] 制御周期
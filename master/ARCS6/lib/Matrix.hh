@@ -875,6 +875,7 @@ class Matrix {
 			static_assert(U.N == v.N, "Matrix Size Error");	// 行列の幅と横ベクトルの長さが等しいかチェック
 			static_assert(v.M == 1, "Input is NOT vector.");// 行ベクトルかチェック
 			arcs_assert(0 < m && m <= U.M);	// 指定した行が行列の高さ以内かチェック
+			if(m == 0 || U.M < m) return;	// 緊急停止済みでassertから戻ってきた場合に範囲外へ書き込まないようにする
 			for(size_t i=0;i<U.N;i++) U.Data[i][m-1] = v.Data[i][0];
 		}
 		
@@ -14,6 +14,25 @@
 #include <cmath>
 #include <tuple>
 #include "MotorFrameTransform.hh"
+#include "FastMath.hh"
+
+namespace {
+	constexpr double SQRT2_3 = 0.816496580927726032732;	//!< sqrt(2/3)
+	constexpr double SQRT3_2 = 0.866025403784438646764;	//!< sqrt(3)/2
+
+	//! @brief θ, θ-2π/3, θ+2π/3 の sin と cos を返す関数
+	//! sin と cos を1回だけ同時に計算して，θ±2π/3 は加法定理で求める。
+	//! @param[in]	theta	[rad] 角度
+	//! @param[out]	s0, sm, sp	sin(θ), sin(θ-2π/3), sin(θ+2π/3)
+	//! @param[out]	c0, cm, cp	cos(θ), cos(θ-2π/3), cos(θ+2π/3)
+	void SinCos3(const double theta, double& s0, double& sm, double& sp, double& c0, double& cm, double& cp){
+		ARCS::FastMath::SinCos(theta, s0, c0);
+		sm = -0.5*s0 - SQRT3_2*c0;
+		sp = -0.5*s0 + SQRT3_2*c0;
+		cm = -0.5*c0 + SQRT3_2*s0;
+		cp = -0.5*c0 - SQRT3_2*s0;
+	}
+}
 
 //! @brief UVW相からαβ軸に変換する関数(タプル版)
 //! @param[in]	u	U相
@@ -33,8 +52,10 @@ std::tuple<double, double> ARCS::UVWtoAB(const double u, const double v, const d
 //! @param[in]	w	W相
 //! @return	dq軸 (d, q)のタプル
 std::tuple<double, double> ARCS::UVWtoDQ(const double u, const double v, const double w, const double theta){
-	double d = sqrt(2.0/3.0)*(   u*cos(theta) + v*cos(theta - 2.0/3.0*M_PI) + w*cos(theta + 2.0/3.0*M_PI) );
-	double q = sqrt(2.0/3.0)*( - u*sin(theta) - v*sin(theta - 2.0/3.0*M_PI) - w*sin(theta + 2.0/3.0*M_PI) );
+	double s0, sm, sp, c0, cm, cp;
+	SinCos3(theta, s0, sm, sp, c0, cm, cp);
+	double d = SQRT2_3*(   u*c0 + v*cm + w*cp );
+	double q = SQRT2_3*( - u*s0 - v*sm - w*sp );
 	return std::forward_as_tuple(d, q);		// タプルで返す
 }
 
@@ -43,28 +64,36 @@ std::tuple<double, double> ARCS::UVWtoDQ(const double u, const double v, const d
 //! @param[in]	q	q軸
 //! @return	UVW相 (u, v, w)のタプル
 std::tuple<double, double, double> ARCS::DQtoUVW(const double d, const double q, const double theta){
-	double u = sqrt(2.0/3.0)*( d*cos(theta               ) - q*sin(theta               ) );	// U相の計算
-	double v = sqrt(2.0/3.0)*( d*cos(theta - 2.0/3.0*M_PI) - q*sin(theta - 2.0/3.0*M_PI) );	// V相の計算
-	double w = sqrt(2.0/3.0)*( d*cos(theta + 2.0/3.0*M_PI) - q*sin(theta + 2.0/3.0*M_PI) );	// W相の計算
+	double s0, sm, sp, c0, cm, cp;
+	SinCos3(theta, s0, sm, sp, c0, cm, cp);
+	double u = SQRT2_3*( d*c0 - q*s0 );	// U相の計算
+	double v = SQRT2_3*( d*cm - q*sm );	// V相の計算
+	double w = SQRT2_3*( d*cp - q*sp );	// W相の計算
 	return std::forward_as_tuple(u, v, w);	// タプルで返す
 }
 
 void ARCS::dq_uvw(double d, double q, double theta, double *u, double *v, double *w){
 	// dq-uvw 変換行列 位置の単位に注意　degではなく『rad』
-	*u=sqrt(2.0/3.0)*(d*cos(theta)-q*sin(theta));
-	*v=sqrt(2.0/3.0)*(d*cos(theta-(2.0/3.0*M_PI))-q*sin(theta-(2.0/3.0*M_PI)));
+	double s0, sm, sp, c0, cm, cp;
+	SinCos3(theta, s0, sm, sp, c0, cm, cp);
+	*u=SQRT2_3*(d*c0-q*s0);
+	*v=SQRT2_3*(d*cm-q*sm);
 	*w=-*u-*v;	
 }
 
 void ARCS::dq_uvw_inv(double u, double v, double w, double theta, double *d, double *q){
 	// 逆行列
-	*d=sqrt(2.0/3.0)*(u*cos(theta)+v*cos(theta-2.0/3.0*M_PI)+w*cos(theta+2.0/3.0*M_PI));
-	*q=-sqrt(2.0/3.0)*(u*sin(theta)+v*sin(theta-2.0/3.0*M_PI)+w*sin(theta+2.0/3.0*M_PI));
+	double s0, sm, sp, c0, cm, cp;
+	SinCos3(theta, s0, sm, sp, c0, cm, cp);
+	*d=SQRT2_3*(u*c0+v*cm+w*cp);
+	*q=-SQRT2_3*(u*s0+v*sm+w*sp);
 }
 
 void ARCS::dq_uv(double d, double q, double theta, double *u, double *v){
 	// dq-uv 変換行列 位置の単位に注意　degではなく『rad』
-	*u=sqrt(2.0/3.0)*(d*cos(theta)-q*sin(theta));
-	*v=sqrt(2.0/3.0)*(d*cos(theta-(2.0/3.0*M_PI))-q*sin(theta-(2.0/3.0*M_PI)));
+	double s0, sm, sp, c0, cm, cp;
+	SinCos3(theta, s0, sm, sp, c0, cm, cp);
+	*u=SQRT2_3*(d*c0-q*s0);
+	*v=SQRT2_3*(d*cm-q*sm);
 }
 
@@ -2,6 +2,7 @@
 //! @brief 移動平均クラス
 //!
 //! 入力信号の移動平均を計算し出力するクラス。
+//! 窓内の総和を差分で更新するので，1サンプルあたりの計算量は窓の長さによらず O(1)。
 //!
 //! @date 2020/04/15
 //! @author Yokokura, Yuki
@@ -15,8 +16,7 @@
 #define MOVINGAVERAGE
 
 #include <cassert>
-#include "RingBuffer.hh"
-#include "Statistics.hh"
+#include "SlidingWindow.hh"
 
 // ARCS組込み用マクロ
 #ifdef ARCS_IN
@@ -61,26 +61,26 @@ class MovingAverage {
 		//! @param[in]	u	入力信号
 		//! @return	出力信号
 		double GetSignal(const double u){
-			WindowData.SetFirstValue(u);				// リングバッファの先頭に入力信号を詰める
-			return Statistics::Mean(WindowData.Buffer);	// リングバッファ内の平均値を返す
+			WindowData.Push(u);				// 移動窓の先頭に入力信号を詰めて総和を更新
+			return WindowData.GetMean();	// 移動窓内の平均値を返す
 		}
 		
 		//! @brief 移動平均の窓データを指定した値で埋める関数
 		//! @param[in]	u	指定値
 		void Fill(const double u){
-			WindowData.FillBuffer(u);	// リングバッファを指定した値で埋める
+			WindowData.Fill(u);	// 移動窓を指定した値で埋める
 		}
 		
 		//! @brief 移動平均の窓データをクリアする関数
 		void Clear(void){
-			WindowData.ClearBuffer();
+			WindowData.Clear();
 		}
 		
 	private:
 		MovingAverage(const MovingAverage&) = delete;					//!< コピーコンストラクタ使用禁止
 		const MovingAverage& operator=(const MovingAverage&) = delete;	//!< 代入演算子使用禁止
 		
-		RingBuffer<double, N, false> WindowData;	//!< 移動する窓データ
+		SlidingSum<N> WindowData;	//!< 移動する窓データとその総和
 };
 }
 
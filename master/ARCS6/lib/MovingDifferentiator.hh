@@ -15,7 +15,8 @@
 #define MOVINGDIFFERENTIATOR
 
 #include <cmath>
-#include "RingBuffer.hh"
+#include "Matrix.hh"
+#include "SlidingWindow.hh"
 
 // ARCS組込み用マクロ
 #ifdef ARCS_IN
@@ -47,7 +48,7 @@ class MovingDifferentiator {
 		//! @brief ムーブコンストラクタ
 		//! @param[in]	r	右辺値
 		MovingDifferentiator(MovingDifferentiator&& r)
-			: VarWindow(r.VarWindow), TimeWindow(r.TimeWindow), FirstTime(r.FirstTime)
+			: VarWindow(std::move(r.VarWindow)), TimeWindow(std::move(r.TimeWindow)), FirstTime(r.FirstTime)
 		{
 			
 		}
@@ -64,17 +65,15 @@ class MovingDifferentiator {
 		double GetSignal(const double Var, const double Time){
 			if(FirstTime){
 				// 初めて呼ばれた場合は，
-				VarWindow.FillBuffer(Var);		// 初期位置でバッファを埋めておく
-				TimeWindow.FillBuffer(Time);	// 初期時刻でバッファを埋めておく
+				VarWindow.Fill(Var);	// 初期位置でバッファを埋めておく
+				TimeWindow.Fill(Time);	// 初期時刻でバッファを埋めておく
 				FirstTime = false;				// フラグリセット
 				return 0;						// 最初の1回目は速度を計算できないのでゼロ
 			}else{
 				// 2回目以降は，
-				const T dx = Var - VarWindow.GetFinalValue();		// 現在位置と位置リングバッファの最後尾との偏差の計算
-				const double dt = Time - TimeWindow.GetFinalValue();// 現在時刻と時刻リングバッファの最後尾との偏差の計算
+				const T dx = Var - VarWindow.Push(Var);			// 窓の先頭に現在位置を詰めて，押し出された最後尾との偏差を計算
+				const double dt = Time - TimeWindow.Push(Time);// 窓の先頭に現在時刻を詰めて，押し出された最後尾との偏差を計算
 				const T v = dx/dt;				// 微分の計算
-				VarWindow.SetFirstValue(Var);	// 位置リングバッファの先頭に現在位置を詰める
-				TimeWindow.SetFirstValue(Time);	// 時刻リングバッファの先頭に現在時刻を詰める
 				if(std::isfinite(v)){
 					return v;	// 微分結果が有限値なら計算結果を返す
 				}else{
@@ -91,17 +90,15 @@ class MovingDifferentiator {
 		Matrix<NN,MM> GetSignal(const Matrix<NN,MM>& Var, const double Time){
 			if(FirstTime){
 				// 初めて呼ばれた場合は，
-				VarWindow.FillBuffer(Var);		// 初期位置でバッファを埋めておく
-				TimeWindow.FillBuffer(Time);	// 初期時刻でバッファを埋めておく
+				VarWindow.Fill(Var);	// 初期位置でバッファを埋めておく
+				TimeWindow.Fill(Time);	// 初期時刻でバッファを埋めておく
 				FirstTime = false;				// フラグリセット
 				return Matrix<NN,MM>::zeros();	// 最初の1回目は速度を計算できないのでゼロ
 			}else{
 				// 2回目以降は，
-				const T dx = Var - VarWindow.GetFinalValue();		// 現在位置と位置リングバッファの最後尾との偏差の計算
-				const double dt = Time - TimeWindow.GetFinalValue();// 現在時刻と時刻リングバッファの最後尾との偏差の計算
+				const T dx = Var - VarWindow.Push(Var);			// 窓の先頭に現在位置を詰めて，押し出された最後尾との偏差を計算
+				const double dt = Time - TimeWindow.Push(Time);// 窓の先頭に現在時刻を詰めて，押し出された最後尾との偏差を計算
 				const T v = dx/dt;				// 微分の計算
-				VarWindow.SetFirstValue(Var);	// 位置リングバッファの先頭に現在位置を詰める
-				TimeWindow.SetFirstValue(Time);	// 時刻リングバッファの先頭に現在時刻を詰める
 				return v;						// 計算結果を返す
 			}
 		}
@@ -114,8 +111,8 @@ class MovingDifferentiator {
 	private:
 		MovingDifferentiator(const MovingDifferentiator&) = delete;					//!< コピーコンストラクタ使用禁止
 		const MovingDifferentiator& operator=(const MovingDifferentiator&) = delete;//!< 代入演算子使用禁止
-		RingBuffer<T, W, false> VarWindow;			//!< 変数データ用リングバッファ
-		RingBuffer<double, W, false> TimeWindow;	//!< 時間データ用リングバッファ
+		SlidingWindow<T, W> VarWindow;		//!< 変数データ用リングバッファ
+		SlidingWindow<double, W> TimeWindow;	//!< 時間データ用リングバッファ
 		bool FirstTime;								//!< 初めて呼ばれたかどうかのフラグ
 };
 }
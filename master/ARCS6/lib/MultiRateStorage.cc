@@ -0,0 +1,15 @@
+//! @file MultiRateStorage.cc
+//! @brief マルチレートデータ格納/ファイル出力クラス(テンプレート版)
+//!
+//! チャネル毎に異なる間引き数でデータを一時的に格納し，チャネル毎に時刻付きの系列として
+//! 1つのCSV/TAB区切りDATファイルに出力します。間引き前に区間平均によるアンチエイリアス処理も可能です。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "MultiRateStorage.hh"
+
+// テンプレートクラスのため，実体もヘッダ側に実装。
@@ -0,0 +1,250 @@
+//! @file MultiRateStorage.hh
+//! @brief マルチレートデータ格納/ファイル出力クラス(テンプレート版)
+//!
+//! チャネル毎に異なる間引き数でデータを一時的に格納し，チャネル毎に時刻付きの系列として
+//! 1つのCSV/TAB区切りDATファイルに出力します。間引き前に区間平均によるアンチエイリアス処理も可能です。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef MULTIRATESTORAGE
+#define MULTIRATESTORAGE
+
+#include <cassert>
+#include <array>
+#include <memory>
+#include <string>
+#include <fstream>
+#include "DataStorage.hh"
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+	#include "ARCSeventlog.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+	#define PassedLog()
+	#define EventLog(a)
+	#define EventLogVar(a)
+#endif
+
+namespace ARCS {	// ARCS名前空間
+	//! @brief マルチレートデータ格納クラスのコンパイル時スケジュール計算関数群
+	namespace MultiRateSchedule {
+		//! @brief 間引き数の種類の数を数える関数
+		//! @param[in]	Rate	各チャネルの間引き数
+		//! @return	間引き数の種類の数
+		template<size_t N>
+		constexpr size_t CountGroups(const std::array<unsigned int, N>& Rate){
+			size_t ret = 0;
+			for(size_t i = 0; i < N; ++i){
+				bool Found = false;
+				for(size_t j = 0; j < i; ++j) Found |= (Rate[j] == Rate[i]);
+				if(Found == false) ++ret;
+			}
+			return ret;
+		}
+
+		//! @brief 間引き数の種類を出現順に並べる関数
+		//! @param[in]	Rate	各チャネルの間引き数
+		//! @return	グループ毎の間引き数
+		template<size_t G, size_t N>
+		constexpr std::array<unsigned int, G> GroupRates(const std::array<unsigned int, N>& Rate){
+			std::array<unsigned int, G> ret = {0};
+			size_t g = 0;
+			for(size_t i = 0; i < N; ++i){
+				bool Found = false;
+				for(size_t j = 0; j < g; ++j) Found |= (ret[j] == Rate[i]);
+				if(Found == false) ret[g++] = Rate[i];
+			}
+			return ret;
+		}
+
+		//! @brief チャネル番号をグループ順に並べる関数
+		//! @param[in]	Rate		各チャネルの間引き数
+		//! @param[in]	GroupRate	グループ毎の間引き数
+		//! @return	グループ順に並べたチャネル番号
+		template<size_t G, size_t N>
+		constexpr std::array<size_t, N> ChannelOrder(const std::array<unsigned int, N>& Rate, const std::array<unsigned int, G>& GroupRate){
+			std::array<size_t, N> ret = {0};
+			size_t k = 0;
+			for(size_t g = 0; g < G; ++g){
+				for(size_t i = 0; i < N; ++i) if(Rate[i] == GroupRate[g]) ret[k++] = i;
+			}
+			return ret;
+		}
+
+		//! @brief 各グループの先頭位置を計算する関数
+		//! @param[in]	Rate		各チャネルの間引き数
+		//! @param[in]	GroupRate	グループ毎の間引き数
+		//! @return	グループ順に並べたチャネル番号の配列における各グループの先頭位置(最後は終端)
+		template<size_t G, size_t N>
+		constexpr std::array<size_t, G + 1> GroupBegin(const std::array<unsigned int, N>& Rate, const std::array<unsigned int, G>& GroupRate){
+			std::array<size_t, G + 1> ret = {0};
+			for(size_t g = 0; g < G; ++g){
+				size_t Num = 0;
+				for(size_t i = 0; i < N; ++i) if(Rate[i] == GroupRate[g]) ++Num;
+				ret[g + 1] = ret[g] + Num;
+			}
+			return ret;
+		}
+
+		//! @brief 各チャネルのデータバッファ上の先頭位置を計算する関数
+		//! @param[in]	Capacity	各チャネルのデータ数
+		//! @return	各チャネルの先頭位置(最後は全体の要素数)
+		template<size_t N>
+		constexpr std::array<size_t, N + 1> Offsets(const std::array<size_t, N>& Capacity){
+			std::array<size_t, N + 1> ret = {0};
+			for(size_t i = 0; i < N; ++i) ret[i + 1] = ret[i] + 2*Capacity[i];	// 時刻と値の2つ分
+			return ret;
+		}
+	}
+
+	//! @brief マルチレートデータ格納/ファイル出力クラス(テンプレート版)
+	//! 毎周期のコストは「間引き数の種類の数 + その周期で保存時刻が来たチャネル数 + アンチエイリアス有効チャネル数」に比例し，
+	//! 全チャネル数には(引数の受け渡しを除いて)比例しない。
+	//! @tparam	SmplTime	[ns] 制御周期
+	//! @tparam	SaveTime	[s] 保存時間
+	//! @tparam	Rates		各チャネルの間引き数 (チャネル数分だけ並べる)
+	template <unsigned long SmplTime, unsigned int SaveTime, unsigned int... Rates>
+	class MultiRateStorage {
+		public:
+			static constexpr size_t N = sizeof...(Rates);	//!< チャネル数
+
+			//! @brief コンストラクタ
+			MultiRateStorage()
+				: Data(std::make_unique<double[]>(OFFSET[N])), Buff({0}), Accum({0}), AntiAlias({false}),
+				  AAList({0}), AANum(0), Tindex({0}), Countdown(GROUP_RATE)
+			{
+				static_assert(0 < N, "MultiRateStorage: Number of channels must be positive");
+				PassedLog();	// イベントログにココを通過したことを記録
+			}
+
+			//! @brief デストラクタ
+			~MultiRateStorage(){
+				PassedLog();	// イベントログにココを通過したことを記録
+			}
+
+			//! @brief 間引き前のアンチエイリアス処理(区間平均)を設定する関数(非リアルタイム空間で呼ぶこと)
+			//! 有効にしたチャネルは，間引き区間の平均値を保存する。
+			//! @param[in]	Channel	チャネル番号
+			//! @param[in]	Enable	true = 有効，false = 無効
+			void SetAntiAlias(const size_t Channel, const bool Enable){
+				arcs_assert(Channel < N);
+				AntiAlias.at(Channel) = Enable;
+				AANum = 0;
+				for(size_t i = 0; i < N; ++i) if(AntiAlias[i] == true) AAList[AANum++] = i;	// 有効チャネルのリストを作り直す
+				ClearCounter();
+			}
+
+			//! @brief データを格納する関数(リアルタイム空間で毎周期呼ぶこと)
+			//! @param[in]	t	時刻
+			//! @param[in]	u	各チャネルの値
+			template<typename... T>
+			void SetData(const double t, const T&... u){
+				static_assert(sizeof...(u) == N, "MultiRateStorage: Number of channels mismatch");
+				size_t i = 0;
+				((Buff[i++] = static_cast<double>(u)), ...);
+
+				// アンチエイリアス有効チャネルの積算
+				for(size_t k = 0; k < AANum; ++k) Accum[AAList[k]] += Buff[AAList[k]];
+
+				// 保存時刻が来たグループのチャネルだけを格納
+				for(size_t g = 0; g < G; ++g){
+					if(--Countdown[g] != 0) continue;
+					Countdown[g] = GROUP_RATE[g];
+					for(size_t k = GROUP_BEGIN[g]; k < GROUP_BEGIN[g + 1]; ++k){
+						const size_t ch = ORDER[k];
+						double y = Buff[ch];
+						if(AntiAlias[ch] == true){
+							y = Accum[ch]/static_cast<double>(GROUP_RATE[g]);	// 間引き区間の平均値
+							Accum[ch] = 0;
+						}
+						if(Tindex[ch] < CAPACITY[ch]){	// 設定時間の範囲内であれば
+							Data[OFFSET[ch] + 2*Tindex[ch]    ] = t;	// 時刻と
+							Data[OFFSET[ch] + 2*Tindex[ch] + 1] = y;	// 値を保持
+							++Tindex[ch];	// 時間用カウンタを進める
+						}
+					}
+				}
+			}
+
+			//! @brief CSV/DATファイルの保存
+			//! チャネル毎に「時刻, 値」の2列を並べて出力する。データ数が少ないチャネルの残りの行は空欄となる。
+			//! @param[in] FileName ファイル名
+			//! @param[in] FileType ファイル形式
+			void SaveDataFile(const std::string& FileName, const DataStorageType FileType) const {
+				// ファイルストリーム
+				std::ofstream fout(FileName.c_str(), std::ios::out | std::ios::trunc);
+
+				// エラーチェック
+				arcs_assert(fout.bad() == false);	// 致命的なエラーの場合
+				arcs_assert(fout.fail() == false);	// ファイル開くのに失敗した場合
+
+				// 書式設定
+				fout.setf(std::ios::scientific);	// 指数表示
+				fout.precision(14);					// 小数点桁数
+				const char Delim = (FileType == DataStorageType::FORMAT_DAT) ? '\t' : ',';	// 区切り文字
+
+				// 実験データの書き出し
+				PassedLog();	// イベントログにココを通過したことを記録
+				size_t Tmax = 0;
+				for(size_t i = 0; i < N; ++i) if(Tmax < Tindex[i]) Tmax = Tindex[i];
+				for(size_t j = 0; j < Tmax; ++j){		// 一番長いチャネルの時間分だけ回す
+					for(size_t i = 0; i < N; ++i){		// チャネルの数だけ回す
+						if(j < Tindex[i]) fout << Data[OFFSET[i] + 2*j] << Delim << Data[OFFSET[i] + 2*j + 1];
+						else fout << Delim;	// データが無いときは空欄
+						if(i < N - 1) fout << Delim;
+					}
+					fout << '\n';	// 改行
+				}
+				fout.flush();
+				PassedLog();	// イベントログにココを通過したことを記録
+			}
+
+			//! @brief 要素数カウンタをクリア
+			void ClearCounter(void){
+				Tindex.fill(0);
+				Countdown = GROUP_RATE;
+				Accum.fill(0);
+			}
+
+			//! @brief チャネル毎の格納済みデータ数を返す関数
+			//! @param[in]	Channel	チャネル番号
+			//! @return	データ数
+			size_t GetDataNum(const size_t Channel) const {
+				return Tindex.at(Channel);
+			}
+
+		private:
+			MultiRateStorage(const MultiRateStorage&) = delete;					//!< コピーコンストラクタ使用禁止
+			const MultiRateStorage& operator=(const MultiRateStorage&) = delete;//!< 代入演算子使用禁止
+
+			static constexpr std::array<unsigned int, N> RATE = {Rates...};	//!< 各チャネルの間引き数
+			static constexpr size_t G = MultiRateSchedule::CountGroups(RATE);	//!< 間引き数の種類の数
+			static constexpr std::array<unsigned int, G> GROUP_RATE = MultiRateSchedule::GroupRates<G>(RATE);	//!< グループ毎の間引き数
+			static constexpr std::array<size_t, N> ORDER = MultiRateSchedule::ChannelOrder(RATE, GROUP_RATE);		//!< グループ順に並べたチャネル番号
+			static constexpr std::array<size_t, G + 1> GROUP_BEGIN = MultiRateSchedule::GroupBegin(RATE, GROUP_RATE);	//!< 各グループの先頭位置
+			static constexpr std::array<size_t, N> CAPACITY = {
+				static_cast<size_t>(static_cast<unsigned long long>(SaveTime)*1000000000ULL/SmplTime/Rates)...
+			};	//!< 各チャネルのデータ数
+			static constexpr std::array<size_t, N + 1> OFFSET = MultiRateSchedule::Offsets(CAPACITY);	//!< 各チャネルのデータバッファ上の先頭位置
+
+			std::unique_ptr<double[]> Data;		//!< データ格納用変数(巨大なデータを扱えるようにヒープ領域に確保する)
+			std::array<double, N> Buff;			//!< データバッファ
+			std::array<double, N> Accum;		//!< アンチエイリアス用の積算値
+			std::array<bool, N> AntiAlias;		//!< アンチエイリアス有効フラグ
+			std::array<size_t, N> AAList;		//!< アンチエイリアス有効チャネルのリスト
+			size_t AANum;						//!< アンチエイリアス有効チャネルの数
+			std::array<size_t, N> Tindex;		//!< 時間用カウンタ
+			std::array<unsigned int, G> Countdown;	//!< 次の保存時刻までの残り周期数
+	};
+}
+
+#endif
+
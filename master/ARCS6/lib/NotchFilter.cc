@@ -43,6 +43,28 @@ double NotchFilter::GetSignal(double u){
 	return y;
 }
 
+void NotchFilter::GetSignals(const double* u, double* y, const size_t K){
+	// 出力信号の一括取得 u；入力信号の配列，y；出力信号の配列，K；サンプル数 (u と y は同じ配列でも良い)
+	// GetSignal を K 回呼ぶのと同じ式で計算するので結果はビット単位で一致する。
+	// 係数の計算をループの外に出し，状態変数を局所変数に置いたまま漸化式を回す。
+	const double c0 = 1.0/(4.0+2.0*Ts*w/Q+w*w*Ts*Ts);	// 係数
+	const double c1 = 4.0+w*w*Ts*Ts, c2 = 2.0*w*w*Ts*Ts-8.0, c3 = 4.0-2.0*Ts*w/Q+w*w*Ts*Ts;
+	double u1 = uZ1, u2 = uZ2, y1 = yZ1, y2 = yZ2;
+	for(size_t k = 0; k < K; ++k){
+		const double uk = u[k];
+		const double yk = c0*( (uk+u2)*c1 + (u1-y1)*c2 - y2*c3 );
+		y[k] = yk;
+		u2 = u1;
+		u1 = uk;
+		y2 = y1;
+		y1 = yk;
+	}
+	uZ1 = u1;
+	uZ2 = u2;
+	yZ1 = y1;
+	yZ2 = y2;
+}
+
 void NotchFilter::SetCuttoff(double AngFreq){
 	// 遮断中心周波数の再設定 AngFreq；[rad/s] 帯域
 	w=AngFreq;
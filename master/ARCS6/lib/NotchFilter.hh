@@ -14,6 +14,8 @@
 #ifndef NOTCHFILTER
 #define NOTCHFILTER
 
+#include <cstddef>
+
 namespace ARCS {	// ARCS名前空間
 	//! @brief ノッチフィルタクラス
 	class NotchFilter {
@@ -31,6 +33,7 @@ namespace ARCS {	// ARCS名前空間
 			// コンストラクタ  AngFreq；[rad/s] 遮断中心周波数，Sharp；鋭さ，SmplTime；[s] 制御周期
 			~NotchFilter();						// デストラクタ
 			double GetSignal(double u);			// 出力信号の取得 u；入力信号
+			void GetSignals(const double* u, double* y, const size_t K);	// 出力信号の一括取得 u；入力信号の配列，y；出力信号の配列，K；サンプル数
 			void SetCuttoff(double AngFreq);	// 遮断中心周波数の再設定 AngFreq；[rad/s] 帯域
 			void SetSharpness(double Sharp);	// 鋭さの再設定 Sharp；鋭さ
 			void SetSmplTime(double SmplTime);	// 制御周期の再設定 SmplTime；[s] 制御周期
@@ -14,6 +14,8 @@
 #ifndef PHASELEADLAG
 #define PHASELEADLAG
 
+#include <cstddef>
+
 namespace ARCS {	// ARCS名前空間
 	//! @brief 位相進み/遅れ補償器クラス
 	class PhaseLeadLag {
@@ -30,6 +32,7 @@ namespace ARCS {	// ARCS名前空間
 			// AngFreq；[rad/s] ゲイン特性の折れ点周波数，a < 1 で位相遅れ，1 < a で位相進み，SmplTime；[s] 制御周期
 			~PhaseLeadLag();					// デストラクタ
 			double GetSignal(double u);			// 出力信号の取得 u；入力信号
+			void GetSignals(const double* u, double* y, const size_t K);	// 出力信号の一括取得 u；入力信号の配列，y；出力信号の配列，K；サンプル数
 			void SetSmplTime(double SmplTime);	// 制御周期の再設定 SmplTime；[s] 制御周期
 			void SetFreq(double AngFreq);			// ゲイン特性の折れ点周波数の再設定 AngFreq；[rad/s] 折れ点周波数
 			void SetPhase(double Phase);		// a < 1 で位相遅れ，1 < a で位相進み
@@ -89,6 +89,13 @@ class RandomGenerator {
 			RandomDevice.entropy();
 			MersenneTwister.seed(RandomDevice());
 		}
+		
+		//! @brief 乱数シードを固定値に設定する関数 (再現性のある乱数列が欲しいとき用)
+		//! @param[in]	Seed	乱数シード
+		void SetSeed(const unsigned int Seed){
+			MersenneTwister.seed(Seed);
+			GaussianRandom.reset();	// 正規分布乱数の内部状態も捨てる
+		}
 
 		//! @brief 乱数行列を生成する関数
 		//! @param[out]	Y	乱数で埋められた行列
@@ -3,7 +3,7 @@
 //!
 //! POSIX準拠の共有メモリを生成・使用・解放するクラス
 //!
-//! @date 2024/04/19
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2024 Yokokura, Yuki
@@ -136,7 +136,7 @@ class SharedMemory {
 			// メモリの初期化
 			if constexpr(M == ShMemMode::SHM_WRONLY || M == ShMemMode::SHM_RDWR){
 				// 書き込みできるモードのときはゼロ埋め
-				memset(ShMem, 0, sizeof(T)*S);
+				memset(static_cast<void*>(ShMem), 0, sizeof(T)*S);
 			}
 		}
 		
@@ -171,6 +171,19 @@ class SharedMemory {
 			ShMem[i] = val;
 		}
 		
+		//! @brief 共有メモリの先頭ポインタを返す関数
+		//! 構造体を丸ごとコピーせずに直接アクセスしたいときに使う
+		//! @return	先頭ポインタ
+		T* GetPointer(void){
+			return ShMem;
+		}
+		
+		//! @brief 共有メモリの先頭ポインタを返す関数(const版)
+		//! @return	先頭ポインタ
+		const T* GetPointer(void) const {
+			return ShMem;
+		}
+		
 	private:
 		SharedMemory(const SharedMemory&) = delete;						//!< コピーコンストラクタ使用禁止
 		const SharedMemory& operator=(const SharedMemory&) = delete;	//!< 代入演算子使用禁止
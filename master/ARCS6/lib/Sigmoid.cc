@@ -11,13 +11,14 @@
 
 #include "Sigmoid.hh"
 #include <cmath>
+#include "FastMath.hh"
 
 //! @brief シグモイド関数
 //! @param[in] u 入力信号
 //! @param[in] a ゲイン
 //! @return 出力信号
 double ARCS::Sigmoid(double u, double a){
-	return 1.0/(1.0 + exp(-a*u));
+	return FastMath::Sigmoid(a*u);
 }
 
 
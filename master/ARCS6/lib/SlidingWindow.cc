@@ -0,0 +1,14 @@
+//! @file SlidingWindow.cc
+//! @brief 移動窓演算クラス群
+//!
+//! 移動窓のリングバッファ，窓内の総和，窓内の最小値・最大値を1サンプルあたり O(1) で更新するクラス群。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "SlidingWindow.hh"
+
+// テンプレートクラスのため，実体もヘッダ側に実装。
@@ -0,0 +1,322 @@
+//! @file SlidingWindow.hh
+//! @brief 移動窓演算クラス群
+//!
+//! 移動窓のリングバッファ，窓内の総和，窓内の最小値・最大値を1サンプルあたり O(1) で更新するクラス群。
+//! どれも1つの制御ループからのみ読み書きされることを前提にしているので，Mutexロックは使わない。
+//!
+//! @par 窓内の総和の誤差について
+//! 総和は「入ってきた値を足して出ていった値を引く」で更新するので，そのままだと丸め誤差が際限なく蓄積する。
+//! ここでは補償付き加算(Kahanの加算)を使った上で，窓の1周分ごとに別途積算しておいた総和で置き換えるので，
+//! 誤差は窓1周分の補償付き加算の誤差で頭打ちになる。置き換えは毎サンプル1回の加算で並行して作るので，
+//! 窓の長さ N によらず最悪でも O(1) で済む(N サンプルに1回だけ O(N) の再計算をする方式と違って処理時間が跳ねない)。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef SLIDINGWINDOW
+#define SLIDINGWINDOW
+
+#include <cassert>
+#include <array>
+#include <type_traits>
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+	#include "ARCSeventlog.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+	#define PassedLog()
+	#define EventLog(a)
+	#define EventLogVar(a)
+#endif
+
+namespace ARCS {	// ARCS名前空間
+//! @brief 移動窓リングバッファクラス (単一所有者用，Mutexロック無し)
+//! @tparam	T	型
+//! @tparam	N	窓の長さ
+template <typename T, size_t N>
+class SlidingWindow {
+	static_assert(0 < N, "SlidingWindow: Size Error");
+	public:
+		//! @brief コンストラクタ
+		SlidingWindow()
+			: Buffer(), i(0)
+		{
+
+		}
+
+		//! @brief ムーブコンストラクタ
+		//! @param[in]	r	右辺値
+		SlidingWindow(SlidingWindow&& r)
+			: Buffer(std::move(r.Buffer)), i(r.i)
+		{
+
+		}
+
+		//! @brief デストラクタ
+		~SlidingWindow(){
+
+		}
+
+		//! @brief 窓の先頭に値を詰めて，窓から押し出された最後尾の値を返す関数
+		//! @param[in]	u	入力値
+		//! @return	押し出された値 (詰める前の最後尾の値)
+		T Push(const T& u){
+			T ret = Buffer[i];			// 最後尾の値を退避
+			Buffer[i] = u;				// 最後尾の位置に入力値を上書きして先頭にする
+			i = (i + 1 == N) ? 0 : i + 1;	// 除算を使わずにカウンタを進める
+			return ret;
+		}
+
+		//! @brief 窓の先頭(最新)の値を返す関数
+		//! @return	最新の値
+		const T& GetFirstValue(void) const {
+			return Buffer[i == 0 ? N - 1 : i - 1];
+		}
+
+		//! @brief 窓の最後尾(最古)の値を返す関数
+		//! @return	最古の値
+		const T& GetFinalValue(void) const {
+			return Buffer[i];
+		}
+
+		//! @brief 窓の先頭から k だけ過去に戻ったところの値を返す関数
+		//! @param[in]	k	相対要素番号 (0 = 最新, N-1 = 最古)
+		//! @return	値
+		const T& GetRelativeValueFromFirst(const size_t k) const {
+			arcs_assert(k < N);
+			return Buffer[k < i ? i - 1 - k : i - 1 - k + N];
+		}
+
+		//! @brief 窓の中身を指定値で埋める関数
+		//! @param[in]	u	指定値
+		void Fill(const T& u){
+			Buffer.fill(u);
+		}
+
+		//! @brief 窓の中身をそのまま返す関数 (要素の並びは時刻順ではない)
+		//! @return	窓の配列
+		const std::array<T, N>& GetBuffer(void) const {
+			return Buffer;
+		}
+
+	private:
+		SlidingWindow(const SlidingWindow&) = delete;					//!< コピーコンストラクタ使用禁止
+		const SlidingWindow& operator=(const SlidingWindow&) = delete;	//!< 代入演算子使用禁止
+		std::array<T, N> Buffer;	//!< リングバッファ
+		size_t i;					//!< 次に書き込む(=最古の値がある)要素番号
+};
+
+//! @brief 移動窓内の総和クラス
+//! @tparam	N	窓の長さ
+//! @tparam	T	浮動小数点型 (デフォルトはdouble型)
+template <size_t N, typename T = double>
+class SlidingSum {
+	static_assert(std::is_floating_point_v<T>, "SlidingSum: Type Error");
+	public:
+		//! @brief コンストラクタ
+		SlidingSum()
+			: Window(), Sum(0), SumComp(0), Fresh(0), FreshComp(0), Count(0)
+		{
+
+		}
+
+		//! @brief ムーブコンストラクタ
+		//! @param[in]	r	右辺値
+		SlidingSum(SlidingSum&& r)
+			: Window(std::move(r.Window)), Sum(r.Sum), SumComp(r.SumComp), Fresh(r.Fresh), FreshComp(r.FreshComp), Count(r.Count)
+		{
+
+		}
+
+		//! @brief デストラクタ
+		~SlidingSum(){
+
+		}
+
+		//! @brief 窓の先頭に入力値を詰めて，窓内の総和を返す関数
+		//! @param[in]	u	入力値
+		//! @return	窓内の総和
+		T Push(const T u){
+			const T Old = Window.Push(u);	// 先頭に詰めて押し出された値を受け取る
+			KahanAdd(Sum, SumComp, u - Old);// 差分で総和を更新
+			KahanAdd(Fresh, FreshComp, u);	// 窓1周分の総和を並行して積算
+			if(++Count == N){
+				// 窓が1周したら，積算しておいた総和は窓内の全要素の総和そのものなので置き換えて誤差を捨てる
+				Sum = Fresh;
+				SumComp = FreshComp;
+				Fresh = FreshComp = 0;
+				Count = 0;
+			}
+			return Sum;
+		}
+
+		//! @brief 窓内の総和を返す関数
+		//! @return	総和
+		T GetSum(void) const {
+			return Sum;
+		}
+
+		//! @brief 窓内の平均値を返す関数
+		//! @return	平均値
+		T GetMean(void) const {
+			return Sum/static_cast<T>(N);
+		}
+
+		//! @brief 窓内を指定値で埋める関数
+		//! @param[in]	u	指定値
+		void Fill(const T u){
+			Window.Fill(u);
+			Sum = static_cast<T>(N)*u;
+			SumComp = Fresh = FreshComp = 0;
+			Count = 0;
+		}
+
+		//! @brief 窓内をゼロクリアする関数
+		void Clear(void){
+			Fill(0);
+		}
+
+	private:
+		SlidingSum(const SlidingSum&) = delete;					//!< コピーコンストラクタ使用禁止
+		const SlidingSum& operator=(const SlidingSum&) = delete;//!< 代入演算子使用禁止
+		SlidingWindow<T, N> Window;	//!< 移動窓
+		T Sum;			//!< 窓内の総和
+		T SumComp;		//!< 総和の補償項
+		T Fresh;		//!< 窓1周分の総和
+		T FreshComp;	//!< 窓1周分の総和の補償項
+		size_t Count;	//!< 窓1周分の総和の積算数
+
+		//! @brief 補償付き加算 (Kahanの加算)
+		//! @param[in,out]	s	総和
+		//! @param[in,out]	c	補償項
+		//! @param[in]		x	加える値
+		static void KahanAdd(T& s, T& c, const T x){
+			const T y = x - c;
+			const T t = s + y;
+			c = (t - s) - y;
+			s = t;
+		}
+};
+
+//! @brief 移動窓内の最小値・最大値クラス (単調両端キュー版)
+//! 窓内で最小値・最大値になる可能性が残っている値だけを単調な両端キューで保持するので，更新は償却 O(1)。
+//! @tparam	N	窓の長さ
+//! @tparam	T	型 (デフォルトはdouble型)
+template <size_t N, typename T = double>
+class SlidingMinMax {
+	static_assert(0 < N, "SlidingMinMax: Size Error");
+	public:
+		//! @brief コンストラクタ
+		SlidingMinMax()
+			: MinQue(), MaxQue(), k(0)
+		{
+			Fill(0);
+		}
+
+		//! @brief ムーブコンストラクタ
+		//! @param[in]	r	右辺値
+		SlidingMinMax(SlidingMinMax&& r)
+			: MinQue(std::move(r.MinQue)), MaxQue(std::move(r.MaxQue)), k(r.k)
+		{
+
+		}
+
+		//! @brief デストラクタ
+		~SlidingMinMax(){
+
+		}
+
+		//! @brief 窓の先頭に入力値を詰める関数
+		//! @param[in]	u	入力値
+		void Push(const T& u){
+			++k;
+			MinQue.Push(u, k, [](const T& a, const T& b){ return b <= a; });	// u 以上の値はもう最小値にならない
+			MaxQue.Push(u, k, [](const T& a, const T& b){ return a <= b; });	// u 以下の値はもう最大値にならない
+		}
+
+		//! @brief 窓内の最小値を返す関数
+		//! @return	最小値
+		const T& GetMin(void) const {
+			return MinQue.Front();
+		}
+
+		//! @brief 窓内の最大値を返す関数
+		//! @return	最大値
+		const T& GetMax(void) const {
+			return MaxQue.Front();
+		}
+
+		//! @brief 窓内を指定値で埋める関数
+		//! @param[in]	u	指定値
+		void Fill(const T& u){
+			MinQue.Reset(u, k);	// 窓内の全要素が同じ値なので，最新の1個だけ覚えておけば良い
+			MaxQue.Reset(u, k);
+		}
+
+		//! @brief 窓内をゼロクリアする関数
+		void Clear(void){
+			Fill(0);
+		}
+
+	private:
+		SlidingMinMax(const SlidingMinMax&) = delete;					//!< コピーコンストラクタ使用禁止
+		const SlidingMinMax& operator=(const SlidingMinMax&) = delete;	//!< 代入演算子使用禁止
+
+		//! @brief 固定長の単調両端キュー
+		struct MonoQueue {
+			std::array<T, N> Value = {};		//!< 値
+			std::array<size_t, N> Index = {};	//!< 値が入ってきたサンプル番号
+			size_t Head = 0;	//!< 先頭の要素番号
+			size_t Size = 0;	//!< 要素数
+
+			//! @brief 値を追加する関数
+			//! @param[in]	u		入力値
+			//! @param[in]	kk		サンプル番号
+			//! @param[in]	Dominated	末尾の値 a が新しい値 b に支配されるとき true を返す関数
+			template<typename F>
+			void Push(const T& u, const size_t kk, F&& Dominated){
+				if(0 < Size && Index[Head] + N <= kk){
+					Head = (Head + 1 == N) ? 0 : Head + 1;	// 窓から出た先頭を捨てる
+					--Size;
+				}
+				while(0 < Size && Dominated(Value[Wrap(Head + Size - 1)], u)) --Size;	// 支配される末尾を捨てる
+				const size_t j = Wrap(Head + Size);
+				Value[j] = u;
+				Index[j] = kk;
+				++Size;
+			}
+
+			//! @brief 先頭の値を返す関数
+			const T& Front(void) const {
+				return Value[Head];
+			}
+
+			//! @brief 1個の値だけを持つ状態にする関数
+			void Reset(const T& u, const size_t kk){
+				Head = 0;
+				Size = 1;
+				Value[0] = u;
+				Index[0] = kk;
+			}
+
+			//! @brief 要素番号を 0～N-1 に折り返す関数 (j < 2N が前提)
+			static size_t Wrap(const size_t j){
+				return j < N ? j : j - N;
+			}
+		};
+
+		MonoQueue MinQue;	//!< 最小値用の単調増加キュー
+		MonoQueue MaxQue;	//!< 最大値用の単調減少キュー
+		size_t k;			//!< サンプル番号
+};
+}
+
+#endif
+
@@ -15,7 +15,7 @@
 #define SPEEDCALCULATOR
 
 #include <cmath>
-#include "RingBuffer.hh"
+#include "SlidingWindow.hh"
 
 namespace ARCS {	// ARCS名前空間
 	//! @brief 速度計算器
@@ -33,7 +33,7 @@ namespace ARCS {	// ARCS名前空間
 			//! @brief ムーブコンストラクタ
 			//! @param[in]	r	右辺値
 			SpeedCalculator(SpeedCalculator&& r)
-				: PositionBuff(r.PositionBuff), TimeBuff(r.TimeBuff), FirstTime(r.FirstTime)
+				: PositionBuff(std::move(r.PositionBuff)), TimeBuff(std::move(r.TimeBuff)), FirstTime(r.FirstTime)
 			{
 				
 			}
@@ -50,17 +50,15 @@ namespace ARCS {	// ARCS名前空間
 			double GetSpeed(const double Position, const double Time){
 				if(FirstTime){
 					// 初めて呼ばれた場合は，
-					PositionBuff.FillBuffer(Position);	// 初期位置でバッファを埋めておく
-					TimeBuff.FillBuffer(Time);			// 初期時刻でバッファを埋めておく
+					PositionBuff.Fill(Position);		// 初期位置でバッファを埋めておく
+					TimeBuff.Fill(Time);			// 初期時刻でバッファを埋めておく
 					FirstTime = false;					// フラグリセット
 					return 0;							// 最初の1回目は速度を計算できないのでゼロ
 				}else{
 					// 2回目以降は，
-					const double dx = Position - PositionBuff.GetFinalValue();	// 現在位置と位置リングバッファの最後尾との偏差の計算
-					const double dt = Time - TimeBuff.GetFinalValue();			// 現在時刻と時刻リングバッファの最後尾との偏差の計算
+					const double dx = Position - PositionBuff.Push(Position);	// 窓の先頭に現在位置を詰めて，押し出された最後尾との偏差を計算
+					const double dt = Time - TimeBuff.Push(Time);				// 窓の先頭に現在時刻を詰めて，押し出された最後尾との偏差を計算
 					const double v = dx/dt;					// 速度の計算
-					PositionBuff.SetFirstValue(Position);	// 位置リングバッファの先頭に現在位置を詰める
-					TimeBuff.SetFirstValue(Time);			// 時刻リングバッファの先頭に現在時刻を詰める
 					if(std::isfinite(v)){
 						return v;	// 速度が有限値なら計算結果を返す
 					}else{
@@ -77,8 +75,8 @@ namespace ARCS {	// ARCS名前空間
 		private:
 			SpeedCalculator(const SpeedCalculator&) = delete;					//!< コピーコンストラクタ使用禁止
 			const SpeedCalculator& operator=(const SpeedCalculator&) = delete;	//!< 代入演算子使用禁止
-			RingBuffer<double, N, false> PositionBuff;	//!< 位置データ用リングバッファ
-			RingBuffer<double, N, false> TimeBuff;		//!< 時間データ用リングバッファ
+			SlidingWindow<double, N> PositionBuff;	//!< 位置データ用リングバッファ
+			SlidingWindow<double, N> TimeBuff;		//!< 時間データ用リングバッファ
 			bool FirstTime;								//!< 初めて呼ばれたかどうかのフラグ
 	};
 }
@@ -41,7 +41,7 @@ class StateSpaceSystem {
 	public:
 		//! @brief コンストラクタ(空コンストラクタ版)
 		StateSpaceSystem(void)
-			: Ad(), Bd(), Cd(), Dd(), u(), x(), x_next(), y(), y_next(), DirectTerm(true)
+			: Ad(), Bd(), Cd(), Dd(), u(), x(), x_prev(), u_prev(), y(), y_next(), YValid(true), YnextValid(true), DirectTerm(true)
 		{
 			PassedLog();
 		}
@@ -52,7 +52,7 @@ class StateSpaceSystem {
 		//! @param[in]	C	C行列
 		//! @param[in]	Ts	サンプリング周期 [s]
 		StateSpaceSystem(const ArcsMat<N,N>& A, const ArcsMat<N,I>& B, const ArcsMat<O,N>& C, const double Ts)
-			: Ad(), Bd(), Cd(), Dd(), u(), x(), x_next(), y(), y_next(), DirectTerm(true)
+			: Ad(), Bd(), Cd(), Dd(), u(), x(), x_prev(), u_prev(), y(), y_next(), YValid(true), YnextValid(true), DirectTerm(true)
 		{
 			SetContinuous(A, B, C, Ts);		// 連続系のA行列，B行列，C行列を設定して離散化
 			PassedLog();
@@ -65,7 +65,7 @@ class StateSpaceSystem {
 		//! @param[in]	D	D行列
 		//! @param[in]	Ts	サンプリング周期 [s]
 		StateSpaceSystem(const ArcsMat<N,N>& A, const ArcsMat<N,I>& B, const ArcsMat<O,N>& C, const ArcsMat<O,I>& D, const double Ts)
-			: Ad(), Bd(), Cd(), Dd(), u(), x(), x_next(), y(), y_next(), DirectTerm(true)
+			: Ad(), Bd(), Cd(), Dd(), u(), x(), x_prev(), u_prev(), y(), y_next(), YValid(true), YnextValid(true), DirectTerm(true)
 		{
 			SetContinuous(A, B, C, D, Ts);	// 連続系のA行列，B行列，C行列，D行列を設定して離散化
 			PassedLog();
@@ -74,7 +74,8 @@ class StateSpaceSystem {
 		//! @brief ムーブコンストラクタ
 		//! @param[in]	r	右辺値
 		StateSpaceSystem(StateSpaceSystem&& r)
-			: Ad(r.Ad), Bd(r.Bd), Cd(r.Cd), Dd(r.Dd), u(r.u), x(r.x), x_next(r.x_next), y(r.y), y_next(r.y_next), DirectTerm(r.DirectTerm)
+			: Ad(r.Ad), Bd(r.Bd), Cd(r.Cd), Dd(r.Dd), u(r.u), x(r.x), x_prev(r.x_prev), u_prev(r.u_prev),
+			  y(r.y), y_next(r.y_next), YValid(r.YValid), YnextValid(r.YnextValid), DirectTerm(r.DirectTerm)
 		{
 			
 		}
@@ -104,6 +105,7 @@ class StateSpaceSystem {
 				Cd = Ch;			// C行列は平衡化後そのまま
 			}
 			DirectTerm = false;		// 直達項は無し
+			InvalidateOutputs();	// 取得前の出力は新しい行列で計算し直す
 		}
 		
 		//! @brief 連続系のA行列，B行列，C行列，D行列を設定して離散化する関数
@@ -116,6 +118,7 @@ class StateSpaceSystem {
 			SetContinuous(A, B, C, Ts);
 			Dd = D;				// D行列は何もせずそのまま
 			DirectTerm = true;	// 直達項は有り
+			InvalidateOutputs();	// 取得前の出力は新しい行列で計算し直す
 		}
 		
 		//! @brief 離散系のA行列，B行列，C行列を設定する関数
@@ -127,6 +130,7 @@ class StateSpaceSystem {
 			Bd = B;
 			Cd = C;
 			DirectTerm = false;	// 直達項は無し
+			InvalidateOutputs();	// 取得前の出力は新しい行列で計算し直す
 		}
 		
 		//! @brief 離散系のA行列，B行列，C行列，D行列を設定する関数
@@ -140,6 +144,7 @@ class StateSpaceSystem {
 			Cd = C;
 			Dd = D;
 			DirectTerm = true;	// 直達項は有り
+			InvalidateOutputs();	// 取得前の出力は新しい行列で計算し直す
 		}
 		
 		//! @brief 状態空間モデルへの入力ベクトルを予め設定する関数
@@ -165,54 +170,52 @@ class StateSpaceSystem {
 		}
 		
 		//! @brief 状態空間モデルの応答を計算して状態ベクトルを更新する関数
+		//! 出力方程式は出力を取得するときに必要な方だけ計算し，次の Update までキャッシュする(成分を個別に何度取得しても計算は1回ずつ)。
+		//! 出力は最初に取得した時点の行列と状態で計算するので，Update の後に SetDiscrete などで行列を変えたり ClearStateVector を呼んだりすると，
+		//! その後に取得する出力には変更が反映される(Update 時に出力まで計算していた以前の版とはこの点が異なる)。
 		void Update(void){
-			x_next = Ad*x + Bd*u;			// 状態方程式
-			if(DirectTerm == false){
-				y = Cd*x;					// 直達項なし版の出力方程式
-				y_next = Cd*x_next;			// 直達項なし版の出力方程式(次の時刻の出力ベクトルを即時に返す場合用)
-			}else{
-				y = Cd*x + Dd*u;			// 直達項あり版の出力方程式
-				y_next = Cd*x_next + Dd*u;	// 直達項あり版の出力方程式(次の時刻の出力ベクトルを即時に返す場合用)
-			}
-			x = x_next;						// 状態ベクトルを更新
+			x_prev = x;								// 出力方程式用に更新前の状態ベクトルと入力ベクトルを保持
+			u_prev = u;
+			x = lazy(Ad)*x_prev + lazy(Bd)*u_prev;	// 状態方程式(式テンプレートで一時変数なしに計算)
+			InvalidateOutputs();					// 出力は取得時に計算し直す
 		}
 		
 		//! @brief 状態空間モデルからの出力ベクトルを取得する関数(引数で返す版)
 		//! @param[out]	you	出力ベクトル
 		void GetOutput(ArcsMat<O,1>& yout){
-			yout = y;
+			yout = CurrentOutput();
 		}
 		
 		//! @brief 状態空間モデルからの出力ベクトルを取得する関数(ベクトルで返す版)
 		//! @return	出力ベクトル
 		ArcsMat<O,1> GetOutput(void){
-			return y;
+			return CurrentOutput();
 		}
 		
 		//! @brief 状態空間モデルからの出力ベクトルの内の、１つの成分のみを選択して取得する関数
 		//! @param[in]	i	出力ベクトルの要素番号(1～N)
 		//! @return	出力値
 		double GetOutput(size_t i){
-			return y[i];
+			return CurrentOutput()[i];
 		}
 		
 		//! @brief 状態空間モデルからの、次の時刻の出力ベクトルを取得する関数(引数で返す版)
 		//! @param[out]	you	出力ベクトル
 		void GetNextOutput(ArcsMat<O,1>& yout){
-			yout = y_next;
+			yout = NextOutput();
 		}
 		
 		//! @brief 状態空間モデルからの、次の時刻の出力ベクトルを取得する関数(ベクトルで返す版)
 		//! @return	出力ベクトル
 		ArcsMat<O,1> GetNextOutput(void){
-			return y_next;
+			return NextOutput();
 		}
 		
 		//! @brief 状態空間モデルからの、次の時刻の出力ベクトルの内の、１つの成分のみを選択して取得する関数
 		//! @param[in]	i	出力ベクトルの要素番号(1～N)
 		//! @return	出力値
 		double GetNextOutput(size_t i){
-			return y_next[i];
+			return NextOutput()[i];
 		}
 		
 		//! @brief 状態空間モデルの応答を計算して取得する関数(引数で返す版)
@@ -220,8 +223,8 @@ class StateSpaceSystem {
 		//! @param[out]	yout	出力ベクトル
 		void GetResponses(const ArcsMat<I,1>& uin, ArcsMat<O,1>& yout){
 			u = uin;	// 入力ベクトルを設定
-			Update();	// 状態空間モデルの応答を計算して状態ベクトルを更新
-			yout = y;	// 出力ベクトルを返す
+			Update();				// 状態空間モデルの応答を計算して状態ベクトルを更新
+			yout = CurrentOutput();	// 出力ベクトルを返す (次の時刻の出力は計算しない)
 		}
 		
 		//! @brief 状態空間モデルの応答を計算して取得する関数(ベクトルで返す版)
@@ -264,8 +267,8 @@ class StateSpaceSystem {
 		//! @param[out]	yout	出力ベクトル
 		void GetNextResponses(const ArcsMat<I,1>& uin, ArcsMat<O,1>& yout){
 			u = uin;		// 入力ベクトルを設定
-			Update();		// 状態空間モデルの応答を計算して状態ベクトルを更新
-			yout = y_next;	// 次の時刻の出力ベクトルを返す
+			Update();			// 状態空間モデルの応答を計算して状態ベクトルを更新
+			yout = NextOutput();	// 次の時刻の出力ベクトルを返す (現在の出力は計算しない)
 		}
 		
 		//! @brief 状態空間モデルの応答を計算して取得する関数(次の時刻の出力ベクトルを即時に返す版)(ベクトルで返す版)
@@ -305,6 +308,7 @@ class StateSpaceSystem {
 		//! @brief 状態ベクトルをクリアする関数
 		void ClearStateVector(void){
 			x = ArcsMat<N,1>::zeros();
+			YnextValid = false;	// 次の時刻の出力は新しい状態ベクトルで計算し直す
 		}
 		
 	private:
@@ -316,10 +320,50 @@ class StateSpaceSystem {
 		ArcsMat<O,I> Dd;		//!< D行列
 		ArcsMat<I,1> u;		//!< 入力ベクトル
 		ArcsMat<N,1> x;		//!< 状態ベクトル
-		ArcsMat<N,1> x_next;	//!< 次の時刻の状態ベクトル
-		ArcsMat<O,1> y;		//!< 出力ベクトル
-		ArcsMat<O,1> y_next;	//!< 次の時刻の出力ベクトル
+		ArcsMat<N,1> x_prev;	//!< 更新前の状態ベクトル
+		ArcsMat<I,1> u_prev;	//!< 状態の更新に使った入力ベクトル
+		ArcsMat<O,1> y;		//!< 出力ベクトルのキャッシュ
+		ArcsMat<O,1> y_next;	//!< 次の時刻の出力ベクトルのキャッシュ
+		bool YValid;		//!< 出力ベクトルのキャッシュが有効かどうか
+		bool YnextValid;	//!< 次の時刻の出力ベクトルのキャッシュが有効かどうか
 		bool DirectTerm;	//!< 直達項の有無フラグ(true = 直達項あり，false = 直達項なし)
+		
+		//! @brief 出力方程式を計算する関数
+		//! @param[in]	xs	状態ベクトル (更新前の x_prev なら現在の出力，更新後の x なら次の時刻の出力)
+		//! @return	出力ベクトル
+		ArcsMat<O,1> Output(const ArcsMat<N,1>& xs) const {
+			if(DirectTerm == false){
+				return Cd*xs;						// 直達項なし版の出力方程式
+			}else{
+				return lazy(Cd)*xs + lazy(Dd)*u_prev;	// 直達項あり版の出力方程式
+			}
+		}
+		
+		//! @brief 出力ベクトルを返す関数 (Update後の最初の取得時のみ計算する)
+		//! @return	出力ベクトル
+		const ArcsMat<O,1>& CurrentOutput(void){
+			if(YValid == false){
+				y = Output(x_prev);
+				YValid = true;
+			}
+			return y;
+		}
+		
+		//! @brief 次の時刻の出力ベクトルを返す関数 (Update後の最初の取得時のみ計算する)
+		//! @return	出力ベクトル
+		const ArcsMat<O,1>& NextOutput(void){
+			if(YnextValid == false){
+				y_next = Output(x);
+				YnextValid = true;
+			}
+			return y_next;
+		}
+		
+		//! @brief 出力ベクトルのキャッシュを無効にする関数
+		void InvalidateOutputs(void){
+			YValid = false;
+			YnextValid = false;
+		}
 };
 }
 
@@ -0,0 +1,15 @@
+//! @file TelemetryRing.cc
+//! @brief 共有メモリテレメトリリングバッファクラス(テンプレート版)
+//!
+//! リアルタイムスレッドから信号を共有メモリ上のリングバッファへ通番付きで書き込み，
+//! 外部プロセスからいつでも何個でも読み出せるようにするクラス。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "TelemetryRing.hh"
+
+// テンプレートクラスのため，実体もヘッダ側に実装。
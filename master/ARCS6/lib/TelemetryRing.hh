@@ -0,0 +1,252 @@
+//! @file TelemetryRing.hh
+//! @brief 共有メモリテレメトリリングバッファクラス(テンプレート版)
+//!
+//! リアルタイムスレッドから信号を共有メモリ上のリングバッファへ通番付きで書き込み，
+//! 外部プロセスからいつでも何個でも読み出せるようにするクラス。
+//! 書き込み側は待機もロックもしないので，読み出し側の有無や速さに影響されない。
+//! 読み出し側は通番により取りこぼし(オーバーラン)を検出する。
+//!
+//! @par 共有メモリのバイト配置 (外部ツールから読む場合はこれに従うこと，すべてリトルエンディアン)
+//! - 0  : uint32 マジックナンバー 0x54435241 ("ARCT")
+//! - 4  : uint32 バージョン (= 1)
+//! - 8  : uint32 変数の数 N
+//! - 12 : uint32 リングバッファ長 L
+//! - 16 : uint64 書き込み済みサンプル数 (次に書き込むサンプルの通番)
+//! - 64 + k*(16 + 8*N) : k番目のスロット
+//!   - +0  : uint64 スロットの通番 (サンプル通番 + 1, 書き込み中は0)
+//!   - +8  : double 時刻
+//!   - +16 : double 変数値 × N
+//! - 通番 n のサンプルはスロット n % L に格納される。スロット通番を読む → データを読む → スロット通番を読み直す，
+//!   の順で読み出して，前後の通番が両方とも n + 1 であれば正しく読み出せている。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef TELEMETRYRING
+#define TELEMETRYRING
+
+#include <cassert>
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <string>
+#include "SharedMemory.hh"
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+	#include "ARCSeventlog.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+	#define PassedLog()
+	#define EventLog(a)
+	#define EventLogVar(a)
+#endif
+
+namespace ARCS {	// ARCS名前空間
+	//! @brief 共有メモリテレメトリのメモリ配置
+	//! @tparam	NumOfVar	変数の数
+	//! @tparam	RingLen		リングバッファ長
+	template <size_t NumOfVar, size_t RingLen>
+	struct TelemetryLayout {
+		static constexpr uint32_t MAGIC = 0x54435241;	//!< マジックナンバー ("ARCT")
+		static constexpr uint32_t VERSION = 1;			//!< バージョン
+
+		//! @brief ヘッダ (64バイト)
+		struct Header {
+			std::atomic<uint32_t> Magic;	//!< マジックナンバー(初期化完了後に書き込まれる)
+			uint32_t Version;				//!< バージョン
+			uint32_t VarNum;				//!< 変数の数
+			uint32_t RingSize;				//!< リングバッファ長
+			std::atomic<uint64_t> WriteSeq;	//!< 書き込み済みサンプル数
+			uint64_t Reserved[5];			//!< 予約
+		};
+
+		//! @brief スロット
+		struct Slot {
+			std::atomic<uint64_t> Seq;			//!< スロットの通番 (サンプル通番 + 1, 書き込み中は0)
+			double Time;						//!< 時刻
+			std::array<double, NumOfVar> Vars;	//!< 変数値
+		};
+
+		Header Head;						//!< ヘッダ
+		std::array<Slot, RingLen> Slots;	//!< スロット配列
+	};
+
+	//! @brief 共有メモリテレメトリ書き込みクラス(リアルタイムスレッド側)
+	//! @tparam	NumOfVar	変数の数
+	//! @tparam	RingLen		リングバッファ長
+	template <size_t NumOfVar, size_t RingLen>
+	class TelemetryWriter {
+		public:
+			using Layout = TelemetryLayout<NumOfVar, RingLen>;	//!< メモリ配置の型
+
+			//! @brief コンストラクタ(非リアルタイム空間で呼ぶこと)
+			//! @param[in]	Name	共有メモリの名前 (例："/ARCS_TELEMETRY")
+			explicit TelemetryWriter(const std::string& Name)
+				: ShMem(Name), Ring(ShMem.GetPointer()), WriteSeq(0)
+			{
+				static_assert(std::atomic<uint64_t>::is_always_lock_free, "TelemetryWriter: 64bit atomics must be lock-free");
+				static_assert(sizeof(typename Layout::Header) == 64, "TelemetryWriter: Header size must be 64 bytes");
+				static_assert(0 < RingLen, "TelemetryWriter: Ring length must be positive");
+				Ring->Head.Version = Layout::VERSION;
+				Ring->Head.VarNum = NumOfVar;
+				Ring->Head.RingSize = RingLen;
+				Ring->Head.WriteSeq.store(0, std::memory_order_relaxed);
+				for(auto& x : Ring->Slots) x.Seq.store(0, std::memory_order_relaxed);
+				Ring->Head.Magic.store(Layout::MAGIC, std::memory_order_release);	// 初期化完了を読み出し側に知らせる
+				PassedLog();
+			}
+
+			//! @brief デストラクタ
+			~TelemetryWriter(){
+				Ring->Head.Magic.store(0, std::memory_order_release);	// 読み出し側に終了を知らせる
+				PassedLog();
+			}
+
+			//! @brief 1サンプル分のデータを書き込む関数(リアルタイム空間で呼んでもよい)
+			//! @param[in]	t		時刻
+			//! @param[in]	Vars	変数値
+			void Publish(const double t, const std::array<double, NumOfVar>& Vars){
+				auto& s = Ring->Slots[WriteSeq % RingLen];
+				s.Seq.store(0, std::memory_order_relaxed);				// 書き込み中の印を付けて，
+				std::atomic_thread_fence(std::memory_order_release);	// それより後に
+				s.Time = t;												// データを書き込み，
+				s.Vars = Vars;
+				s.Seq.store(WriteSeq + 1, std::memory_order_release);	// 書き込み完了の印を付けて，
+				++WriteSeq;
+				Ring->Head.WriteSeq.store(WriteSeq, std::memory_order_release);	// 全体の通番を進める
+			}
+
+			//! @brief 1サンプル分のデータを書き込む関数(可変長引数版)
+			//! @param[in]	t	時刻
+			//! @param[in]	u	変数値
+			template<typename... T>
+			void Publish(const double t, const T&... u){
+				static_assert(sizeof...(u) == NumOfVar, "TelemetryWriter: Number of variables mismatch");
+				Publish(t, std::array<double, NumOfVar>{static_cast<double>(u)...});
+			}
+
+			//! @brief 書き込み済みサンプル数を返す関数
+			//! @return	サンプル数
+			uint64_t GetWriteCount(void) const {
+				return WriteSeq;
+			}
+
+		private:
+			TelemetryWriter(const TelemetryWriter&) = delete;					//!< コピーコンストラクタ使用禁止
+			const TelemetryWriter& operator=(const TelemetryWriter&) = delete;	//!< 代入演算子使用禁止
+
+			SharedMemory<Layout, 1, ShMemSide::SHM_HOST, ShMemMode::SHM_RDWR> ShMem;	//!< 共有メモリ
+			Layout* Ring;		//!< リングバッファへのポインタ
+			uint64_t WriteSeq;	//!< 書き込み済みサンプル数
+	};
+
+	//! @brief 共有メモリテレメトリ読み出しクラス(外部プロセス側)
+	//! @tparam	NumOfVar	変数の数
+	//! @tparam	RingLen		リングバッファ長
+	template <size_t NumOfVar, size_t RingLen>
+	class TelemetryReader {
+		public:
+			using Layout = TelemetryLayout<NumOfVar, RingLen>;	//!< メモリ配置の型
+
+			//! @brief 読み出し開始位置の定義
+			enum class StartPos {
+				LATEST,	//!< 次に書き込まれるサンプルから読み出す
+				OLDEST	//!< リングバッファに残っている一番古いサンプルから読み出す
+			};
+
+			//! @brief コンストラクタ
+			//! 書き込み側が初期化を終えている必要がある
+			//! @param[in]	Name	共有メモリの名前 (例："/ARCS_TELEMETRY")
+			//! @param[in]	Start	読み出し開始位置
+			TelemetryReader(const std::string& Name, const StartPos Start)
+				: ShMem(Name), Ring(ShMem.GetPointer()), ReadSeq(0), LostNum(0)
+			{
+				arcs_assert(IsAlive() == true);					// 書き込み側が初期化済みでなければならない
+				arcs_assert(Ring->Head.Version == Layout::VERSION);
+				arcs_assert(Ring->Head.VarNum == NumOfVar);		// 変数の数が一致しなければならない
+				arcs_assert(Ring->Head.RingSize == RingLen);	// リングバッファ長が一致しなければならない
+				const uint64_t Head = Ring->Head.WriteSeq.load(std::memory_order_acquire);
+				if(Start == StartPos::LATEST || Head < RingLen){
+					ReadSeq = (Start == StartPos::LATEST) ? Head : 0;
+				}else{
+					ReadSeq = Head - RingLen;
+				}
+				PassedLog();
+			}
+
+			//! @brief デストラクタ
+			~TelemetryReader(){
+				PassedLog();
+			}
+
+			//! @brief 書き込み側が動作中かどうかを返す関数
+			//! @return	true = 動作中
+			bool IsAlive(void) const {
+				return Ring->Head.Magic.load(std::memory_order_acquire) == Layout::MAGIC;
+			}
+
+			//! @brief 次の1サンプルを読み出す関数
+			//! 取りこぼしたサンプルは読み飛ばして取りこぼし数に加算する。
+			//! @param[out]	t		時刻
+			//! @param[out]	Vars	変数値
+			//! @return	true = 読み出し成功，false = 新しいサンプル無し
+			bool Read(double& t, std::array<double, NumOfVar>& Vars){
+				while(true){
+					const uint64_t Head = Ring->Head.WriteSeq.load(std::memory_order_acquire);
+					if(Head <= ReadSeq) return false;	// 新しいサンプル無し
+					if(RingLen < Head - ReadSeq){
+						// リングバッファ1周分以上遅れていたら残っている一番古いサンプルまで読み飛ばす
+						LostNum += Head - RingLen - ReadSeq;
+						ReadSeq = Head - RingLen;
+					}
+
+					// スロットの読み出し(前後の通番が一致すれば成功)
+					const auto& s = Ring->Slots[ReadSeq % RingLen];
+					const uint64_t Seq1 = s.Seq.load(std::memory_order_acquire);
+					t = s.Time;
+					Vars = s.Vars;
+					std::atomic_thread_fence(std::memory_order_acquire);
+					const uint64_t Seq2 = s.Seq.load(std::memory_order_relaxed);
+					if(Seq1 == ReadSeq + 1 && Seq2 == ReadSeq + 1){
+						++ReadSeq;
+						return true;	// 読み出し成功
+					}
+
+					// 読み出し中に上書きされたので取りこぼしとして数えて次へ
+					++LostNum;
+					++ReadSeq;
+				}
+			}
+
+			//! @brief 直前に読み出したサンプルの通番を返す関数
+			//! @return	通番
+			uint64_t GetSequence(void) const {
+				return ReadSeq - 1;
+			}
+
+			//! @brief これまでの取りこぼし数を返す関数
+			//! @return	取りこぼしたサンプル数
+			uint64_t GetLostCount(void) const {
+				return LostNum;
+			}
+
+		private:
+			TelemetryReader(const TelemetryReader&) = delete;					//!< コピーコンストラクタ使用禁止
+			const TelemetryReader& operator=(const TelemetryReader&) = delete;	//!< 代入演算子使用禁止
+
+			SharedMemory<Layout, 1, ShMemSide::SHM_CLIENT, ShMemMode::SHM_RDONLY> ShMem;	//!< 共有メモリ
+			const Layout* Ring;	//!< リングバッファへのポインタ
+			uint64_t ReadSeq;	//!< 次に読み出すサンプルの通番
+			uint64_t LostNum;	//!< 取りこぼしたサンプル数
+	};
+}
+
+#endif
+
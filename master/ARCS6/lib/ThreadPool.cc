@@ -0,0 +1,102 @@
+//! @file ThreadPool.cc
+//! @brief スレッドプールクラス
+//!
+//! あらかじめ生成しておいたワーカースレッドで，範囲を分割して並列に処理するクラス。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include <algorithm>
+#include "ThreadPool.hh"
+
+using namespace ARCS;
+
+//! @brief コンストラクタ
+//! @param[in]	NumOfThreads	並列数(呼び出し元スレッドを含む, 1以下ならワーカースレッドは生成しない)
+ThreadPool::ThreadPool(const size_t NumOfThreads)
+	: Workers(), CallMutex(), JobMutex(), StartCond(), DoneCond(),
+	  Job(nullptr), JobBegin(0), JobEnd(0), JobParts(0), NextPart(0), Running(0), Generation(0), Quit(false)
+{
+	for(size_t i = 1; i < NumOfThreads; ++i) Workers.emplace_back(&ThreadPool::WorkerLoop, this);
+}
+
+//! @brief デストラクタ
+ThreadPool::~ThreadPool(){
+	{
+		std::lock_guard<std::mutex> Lock(JobMutex);
+		Quit = true;	// 終了要求を出して，
+	}
+	StartCond.notify_all();
+	for(auto& w : Workers) w.join();	// すべてのワーカースレッドの終了を待つ
+}
+
+//! @brief 範囲 [Begin, End) を並列数で分割して並列に処理する関数
+//!        呼び出し元スレッドも処理に加わり，すべての分割範囲の処理が終わるまで戻らない。
+//! @param[in]	Begin	範囲の開始
+//! @param[in]	End		範囲の終了(この値は含まない)
+//! @param[in]	Func	分割範囲 [b, e) を処理する関数オブジェクト
+void ThreadPool::ParallelFor(const size_t Begin, const size_t End, const std::function<void(size_t,size_t)>& Func){
+	if(End <= Begin) return;
+	if(Workers.empty() || End - Begin == 1){
+		Func(Begin, End);	// 並列化できない場合はそのまま処理
+		return;
+	}
+
+	std::lock_guard<std::mutex> CallLock(CallMutex);
+	{
+		// ジョブを設定して世代番号を進める
+		std::lock_guard<std::mutex> Lock(JobMutex);
+		Job = &Func;
+		JobBegin = Begin;
+		JobEnd = End;
+		JobParts = std::min(End - Begin, Workers.size() + 1);
+		NextPart = 0;
+		Running = Workers.size();
+		++Generation;
+	}
+	StartCond.notify_all();
+	RunParts();	// 呼び出し元スレッドも処理する
+
+	// すべてのワーカースレッドの処理完了を待つ
+	std::unique_lock<std::mutex> Lock(JobMutex);
+	DoneCond.wait(Lock, [this]{ return Running == 0; });
+	Job = nullptr;
+}
+
+//! @brief 並列数(呼び出し元スレッドを含む)を返す関数
+//! @return	並列数
+size_t ThreadPool::GetNumOfThreads(void) const {
+	return Workers.size() + 1;
+}
+
+//! @brief ワーカースレッドの処理ループ
+void ThreadPool::WorkerLoop(void){
+	uint64_t Seen = 0;	// 処理済みの世代番号
+	while(true){
+		{
+			// 新しいジョブか終了要求を待つ
+			std::unique_lock<std::mutex> Lock(JobMutex);
+			StartCond.wait(Lock, [this, Seen]{ return Quit || Generation != Seen; });
+			if(Quit) return;
+			Seen = Generation;
+		}
+		RunParts();
+		{
+			std::lock_guard<std::mutex> Lock(JobMutex);
+			if(--Running == 0) DoneCond.notify_one();	// 最後のワーカースレッドが完了を通知
+		}
+	}
+}
+
+//! @brief 未処理の分割範囲を取り出して処理する関数
+void ThreadPool::RunParts(void){
+	const size_t Num = JobEnd - JobBegin;
+	while(true){
+		const size_t p = NextPart.fetch_add(1);
+		if(JobParts <= p) break;
+		(*Job)(JobBegin + Num*p/JobParts, JobBegin + Num*(p + 1)/JobParts);
+	}
+}
@@ -0,0 +1,62 @@
+//! @file ThreadPool.hh
+//! @brief スレッドプールクラス
+//!
+//! あらかじめ生成しておいたワーカースレッドで，範囲を分割して並列に処理するクラス。
+//! 大規模行列演算やニューラルネットの学習などのオフライン計算用であり，実時間スレッドでの使用は想定していない。
+//!
+//! 使用例：
+//! 	ThreadPool Pool(4);	// 呼び出し元スレッドも含めて4並列
+//! 	Pool.ParallelFor(0, 1000, [&](size_t Begin, size_t End){ for(size_t i = Begin; i < End; ++i) y[i] = f(x[i]); });
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef THREADPOOL
+#define THREADPOOL
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+namespace ARCS {	// ARCS名前空間
+	//! @brief スレッドプールクラス
+	class ThreadPool {
+		public:
+			explicit ThreadPool(const size_t NumOfThreads = std::thread::hardware_concurrency());	//!< コンストラクタ
+			~ThreadPool();	//!< デストラクタ
+			void ParallelFor(const size_t Begin, const size_t End, const std::function<void(size_t,size_t)>& Func);	//!< 範囲 [Begin, End) を分割して並列に処理する関数
+			size_t GetNumOfThreads(void) const;	//!< 並列数(呼び出し元スレッドを含む)を返す関数
+
+		private:
+			ThreadPool(ThreadPool&& r) = delete;						//!< ムーブコンストラクタ使用禁止
+			ThreadPool(const ThreadPool&) = delete;						//!< コピーコンストラクタ使用禁止
+			const ThreadPool& operator=(const ThreadPool&) = delete;	//!< 代入演算子使用禁止
+			void WorkerLoop(void);	//!< ワーカースレッドの処理ループ
+			void RunParts(void);	//!< 未処理の分割範囲を取り出して処理する関数
+
+			std::vector<std::thread> Workers;	//!< ワーカースレッド
+			std::mutex CallMutex;				//!< ParallelFor 同士の排他用Mutex
+			std::mutex JobMutex;				//!< ジョブ設定用Mutex
+			std::condition_variable StartCond;	//!< ジョブ開始の通知用
+			std::condition_variable DoneCond;	//!< ジョブ完了の通知用
+			const std::function<void(size_t,size_t)>* Job;	//!< 現在のジョブ
+			size_t JobBegin;					//!< 現在のジョブの範囲の開始
+			size_t JobEnd;						//!< 現在のジョブの範囲の終了
+			size_t JobParts;					//!< 現在のジョブの分割数
+			std::atomic<size_t> NextPart;		//!< 次に処理する分割範囲の番号
+			size_t Running;						//!< 処理中のワーカースレッドの数
+			uint64_t Generation;				//!< ジョブの世代番号
+			bool Quit;							//!< 終了要求フラグ
+	};
+}
+
+#endif
+
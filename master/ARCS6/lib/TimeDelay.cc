@@ -3,6 +3,7 @@
 //!
 //! 遅延器 G(s)=e^(-s*T*n) -> G(z)=z^(-n)
 //! (但し T は制御周期で，制御周期単位でしか遅延時間を設定できないことに注意)
+//! (端数の遅延時間や動的確保なしの遅延器が必要な場合は DelayLine を使うこと)
 //!
 //! @date 2019/02/26
 //! @author Yuki YOKOKURA
@@ -39,15 +40,9 @@ double TimeDelay::GetSignal(const double u){
 	Rcount++;
 	Wcount=Rcount+num;
 	
-	// カウンタ値の場合分け
+	// カウンタ値の場合分け (SetDelayTime で 0 <= num < dmem_max に制限しているので，1回引けば必ず範囲内に収まる)
 	if(dmem_max<=Wcount)Wcount=Wcount-dmem_max;		// 最大値を超える場合
 	if(dmem_max<=Rcount)Rcount=Rcount-dmem_max;		// 最大値を超える場合
-	
-	// 要素番号リミッタ(念のため)
-	if(Wcount<0)Wcount=0;
-	if(dmem_max<=Wcount)Wcount=dmem_max;
-	if(Rcount<0)Rcount=0;
-	if(dmem_max<=Rcount)Rcount=dmem_max;
 
 	dmem[Wcount]=u;	// 遅延メモリへの書き込み
 	y=dmem[Rcount];	// 遅延メモリから読み出し
@@ -57,7 +52,10 @@ double TimeDelay::GetSignal(const double u){
 
 void TimeDelay::SetDelayTime(const long DelayTime){
 	// 遅延時間の設定 DelayTime；遅延時間 (最大遅延時間を越えないこと)
-	if(DelayTime<dmem_max){
+	// GetSignal のカウンタの折り返しは 0 <= num < dmem_max を前提とするので，ここで必ずその範囲に収める
+	if(DelayTime<0){
+		num=0;			// 設定が負のとき
+	}else if(DelayTime<dmem_max){
 		num=DelayTime;	// 設定が最大遅延時間を越えてないとき
 	}else{
 		num=dmem_max-1;	// 設定が最大遅延時間を越えているとき
@@ -3,6 +3,7 @@
 //!
 //! 遅延器 G(s)=e^(-s*T*n) -> G(z)=z^(-n)
 //! (但し T は制御周期で，制御周期単位でしか遅延時間を設定できないことに注意)
+//! (端数の遅延時間や動的確保なしの遅延器が必要な場合は DelayLine を使うこと)
 //!
 //! @date 2019/02/26
 //! @author Yuki YOKOKURA
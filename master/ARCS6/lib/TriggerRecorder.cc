@@ -0,0 +1,15 @@
+//! @file TriggerRecorder.cc
+//! @brief トリガ付きデータレコーダクラス(テンプレート版)
+//!
+//! オシロスコープのように，常に直近のデータをリングバッファに全周期で記録しておき，
+//! トリガ条件が成立したらトリガ前後のデータを凍結して，バックグラウンドでCSVファイルに書き出します。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#include "TriggerRecorder.hh"
+
+// テンプレートクラスのため，実体もヘッダ側に実装。
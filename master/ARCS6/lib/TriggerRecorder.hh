@@ -0,0 +1,298 @@
+//! @file TriggerRecorder.hh
+//! @brief トリガ付きデータレコーダクラス(テンプレート版)
+//!
+//! オシロスコープのように，常に直近のデータをリングバッファに全周期で記録しておき，
+//! トリガ条件が成立したらトリガ前後のデータを凍結して，バックグラウンドでCSVファイルに書き出します。
+//! 稀にしか発生しない異常の前後のデータを，メモリ使用量一定のままで全周期分残すことができます。
+//!
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+#ifndef TRIGGERRECORDER
+#define TRIGGERRECORDER
+
+#include <pthread.h>
+#include <unistd.h>
+#include <cassert>
+#include <cstdio>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <fstream>
+#include "CPUSettings.hh"
+
+// ARCS組込み用マクロ
+#ifdef ARCS_IN
+	// ARCSに組み込まれる場合
+	#include "ARCSassert.hh"
+	#include "ARCSeventlog.hh"
+#else
+	// ARCSに組み込まれない場合
+	#define arcs_assert(a) (assert(a))
+	#define PassedLog()
+	#define EventLog(a)
+	#define EventLogVar(a)
+#endif
+
+namespace ARCS {	// ARCS名前空間
+	//! @brief トリガ条件の定義
+	enum class TriggerMode {
+		DISABLE,	//!< 無効
+		RISING,		//!< 立ち上がりエッジ (しきい値を下から上へ横切ったとき)
+		FALLING,	//!< 立ち下がりエッジ (しきい値を上から下へ横切ったとき)
+		BOTH,		//!< 両エッジ
+		ABOVE,		//!< しきい値以上のとき
+		BELOW		//!< しきい値以下のとき
+	};
+
+	//! @brief トリガ付きデータレコーダクラス(テンプレート版)
+	//! @tparam	NumOfVar	変数の数
+	//! @tparam	PreNum		トリガ前に残すデータ数
+	//! @tparam	PostNum		トリガ後(トリガ時点を含む)に残すデータ数
+	template <size_t NumOfVar, size_t PreNum, size_t PostNum>
+	class TriggerRecorder {
+		public:
+			static constexpr size_t TRIGGER_MAX = 4;	//!< しきい値トリガ条件の最大数
+
+			//! @brief コンストラクタ
+			//! 書き出しスレッドは生成元のリアルタイムポリシーとCPUコアを継承してしまうので，通常ポリシー(SCHED_OTHER)にして実時間スレッドとは別のCPUコアに割り当てる。
+			//! @param[in]	FileName	保存ファイル名の接頭辞(「接頭辞_000.csv」のように連番で保存される)
+			//! @param[in]	CPUnum		書き出しスレッドに割り当てるCPUコア番号（実時間スレッドとは別にすること）
+			explicit TriggerRecorder(const std::string& FileName, const unsigned int CPUnum = 0)
+				: FilePrefix(FileName), Ring(std::make_unique<RingBuffer>()), Triggers(), PrevVars({0}),
+				  WriteIndex(0), FillNum(0), PostCount(0), HasPrev(false),
+				  State(RecState::ARMED), CaptureCount(0), Destruct(false), ThreadID()
+			{
+				static_assert(0 < NumOfVar, "TriggerRecorder: Number of variables must be positive");
+				static_assert(0 < PostNum, "TriggerRecorder: Post-trigger length must be positive");
+				for(size_t j = 0; j < BUFF_NUM; ++j) Ring->at(j).fill(0);
+				pthread_create(&ThreadID, NULL, (void*(*)(void*))WriterThread, this);	// 書き出しスレッド生成
+				CPUSettings::SetCPUandPolicy(ThreadID, CPUnum, SCHED_OTHER);			// 通常ポリシーにして非実時間のCPUコアに割り当て
+				PassedLog();
+			}
+
+			//! @brief デストラクタ
+			//! 書き出し待ちのデータがあれば書き出し終わるまで待機する
+			//! トリガ後のデータを記録中に破棄された場合(異常で制御ループが止まったときなど)は，そこまでのトリガ後データで凍結して書き出す
+			//! (破棄するときにはリアルタイム側はもうSetDataを呼ばないこと)
+			~TriggerRecorder(){
+				if(State.load(std::memory_order_acquire) == RecState::TRIGGERED){
+					// 記録途中なら，通常の書き出しと同じくトリガ前を PreNum 個までにしてから凍結
+					FillNum = std::min(FillNum, PreNum + PostNum - PostCount);
+					State.store(RecState::FROZEN, std::memory_order_release);
+				}
+				Destruct.store(true, std::memory_order_release);	// 凍結を公開してから破棄指令
+				pthread_join(ThreadID, nullptr);	// 書き出しスレッド終了待機
+				PassedLog();
+			}
+
+			//! @brief しきい値トリガ条件を設定する関数(非リアルタイム空間で呼ぶこと)
+			//! @param[in]	TrigNum	トリガ条件番号 (0 ～ TRIGGER_MAX-1)
+			//! @param[in]	VarNum	監視する変数番号 (0 ～ NumOfVar-1)
+			//! @param[in]	Level	しきい値
+			//! @param[in]	Mode	トリガ条件
+			void SetTrigger(const size_t TrigNum, const size_t VarNum, const double Level, const TriggerMode Mode){
+				arcs_assert(TrigNum < TRIGGER_MAX);
+				arcs_assert(VarNum < NumOfVar);
+				Triggers.at(TrigNum).VarNum = VarNum;
+				Triggers.at(TrigNum).Level = Level;
+				Triggers.at(TrigNum).Mode = Mode;
+			}
+
+			//! @brief すべてのしきい値トリガ条件を無効にする関数
+			void ClearTriggers(void){
+				for(auto& x : Triggers) x.Mode = TriggerMode::DISABLE;
+			}
+
+			//! @brief データを記録してしきい値トリガ条件を評価する関数(リアルタイム空間で毎周期呼ぶこと)
+			//! @param[in]	t	時刻
+			//! @param[in]	u	変数値
+			template<typename... T>
+			void SetData(const double t, const T&... u){
+				static_assert(sizeof...(u) == NumOfVar, "TriggerRecorder: Number of variables mismatch");
+				const RecState Now = State.load(std::memory_order_acquire);
+				if(Now == RecState::FROZEN) return;	// 書き出し中は記録しない
+
+				// リングバッファへの記録
+				auto& Row = Ring->at(WriteIndex);
+				size_t i = 0;
+				Row[i++] = t;
+				((Row[i++] = static_cast<double>(u)), ...);
+				WriteIndex = (WriteIndex + 1) % BUFF_NUM;
+				if(FillNum < BUFF_NUM) ++FillNum;
+
+				// しきい値トリガ条件は前回値を使うので，前回値の更新より先に評価しておく
+				const bool Triggered = Now == RecState::ARMED && EvaluateTriggers(Row);
+
+				// 前回値の保持
+				// 凍結後は書き出しスレッドが前回値を初期化するので，状態を公開する(FROZENにする)前に更新を済ませておくこと
+				for(size_t n = 0; n < NumOfVar; ++n) PrevVars[n] = Row[n + 1];
+				HasPrev = true;
+
+				if(Now == RecState::ARMED){
+					// トリガ待機中はしきい値トリガ条件の成立でトリガ
+					if(Triggered == true) Trigger();
+				}else{
+					// トリガ後はトリガ後データ数に達したらデータを凍結
+					--PostCount;
+					if(PostCount == 0) State.store(RecState::FROZEN, std::memory_order_release);
+				}
+			}
+
+			//! @brief 外部からトリガをかける関数(リアルタイム空間で呼んでもよい)
+			//! モータドライバの異常状態やEtherCATのワーキングカウンタ異常などの事象でトリガをかけるときに使う。
+			//! 直前にSetDataで記録したデータがトリガ時点となる。
+			void Trigger(void){
+				if(State.load(std::memory_order_acquire) != RecState::ARMED) return;	// トリガ待機中以外は無視
+				PostCount = PostNum - 1;	// トリガ時点のデータは記録済み
+				if(PostCount == 0){
+					State.store(RecState::FROZEN, std::memory_order_release);
+				}else{
+					State.store(RecState::TRIGGERED, std::memory_order_release);
+				}
+			}
+
+			//! @brief 条件が真のときにトリガをかける関数(リアルタイム空間で呼んでもよい)
+			//! @param[in]	Condition	トリガ条件
+			void TriggerIf(const bool Condition){
+				if(Condition == true) Trigger();
+			}
+
+			//! @brief トリガ待機中かどうかを返す関数
+			//! @return	true = トリガ待機中，false = トリガ後または書き出し中
+			bool IsArmed(void) const {
+				return State.load(std::memory_order_acquire) == RecState::ARMED;
+			}
+
+			//! @brief これまでに書き出したファイルの数を返す関数
+			//! @return	ファイル数
+			size_t GetCaptureCount(void) const {
+				return CaptureCount.load(std::memory_order_acquire);
+			}
+
+		private:
+			TriggerRecorder(const TriggerRecorder&) = delete;					//!< コピーコンストラクタ使用禁止
+			const TriggerRecorder& operator=(const TriggerRecorder&) = delete;	//!< 代入演算子使用禁止
+
+			//! @brief 記録状態の定義
+			enum class RecState {
+				ARMED,		//!< トリガ待機中
+				TRIGGERED,	//!< トリガ後のデータを記録中
+				FROZEN		//!< データ凍結(書き出し中)
+			};
+
+			//! @brief しきい値トリガ条件
+			struct TriggerCondition {
+				size_t VarNum = 0;						//!< 監視する変数番号
+				double Level = 0;						//!< しきい値
+				TriggerMode Mode = TriggerMode::DISABLE;//!< トリガ条件
+			};
+
+			static constexpr size_t BUFF_NUM = PreNum + PostNum;	//!< リングバッファの長さ
+			static constexpr unsigned long WRITER_WAIT = 10000;		//!< [us] 書き出しスレッドのポーリング周期
+			using RingBuffer = std::array<std::array<double, NumOfVar + 1>, BUFF_NUM>;	//!< リングバッファの型(1列目は時刻)
+
+			//! @brief しきい値トリガ条件を評価する関数
+			//! @param[in]	Row	今回記録したデータ
+			//! @return	true = トリガ条件成立
+			bool EvaluateTriggers(const std::array<double, NumOfVar + 1>& Row) const {
+				bool ret = false;
+				for(const auto& x : Triggers){
+					const double y = Row[x.VarNum + 1];
+					const double y1 = PrevVars[x.VarNum];
+					switch(x.Mode){
+						case TriggerMode::RISING:
+							ret |= HasPrev && y1 < x.Level && x.Level <= y;
+							break;
+						case TriggerMode::FALLING:
+							ret |= HasPrev && x.Level < y1 && y <= x.Level;
+							break;
+						case TriggerMode::BOTH:
+							ret |= HasPrev && ((y1 < x.Level && x.Level <= y) || (x.Level < y1 && y <= x.Level));
+							break;
+						case TriggerMode::ABOVE:
+							ret |= x.Level <= y;
+							break;
+						case TriggerMode::BELOW:
+							ret |= y <= x.Level;
+							break;
+						default:
+							break;
+					}
+				}
+				return ret;
+			}
+
+			//! @brief 凍結したデータをCSVファイルに書き出す関数
+			void WriteCsvFile(void){
+				char Number[16];
+				snprintf(Number, sizeof(Number), "_%03zu.csv", CaptureCount.load());
+				const std::string FileName = FilePrefix + Number;
+				EventLog("Writing Trigger Capture File...");
+
+				std::ofstream fout(FileName, std::ios::out | std::ios::trunc);
+				arcs_assert(fout.bad() == false);	// 致命的なエラーの場合
+				arcs_assert(fout.fail() == false);	// ファイル開くのに失敗した場合
+				fout.setf(std::ios::scientific);	// 指数表示
+				fout.precision(14);					// 小数点桁数
+
+				// 古いデータから順に書き出す
+				const size_t Start = (WriteIndex + BUFF_NUM - FillNum) % BUFF_NUM;
+				for(size_t j = 0; j < FillNum; ++j){
+					const auto& Row = Ring->at((Start + j) % BUFF_NUM);
+					for(size_t n = 0; n <= NumOfVar; ++n){
+						fout << Row[n];
+						if(n < NumOfVar) fout << ',';
+					}
+					fout << '\n';
+				}
+				fout.flush();
+				EventLog("Writing Trigger Capture File...Done");
+			}
+
+			//! @brief 書き出しスレッド
+			//! @param[in]	p	クラスメンバアクセス用ポインタ
+			static void WriterThread(TriggerRecorder* const p){
+				while(true){
+					// 破棄指令を先に読むことで，デストラクタでの凍結を見逃さないようにする
+					const bool Exit = p->Destruct.load(std::memory_order_acquire);
+					if(p->State.load(std::memory_order_acquire) == RecState::FROZEN){
+						// データが凍結されていたら書き出して，
+						p->WriteCsvFile();
+						++(p->CaptureCount);
+
+						// 次のトリガに備えて再び待機状態にする
+						// (凍結中はリアルタイム側はこれらに触れないので，ARMEDを公開するまではこのスレッドが所有する)
+						p->WriteIndex = 0;
+						p->FillNum = 0;
+						p->HasPrev = false;
+						p->State.store(RecState::ARMED, std::memory_order_release);
+					}else if(Exit == true){
+						break;	// 書き出し待ちのデータが無いときに破棄指令が来たら終了
+					}
+					usleep(WRITER_WAIT);	// 指定時間だけ待機
+				}
+			}
+
+			const std::string FilePrefix;			//!< 保存ファイル名の接頭辞
+			std::unique_ptr<RingBuffer> Ring;		//!< リングバッファ(巨大なデータを扱えるようにヒープ領域に確保する)
+			std::array<TriggerCondition, TRIGGER_MAX> Triggers;	//!< しきい値トリガ条件
+			std::array<double, NumOfVar> PrevVars;	//!< 前回の変数値
+			size_t WriteIndex;	//!< 次に書き込む要素番号
+			size_t FillNum;		//!< 記録済みのデータ数
+			size_t PostCount;	//!< トリガ後の残りデータ数
+			bool HasPrev;		//!< 前回値が有効かどうか
+			std::atomic<RecState> State;		//!< 記録状態
+			std::atomic<size_t> CaptureCount;	//!< 書き出したファイル数
+			std::atomic<bool> Destruct;			//!< 破棄指令
+			pthread_t ThreadID;					//!< 書き出しスレッドの識別子
+	};
+}
+
+#endif
+
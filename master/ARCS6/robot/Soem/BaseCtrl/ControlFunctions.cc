@@ -27,6 +27,7 @@
 
 // 追加のARCSライブラリをここに記述
 #include "ArcsMatrix.hh"
+#include "TriggerRecorder.hh"
 
 using namespace ARCS;
 
@@ -59,6 +60,9 @@ bool ControlFunctions::ControlFunction1(const double t, const double Tact, const
     
     static EthercatReceiver<int> Volume{ SlaveIndex{ 2 } };
 
+    // 異常発生前後のデータを全周期で残すトリガ付きデータレコーダ (角度, 角速度, 電流, 状態)
+    static TriggerRecorder<4, 2000, 2000> FaultRec{ "FAULT" };
+
     if (CmdFlag == CTRL_INIT)
     {
         // 初期化モード (ここは制御開始時/再開時に1度だけ呼び出される(非リアルタイム空間なので重い処理もOK))
@@ -67,6 +71,11 @@ bool ControlFunctions::ControlFunction1(const double t, const double Tact, const
         Interface.ServoON();          // サーボON指令の送出
         Initializing = false;         // 初期化中ランプ消灯
 
+        // トリガ条件の設定 (モーターがエラー状態に遷移したとき，もしくは過速度のとき)
+        FaultRec.SetTrigger(0, 3, static_cast<double>(AcMotor::StateKind::Error), TriggerMode::RISING);
+        FaultRec.SetTrigger(1, 1,  ALMLEVEL_OVERSPD, TriggerMode::RISING);
+        FaultRec.SetTrigger(2, 1, -ALMLEVEL_OVERSPD, TriggerMode::FALLING);
+
         switch (Bus.Init("enp1s0"))
         {
         case EthercatBus::InitState::ALL_SLAVES_OP_STATE:
@@ -94,7 +103,7 @@ bool ControlFunctions::ControlFunction1(const double t, const double Tact, const
         Graph.SetTime(Tact, t);         // [s] グラフ描画用の周期と時刻のセット
 
 
-        Bus.Update();
+        const bool BusOk = Bus.Update();    // ワーキングカウンタが期待値に達していなければfalse
 
 
         // if (const auto TargetVelocity = Volume.GetData())
@@ -145,6 +154,10 @@ bool ControlFunctions::ControlFunction1(const double t, const double Tact, const
         Graph.SetVars(2, AcMotor.GetIqCurrent());
         Graph.SetVars(3, (uint8_t)AcMotor.GetState());
 
+        FaultRec.SetData(t, AcMotor.GetTheta(), AcMotor.GetOmega(), AcMotor.GetIqCurrent(),
+                         static_cast<uint8_t>(AcMotor.GetState()));    // トリガ付きデータレコーダへの記録とトリガ条件の評価
+        FaultRec.TriggerIf(BusOk == false);                           // ワーキングカウンタ異常でもトリガ
+
         UsrGraph.SetVars(0, 10);                                // ユーザカスタムプロット（例）
         Memory.SetData(Tact, t, 0, 0, 0, 0, 0, 0, 0, 0, 0);    // CSVデータ保存変数 (周期, A列, B列, ..., J列)
                                                                // リアルタイム制御ここまで
@@ -0,0 +1,129 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par arcs_assertの消費時間の測定
+//! - 状態空間モデルの更新とリングバッファへの書き込みを模した代表的な制御ループで，
+//!   1周期あたりのassertの消費時間を「assert無し」「旧式(std::string渡し)」「現行のarcs_assert」で比較する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cassert>
+#include <cmath>
+#include <array>
+#include <string>
+#include <chrono>
+
+// 追加のARCSライブラリをここに記述
+#include "ARCSassert.hh"
+#include "ArcsMatrix.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+
+namespace {
+	constexpr size_t N = 4;			//!< 状態数
+	constexpr size_t L = 64;		//!< リングバッファ長
+	constexpr size_t K = 10000000;	//!< 測定する制御周期の回数
+
+	//! @brief 旧式のassert関数(条件が真でも毎回std::stringの一時オブジェクトを2個生成する)
+	[[gnu::noinline]] void legacy_assert(const bool assertion, const std::string& condition, const std::string& file, const int line){
+		if(assertion == false) ARCSassert::assert_failed(condition.c_str(), file.c_str(), line);
+	}
+	#define legacy_arcs_assert(a) (__builtin_constant_p(a) ? assert(a) : legacy_assert(a,#a,__FILE__,__LINE__))
+
+	// assertの種類の定義
+	enum class AssertType {
+		NONE,	//!< assert無し
+		LEGACY,	//!< 旧式
+		ARCS	//!< 現行のarcs_assert
+	};
+
+	//! @brief 代表的な制御ループ(離散状態方程式の更新＋リングバッファへの記録)
+	//! @tparam	A	assertの種類
+	//! @return	計算結果(最適化による消去の防止用)
+	template<AssertType A>
+	double ControlLoop(void){
+		std::array<std::array<double, N>, N> Ad = {{
+			{ 0.90, 0.01, 0.00, 0.00},
+			{-0.01, 0.90, 0.01, 0.00},
+			{ 0.00,-0.01, 0.90, 0.01},
+			{ 0.00, 0.00,-0.01, 0.90}
+		}};
+		std::array<double, N> bd = {0.1, 0.0, 0.0, 0.0};
+		std::array<double, N> x = {0};
+		std::array<double, N> x_next = {0};
+		std::array<double, L> Buffer = {0};
+		size_t k = 0;
+
+		for(size_t i = 0; i < K; ++i){
+			const double u = (i & 0x100) ? 1.0 : -1.0;	// 矩形波入力
+			for(size_t m = 0; m < N; ++m){
+				double sum = bd[m]*u;
+				for(size_t n = 0; n < N; ++n) sum += Ad[m][n]*x[n];
+				x_next[m] = sum;
+			}
+			x = x_next;
+
+			// 記録と範囲チェック
+			if constexpr(A == AssertType::LEGACY){
+				legacy_arcs_assert(k < L);
+				legacy_arcs_assert(std::isfinite(x[0]));
+				legacy_arcs_assert(std::isfinite(x[N - 1]));
+			}
+			if constexpr(A == AssertType::ARCS){
+				arcs_assert(k < L);
+				arcs_assert(std::isfinite(x[0]));
+				arcs_assert(std::isfinite(x[N - 1]));
+			}
+			Buffer[k] = x[N - 1];
+			k = (k + 1) % L;
+		}
+
+		double ret = 0;
+		for(size_t j = 0; j < L; ++j) ret += Buffer[j];
+		return ret;
+	}
+
+	//! @brief 制御ループの消費時間を測定する関数
+	//! @tparam	A	assertの種類
+	//! @param[in]	Name	表示名
+	//! @return	1周期あたりの消費時間 [ns]
+	template<AssertType A>
+	double MeasureLoop(const char* Name){
+		const auto start_time = std::chrono::steady_clock::now();
+		const double y = ControlLoop<A>();
+		const auto end_time = std::chrono::steady_clock::now();
+		const double t = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count()/static_cast<double>(K);
+		printf("%-28s : %7.3f [ns/cycle]  (y = % g)\n", Name, t, y);
+		return t;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了ステータス
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	printf("Control loop with N = %zu states, %zu cycles\n\n", N, K);
+	const double t0 = MeasureLoop<AssertType::NONE>("Without assertion");
+	const double t1 = MeasureLoop<AssertType::LEGACY>("Legacy (std::string) assert");
+	const double t2 = MeasureLoop<AssertType::ARCS>("arcs_assert");
+	printf("\nAssertion overhead per cycle:\n");
+	printf("  Legacy      : %7.3f [ns]\n", t1 - t0);
+	printf("  arcs_assert : %7.3f [ns]\n", t2 - t0);
+
+	return EXIT_SUCCESS;	// 正常終了
+}
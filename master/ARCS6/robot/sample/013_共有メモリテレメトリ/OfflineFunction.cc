@@ -0,0 +1,137 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par 共有メモリテレメトリのクライアント
+//! - ARCS本体が ARCSparams::TELEMETRY_ENABLE = true (既定は無効) で動作中(/dev/shm/ARCS_TELEMETRY が存在する)ならば，そこに接続して受信速度と取りこぼし数を表示する。
+//!   (ARCS本体と，このクライアントの ConstParams::DATA_NUM は一致させること)
+//! - ARCS本体が動作していなければ，書き込みスレッドと読み出し側をこのプロセス内で動かして，
+//!   書き込み/読み出しのスループットと，読み出し側が遅いときの取りこぼし検出を確認する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <array>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <atomic>
+
+// 追加のARCSライブラリをここに記述
+#include "ARCSparams.hh"
+#include "ConstParams.hh"
+#include "TelemetryRing.hh"
+
+using namespace ARCS;
+
+namespace {
+	constexpr size_t N = ConstParams::DATA_NUM;					//!< 変数の数
+	constexpr size_t L = ARCSparams::TELEMETRY_RING_LEN;		//!< リングバッファ長
+	constexpr char TEST_NAME[] = "/ARCS_TELEMETRY_TEST";		//!< ループバック試験用の共有メモリの名前
+	constexpr uint64_t TEST_NUM = 20000000;						//!< ループバック試験で書き込むサンプル数
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 経過時間を返す関数
+	//! @param[in]	Start	開始時刻
+	//! @return	[s] 経過時間
+	double ElapsedTime(const Clock::time_point& Start){
+		return std::chrono::duration<double>(Clock::now() - Start).count();
+	}
+
+	//! @brief 動作中のARCS本体に接続して受信する関数
+	//! @param[in]	Duration	[s] 受信する時間
+	void AttachToARCS(const double Duration){
+		TelemetryReader<N, L> Reader(ARCSparams::TELEMETRY_NAME, TelemetryReader<N, L>::StartPos::LATEST);
+		double t = 0;
+		std::array<double, N> Vars = {0};
+		uint64_t ReadNum = 0;
+		const auto Start = Clock::now();
+		while(ElapsedTime(Start) < Duration && Reader.IsAlive() == true){
+			if(Reader.Read(t, Vars) == true){
+				++ReadNum;
+			}else{
+				usleep(1000);	// 新しいサンプルが無ければ少し待つ
+			}
+		}
+		const double T = ElapsedTime(Start);
+		printf("Received %lu samples in %.3f [s] : %.1f [samples/s], lost = %lu\n", ReadNum, T, ReadNum/T, Reader.GetLostCount());
+		printf("Last sample : seq = %lu, t = %.6f [s], vars =", Reader.GetSequence(), t);
+		for(size_t i = 1; i < N; ++i) printf(" % g", Vars[i]);
+		printf("\n");
+	}
+
+	//! @brief 同一プロセス内で書き込みと読み出しのスループットを測定する関数
+	//! @param[in]	Name		表示名
+	//! @param[in]	ReaderWait	[us] 読み出し側がサンプルを読み切った後に待つ時間(遅い読み出し側の模擬)
+	void LoopbackTest(const char* Name, const unsigned int ReaderWait){
+		TelemetryWriter<N, L> Writer(TEST_NAME);
+		TelemetryReader<N, L> Reader(TEST_NAME, TelemetryReader<N, L>::StartPos::OLDEST);
+		std::atomic<bool> Done(false);
+		double WriteTime = 0;
+
+		// 書き込みスレッド (リアルタイムスレッドの模擬，全力で書き込む)
+		std::thread WriterThread([&](){
+			std::array<double, N> Vars = {0};
+			const auto Start = Clock::now();
+			for(uint64_t k = 0; k < TEST_NUM; ++k){
+				Vars[0] = k*1e-4;
+				for(size_t i = 1; i < N; ++i) Vars[i] = static_cast<double>(k + i);
+				Writer.Publish(Vars[0], Vars);
+			}
+			WriteTime = ElapsedTime(Start);
+			Done = true;
+		});
+
+		// 読み出し側 (外部プロセスの模擬)
+		double t = 0;
+		std::array<double, N> Vars = {0};
+		uint64_t ReadNum = 0, BadNum = 0;
+		const auto Start = Clock::now();
+		while(true){
+			const bool Finished = Done.load();
+			while(Reader.Read(t, Vars) == true){
+				++ReadNum;
+				if(Vars[1] != static_cast<double>(Reader.GetSequence() + 1)) ++BadNum;	// 中身と通番の整合性チェック
+			}
+			if(Finished == true) break;
+			if(ReaderWait != 0) usleep(ReaderWait);
+		}
+		const double ReadTime = ElapsedTime(Start);
+		WriterThread.join();
+
+		printf("%-22s : write %6.1f [ns/sample], read %9lu + lost %9lu = %9lu, corrupted = %lu, %6.1f [Msamples/s]\n",
+			Name, WriteTime/TEST_NUM*1e9, ReadNum, Reader.GetLostCount(), ReadNum + Reader.GetLostCount(), BadNum, ReadNum/ReadTime*1e-6);
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	const std::string ShmFile = std::string("/dev/shm") + ARCSparams::TELEMETRY_NAME;
+	if(access(ShmFile.c_str(), F_OK) == 0){
+		// ARCS本体が動作中なら接続
+		printf("Attaching to %s (N = %zu, L = %zu)\n", ARCSparams::TELEMETRY_NAME, N, L);
+		AttachToARCS(5);
+	}else{
+		// 動作していなければループバック試験
+		printf("%s not found. Running loopback throughput test (N = %zu, L = %zu, %lu samples)\n", ARCSparams::TELEMETRY_NAME, N, L, TEST_NUM);
+		LoopbackTest("Fast reader (polling)", 0);
+		LoopbackTest("Slow reader (1 ms)", 1000);
+	}
+
+	return EXIT_SUCCESS;	// 正常終了
+}
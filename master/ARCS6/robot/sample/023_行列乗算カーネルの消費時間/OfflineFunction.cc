@@ -0,0 +1,133 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par ArcsMat乗算カーネルの消費時間の測定
+//! - N = 2～16 の ArcsMat<N,N>*ArcsMat<N,1> と ArcsMat<N,N>*ArcsMat<N,N> について，
+//!   従来の3重ループ，operator*(厳密モードのSIMDカーネル)，FMAによる高速モードのカーネルの消費時間を比較する。
+//! - 厳密モードの結果が従来の3重ループとビット単位で一致することも確認する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <array>
+#include <chrono>
+#include <utility>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "RandomGenerator.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+
+namespace {
+	constexpr size_t K = 2000000;	//!< 測定する計算回数
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 最適化で計算が消されないようにする関数
+	//! @param[in]	x	対象の変数
+	template<typename T>
+	inline void KeepAlive(T& x){
+		asm volatile("" : : "g"(&x) : "memory");
+	}
+
+	//! @brief 従来の3重ループによる行列乗算(比較用)
+	//! @param[in]	L	左側行列
+	//! @param[in]	R	右側行列
+	//! @return	結果
+	template<size_t M, size_t N, size_t Q>
+	ArcsMat<M,Q> ReferenceMultiply(const ArcsMat<M,N>& L, const ArcsMat<N,Q>& R){
+		ArcsMat<M,Q> ret;
+		for(size_t k = 1; k <= Q; ++k){
+			for(size_t i = 1; i <= N; ++i){
+				for(size_t j = 1; j <= M; ++j) ret(j,k) += L(j,i)*R(i,k);
+			}
+		}
+		return ret;
+	}
+
+	//! @brief 1回あたりの消費時間を測定する関数
+	//! @param[in]	Func	測定対象
+	//! @return	[ns] 1回あたりの消費時間
+	template<typename F>
+	double Measure(F&& Func){
+		const auto Start = Clock::now();
+		for(size_t i = 0; i < K; ++i) Func();
+		return std::chrono::duration<double>(Clock::now() - Start).count()/K*1e9;
+	}
+
+	//! @brief 2つの行列がビット単位で一致するかを返す関数
+	//! @param[in]	A, B	比較する行列
+	//! @return	true = 一致
+	template<size_t M, size_t N>
+	bool IsBitwiseEqual(const ArcsMat<M,N>& A, const ArcsMat<M,N>& B){
+		return std::memcmp(&A.ReadOnlyRef()[0][0], &B.ReadOnlyRef()[0][0], sizeof(double)*M*N) == 0;
+	}
+
+	//! @brief 最大絶対誤差を返す関数
+	//! @param[in]	A, B	比較する行列
+	//! @return	最大絶対誤差
+	template<size_t M, size_t N>
+	double MaxError(const ArcsMat<M,N>& A, const ArcsMat<M,N>& B){
+		double ret = 0;
+		for(size_t j = 1; j <= N; ++j) for(size_t i = 1; i <= M; ++i) ret = std::max(ret, std::fabs(A(i,j) - B(i,j)));
+		return ret;
+	}
+
+	//! @brief N×N行列と N×Q行列の乗算を測定して表示する関数
+	template<size_t N, size_t Q>
+	void Benchmark(RandomGenerator<double>& Rnd){
+		ArcsMat<N,N> A;
+		ArcsMat<N,Q> x, y1, y2, y3;
+		Rnd.GetRandomMatrix(A);
+		Rnd.GetRandomMatrix(x);
+
+		// 消費時間の測定
+		const double t1 = Measure([&](){ KeepAlive(A); KeepAlive(x); y1 = ReferenceMultiply(A, x); KeepAlive(y1); });
+		const double t2 = Measure([&](){ KeepAlive(A); KeepAlive(x); y2 = A*x; KeepAlive(y2); });
+		const double t3 = Measure([&](){
+			KeepAlive(A); KeepAlive(x);
+			ArcsMatrixKernel::Multiply<N,N,Q,false>(&A.ReadOnlyRef()[0][0], &x.ReadOnlyRef()[0][0], &y3(1,1));
+			KeepAlive(y3);
+		});
+
+		printf("%2zu x %-2zu * %2zu x %-2zu : loop %7.1f [ns], strict %7.1f [ns] (x%4.1f, %s), fast %7.1f [ns] (x%4.1f, err %.1e)\n",
+			N, N, N, Q, t1, t2, t1/t2, IsBitwiseEqual(y1, y2) ? "bitwise equal" : "MISMATCH     ",
+			t3, t1/t3, MaxError(y1, y3));
+	}
+
+	//! @brief N = 2～16 について測定する関数
+	template<size_t... I>
+	void BenchmarkAll(RandomGenerator<double>& Rnd, std::index_sequence<I...>){
+		printf("Matrix * Vector\n");
+		(Benchmark<I + 2, 1>(Rnd), ...);
+		printf("Matrix * Matrix\n");
+		(Benchmark<I + 2, I + 2>(Rnd), ...);
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	printf("Strict mode = %s, K = %zu\n", ArcsMatrixKernel::STRICT ? "true" : "false", K);
+	RandomGenerator Rnd(-1, 1);
+	BenchmarkAll(Rnd, std::make_index_sequence<15>{});
+
+	return EXIT_SUCCESS;	// 正常終了
+}
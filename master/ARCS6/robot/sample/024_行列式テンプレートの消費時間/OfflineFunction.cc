@@ -0,0 +1,136 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par ArcsMat式テンプレートの消費時間の測定
+//! - 状態次数 N = 2～12 の状態空間モデル/オブザーバの1サンプル分の更新
+//!   「x = A*x + B*u; y = C*x + D*u;」と「x = A*x + B*u + L*(y - C*x);」について，
+//!   従来の即時評価と lazy() による式テンプレートの消費時間を比較する。
+//! - 両者の計算結果の最大絶対誤差も表示する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <utility>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "RandomGenerator.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+
+namespace {
+	constexpr size_t K = 2000000;	//!< 測定する計算回数
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 最適化で計算が消されないようにする関数
+	//! @param[in]	x	対象の変数
+	template<typename T>
+	inline void KeepAlive(T& x){
+		asm volatile("" : : "g"(&x) : "memory");
+	}
+
+	//! @brief 1回あたりの消費時間を測定する関数
+	//! @param[in]	Func	測定対象
+	//! @return	[ns] 1回あたりの消費時間
+	template<typename F>
+	double Measure(F&& Func){
+		const auto Start = Clock::now();
+		for(size_t i = 0; i < K; ++i) Func();
+		return std::chrono::duration<double>(Clock::now() - Start).count()/K*1e9;
+	}
+
+	//! @brief 最大絶対誤差を返す関数
+	//! @param[in]	A, B	比較する行列
+	//! @return	最大絶対誤差
+	template<size_t M, size_t N>
+	double MaxError(const ArcsMat<M,N>& A, const ArcsMat<M,N>& B){
+		double ret = 0;
+		for(size_t j = 1; j <= N; ++j) for(size_t i = 1; i <= M; ++i) ret = std::max(ret, std::fabs(A(i,j) - B(i,j)));
+		return ret;
+	}
+
+	//! @brief N次系の状態空間モデルとオブザーバの更新を測定して表示する関数
+	template<size_t N>
+	void Benchmark(RandomGenerator<double>& Rnd){
+		constexpr size_t I = 2, O = 2;	// 入力と出力の数
+		ArcsMat<N,N> A;
+		ArcsMat<N,I> B;
+		ArcsMat<O,N> C;
+		ArcsMat<O,I> D;
+		ArcsMat<N,O> L;
+		ArcsMat<I,1> u;
+		Rnd.GetRandomMatrix(A);
+		Rnd.GetRandomMatrix(B);
+		Rnd.GetRandomMatrix(C);
+		Rnd.GetRandomMatrix(D);
+		Rnd.GetRandomMatrix(L);
+		Rnd.GetRandomMatrix(u);
+		A = 0.5/static_cast<double>(N)*A;	// 発散しないように縮めておく
+		L = 0.1*L;
+
+		// 状態空間モデル
+		ArcsMat<N,1> x1, x2;
+		ArcsMat<O,1> y1, y2;
+		const double t1 = Measure([&](){
+			KeepAlive(u);
+			x1 = A*x1 + B*u;
+			y1 = C*x1 + D*u;
+			KeepAlive(x1); KeepAlive(y1);
+		});
+		const double t2 = Measure([&](){
+			KeepAlive(u);
+			x2 = lazy(A)*x2 + lazy(B)*u;
+			y2 = lazy(C)*x2 + lazy(D)*u;
+			KeepAlive(x2); KeepAlive(y2);
+		});
+		printf("N = %2zu : state space eager %7.1f [ns], lazy %7.1f [ns] (x%4.2f, err %.1e)",
+			N, t1, t2, t1/t2, std::max(MaxError(x1, x2), MaxError(y1, y2)));
+
+		// 同一次元オブザーバ
+		ArcsMat<N,1> xh1, xh2;
+		const double t3 = Measure([&](){
+			KeepAlive(u); KeepAlive(y1);
+			xh1 = A*xh1 + B*u + L*(y1 - C*xh1);
+			KeepAlive(xh1);
+		});
+		const double t4 = Measure([&](){
+			KeepAlive(u); KeepAlive(y1);
+			xh2 = lazy(A)*xh2 + lazy(B)*u + lazy(L)*(lazy(y1) - lazy(C)*xh2);
+			KeepAlive(xh2);
+		});
+		printf(", observer eager %7.1f [ns], lazy %7.1f [ns] (x%4.2f, err %.1e)\n", t3, t4, t3/t4, MaxError(xh1, xh2));
+	}
+
+	//! @brief N = 2～12 について測定する関数
+	template<size_t... I>
+	void BenchmarkAll(RandomGenerator<double>& Rnd, std::index_sequence<I...>){
+		(Benchmark<I + 2>(Rnd), ...);
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	printf("K = %zu\n", K);
+	RandomGenerator Rnd(-1, 1);
+	BenchmarkAll(Rnd, std::make_index_sequence<11>{});
+
+	return EXIT_SUCCESS;	// 正常終了
+}
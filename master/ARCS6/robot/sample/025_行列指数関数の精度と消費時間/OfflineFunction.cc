@@ -0,0 +1,186 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par 行列指数関数の精度と消費時間の測定
+//! - Higham のスケーリング＆スクエアリング法による expm と，従来の13次パデ近似による expm を比較する。
+//! - N = 2, 4, 8, 12 のランダム行列を 1-ノルムが 1e-6～1e+2 になるように拡大縮小して，
+//!   両者の相対誤差と1回あたりの消費時間を表示する。
+//! - 解析解が分かる回転行列・対角行列・べき零行列で，相対誤差が 1e-13 以下であることも確認する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "RandomGenerator.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+
+namespace {
+	constexpr size_t K = 20000;		//!< 消費時間を測定する計算回数
+	constexpr double TOL = 1e-13;	//!< 解析解との相対誤差の許容値
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 最適化で計算が消されないようにする関数
+	//! @param[in]	x	対象の変数
+	template<typename T>
+	inline void KeepAlive(T& x){
+		asm volatile("" : : "g"(&x) : "memory");
+	}
+
+	//! @brief 1回あたりの消費時間を測定する関数
+	//! @param[in]	Func	測定対象
+	//! @return	[ns] 1回あたりの消費時間
+	template<typename F>
+	double Measure(F&& Func){
+		const auto Start = Clock::now();
+		for(size_t i = 0; i < K; ++i) Func();
+		return std::chrono::duration<double>(Clock::now() - Start).count()/K*1e9;
+	}
+
+	//! @brief 従来の固定次数パデ近似による行列指数関数(比較用)
+	//! @tparam	Q	パデ近似の次数
+	//! @param[in]	U	入力行列
+	//! @return	出力行列
+	template<size_t Q = 13, size_t N>
+	ArcsMat<N,N> ReferenceExpm(const ArcsMat<N,N>& U){
+		// L∞ノルムでスケーリング
+		int e = 0;
+		std::frexp(norm<NormType::AMT_LINF>(U), &e);
+		ArcsMat<N,N> A;
+		if(0 < e){
+			A = std::pow(0.5, e + 1)*U;
+		}else{
+			e = 0;
+			A = 0.5*U;
+		}
+
+		// 指数行列のパデ近似の計算
+		const auto I = ArcsMat<N,N>::eye();
+		ArcsMat<N,N> L = I, R = I, X = I, cX, Y;
+		double c = 1;
+		bool signflag = false;
+		for(size_t i = 1; i <= Q; ++i){
+			c = c*static_cast<double>(Q - i + 1) / static_cast<double>(i*(2*Q - i + 1));
+			X = A*X;
+			cX = c*X;
+			R += cX;
+			L += static_cast<double>(2*static_cast<int>(signflag) - 1)*cX;
+			signflag = !signflag;
+		}
+		for(size_t i = 1; i <= N; ++i){
+			setcolumn(Y, linsolve(L, getcolumn(R, i)), i);	// 従来版は列ごとにLU分解して解いていた
+		}
+
+		// スケールを元に戻す
+		for(size_t i = 0; i < static_cast<size_t>(e) + 1; ++i) Y *= Y;
+		return Y;
+	}
+
+	//! @brief 1-ノルムで測った相対誤差を返す関数
+	//! @param[in]	Y	計算値
+	//! @param[in]	Yref	基準値
+	//! @return	相対誤差
+	template<size_t N>
+	double RelError(const ArcsMat<N,N>& Y, const ArcsMat<N,N>& Yref){
+		return norm<NormType::AMT_L1>(ArcsMat<N,N>(Y - Yref))/norm<NormType::AMT_L1>(Yref);
+	}
+
+	//! @brief 解析解との比較結果を表示する関数
+	//! @param[in]	Name	試験の名前
+	//! @param[in]	Y	計算値
+	//! @param[in]	Yref	解析解
+	//! @return	true = 許容値以内
+	template<size_t N>
+	bool Check(const char* Name, const ArcsMat<N,N>& Y, const ArcsMat<N,N>& Yref){
+		const double Err = RelError(Y, Yref);
+		printf("%-34s : rel. err %.2e  %s\n", Name, Err, Err <= TOL ? "PASS" : "FAIL");
+		return Err <= TOL;
+	}
+
+	//! @brief N×N のランダム行列について従来版と比較して表示する関数
+	template<size_t N>
+	void Benchmark(RandomGenerator<double>& Rnd){
+		ArcsMat<N,N> A0;
+		Rnd.GetRandomMatrix(A0);
+		A0 = 1.0/norm<NormType::AMT_L1>(A0)*A0;	// 1-ノルムを1に揃える
+		for(const double Scale : {1e-6, 1e-2, 0.2, 1.0, 4.0, 20.0, 100.0}){
+			const ArcsMat<N,N> A = Scale*A0;
+			ArcsMat<N,N> Y1, Y2;
+			const double t1 = Measure([&](){ KeepAlive(A); Y1 = ReferenceExpm(A); KeepAlive(Y1); });
+			const double t2 = Measure([&](){ KeepAlive(A); Y2 = expm(A); KeepAlive(Y2); });
+			printf("N = %2zu, |A|1 = %5.0e : previous %8.0f [ns], Higham %8.0f [ns] (x%4.1f), rel. diff %.2e\n",
+				N, Scale, t1, t2, t1/t2, RelError(Y2, Y1));
+		}
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	// 1. 解析解との比較
+	bool Passed = true;
+	for(const double w : {1e-3, 0.5, 3.0, 30.0}){
+		// 回転行列 exp([0 w; -w 0]) = [cos(w) sin(w); -sin(w) cos(w)]
+		const auto A = ArcsMat<2,2>{0, w, -w, 0};
+		const auto Yref = ArcsMat<2,2>{std::cos(w), std::sin(w), -std::sin(w), std::cos(w)};
+		char Name[64];
+		snprintf(Name, sizeof(Name), "rotation, w = %g", w);
+		Passed &= Check(Name, expm(A), Yref);
+	}
+	{
+		// 対角行列 exp(diag(a)) = diag(exp(a))
+		const auto A = ArcsMat<4,1>::diag(ArcsMat<4,1>{-5.0, -0.1, 0.3, 2.0});
+		const auto Yref = ArcsMat<4,1>::diag(ArcsMat<4,1>{std::exp(-5.0), std::exp(-0.1), std::exp(0.3), std::exp(2.0)});
+		Passed &= Check("diagonal", expm(A), Yref);
+	}
+	{
+		// べき零行列 exp(N) = I + N + N^2/2 (N^3 = 0)
+		const auto A = ArcsMat<3,3>{0, 1, 2, 0, 0, 3, 0, 0, 0};
+		const auto Yref = ArcsMat<3,3>::eye() + A + 0.5*A*A;
+		Passed &= Check("nilpotent", expm(A), Yref);
+	}
+	{
+		// 次数を落とした場合 (1次と5次までのパデ近似)
+		const auto A = ArcsMat<2,2>{0, 2.0, -2.0, 0};
+		const auto Yref = ArcsMat<2,2>{std::cos(2.0), std::sin(2.0), -std::sin(2.0), std::cos(2.0)};
+		Passed &= Check("rotation, w = 2, K = 1", expm<1>(A), Yref);
+		Passed &= Check("rotation, w = 2, K = 5", expm<5>(A), Yref);
+	}
+	{
+		// コンパイル時計算
+		constexpr auto A = ArcsMat<2,2>{0, 1.0, -1.0, 0};
+		constexpr auto Y = expm(A);
+		const auto Yref = ArcsMat<2,2>{std::cos(1.0), std::sin(1.0), -std::sin(1.0), std::cos(1.0)};
+		Passed &= Check("rotation, w = 1, constexpr", Y, Yref);
+	}
+	printf("Analytic solution check : %s\n\n", Passed ? "PASS" : "FAIL");
+
+	// 2. 従来版との比較
+	printf("K = %zu\n", K);
+	RandomGenerator Rnd(-1, 1);
+	Benchmark<2>(Rnd);
+	Benchmark<4>(Rnd);
+	Benchmark<8>(Rnd);
+	Benchmark<12>(Rnd);
+
+	return EXIT_SUCCESS;	// 正常終了
+}
@@ -0,0 +1,155 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par 連続系状態空間モデルの離散化の精度と消費時間の測定
+//! - Van Loanの方法による Discretize() と，シンプソン法の数値積分による DiscretizeSimpson() を比較する。
+//! - 1次遅れ系と積分器の解析解で，ZOH/FOH/Tustin の各離散化が正しいことを確認する。
+//! - 2慣性系と N = 2, 4, 8 のランダムな安定系について，両者の相対誤差と1回あたりの消費時間
+//!   (StateSpaceクラスなどの起動時に掛かる時間)を表示する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "ArcsControl.hh"
+#include "RandomGenerator.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+
+namespace {
+	constexpr double Ts = 100e-6;	//!< [s] サンプリング周期
+	constexpr double TOL = 1e-12;	//!< 解析解との相対誤差の許容値
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 1回あたりの消費時間を測定する関数
+	//! @param[in]	K		測定する計算回数
+	//! @param[in]	Func	測定対象
+	//! @return	[us] 1回あたりの消費時間
+	template<typename F>
+	double Measure(const size_t K, F&& Func){
+		const auto Start = Clock::now();
+		for(size_t i = 0; i < K; ++i) Func();
+		return std::chrono::duration<double>(Clock::now() - Start).count()/static_cast<double>(K)*1e6;
+	}
+
+	//! @brief 1-ノルムで測った相対誤差を返す関数
+	//! @param[in]	Y	計算値
+	//! @param[in]	Yref	基準値
+	//! @return	相対誤差
+	template<size_t M, size_t N>
+	double RelError(const ArcsMat<M,N>& Y, const ArcsMat<M,N>& Yref){
+		return norm<NormType::AMT_L1>(ArcsMat<M,N>(Y - Yref))/norm<NormType::AMT_L1>(Yref);
+	}
+
+	//! @brief 解析解との比較結果を表示する関数
+	//! @param[in]	Name	試験の名前
+	//! @param[in]	y		計算値
+	//! @param[in]	yref	解析解
+	//! @return	true = 許容値以内
+	bool Check(const char* Name, const double y, const double yref){
+		const double Err = std::fabs(y - yref)/std::fabs(yref);
+		printf("%-28s : % .15e (rel. err %.1e)  %s\n", Name, y, Err, Err <= TOL ? "PASS" : "FAIL");
+		return Err <= TOL;
+	}
+
+	//! @brief 2つの離散化の方法を比較して表示する関数
+	//! @param[in]	Name	系の名前
+	//! @param[in]	Ac, Bc	連続系のA,B行列
+	template<size_t N, size_t NB>
+	void Compare(const char* Name, const ArcsMat<N,N>& Ac, const ArcsMat<N,NB>& Bc){
+		ArcsMat<N,N> Ad1, Ad2;
+		ArcsMat<N,NB> Bd1, Bd2;
+		const double t1 = Measure(5,    [&](){ ArcsControl::DiscretizeSimpson(Ac, Bc, Ad1, Bd1, Ts); });
+		const double t2 = Measure(2000, [&](){ ArcsControl::Discretize(Ac, Bc, Ad2, Bd2, Ts); });
+		printf("%-22s : Simpson %10.1f [us], Van Loan %6.2f [us] (x%6.0f), rel. diff Ad %.1e, Bd %.1e\n",
+			Name, t1, t2, t1/t2, RelError(Ad2, Ad1), RelError(Bd2, Bd1));
+	}
+
+	//! @brief N次のランダムな安定系について比較する関数
+	template<size_t N>
+	void CompareRandom(RandomGenerator<double>& Rnd){
+		ArcsMat<N,N> Ac;
+		ArcsMat<N,1> Bc;
+		Rnd.GetRandomMatrix(Ac);
+		Rnd.GetRandomMatrix(Bc);
+		Ac = 1000.0*(lazy(Ac) - ArcsMat<N,N>::eye()*(2.0*static_cast<double>(N)));	// 対角優位にして安定にする
+		char Name[32];
+		snprintf(Name, sizeof(Name), "random stable, N = %zu", N);
+		Compare(Name, Ac, Bc);
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	// 1. 解析解との比較
+	bool Passed = true;
+	{
+		// 1次遅れ系 1/(s + a)
+		constexpr double a = 300;
+		const ArcsMat<1,1> Ac = {-a}, Bc = {1}, Cc = {1}, Dc = {0};
+		const double Phi = std::exp(-a*Ts);
+		const auto [Azoh, Bzoh, Czoh, Dzoh] = ArcsControl::DiscretizeSystem<ArcsControl::DiscMethod::DSC_ZOH>(Ac, Bc, Cc, Dc, Ts);
+		Passed &= Check("1st order, ZOH, Ad", Azoh[1], Phi);
+		Passed &= Check("1st order, ZOH, Bd", Bzoh[1], (1.0 - Phi)/a);
+		const auto [Afoh, Bfoh, Cfoh, Dfoh] = ArcsControl::DiscretizeSystem<ArcsControl::DiscMethod::DSC_FOH>(Ac, Bc, Cc, Dc, Ts);
+		const double Gam2 = (a*Ts - 1.0 + Phi)/(a*a*Ts);	// Γ2 = ∫0^Ts exp(-aτ)(Ts - τ)/Ts dτ
+		Passed &= Check("1st order, FOH, Ad", Afoh[1], Phi);
+		Passed &= Check("1st order, FOH, Bd", Bfoh[1], (1.0 - Phi)/a + (Phi - 1.0)*Gam2);
+		Passed &= Check("1st order, FOH, Dd", Dfoh[1], Gam2);
+		const auto [Atus, Btus, Ctus, Dtus] = ArcsControl::DiscretizeSystem<ArcsControl::DiscMethod::DSC_TUSTIN>(Ac, Bc, Cc, Dc, Ts);
+		Passed &= Check("1st order, Tustin, Ad", Atus[1], (1.0 - a*Ts/2.0)/(1.0 + a*Ts/2.0));
+		Passed &= Check("1st order, Tustin, Bd*Cd", Btus[1]*Ctus[1], Ts/((1.0 + a*Ts/2.0)*(1.0 + a*Ts/2.0)));
+		Passed &= Check("1st order, Tustin, Dd", Dtus[1], Ts/2.0/(1.0 + a*Ts/2.0));
+	}
+	{
+		// 積分器 1/s (FOHと双一次変換はどちらも Ts/2 (z + 1)/(z - 1) になる)
+		const ArcsMat<1,1> Ac = {0}, Bc = {1}, Cc = {1}, Dc = {0};
+		const auto [Afoh, Bfoh, Cfoh, Dfoh] = ArcsControl::DiscretizeSystem<ArcsControl::DiscMethod::DSC_FOH>(Ac, Bc, Cc, Dc, Ts);
+		Passed &= Check("integrator, FOH, Bd", Bfoh[1], Ts);
+		Passed &= Check("integrator, FOH, Dd", Dfoh[1], Ts/2.0);
+		const auto [Atus, Btus, Ctus, Dtus] = ArcsControl::DiscretizeSystem<ArcsControl::DiscMethod::DSC_TUSTIN>(Ac, Bc, Cc, Dc, Ts);
+		Passed &= Check("integrator, Tustin, Bd", Btus[1], Ts);
+		Passed &= Check("integrator, Tustin, Dd", Dtus[1], Ts/2.0);
+	}
+	printf("Analytic solution check : %s\n\n", Passed ? "PASS" : "FAIL");
+
+	// 2. 従来のシンプソン法との比較
+	constexpr double Jl = 1e-4, Dl = 1e-3, Ks = 10, Ds = 1e-2, Jm = 1e-4, Dm = 1e-3, Rg = 1, Kt = 0.1;
+	const ArcsMat<3,3> Atc = {
+		-(Dl + Ds)/Jl,	Ks/Jl,			Ds/(Jl*Rg)			  ,
+		-1,				0,				1.0/Rg				  ,
+		Ds/(Jm*Rg),		-Ks/(Jm*Rg),	-(Ds/(Rg*Rg) + Dm)/Jm
+	};
+	const ArcsMat<3,2> Btc = {
+		0		, -1.0/Jl,
+		0		, 0	     ,
+		Kt/Jm	, 0
+	};
+	Compare("two-inertia system", Atc, Btc);
+	RandomGenerator Rnd(-1, 1);
+	CompareRandom<2>(Rnd);
+	CompareRandom<4>(Rnd);
+	CompareRandom<8>(Rnd);
+
+	return EXIT_SUCCESS;	// 正常終了
+}
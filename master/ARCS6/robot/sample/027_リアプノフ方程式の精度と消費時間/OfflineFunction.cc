@@ -0,0 +1,145 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par リアプノフ/シルベスタ方程式の精度と消費時間の測定
+//! - 実Schur分解に基づく Lyapunov()/DiscLyapunov() と，クロネッカー積による LyapunovKron()/DiscLyapunovKron() を
+//!   N = 2～12 のランダムな安定系で比較し，相対誤差と消費時間を表示する。
+//! - N = 2～40 について Lyapunov()/DiscLyapunov()/Sylvester() の残差と消費時間を表示して，
+//!   計算量が O(n^3) で増えることを確認する。(クロネッカー積版は n^2×n^2 の行列がスタックに載らない)
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "ArcsControl.hh"
+#include "RandomGenerator.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+
+namespace {
+	constexpr double TOL = 1e-10;	//!< 相対誤差/相対残差の許容値
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 1回あたりの消費時間を測定する関数
+	//! @param[in]	K		測定する計算回数
+	//! @param[in]	Func	測定対象
+	//! @return	[us] 1回あたりの消費時間
+	template<typename F>
+	double Measure(const size_t K, F&& Func){
+		const auto Start = Clock::now();
+		for(size_t i = 0; i < K; ++i) Func();
+		return std::chrono::duration<double>(Clock::now() - Start).count()/static_cast<double>(K)*1e6;
+	}
+
+	//! @brief 1-ノルムで測った相対誤差を返す関数
+	//! @param[in]	Y	計算値
+	//! @param[in]	Yref	基準値
+	//! @return	相対誤差
+	template<size_t M, size_t N>
+	double RelError(const ArcsMat<M,N>& Y, const ArcsMat<M,N>& Yref){
+		return norm<NormType::AMT_L1>(ArcsMat<M,N>(Y - Yref))/norm<NormType::AMT_L1>(Yref);
+	}
+
+	//! @brief N次のランダムな安定行列と正定値行列を生成する関数
+	//! @param[in]	Rnd	乱数生成器
+	//! @param[out]	A	連続系の安定行列
+	//! @param[out]	Ad	離散系の安定行列 (スペクトル半径 < 1)
+	//! @param[out]	Q	正定値対称行列
+	template<size_t N>
+	void RandomSystem(RandomGenerator<double>& Rnd, ArcsMat<N,N>& A, ArcsMat<N,N>& Ad, ArcsMat<N,N>& Q){
+		ArcsMat<N,N> R;
+		Rnd.GetRandomMatrix(A);
+		Rnd.GetRandomMatrix(R);
+		A = A - ArcsMat<N,N>::eye()*static_cast<double>(N);			// 対角優位にして安定にする
+		Ad = 0.95/norm<NormType::AMT_L1>(A)*A;						// ノルムを1未満にして安定にする
+		Q = R*~R + ArcsMat<N,N>::eye();
+	}
+
+	//! @brief クロネッカー積版と比較して表示する関数
+	//! @return	true = 許容値以内
+	template<size_t N>
+	bool CompareKron(RandomGenerator<double>& Rnd){
+		ArcsMat<N,N> A, Ad, Q, X1, X2, Xd1, Xd2;
+		RandomSystem(Rnd, A, Ad, Q);
+		const double t1 = Measure(N <= 8 ? 100 : 5, [&](){ ArcsControl::LyapunovKron(A, Q, X1); });
+		const double t2 = Measure(1000, [&](){ ArcsControl::Lyapunov(A, Q, X2); });
+		const double t3 = Measure(N <= 8 ? 100 : 5, [&](){ ArcsControl::DiscLyapunovKron(Ad, Q, Xd1); });
+		const double t4 = Measure(1000, [&](){ ArcsControl::DiscLyapunov(Ad, Q, Xd2); });
+		const double e1 = RelError(X2, X1), e2 = RelError(Xd2, Xd1);
+		const bool Passed = e1 <= TOL && e2 <= TOL;
+		printf("N = %2zu : Lyapunov Kron %9.1f [us], Schur %6.1f [us] (x%6.0f, rel. diff %.1e), "
+			"DiscLyapunov Kron %9.1f [us], Schur %6.1f [us] (x%6.0f, rel. diff %.1e)  %s\n",
+			N, t1, t2, t1/t2, e1, t3, t4, t3/t4, e2, Passed ? "PASS" : "FAIL");
+		return Passed;
+	}
+
+	//! @brief 実Schur分解版の残差と消費時間を表示する関数
+	//! @return	true = 許容値以内
+	template<size_t N>
+	bool Scaling(RandomGenerator<double>& Rnd){
+		ArcsMat<N,N> A, Ad, Q, X, Xd, B;
+		ArcsMat<N,3> C;
+		ArcsMat<3,3> F;
+		ArcsMat<N,3> Xs;
+		RandomSystem(Rnd, A, Ad, Q);
+		Rnd.GetRandomMatrix(F);
+		Rnd.GetRandomMatrix(C);
+		constexpr size_t K = 40000/(N*N) + 10;
+		const double t1 = Measure(K, [&](){ ArcsControl::Lyapunov(A, Q, X); });
+		const double t2 = Measure(K, [&](){ ArcsControl::DiscLyapunov(Ad, Q, Xd); });
+		const double t3 = Measure(K, [&](){ ArcsControl::Sylvester(A, F, C, Xs); });
+		const double r1 = norm<NormType::AMT_L1>(ArcsMat<N,N>(A*X + X*~A + Q))/norm<NormType::AMT_L1>(Q);
+		const double r2 = norm<NormType::AMT_L1>(ArcsMat<N,N>(Ad*Xd*~Ad - Xd + Q))/norm<NormType::AMT_L1>(Q);
+		const double r3 = norm<NormType::AMT_L1>(ArcsMat<N,3>(A*Xs + Xs*F - C))/norm<NormType::AMT_L1>(C);
+		const bool Passed = r1 <= TOL && r2 <= TOL && r3 <= TOL;
+		printf("N = %2zu : Lyapunov %8.1f [us] (res. %.1e), DiscLyapunov %8.1f [us] (res. %.1e), Sylvester(N×3) %8.1f [us] (res. %.1e)  %s\n",
+			N, t1, r1, t2, r2, t3, r3, Passed ? "PASS" : "FAIL");
+		return Passed;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	RandomGenerator Rnd(-1, 1);
+	bool Passed = true;
+
+	// 1. クロネッカー積版との比較
+	Passed &= CompareKron<2>(Rnd);
+	Passed &= CompareKron<4>(Rnd);
+	Passed &= CompareKron<8>(Rnd);
+	Passed &= CompareKron<12>(Rnd);
+	printf("\n");
+
+	// 2. 次数に対する消費時間の増え方
+	Passed &= Scaling<2>(Rnd);
+	Passed &= Scaling<4>(Rnd);
+	Passed &= Scaling<8>(Rnd);
+	Passed &= Scaling<12>(Rnd);
+	Passed &= Scaling<16>(Rnd);
+	Passed &= Scaling<24>(Rnd);
+	Passed &= Scaling<32>(Rnd);
+	Passed &= Scaling<40>(Rnd);
+	printf("Accuracy check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
@@ -0,0 +1,246 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par 固有値分解と特異値分解の収束と消費時間の測定
+//! - Francisのダブルシフト QR 法による eig() と，従来の陽的シフト QR 法による複素Schur分解の固有値を比較する。
+//! - 片側Jacobi法による SVD() と，従来の QR 分解の交互反復による SVD を比較する。
+//! - N = 4～16 のランダム行列について，固有値/特異値の差，分解の残差と1回あたりの消費時間を表示し，
+//!   N = 24～40 では新しい方のみの残差と消費時間を表示する。
+//! - SVD は残差，U と V の直交性，特異値が非負の降順であることで判定する(従来版との特異値の差は表示のみ)。乱数シードは固定する。
+//! - 重根と複素固有値を含むコンパニオン行列の固有値を既知の値と比較する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <complex>
+#include <algorithm>
+#include <array>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "RandomGenerator.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+
+namespace {
+	using Complex = std::complex<double>;
+	constexpr double TOL = 1e-10;	//!< 相対残差の許容値
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 1回あたりの消費時間を測定する関数
+	//! @param[in]	K		測定する計算回数
+	//! @param[in]	Func	測定対象
+	//! @return	[us] 1回あたりの消費時間
+	template<typename F>
+	double Measure(const size_t K, F&& Func){
+		const auto Start = Clock::now();
+		for(size_t i = 0; i < K; ++i) Func();
+		return std::chrono::duration<double>(Clock::now() - Start).count()/static_cast<double>(K)*1e6;
+	}
+
+	//! @brief 従来のヘッセンベルグ分解(比較用)
+	//! @param[in]	A	入力行列
+	//! @param[out]	P	ユニタリ行列
+	//! @param[out]	H	ヘッセンベルグ行列
+	template<size_t N>
+	void ReferenceHessenberg(const ArcsMat<N,N,Complex>& A, ArcsMat<N,N,Complex>& P, ArcsMat<N,N,Complex>& H){
+		ArcsMat<N,N,Complex> W;
+		ArcsMat<N,1,Complex> h, u, v;
+		P = ArcsMat<N,N,Complex>::eye();
+		H = A;
+		for(size_t k = 1; k <= N - 2; ++k){
+			h = ArcsMat<N,1,Complex>::shiftup(getcolumn(H, k), k);
+			u[1] = -std::exp(Complex(0.0, std::arg(h[1])))*std::sqrt((~h*h)[1]);
+			v = h - u;
+			ArcsMat<N,1,Complex>::Householder(v, W, k);	// 密なハウスホルダー行列を毎回生成して掛ける
+			H = W*H*~W;
+			P = P*~W;
+		}
+	}
+
+	//! @brief 従来の陽的シフト QR 法による複素Schur分解(比較用)
+	//! @param[in]	A	入力行列
+	//! @param[out]	U	ユニタリ行列
+	//! @param[out]	S	上三角行列
+	//! @return	true = 収束した (従来版には反復上限が無かったので 100N 回で打ち切る)
+	template<size_t N>
+	bool ReferenceSchur(const ArcsMat<N,N,Complex>& A, ArcsMat<N,N,Complex>& U, ArcsMat<N,N,Complex>& S){
+		const auto I = ArcsMat<N,N,Complex>::eye();
+		ArcsMat<N,N,Complex> P, H, W, Q, R, V;
+		ReferenceHessenberg(A, P, H);
+		size_t k = N;
+		U = P;
+		S = H;
+		Complex a = 0;
+		for(size_t i = 0; i < 100*N; ++i){
+			k = (getdiag(S, -1)).GetNumOfNonZero() + 1;
+			if(1 < k){
+				a = (S(k-1,k-1) + S(k,k) + std::sqrt(std::pow(S(k-1,k-1) + S(k,k), 2) - 4.0*(S(k-1,k-1)*S(k,k) - (S(k-1,k)*S(k,k-1)))))/2.0;
+				W.FillAllZero();
+				ArcsMat<N,N,Complex>::copymatrix(S - a*I, 1, k, 1, k, W, 1, 1);
+				ArcsMat<N,N,Complex>::QR(W, Q, R);	// 有効ブロックを毎回密にQR分解する
+				V = I;
+				ArcsMat<N,N,Complex>::copymatrix(Q, 1, k, 1, k, V, 1, 1);
+				U = U*V;
+				S = ~V*S*V;
+				S.ZeroingTriLo();
+			}else{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	//! @brief 従来のQR分解の交互反復による特異値分解(比較用)
+	//! @param[in]	A	入力行列
+	//! @param[out]	U, S, V	特異値分解
+	template<size_t N>
+	void ReferenceSVD(const ArcsMat<N,N>& A, ArcsMat<N,N>& U, ArcsMat<N,N>& S, ArcsMat<N,N>& V){
+		ArcsMat<N,N> Snm, Qm, Qn;
+		U = ArcsMat<N,N>::eye();
+		V = ArcsMat<N,N>::eye();
+		S = A;
+		for(size_t i = 0; i < 100*N; ++i){
+			QR(S, Qm, S);
+			QR(~S, Qn, Snm);
+			S = ~Snm;
+			U = U*Qm;
+			V = V*Qn;
+			const double E = norm<NormType::AMT_LINF>(gettriup(Snm));
+			const double F = norm<NormType::AMT_LINF>(getdiag(Snm));
+			if(std::abs(E - F) < ArcsMat<N,N>::EPSILON) break;
+		}
+		for(size_t k = 1; k <= N; ++k){
+			if(S(k,k) < 0){
+				S(k,k) = -S(k,k);
+				setcolumn(U, -getcolumn(U, k), k);
+			}
+		}
+	}
+
+	//! @brief 固有値の集合の最大差を返す関数 (実部→虚部の順に並べて比較)
+	//! @param[in]	v1, v2	固有値ベクトル
+	//! @return	最大差
+	template<size_t N>
+	double EigDiff(const ArcsMat<N,1,Complex>& v1, const ArcsMat<N,1,Complex>& v2){
+		std::array<Complex,N> a, b;
+		for(size_t i = 0; i < N; ++i){
+			a[i] = v1[i+1];
+			b[i] = v2[i+1];
+		}
+		const auto Less = [](const Complex& x, const Complex& y){
+			return std::abs(x.real() - y.real()) > 1e-9 ? x.real() < y.real() : x.imag() < y.imag();
+		};
+		std::sort(a.begin(), a.end(), Less);
+		std::sort(b.begin(), b.end(), Less);
+		double ret = 0;
+		for(size_t i = 0; i < N; ++i) ret = std::max(ret, std::abs(a[i] - b[i]));
+		return ret;
+	}
+
+	//! @brief N×N のランダム行列について測定して表示する関数
+	//! @tparam	Compare	true = 従来版とも比較する
+	//! @return	true = 許容値以内
+	template<size_t N, bool Compare>
+	bool Benchmark(RandomGenerator<double>& Rnd){
+		ArcsMat<N,N> A;
+		Rnd.GetRandomMatrix(A);
+		const double nA = norm(A);
+		const ArcsMat<N,N,Complex> Ac(A);
+		constexpr size_t K = 20000/(N*N) + 5;
+
+		// 固有値 (実Schur分解)
+		ArcsMat<N,N> Us, Ss;
+		ArcsMat<N,1,Complex> v1, v2;
+		const double t1 = Measure(K, [&](){ Schur(A, Us, Ss); });
+		const double t2 = Measure(K, [&](){ eig(A, v1); });
+		const double r1 = norm(ArcsMat<N,N>(Us*Ss*~Us - A))/nA;
+
+		// 特異値分解
+		ArcsMat<N,N> U1, S1, V1, U2, S2, V2;
+		const double t3 = Measure(K, [&](){ SVD(A, U1, S1, V1); });
+		const double r3 = norm(ArcsMat<N,N>(U1*S1*~V1 - A))/nA;
+		const double o3 = std::max(
+			norm(ArcsMat<N,N>(~U1*U1 - ArcsMat<N,N>::eye())), norm(ArcsMat<N,N>(~V1*V1 - ArcsMat<N,N>::eye()))
+		);	// 直交性
+		bool Sorted = 0 <= S1(N,N);
+		for(size_t i = 1; i < N; ++i) Sorted &= S1(i+1,i+1) <= S1(i,i);	// 特異値が非負で降順に並んでいるか
+		bool Passed = r1 <= TOL && r3 <= TOL && o3 <= TOL && Sorted;
+		printf("N = %2zu : Schur %8.1f [us] (res. %.1e), eig %8.1f [us], SVD %8.1f [us] (res. %.1e, orth. %.1e%s)",
+			N, t1, r1, t2, t3, r3, o3, Sorted ? "" : ", NOT SORTED");
+
+		if constexpr(Compare){
+			// 従来版
+			ArcsMat<N,N,Complex> Ur, Sr;
+			bool Converged = false;
+			const double t4 = Measure(1, [&](){ Converged = ReferenceSchur(Ac, Ur, Sr); v2 = getdiag(Sr); });
+			const double t5 = Measure(1, [&](){ ReferenceSVD(A, U2, S2, V2); });
+			const double de = EigDiff(v1, v2)/nA;
+			const double ds = norm<NormType::AMT_LINF>(ArcsMat<N,1>(getdiag(S1) - getdiag(S2)))/nA;
+			const double r5 = norm(ArcsMat<N,N>(U2*S2*~V2 - A))/nA;
+			if(Converged){
+				Passed &= de <= TOL;
+				printf("\n         previous Schur %8.1f [us] (x%5.0f vs eig, eig diff %.1e)", t4, t4/t2, de);
+			}else{
+				printf("\n         previous Schur %8.1f [us] (not converged in %zu iterations)", t4, 100*N);
+			}
+			// 従来版は反復回数の上限で打ち切られて収束していないことがあるので，特異値の差は表示のみとする
+			printf(", previous SVD %8.1f [us] (x%5.0f, res. %.1e, sv diff %.1e)", t5, t5/t3, r5, ds);
+		}
+		printf("  %s\n", Passed ? "PASS" : "FAIL");
+		return Passed;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	RandomGenerator Rnd(-1, 1);
+	Rnd.SetSeed(1);	// 毎回同じ行列で確認する
+	bool Passed = true;
+	Passed &= Benchmark<4,  true>(Rnd);
+	Passed &= Benchmark<8,  true>(Rnd);
+	Passed &= Benchmark<12, true>(Rnd);
+	Passed &= Benchmark<16, true>(Rnd);
+	Passed &= Benchmark<24, false>(Rnd);
+	Passed &= Benchmark<32, false>(Rnd);
+	Passed &= Benchmark<40, false>(Rnd);
+
+	// 重根と複素固有値を含むコンパニオン行列 (s + 1)^3 (s^2 + 2s + 5)
+	const ArcsMat<5,5> Acm = {
+		-5, -14, -22, -17, -5,
+		 1,   0,   0,   0,  0,
+		 0,   1,   0,   0,  0,
+		 0,   0,   1,   0,  0,
+		 0,   0,   0,   1,  0
+	};
+	const ArcsMat<5,1,Complex> vcm = eig(Acm);
+	dispf(vcm, "% 10.6f");
+	std::array<Complex, 5> Vcm, Vex = {Complex(-1,-2), Complex(-1,0), Complex(-1,0), Complex(-1,0), Complex(-1,2)};
+	for(size_t i = 0; i < 5; ++i) Vcm[i] = vcm[i + 1];
+	std::sort(Vcm.begin(), Vcm.end(), [](const Complex& a, const Complex& b){ return a.imag() < b.imag(); });	// 虚部の順に並べる
+	double Ecm = 0;
+	for(size_t i = 0; i < 5; ++i) Ecm = std::max(Ecm, std::abs(Vcm[i] - Vex[i]));
+	printf("Companion matrix : max. eig err. %.1e (triple root)\n", Ecm);
+	Passed &= Ecm < 1e-4;	// 3重根は eps^(1/3) 程度ずれるので緩めの許容値
+	printf("Convergence check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
@@ -0,0 +1,142 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par 行列分解の再利用による消費時間の測定
+//! - 同じ係数行列で右辺だけ変えて繰り返し解く場合について，毎回 linsolve() で解く場合と，
+//!   LUfact/Cholfact/QRfact で1回だけ分解して Solve() で解く場合の1回あたりの消費時間を比較する。
+//! - 係数行列をランク1更新したときに，分解し直す場合と Update()/Downdate() で分解結果を修正する場合を比較する。
+//! - 解の残差と分解結果の誤差が許容値以内であることも確認する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "ArcsMatrixFact.hh"
+#include "RandomGenerator.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+
+namespace {
+	constexpr double TOL = 1e-10;	//!< 相対残差の許容値
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 最適化で計算が消されないようにする関数
+	//! @param[in]	x	対象の変数
+	template<typename T>
+	inline void KeepAlive(T& x){
+		asm volatile("" : : "g"(&x) : "memory");
+	}
+
+	//! @brief 1回あたりの消費時間を測定する関数
+	//! @param[in]	K		測定する計算回数
+	//! @param[in]	Func	測定対象
+	//! @return	[ns] 1回あたりの消費時間
+	template<typename F>
+	double Measure(const size_t K, F&& Func){
+		const auto Start = Clock::now();
+		for(size_t i = 0; i < K; ++i) Func();
+		return std::chrono::duration<double>(Clock::now() - Start).count()/static_cast<double>(K)*1e9;
+	}
+
+	//! @brief 相対残差 |AX - B|/(|A||X|) を返す関数
+	template<size_t M, size_t N>
+	double Residual(const ArcsMat<M,N>& A, const ArcsMat<N,1>& x, const ArcsMat<M,1>& b){
+		return norm(ArcsMat<M,1>(A*x - b))/(norm(A)*norm(x));
+	}
+
+	//! @brief N×N の係数行列について測定して表示する関数
+	//! @return	true = 許容値以内
+	template<size_t N>
+	bool Benchmark(RandomGenerator<double>& Rnd){
+		constexpr size_t K = 200000/(N*N) + 10;
+		ArcsMat<N,N> A;
+		ArcsMat<N,1> b, u, v, x1, x2;
+		Rnd.GetRandomMatrix(A);
+		Rnd.GetRandomMatrix(b);
+		Rnd.GetRandomMatrix(u);
+		Rnd.GetRandomMatrix(v);
+		const ArcsMat<N,N> S = ~A*A + ArcsMat<N,N>::eye();	// 正定値行列
+		ArcsMat<2*N,N> At;									// 縦長行列
+		ArcsMat<2*N,1> bt;
+		Rnd.GetRandomMatrix(At);
+		Rnd.GetRandomMatrix(bt);
+		ArcsMat<N,1> xt1, xt2;
+
+		// 1. 同じ係数行列で繰り返し解く場合
+		LUfact<N> dA(A);
+		Cholfact<N> dS(S);
+		QRfact<2*N,N> dAt(At);
+		const double t1 = Measure(K, [&](){ KeepAlive(A); x1 = linsolve(A, b); KeepAlive(x1); });
+		const double t2 = Measure(K, [&](){ KeepAlive(A); x2 = dA.Solve(b); KeepAlive(x2); });
+		const double r1 = Residual(A, x2, b);
+		const double t3 = Measure(K, [&](){ KeepAlive(S); x1 = linsolve(S, b); KeepAlive(x1); });
+		const double t4 = Measure(K, [&](){ KeepAlive(S); x2 = dS.Solve(b); KeepAlive(x2); });
+		const double r2 = Residual(S, x2, b);
+		const double t5 = Measure(K/4 + 1, [&](){ KeepAlive(At); xt1 = linsolve(At, bt); KeepAlive(xt1); });
+		const double t6 = Measure(K, [&](){ KeepAlive(At); xt2 = dAt.Solve(bt); KeepAlive(xt2); });
+		const double r3 = norm(ArcsMat<N,1>(xt2 - xt1))/norm(xt1);	// 最小二乗解の差
+		printf("N = %2zu : LU    linsolve %8.0f [ns], Solve %6.0f [ns] (x%5.1f, res. %.1e)\n", N, t1, t2, t1/t2, r1);
+		printf("         Chol  linsolve %8.0f [ns], Solve %6.0f [ns] (x%5.1f, res. %.1e)\n", t3, t4, t3/t4, r2);
+		printf("         QR    linsolve %8.0f [ns], Solve %6.0f [ns] (x%5.1f, diff %.1e) (%zux%zu least squares)\n", t5, t6, t5/t6, r3, 2*N, N);
+
+		// 2. 係数行列をランク1更新する場合 (Update側は毎回元の分解結果をコピーする時間も含む)
+		const ArcsMat<N,N> Au = A + u*~v;
+		const ArcsMat<N,N> Su = S + u*~u;
+		const ArcsMat<2*N,1> ut = concatv(u, v);
+		const ArcsMat<2*N,N> Atu = At + ut*~v;
+		LUfact<N> dA2;
+		Cholfact<N> dS2;
+		QRfact<2*N,N> dAt2;
+		const double t7  = Measure(K/4 + 1, [&](){ KeepAlive(Au); dA2.Factorize(Au); KeepAlive(dA2); });
+		const double t8  = Measure(K/4 + 1, [&](){ dA2 = dA; dA2.Update(u, v); KeepAlive(dA2); });
+		const double r4  = Residual(Au, dA2.Solve(b), b);
+		const double t9  = Measure(K/4 + 1, [&](){ KeepAlive(Su); dS2.Factorize(Su); KeepAlive(dS2); });
+		const double t10 = Measure(K/4 + 1, [&](){ dS2 = dS; dS2.Update(u); KeepAlive(dS2); });
+		const double r5  = norm(ArcsMat<N,N>(~dS2.GetR()*dS2.GetR() - Su))/norm(Su);
+		dS2.Downdate(u);
+		const double r6  = norm(ArcsMat<N,N>(~dS2.GetR()*dS2.GetR() - S))/norm(S);
+		const double t11 = Measure(K/16 + 1, [&](){ KeepAlive(Atu); dAt2.Factorize(Atu); KeepAlive(dAt2); });
+		const double t12 = Measure(K/16 + 1, [&](){ dAt2 = dAt; dAt2.Update(ut, v); KeepAlive(dAt2); });
+		const double r7  = norm(ArcsMat<2*N,N>(dAt2.GetQ()*dAt2.GetR() - Atu))/norm(Atu);
+		printf("         rank-1 update : LU    refactor %8.0f [ns], Update %8.0f [ns] (x%5.1f, res. %.1e)\n", t7, t8, t7/t8, r4);
+		printf("                         Chol  refactor %8.0f [ns], Update %8.0f [ns] (x%5.1f, err. %.1e, downdate err. %.1e)\n", t9, t10, t9/t10, r5, r6);
+		printf("                         QR    refactor %8.0f [ns], Update %8.0f [ns] (x%5.1f, err. %.1e)\n", t11, t12, t11/t12, r7);
+
+		const bool Passed = r1 <= TOL && r2 <= TOL && r3 <= TOL && r4 <= TOL && r5 <= TOL && r6 <= TOL && r7 <= TOL;
+		printf("         %s\n", Passed ? "PASS" : "FAIL");
+		return Passed;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	RandomGenerator Rnd(-1, 1);
+	bool Passed = true;
+	Passed &= Benchmark<4>(Rnd);
+	Passed &= Benchmark<8>(Rnd);
+	Passed &= Benchmark<16>(Rnd);
+	Passed &= Benchmark<32>(Rnd);
+	printf("Accuracy check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
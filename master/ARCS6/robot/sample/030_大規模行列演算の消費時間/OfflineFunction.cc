@@ -0,0 +1,166 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par 大規模行列演算の消費時間の測定
+//! - ArcsMat と ArcsLargeMat の行列積・連立一次方程式の求解の1回あたりの消費時間を比較する。
+//! - ArcsLargeMat はスレッドプールを設定しない場合(単一スレッド)と設定した場合の両方を測定する。
+//! - ArcsMat との相互変換の消費時間も測定する。
+//! - 結果が ArcsMat と許容値以内で一致し，並列計算の結果が単一スレッドの結果と一致することも確認する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "ArcsMatrixLarge.hh"
+#include "ThreadPool.hh"
+#include "RandomGenerator.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+
+namespace {
+	constexpr double TOL = 1e-10;	//!< 相対誤差の許容値
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 最適化で計算が消されないようにする関数
+	//! @param[in]	x	対象の変数
+	template<typename T>
+	inline void KeepAlive(T& x){
+		asm volatile("" : : "g"(&x) : "memory");
+	}
+
+	//! @brief 1回あたりの消費時間を測定する関数
+	//! @param[in]	K		測定する計算回数
+	//! @param[in]	Func	測定対象
+	//! @return	[us] 1回あたりの消費時間
+	template<typename F>
+	double Measure(const size_t K, F&& Func){
+		const auto Start = Clock::now();
+		for(size_t i = 0; i < K; ++i) Func();
+		return std::chrono::duration<double>(Clock::now() - Start).count()/static_cast<double>(K)*1e6;
+	}
+
+	//! @brief 大規模行列を乱数で埋める関数
+	template<size_t M, size_t N>
+	void GetRandomMatrix(RandomGenerator<double>& Rnd, ArcsLargeMat<M,N>& Y){
+		for(size_t n = 1; n <= N; ++n){
+			for(size_t m = 1; m <= M; ++m) Y(m,n) = Rnd.GetRandom();
+		}
+	}
+
+	//! @brief 相対誤差 |X - Y|/|Y| を返す関数
+	template<size_t M, size_t N>
+	double RelErr(const ArcsLargeMat<M,N>& X, const ArcsLargeMat<M,N>& Y){
+		return norm<NormType::AMT_L1>(ArcsLargeMat<M,N>(X - Y))/norm<NormType::AMT_L1>(Y);
+	}
+
+	//! @brief N×N の行列について ArcsMat と ArcsLargeMat の消費時間を比較して表示する関数
+	//! @param[in]	Pool	スレッドプール
+	//! @return	true = 許容値以内
+	template<size_t N>
+	bool Benchmark(RandomGenerator<double>& Rnd, ThreadPool& Pool){
+		constexpr size_t K = 64*64*64*20/(N*N*N) + 2;
+		static ArcsMat<N,N> As, Bs, Cs;	// ArcsMat は大きいのでスタックに置かない
+		static ArcsMat<N,1> bs, xs;
+		ArcsLargeMat<N,N> A, B, C1, C2;
+		ArcsLargeMat<N,1> b, x1, x2;
+		GetRandomMatrix(Rnd, A);
+		GetRandomMatrix(Rnd, B);
+		GetRandomMatrix(Rnd, b);
+		A.ToArcsMat(As);
+		B.ToArcsMat(Bs);
+		b.ToArcsMat(bs);
+
+		// 1. 行列積
+		ArcsMatrixLarge::SetThreadPool(nullptr);
+		const double t1 = Measure(K, [&](){ KeepAlive(As); Cs = As*Bs; KeepAlive(Cs); });
+		const double t2 = Measure(K, [&](){ KeepAlive(A); ArcsLargeMat<N,N>::mult(A, B, C1); KeepAlive(C1); });
+		ArcsMatrixLarge::SetThreadPool(&Pool);
+		const double t3 = Measure(K, [&](){ KeepAlive(A); ArcsLargeMat<N,N>::mult(A, B, C2); KeepAlive(C2); });
+		const double e1 = RelErr(C1, ArcsLargeMat<N,N>(Cs));	// ArcsMat との差
+		const double e2 = RelErr(C2, C1);						// 並列計算と単一スレッドの差
+		printf("N = %4zu : A*B       ArcsMat %9.1f [us], Large %8.1f [us] (x%5.1f), Large+Pool %8.1f [us] (x%5.1f, err. %.1e, %.1e)\n",
+			N, t1, t2, t1/t2, t3, t1/t3, e1, e2);
+
+		// 2. 連立一次方程式
+		ArcsMatrixLarge::SetThreadPool(nullptr);
+		const double t4 = Measure(K, [&](){ KeepAlive(As); xs = linsolve(As, bs); KeepAlive(xs); });
+		const double t5 = Measure(K, [&](){ KeepAlive(A); ArcsLargeMat<N,N>::linsolve(A, b, x1); KeepAlive(x1); });
+		ArcsMatrixLarge::SetThreadPool(&Pool);
+		const double t6 = Measure(K, [&](){ KeepAlive(A); ArcsLargeMat<N,N>::linsolve(A, b, x2); KeepAlive(x2); });
+		const double r1 = norm(ArcsLargeMat<N,1>(A*x1 - b))/(norm<NormType::AMT_L1>(A)*norm(x1));	// 相対残差
+		const double e3 = RelErr(x2, x1);
+		printf("           linsolve  ArcsMat %9.1f [us], Large %8.1f [us] (x%5.1f), Large+Pool %8.1f [us] (x%5.1f, res. %.1e, err. %.1e)\n",
+			t4, t5, t4/t5, t6, t4/t6, r1, e3);
+
+		// 3. ArcsMat との相互変換
+		const double t7 = Measure(10*K, [&](){ KeepAlive(As); C1 = As; C1.ToArcsMat(Cs); KeepAlive(Cs); });
+		printf("           ArcsMat <-> Large conversion %6.2f [us]\n", t7);
+
+		const bool Passed = e1 <= TOL && e2 <= TOL && r1 <= TOL && e3 <= TOL;
+		printf("           %s\n", Passed ? "PASS" : "FAIL");
+		return Passed;
+	}
+
+	//! @brief ArcsMat では大きすぎる N×N の行列について ArcsLargeMat の消費時間を表示する関数
+	//! @param[in]	Pool	スレッドプール
+	//! @return	true = 許容値以内
+	template<size_t N>
+	bool BenchmarkLarge(RandomGenerator<double>& Rnd, ThreadPool& Pool){
+		ArcsLargeMat<N,N> A, B, C1, C2, Ai;
+		GetRandomMatrix(Rnd, A);
+		GetRandomMatrix(Rnd, B);
+
+		ArcsMatrixLarge::SetThreadPool(nullptr);
+		const double t1 = Measure(3, [&](){ KeepAlive(A); ArcsLargeMat<N,N>::mult(A, B, C1); KeepAlive(C1); });
+		const double t2 = Measure(3, [&](){ KeepAlive(A); ArcsLargeMat<N,N>::inv(A, Ai); KeepAlive(Ai); });
+		const double t3 = Measure(3, [&](){ KeepAlive(A); ArcsLargeMat<N,N>::tp(A, C2); KeepAlive(C2); });
+		ArcsMatrixLarge::SetThreadPool(&Pool);
+		const double t4 = Measure(3, [&](){ KeepAlive(A); ArcsLargeMat<N,N>::mult(A, B, C2); KeepAlive(C2); });
+		const double e1 = RelErr(C2, C1);
+		const double r1 = norm<NormType::AMT_L1>(ArcsLargeMat<N,N>(A*Ai - ArcsLargeMat<N,N>::eye()))/(norm<NormType::AMT_L1>(A)*norm<NormType::AMT_L1>(Ai));	// 相対残差
+		printf("N = %4zu : A*B  Large %9.1f [us] (%5.2f [GFLOPS]), Large+Pool %9.1f [us] (%5.2f [GFLOPS], err. %.1e)\n",
+			N, t1, 2.0*N*N*N/t1*1e-3, t4, 2.0*N*N*N/t4*1e-3, e1);
+		printf("           inv  Large %9.1f [us] (res. %.1e), transpose %7.1f [us]\n", t2, r1, t3);
+
+		const bool Passed = e1 <= TOL && r1 <= TOL;
+		printf("           %s\n", Passed ? "PASS" : "FAIL");
+		return Passed;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	RandomGenerator Rnd(-1, 1);
+	ThreadPool Pool;	// ハードウェアの並列数で生成
+	printf("Number of threads : %zu\n", Pool.GetNumOfThreads());
+	bool Passed = true;
+	Passed &= Benchmark<64>(Rnd, Pool);
+	Passed &= Benchmark<128>(Rnd, Pool);
+	Passed &= Benchmark<256>(Rnd, Pool);
+	Passed &= BenchmarkLarge<512>(Rnd, Pool);
+	Passed &= BenchmarkLarge<1024>(Rnd, Pool);
+	ArcsMatrixLarge::SetThreadPool(nullptr);
+	printf("Accuracy check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
@@ -0,0 +1,260 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par リッカチ方程式の精度と消費時間の測定
+//! - 2慣性系(4状態)と4慣性系(8状態)について，Riccati()/DiscRiccati() の相対残差と，
+//!   LQR()/DiscLQR()/Kalman()/DiscKalman() で設計した閉ループ系が安定であることを確認する。
+//! - DiscRiccati() の解を，リッカチ差分方程式を収束するまで回した値反復の解と比較して，反復回数と消費時間を表示する。
+//! - 負荷側慣性の推定値が変わる場合を想定して，負荷側慣性を変えながら DiscLQR() でゲインを計算し直すときの消費時間を表示する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <complex>
+#include <algorithm>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "ArcsControl.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+
+namespace {
+	constexpr double TOL = 1e-10;	//!< 相対残差の許容値
+	constexpr double Ts = 100e-6;	//!< [s] サンプリング周期
+	constexpr double Kt = 0.49;		//!< [Nm/A]	トルク定数
+	constexpr double Jm = 1.10e-4;	//!< [kgm^2] モータ側慣性
+	constexpr double Dm = 3.76e-4;	//!< [Nm s/rad]モータ側粘性
+	constexpr double Jl = 0.133;	//!< [kgm^2]	負荷側慣性
+	constexpr double Dl = 0.1;		//!< [Nm s/rad]負荷側粘性
+	constexpr double Ks = 1.08e4;	//!< [Nm/rad]	2慣性間の剛性
+	constexpr double Rg = 50;		//!< [-]		減速比
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 1回あたりの消費時間を測定する関数
+	//! @param[in]	K		測定する計算回数
+	//! @param[in]	Func	測定対象
+	//! @return	[us] 1回あたりの消費時間
+	template<typename F>
+	double Measure(const size_t K, F&& Func){
+		const auto Start = Clock::now();
+		for(size_t i = 0; i < K; ++i) Func();
+		return std::chrono::duration<double>(Clock::now() - Start).count()/static_cast<double>(K)*1e6;
+	}
+
+	//! @brief 2慣性系の連続系モデルを生成する関数 (状態 x = [負荷位置 負荷速度 ねじれ角 モータ速度]', 入力 = 電流)
+	//! @param[in]	J2	[kgm^2] 負荷側慣性
+	//! @param[out]	A, B, C	A,B,C行列 (出力 = モータ位置の負荷側換算値)
+	void TwoInertia(const double J2, ArcsMat<4,4>& A, ArcsMat<4,1>& B, ArcsMat<1,4>& C){
+		A.Set(
+			0,      1,        0,           0,
+			0, -Dl/J2,    Ks/J2,           0,
+			0,     -1,        0,        1/Rg,
+			0,      0, -Ks/Rg/Jm,     -Dm/Jm
+		);
+		B.Set(0, 0, 0, Kt/Jm);
+		C.Set(1, 0, 1, 0);
+	}
+
+	//! @brief 4慣性系(ばね質量の直列系)の連続系モデルを生成する関数 (状態 x = [θ1 ω1 θ2 ω2 θ3 ω3 θ4 ω4]', 入力 = 1番目へのトルク)
+	//! @param[out]	A, B, C	A,B,C行列 (出力 = 1番目と4番目の位置)
+	void FourInertia(ArcsMat<8,8>& A, ArcsMat<8,1>& B, ArcsMat<2,8>& C){
+		constexpr double J[4] = {1e-3, 2e-3, 1.5e-3, 4e-3};	// [kgm^2] 慣性
+		constexpr double K[3] = {200, 150, 300};				// [Nm/rad] 剛性
+		constexpr double D = 1e-3;								// [Nm s/rad] 粘性
+		A.FillAll(0);
+		B.FillAll(0);
+		C.FillAll(0);
+		for(size_t i = 0; i < 4; ++i){
+			const size_t p = 2*i + 1, v = 2*i + 2;	// 位置と速度の番号
+			A(p,v) = 1;
+			A(v,v) = -D/J[i];
+			if(0 < i){
+				A(v,p) -= K[i-1]/J[i];	// 手前側のばね
+				A(v,p-2) += K[i-1]/J[i];
+			}
+			if(i < 3){
+				A(v,p) -= K[i]/J[i];	// 先側のばね
+				A(v,p+2) += K[i]/J[i];
+			}
+		}
+		B(2,1) = 1/J[0];
+		C(1,1) = 1;
+		C(2,7) = 1;
+	}
+
+	//! @brief 連続リカッチ方程式の相対残差を返す関数
+	template<size_t N, size_t L>
+	double CareResidual(const ArcsMat<N,N>& A, const ArcsMat<N,L>& B, const ArcsMat<N,N>& Q, const ArcsMat<L,L>& R, const ArcsMat<N,N>& X){
+		const ArcsMat<N,N> AX = ~A*X, XGX = X*B*inv(R)*~B*X;
+		return max(abs(ArcsMat<N,N>(AX + ~AX - XGX + Q)))/(2*max(abs(AX)) + max(abs(XGX)) + max(abs(Q)));
+	}
+
+	//! @brief 離散リカッチ方程式の相対残差を返す関数
+	template<size_t N, size_t L>
+	double DareResidual(const ArcsMat<N,N>& A, const ArcsMat<N,L>& B, const ArcsMat<N,N>& Q, const ArcsMat<L,L>& R, const ArcsMat<N,N>& X){
+		const ArcsMat<N,N> AXA = ~A*X*A;
+		const ArcsMat<L,N> BXA = ~B*X*A;
+		const ArcsMat<N,N> S = ~BXA*inv(ArcsMat<L,L>(R + ~B*X*B))*BXA;
+		return max(abs(ArcsMat<N,N>(AXA - X - S + Q)))/(max(abs(AXA)) + max(abs(X)) + max(abs(S)) + max(abs(Q)));
+	}
+
+	//! @brief 離散系の極の絶対値の最大値を返す関数
+	template<size_t N>
+	double SpectralRadius(const ArcsMat<N,N>& A){
+		const auto z = eig(A);
+		double r = 0;
+		for(size_t i = 1; i <= N; ++i) r = std::max(r, std::abs(z[i]));
+		return r;
+	}
+
+	//! @brief リッカチ差分方程式を収束するまで回して離散リカッチ方程式を解く関数 (比較用の値反復)
+	//! @return	反復回数
+	template<size_t N, size_t L>
+	size_t ValueIteration(const ArcsMat<N,N>& A, const ArcsMat<N,L>& B, const ArcsMat<N,N>& Q, const ArcsMat<L,L>& R, ArcsMat<N,N>& X){
+		X = Q;
+		for(size_t k = 1; k <= 10000000; ++k){
+			const ArcsMat<L,N> BXA = ~B*X*A;
+			const ArcsMat<N,N> Xn = ~A*X*A - ~BXA*inv(ArcsMat<L,L>(R + ~B*X*B))*BXA + Q;
+			const double d = max(abs(ArcsMat<N,N>(Xn - X)));
+			X = Xn;
+			if(d <= 1e-15*max(abs(X))) return k;
+		}
+		return 0;
+	}
+
+	//! @brief 1つのモデルについて精度と消費時間を表示する関数
+	//! @param[in]	Name	モデルの名前
+	//! @param[in]	A, B, C	連続系のA,B,C行列
+	//! @param[in]	Q, R	状態と入力の重み行列
+	//! @param[in]	Qn, Rn	プロセス雑音と観測雑音の共分散行列
+	//! @return	true = 許容値以内
+	template<size_t N, size_t L, size_t P>
+	bool Check(
+		const char* Name, const ArcsMat<N,N>& A, const ArcsMat<N,L>& B, const ArcsMat<P,N>& C,
+		const ArcsMat<N,N>& Q, const ArcsMat<L,L>& R, const ArcsMat<N,N>& Qn, const ArcsMat<P,P>& Rn
+	){
+		// 連続系
+		ArcsMat<L,N> K;
+		ArcsMat<N,P> F;
+		ArcsMat<N,N> X, Y;
+		const double t1 = Measure(1000, [&](){ ArcsControl::LQR(A, B, Q, R, K, X); });
+		const double t2 = Measure(1000, [&](){ ArcsControl::Kalman(A, C, Qn, Rn, F, Y); });
+		const double r1 = CareResidual(A, B, Q, R, X);
+		const double r2 = CareResidual(ArcsMat<N,N>(~A), ArcsMat<N,P>(~C), Qn, Rn, Y);
+		const bool s1 = ArcsControl::IsStable(ArcsMat<N,N>(A - B*K)) && ArcsControl::IsStable(ArcsMat<N,N>(A - F*C));
+		printf("%s : LQR %6.1f [us] (res. %.1e), Kalman %6.1f [us] (res. %.1e), closed loop %s\n",
+			Name, t1, r1, t2, r2, s1 ? "stable" : "UNSTABLE");
+
+		// 離散系 (評価関数の重みはサンプリング周期を掛けて連続系と揃える)
+		const auto [Ad, Bd] = ArcsControl::Discretize(A, B, Ts);
+		const ArcsMat<N,N> Qd = Q*Ts, Qnd = Qn*Ts;
+		const ArcsMat<L,L> Rd = R*Ts;
+		const ArcsMat<P,P> Rnd = Rn/Ts;
+		ArcsMat<L,N> Kd;
+		ArcsMat<N,P> Fd;
+		ArcsMat<N,N> Xd, Yd;
+		const double t3 = Measure(1000, [&](){ ArcsControl::DiscLQR(Ad, Bd, Qd, Rd, Kd, Xd); });
+		const double t4 = Measure(1000, [&](){ ArcsControl::DiscKalman(Ad, C, Qnd, Rnd, Fd, Yd); });
+		const double r3 = DareResidual(Ad, Bd, Qd, Rd, Xd);
+		const double r4 = DareResidual(ArcsMat<N,N>(~Ad), ArcsMat<N,P>(~C), Qnd, Rnd, Yd);
+		const double z1 = SpectralRadius(ArcsMat<N,N>(Ad - Bd*Kd)), z2 = SpectralRadius(ArcsMat<N,N>(Ad - Fd*C));
+		const double e1 = max(abs(ArcsMat<N,N>(Xd - X)))/max(abs(X));	// Ts → 0 で連続系の解に近づく
+		printf("%s : DiscLQR %6.1f [us] (res. %.1e, max|z| %.6f), DiscKalman %6.1f [us] (res. %.1e, max|z| %.6f), rel. diff. from LQR %.1e\n",
+			Name, t3, r3, z1, t4, r4, z2, e1);
+
+		// 値反復との比較
+		ArcsMat<N,N> Xv;
+		size_t Iter = 0;
+		const double t5 = Measure(1, [&](){ Iter = ValueIteration(Ad, Bd, Qd, Rd, Xv); });
+		const double e2 = max(abs(ArcsMat<N,N>(Xv - Xd)))/max(abs(Xd));
+		printf("%s : value iteration %8zu iter. %9.1f [us] (x%6.0f), rel. diff. %.1e\n", Name, Iter, t5, t5/t3, e2);
+
+		return r1 <= TOL && r2 <= TOL && s1 && r3 <= TOL && r4 <= TOL && z1 < 1 && z2 < 1 && Iter != 0 && e2 <= 1e-8;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	bool Passed = true;
+
+	// 1. 2慣性系 (4状態)
+	{
+		ArcsMat<4,4> A;
+		ArcsMat<4,1> B;
+		ArcsMat<1,4> C;
+		TwoInertia(Jl, A, B, C);
+		ArcsMat<4,4> Q, Qn;
+		Q.Set(
+			1e4,   0,   0,    0,
+			  0,  10,   0,    0,
+			  0,   0, 1e4,    0,
+			  0,   0,   0, 1e-3
+		);
+		Qn.Set(
+			0,       0, 0,         0,
+			0, 1/Jl/Jl, 0,         0,
+			0,       0, 0,         0,
+			0,       0, 0, 1/Jm/Jm
+		);
+		ArcsMat<1,1> R, Rn;
+		R.Set(1);
+		Rn.Set(1e-10);
+		Passed &= Check("Two-inertia  (4 states)", A, B, C, Q, R, Qn, Rn);
+		printf("\n");
+
+		// 負荷側慣性を変えながらゲインを計算し直す
+		ArcsMat<1,4> Kd;
+		ArcsMat<4,4> Xd;
+		double tmax = 0, rmax = 0;
+		for(size_t i = 0; i <= 100; ++i){
+			const double J2 = Jl*std::pow(4.0, static_cast<double>(i)/100.0 - 0.5);	// 0.5倍～2倍
+			ArcsMat<4,4> Ai;
+			ArcsMat<4,1> Bi;
+			ArcsMat<1,4> Ci;
+			TwoInertia(J2, Ai, Bi, Ci);
+			const auto [Adi, Bdi] = ArcsControl::Discretize(Ai, Bi, Ts);
+			tmax = std::max(tmax, Measure(1, [&](){ ArcsControl::DiscLQR(Adi, Bdi, ArcsMat<4,4>(Q*Ts), ArcsMat<1,1>(R*Ts), Kd, Xd); }));
+			rmax = std::max(rmax, SpectralRadius(ArcsMat<4,4>(Adi - Bdi*Kd)));
+		}
+		printf("Re-design for Jl x0.5 - x2 : DiscLQR max. %6.1f [us], max|z| %.6f\n", tmax, rmax);
+		Passed &= rmax < 1;
+		printf("\n");
+	}
+
+	// 2. 4慣性系 (8状態)
+	{
+		ArcsMat<8,8> A;
+		ArcsMat<8,1> B;
+		ArcsMat<2,8> C;
+		FourInertia(A, B, C);
+		ArcsMat<8,8> Q = ArcsMat<8,8>::eye(), Qn = ArcsMat<8,8>::zeros();
+		Q(7,7) = 1e4;	// 先端の位置を重視
+		for(size_t i = 2; i <= 8; i += 2) Qn(i,i) = 1e3;
+		ArcsMat<1,1> R;
+		R.Set(1e-4);
+		ArcsMat<2,2> Rn = ArcsMat<2,2>::eye()*1e-8;
+		Passed &= Check("Four-inertia (8 states)", A, B, C, Q, R, Qn, Rn);
+	}
+	printf("Accuracy check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
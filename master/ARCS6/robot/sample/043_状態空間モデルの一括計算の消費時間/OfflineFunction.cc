@@ -0,0 +1,162 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par 状態空間モデルの一括計算の消費時間の測定
+//! - 軸ごとにパラメータの異なる多軸の2慣性系モデルと2次フィルタについて，
+//!   DiscStateSpace を軸数分だけ並べて計算する場合と，DiscStateSpaceBatch で一括計算する場合の1サンプルあたりの消費時間を比較する。
+//! - 両者の出力がビット単位で一致することも確認する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <array>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "ArcsControl.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+using namespace ArcsControl;
+
+namespace {
+	constexpr double Ts = 100e-6;	//!< [s] サンプリング周期
+	constexpr size_t K = 100000;	//!< 計算するサンプル数
+	constexpr size_t KU = 1000;		//!< 入力信号の表の長さ
+	constexpr size_t KL = 2000;		//!< 一致確認用に出力を記録する間隔
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 最適化で計算が消されないようにする関数
+	//! @param[in]	x	対象の変数
+	template<typename T>
+	inline void KeepAlive(T& x){
+		asm volatile("" : : "g"(&x) : "memory");
+	}
+
+	//! @brief l軸目の2慣性系モデル(状態：負荷側速度，ねじれ角，モータ側速度，入力：電流，負荷トルク)を離散化する関数
+	//! @param[in]	l	軸番号
+	//! @return	{Ad, Bd} = {離散系A行列, 離散系B行列}
+	std::tuple<ArcsMat<3,3>, ArcsMat<3,2>> TwoInertiaModel(const size_t l){
+		const double Jl = 1e-3*(1.0 + 0.1*l), Jm = 1e-4*(1.0 + 0.05*l);	// [kgm^2] 負荷側慣性，モータ側慣性
+		const double Dl = 1e-3, Dm = 2e-4;	// [Nm/(rad/s)] 粘性摩擦
+		const double Ks = 50.0*(1.0 + 0.2*l);	// [Nm/rad] ばね定数
+		const double Kt = 0.2;				// [Nm/A] トルク定数
+		const ArcsMat<3,3> A = {
+			-Dl/Jl,  Ks/Jl,       0,
+			    -1,      0,       1,
+			     0, -Ks/Jm,  -Dm/Jm
+		};
+		const ArcsMat<3,2> B = {
+			    0, -1/Jl,
+			    0,     0,
+			Kt/Jm,     0
+		};
+		return Discretize(A, B, Ts);
+	}
+
+	//! @brief l軸目の2次ローパスフィルタを離散化する関数
+	//! @param[in]	l	軸番号
+	//! @return	{Ad, Bd} = {離散系A行列, 離散系B行列}
+	std::tuple<ArcsMat<2,2>, ArcsMat<2,1>> FilterModel(const size_t l){
+		const double w = 2.0*M_PI*100.0*(1.0 + 0.3*l), z = 0.7;	// [rad/s] 遮断周波数，減衰係数
+		const ArcsMat<2,2> A = {
+			   0,       1,
+			-w*w, -2*z*w
+		};
+		const ArcsMat<2,1> B = {
+			  0,
+			w*w
+		};
+		return Discretize(A, B, Ts);
+	}
+
+	//! @brief L軸分の状態空間モデルについて測定して表示する関数
+	//! @tparam	N, I, O, L	次数, 入力数, 出力数, 軸数
+	//! @param[in]	Name	モデルの名前
+	//! @param[in]	Model	l軸目の離散系 {Ad, Bd} を返す関数
+	//! @return	true = 出力が一致
+	template<size_t N, size_t I, size_t O, size_t L, typename F>
+	bool Benchmark(const char* Name, F&& Model){
+		static std::array<DiscStateSpace<N,I,O>, L> Sys;	// 軸ごとの状態空間モデル
+		static DiscStateSpaceBatch<N,I,O,L> Batch;			// 一括計算版
+		ArcsMat<O,N> C;		// 出力は状態の先頭 O 個
+		for(size_t i = 1; i <= O; ++i) C(i,i) = 1;
+		for(size_t l = 1; l <= L; ++l){
+			const auto [Ad, Bd] = Model(l);
+			Sys[l - 1].SetSystem(Ad, Bd, C);
+			Batch.SetSystem(l, Ad, Bd, C);
+		}
+
+		// 入力信号 (軸ごとに周波数の異なる正弦波, 正弦波の計算時間を含めないように予め表にしておく)
+		static std::array<ArcsMat<I,L>, KU> Utab;
+		for(size_t k = 0; k < KU; ++k){
+			for(size_t l = 1; l <= L; ++l){
+				for(size_t i = 1; i <= I; ++i) Utab[k](i,l) = std::sin(2.0*M_PI*(10.0*l + i)*Ts*static_cast<double>(k));
+			}
+		}
+
+		// 1. 軸ごとに計算する場合
+		ArcsMat<I,1> u;
+		ArcsMat<O,L> Y1, Y2;
+		double MaxDiff = 0;
+		std::array<ArcsMat<O,L>, K/KL> Log1;	// 一致確認用に間引いて記録
+		const auto Start1 = Clock::now();
+		for(size_t k = 0; k < K; ++k){
+			for(size_t l = 1; l <= L; ++l){
+				for(size_t i = 1; i <= I; ++i) u[i] = Utab[k % KU](i,l);
+				Sys[l - 1].SetInput(u);
+				Sys[l - 1].Update();
+				setcolumn(Y1, Sys[l - 1].GetOutput(), l);
+			}
+			if(k % KL == 0) Log1[k/KL] = Y1;
+			KeepAlive(Y1);
+		}
+		const double t1 = std::chrono::duration<double>(Clock::now() - Start1).count()/K*1e9;
+
+		// 2. 一括計算する場合
+		const auto Start2 = Clock::now();
+		for(size_t k = 0; k < K; ++k){
+			Batch.SetInputs(Utab[k % KU]);
+			Batch.Update();
+			Batch.GetOutputs(Y2);
+			if(k % KL == 0) MaxDiff = std::max(MaxDiff, max(abs(ArcsMat<O,L>(Y2 - Log1[k/KL]))));
+			KeepAlive(Y2);
+		}
+		const double t2 = std::chrono::duration<double>(Clock::now() - Start2).count()/K*1e9;
+		MaxDiff = std::max(MaxDiff, max(abs(ArcsMat<O,L>(Y2 - Y1))));
+
+		const bool Passed = MaxDiff == 0;
+		printf("%-13s %2zu axes : DiscStateSpace x %2zu %7.1f [ns/step], Batch %7.1f [ns/step] (x%4.1f, %5.1f [Maxis-step/s]), max diff %.1e %s\n",
+			Name, L, L, t1, t2, t1/t2, L/t2*1e3, MaxDiff, Passed ? "PASS" : "FAIL");
+		return Passed;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	bool Passed = true;
+	Passed &= Benchmark<3,2,3,6>("TwoInertia", TwoInertiaModel);
+	Passed &= Benchmark<3,2,3,12>("TwoInertia", TwoInertiaModel);
+	Passed &= Benchmark<2,1,1,6>("2nd-order LPF", FilterModel);
+	Passed &= Benchmark<2,1,1,12>("2nd-order LPF", FilterModel);
+	printf("Bitwise match : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
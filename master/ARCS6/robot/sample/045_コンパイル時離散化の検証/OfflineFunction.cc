@@ -0,0 +1,161 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par コンパイル時離散化の検証
+//! - 定数パラメータから作った2慣性系モデルの離散化と，3次バターワースフィルタの平衡化・リアプノフ方程式の解を
+//!   static constexpr としてコンパイル時に計算し，同じ計算を実行時に行った結果と許容値以内で一致することを確認する。
+//!   (コンパイル時の行列積はSIMDカーネルではなく素朴なループで計算するので，ビット単位では一致しない)
+//! - コンパイル時用の平方根と仮数部・指数部の分解関数が std::sqrt, std::frexp とビット単位で一致することも確認する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <cstring>
+#include <array>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "ArcsControl.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+using namespace ArcsControl;
+
+namespace {
+	constexpr double TOL = 1e-12;	//!< 相対誤差の許容値
+
+	// 2慣性系のパラメータ (ConstParams に書かれている定数を想定)
+	constexpr double Ts = 100e-6;				//!< [s] サンプリング周期
+	constexpr double Jl = 1e-3, Jm = 1e-4;		//!< [kgm^2] 負荷側慣性，モータ側慣性
+	constexpr double Dl = 1e-3, Dm = 2e-4;		//!< [Nm/(rad/s)] 粘性摩擦
+	constexpr double Ks = 50.0;					//!< [Nm/rad] ばね定数
+	constexpr double Kt = 0.2;					//!< [Nm/A] トルク定数
+
+	//! @brief 2慣性系の連続系A行列 (状態：負荷側速度，ねじれ角，モータ側速度)
+	constexpr ArcsMat<3,3> Ac = {
+		-Dl/Jl,  Ks/Jl,       0,
+		    -1,      0,       1,
+		     0, -Ks/Jm,  -Dm/Jm
+	};
+
+	//! @brief 2慣性系の連続系B行列 (入力：電流，負荷トルク)
+	constexpr ArcsMat<3,2> Bc = {
+		    0, -1/Jl,
+		    0,     0,
+		Kt/Jm,     0
+	};
+
+	//! @brief 2慣性系の連続系C行列 (出力：モータ側速度)
+	constexpr ArcsMat<1,3> Cc = {0, 0, 1};
+
+	// 3次バターワースフィルタのパラメータ (実際の遮断周波数のままだと要素の桁が大きく離れて条件数が悪くなり，
+	// 積和の丸めの違いが拡大されて比較にならないので，遮断周波数で正規化する)
+	constexpr double wf = 1;	//!< 正規化遮断周波数
+
+	//! @brief 3次バターワースフィルタの連続系A行列 (可制御正準形)
+	constexpr ArcsMat<3,3> Af = {
+		        0,         1,      0,
+		        0,         0,      1,
+		-wf*wf*wf, -2*wf*wf,  -2*wf
+	};
+
+	//! @brief 3次バターワースフィルタの連続系B行列
+	constexpr ArcsMat<3,1> Bf = {0, 0, wf*wf*wf};
+
+	//! @brief 3次バターワースフィルタの連続系C行列
+	constexpr ArcsMat<1,3> Cf = {1, 0, 0};
+
+	// コンパイル時に計算する行列
+	static constexpr auto AdBd = Discretize(Ac, Bc, Ts);				//!< 離散化
+	static constexpr auto AbBbCb = BalanceReal(Af, Bf, Cf);				//!< 平衡化
+	static constexpr auto Wc = Lyapunov(Af, ArcsMat<3,3>(Bf*~Bf));		//!< 可制御グラミアン
+
+	//! @brief コンパイル時用の関数を確認する入力値 (正規化数，非正規化数，2の冪乗，境界値)
+	constexpr std::array<double, 16> Inputs = {
+		2.0, 3.0, 0.5, 1e-300, 1e300, 4.9406564584124654e-324, 2.2250738585072014e-308, 1.7976931348623157e308,
+		0.1, 123456.789, 1.0000000000000002, 0.9999999999999999, 6.02214076e23, 1.602176634e-19, 0.25, 7.0
+	};
+
+	//! @brief コンパイル時に平方根を計算した表を返す関数
+	//! @return	平方根の表
+	constexpr std::array<double, 16> ConstSqrtTable(void){
+		std::array<double, 16> ret = {};
+		for(size_t i = 0; i < Inputs.size(); ++i) ret[i] = ArcsMatrixMath::Sqrt(Inputs[i]);
+		return ret;
+	}
+
+	//! @brief コンパイル時に仮数部と指数部を計算した表を返す関数
+	//! @return	{仮数部の表, 指数部の表}
+	constexpr std::tuple<std::array<double, 16>, std::array<int, 16>> ConstFrexpTable(void){
+		std::array<double, 16> m = {};
+		std::array<int, 16> e = {};
+		for(size_t i = 0; i < Inputs.size(); ++i) m[i] = ArcsMatrixMath::Frexp(Inputs[i], &e[i]);
+		return {m, e};
+	}
+
+	//! @brief 相対誤差 |X - Y|/|Y| を返す関数
+	template<size_t M, size_t N>
+	double RelErr(const ArcsMat<M,N>& X, const ArcsMat<M,N>& Y){
+		return norm<NormType::AMT_L1>(ArcsMat<M,N>(X - Y))/norm<NormType::AMT_L1>(Y);
+	}
+
+	//! @brief 実数がビット単位で一致するかを返す関数
+	bool BitEqual(const double x, const double y){
+		return std::memcmp(&x, &y, sizeof(double)) == 0;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	bool Passed = true;
+
+	// 1. 実行時に同じ計算をする (volatile を経由して定数畳み込みされないようにする)
+	volatile double Tsv = Ts;
+	const auto [Ad, Bd] = Discretize(Ac, Bc, Tsv);
+	const auto [Ab, Bb, Cb] = BalanceReal(Af, Bf, Cf);
+	const auto Wr = Lyapunov(Af, ArcsMat<3,3>(Bf*~Bf));
+
+	// 2. コンパイル時と実行時の結果を比較
+	const double e1 = RelErr(std::get<0>(AdBd), Ad), e2 = RelErr(std::get<1>(AdBd), Bd);
+	const double e3 = RelErr(std::get<0>(AbBbCb), Ab), e4 = RelErr(std::get<1>(AbBbCb), Bb), e5 = RelErr(std::get<2>(AbBbCb), Cb);
+	const double e6 = RelErr(Wc, Wr);
+	printf("Discretize  : Ad err. %.1e, Bd err. %.1e\n", e1, e2);
+	printf("BalanceReal : Ab err. %.1e, Bb err. %.1e, Cb err. %.1e\n", e3, e4, e5);
+	printf("Lyapunov    : Wc err. %.1e\n", e6);
+	Passed &= e1 <= TOL && e2 <= TOL && e3 <= TOL && e4 <= TOL && e5 <= TOL && e6 <= TOL;
+	dispf(std::get<0>(AdBd), "% 16.8e");
+	dispf(std::get<1>(AdBd), "% 16.8e");
+
+	// 3. コンパイル時用の平方根，仮数部と指数部の分解の確認
+	static constexpr auto Sq = ConstSqrtTable();
+	static constexpr auto Fr = ConstFrexpTable();
+	size_t Mismatch = 0;
+	for(size_t i = 0; i < Inputs.size(); ++i){
+		int e = 0;
+		const double m = std::frexp(Inputs[i], &e);
+		if(!BitEqual(Sq[i], std::sqrt(Inputs[i]))) ++Mismatch;
+		if(!BitEqual(std::get<0>(Fr)[i], m) || std::get<1>(Fr)[i] != e) ++Mismatch;
+	}
+	printf("Sqrt/Frexp  : %zu mismatches in %zu inputs\n", Mismatch, Inputs.size());
+	Passed &= Mismatch == 0;
+
+	printf("Compile-time check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
@@ -0,0 +1,232 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par 伝達関数の実現形式の消費時間と精度の比較
+//! - D次のバターワースローパスフィルタ(D = 2～10)を双一次変換で離散化し，
+//!   DiscTransFunc(可制御正準系), DiscTransFuncTDF2(転置直接形II型), DiscBiquadCascade(2次セクション縦続形)の
+//!   1サンプルあたりの消費時間と，long double で計算した2次セクション縦続形に対する誤差を比較する。
+//! - 遮断周波数がサンプリング周波数に比べて低いほど，分母多項式の係数で表す形式は誤差が大きくなる。
+//! - 多チャネルのフィルタについて，DiscBiquadCascadeBatch の倍精度版と単精度版の消費時間も比較する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <array>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "ArcsControl.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+using namespace ArcsControl;
+
+namespace {
+	constexpr double Ts = 100e-6;	//!< [s] サンプリング周期
+	constexpr size_t K = 200000;	//!< 計算するサンプル数
+	constexpr size_t KU = 1000;		//!< 入力信号の表の長さ
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 最適化で計算が消されないようにする関数
+	//! @param[in]	x	対象の変数
+	template<typename T>
+	inline void KeepAlive(T& x){
+		asm volatile("" : : "g"(&x) : "memory");
+	}
+
+	//! @brief D次のバターワースローパスフィルタを双一次変換で離散化した2次セクション行列を返す関数
+	//! @param[in]	fc	[Hz] 遮断周波数
+	//! @return	2次セクション行列 (i行目が i番目のセクションの係数 [b0 b1 b2 a0 a1 a2], 奇数次の最後は1次)
+	template<size_t D>
+	ArcsMat<(D + 1)/2, 6> Butterworth(const double fc){
+		constexpr size_t S = (D + 1)/2;
+		const double wc = 2.0*M_PI*fc;
+		ArcsMat<S,6> SOS;
+		for(size_t i = 1; i <= S; ++i){
+			ArcsMat<3,1> Num = {0, 0, wc*wc}, Den = {1, 2.0*std::sin((2.0*i - 1.0)*M_PI/(2.0*D))*wc, wc*wc};
+			if(D % 2 == 1 && i == S){
+				Num = {0, 0, wc};	// 奇数次の場合の1次のセクション
+				Den = {0, 1, wc};
+			}
+			const auto [b, a] = BilinearSection(Num, Den, Ts, wc);	// 遮断周波数でプリワーピング
+			for(size_t j = 1; j <= 3; ++j){
+				SOS(i,j) = b[j];
+				SOS(i,j + 3) = a[j];
+			}
+		}
+		return SOS;
+	}
+
+	//! @brief 2次セクション行列を展開して z^-1 の多項式の係数ベクトル {c0, c1, ..., cD} を返す関数
+	//! @param[in]	SOS	2次セクション行列
+	//! @param[in]	Col	分子なら1，分母なら4
+	//! @return	係数ベクトル
+	template<size_t D, size_t S>
+	ArcsMat<D + 1,1> Expand(const ArcsMat<S,6>& SOS, const size_t Col){
+		std::array<double, 2*S + 1> c = {1};
+		for(size_t i = 1; i <= S; ++i){
+			std::array<double, 2*S + 1> d = {};
+			for(size_t k = 0; k + 2 < 2*S + 1; ++k){
+				for(size_t j = 0; j < 3; ++j) d[k + j] += c[k]*SOS(i,Col + j);
+			}
+			c = d;
+		}
+		ArcsMat<D + 1,1> ret;
+		for(size_t k = 0; k <= D; ++k) ret[k + 1] = c[k];	// 奇数次の場合は最後の係数が零なので捨てる
+		return ret;
+	}
+
+	//! @brief 入力1サンプルごとに Func を呼んで，消費時間と基準出力に対する最大誤差を返す関数
+	//! @param[in]	Utab	入力信号の表
+	//! @param[in]	Yref	基準出力
+	//! @param[in]	Func	入力から出力を返す関数
+	//! @return	{[ns] 1サンプルあたりの消費時間, 最大誤差}
+	template<typename F>
+	std::tuple<double, double> Measure(const std::array<double, KU>& Utab, const std::array<long double, K>& Yref, F&& Func){
+		static std::array<double, K> Y;
+		const auto Start = Clock::now();
+		for(size_t k = 0; k < K; ++k){
+			Y[k] = Func(Utab[k % KU]);
+			KeepAlive(Y[k]);
+		}
+		const double t = std::chrono::duration<double>(Clock::now() - Start).count()/K*1e9;
+		long double e = 0;
+		for(size_t k = 0; k < K; ++k) e = std::isfinite(Y[k]) ? std::max(e, std::abs(Y[k] - Yref[k])) : INFINITY;
+		return {t, static_cast<double>(e)};
+	}
+
+	//! @brief D次のバターワースローパスフィルタについて3つの実現形式を比較して表示する関数
+	//! @param[in]	fc	[Hz] 遮断周波数
+	//! @param[in]	Utab	入力信号の表
+	//! @return	true = 2次セクション縦続形の誤差が許容値以内
+	template<size_t D>
+	bool Benchmark(const double fc, const std::array<double, KU>& Utab){
+		constexpr size_t S = (D + 1)/2;
+		const auto SOS = Butterworth<D>(fc);
+		const auto Num = Expand<D>(SOS, 1), Den = Expand<D>(SOS, 4);
+
+		// 基準出力 (long double の2次セクション縦続形)
+		static std::array<long double, K> Yref;
+		DiscBiquadCascade<S, long double> Ref(SOS);
+		for(size_t k = 0; k < K; ++k) Yref[k] = Ref.GetResponse(Utab[k % KU]);
+
+		DiscTransFunc<D,D> Sys1(Num, Den);
+		DiscTransFuncTDF2<D,D> Sys2(Num, Den);
+		DiscBiquadCascade<S> Sys3(SOS);
+		const auto [t1, e1] = Measure(Utab, Yref, [&](const double u){ return Sys1.GetResponse(u); });
+		const auto [t2, e2] = Measure(Utab, Yref, [&](const double u){ return Sys2.GetResponse(u); });
+		const auto [t3, e3] = Measure(Utab, Yref, [&](const double u){ return Sys3.GetResponse(u); });
+		printf("D = %2zu : DiscTransFunc %6.1f [ns] (err. %7.1e), TDF2 %5.1f [ns] (x%4.1f, err. %7.1e), Biquad %5.1f [ns] (x%4.1f, err. %7.1e)\n",
+			D, t1, e1, t2, t1/t2, e2, t3, t1/t3, e3);
+		return e3 <= 1e-10;
+	}
+
+	//! @brief L チャネル分の4次のフィルタについて，一括計算の倍精度版と単精度版を比較して表示する関数
+	//! @param[in]	Utab	入力信号の表
+	//! @return	true = 出力が許容値以内で一致
+	template<size_t L>
+	bool BenchmarkBatch(const std::array<double, KU>& Utab){
+		constexpr size_t S = 2;
+		static std::array<DiscBiquadCascade<S>, L> Sys;
+		static DiscBiquadCascadeBatch<S,L> Batch;
+		static DiscBiquadCascadeBatch<S,L,float> BatchF;
+		for(size_t l = 1; l <= L; ++l){
+			const auto SOS = Butterworth<4>(50.0 + 20.0*l);	// チャネルごとに遮断周波数を変える
+			Sys[l - 1].SetSystem(SOS);
+			Batch.SetSystem(l, SOS);
+			BatchF.SetSystem(l, SOS);
+		}
+
+		// チャネルごとに位相をずらした入力信号 (入力の並べ替えの時間を含めないように予め表にしておく)
+		static std::array<ArcsMat<L,1>, KU> Uch;
+		static std::array<ArcsMat<L,1,float>, KU> Uchf;	// 単精度版は入出力も単精度にして変換を省く
+		for(size_t k = 0; k < KU; ++k){
+			for(size_t l = 1; l <= L; ++l){
+				Uch[k][l] = Utab[(k + 17*l) % KU];
+				Uchf[k][l] = static_cast<float>(Uch[k][l]);
+			}
+		}
+
+		ArcsMat<L,1> Y1, Y2;
+		ArcsMat<L,1,float> Y3;
+		double e2 = 0, e3 = 0;
+		const auto Start1 = Clock::now();
+		for(size_t k = 0; k < K; ++k){
+			const auto& u = Uch[k % KU];
+			for(size_t l = 1; l <= L; ++l) Y1[l] = Sys[l - 1].GetResponse(u[l]);
+			KeepAlive(Y1);
+		}
+		const double t1 = std::chrono::duration<double>(Clock::now() - Start1).count()/K*1e9;
+		const auto Start2 = Clock::now();
+		for(size_t k = 0; k < K; ++k){
+			Batch.SetInputs(Uch[k % KU]);
+			Batch.Update();
+			Batch.GetOutputs(Y2);
+			KeepAlive(Y2);
+		}
+		const double t2 = std::chrono::duration<double>(Clock::now() - Start2).count()/K*1e9;
+		const auto Start3 = Clock::now();
+		for(size_t k = 0; k < K; ++k){
+			BatchF.SetInputs(Uchf[k % KU]);
+			BatchF.Update();
+			BatchF.GetOutputs(Y3);
+			KeepAlive(Y3);
+		}
+		const double t3 = std::chrono::duration<double>(Clock::now() - Start3).count()/K*1e9;
+		e2 = max(abs(ArcsMat<L,1>(Y2 - Y1)));
+		for(size_t l = 1; l <= L; ++l) e3 = std::max(e3, std::abs(Y3[l] - Y1[l]));
+
+		printf("L = %2zu : Biquad x %2zu %6.1f [ns/step], Batch(double) %5.1f [ns/step] (x%4.1f, err. %7.1e), Batch(float) %5.1f [ns/step] (x%4.1f, err. %7.1e)\n",
+			L, L, t1, t2, t1/t2, e2, t3, t1/t3, e3);
+		return e2 <= 1e-12 && e3 <= 1e-4;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	// 入力信号 (複数の周波数を含む信号, 計算時間を含めないように予め表にしておく)
+	std::array<double, KU> Utab;
+	for(size_t k = 0; k < KU; ++k){
+		const double t = Ts*static_cast<double>(k);
+		Utab[k] = std::sin(2.0*M_PI*10.0*t) + 0.5*std::sin(2.0*M_PI*230.0*t) + 0.2*std::sin(2.0*M_PI*1700.0*t);
+	}
+
+	bool Passed = true;
+	for(const double fc : {500.0, 10.0}){
+		printf("Butterworth LPF, fc = %.0f [Hz], Ts = %.0f [us]\n", fc, Ts*1e6);
+		Passed &= Benchmark<2>(fc, Utab);
+		Passed &= Benchmark<3>(fc, Utab);
+		Passed &= Benchmark<4>(fc, Utab);
+		Passed &= Benchmark<5>(fc, Utab);
+		Passed &= Benchmark<6>(fc, Utab);
+		Passed &= Benchmark<7>(fc, Utab);
+		Passed &= Benchmark<8>(fc, Utab);
+		Passed &= Benchmark<9>(fc, Utab);
+		Passed &= Benchmark<10>(fc, Utab);
+	}
+	printf("4th-order Butterworth LPF, multi-channel\n");
+	Passed &= BenchmarkBatch<8>(Utab);
+	Passed &= BenchmarkBatch<16>(Utab);
+	Passed &= BenchmarkBatch<32>(Utab);
+	Passed &= BenchmarkBatch<64>(Utab);
+	printf("Accuracy check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
@@ -0,0 +1,148 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par 移動窓演算の消費時間と精度の確認
+//! - 窓の長さ N = 10～10000 について，リングバッファの中身を毎回全部足す従来の移動平均と，
+//!   窓内の総和を差分で更新する MovingAverage (SlidingSum) の1サンプルあたりの消費時間と誤差を比較する。
+//! - 同様に，窓内を毎回全部走査する最小値・最大値と，単調両端キューの SlidingMinMax を比較する。
+//! - 直流成分の大きな信号を長時間入力して，差分だけで更新した総和の誤差が蓄積していくのに対し，
+//!   SlidingSum の誤差は頭打ちになることを確認する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <array>
+#include <algorithm>
+
+// 追加のARCSライブラリをここに記述
+#include "RingBuffer.hh"
+#include "Statistics.hh"
+#include "MovingAverage.hh"
+#include "SlidingWindow.hh"
+
+using namespace ARCS;
+
+namespace {
+	constexpr size_t K = 100000;	//!< 計算するサンプル数
+	constexpr size_t KU = 1000;		//!< 入力信号の表の長さ
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 最適化で計算が消されないようにする関数
+	//! @param[in]	x	対象の変数
+	template<typename T>
+	inline void KeepAlive(T& x){
+		asm volatile("" : : "g"(&x) : "memory");
+	}
+
+	//! @brief 入力1サンプルごとに Func を呼んで，1サンプルあたりの消費時間を返す関数
+	//! @param[in]	Utab	入力信号の表
+	//! @param[out]	Y		出力
+	//! @param[in]	Func	入力から出力を返す関数
+	//! @return	[ns] 1サンプルあたりの消費時間
+	template<typename F>
+	double Measure(const std::array<double, KU>& Utab, std::array<double, K>& Y, F&& Func){
+		const auto Start = Clock::now();
+		for(size_t k = 0; k < K; ++k){
+			Y[k] = Func(Utab[k % KU]);
+			KeepAlive(Y[k]);
+		}
+		return std::chrono::duration<double>(Clock::now() - Start).count()/K*1e9;
+	}
+
+	//! @brief 窓の長さ N について従来版と O(1) 版を比較して表示する関数
+	//! @param[in]	Utab	入力信号の表
+	//! @return	true = 結果が許容値以内で一致
+	template<size_t N>
+	bool Benchmark(const std::array<double, KU>& Utab){
+		static std::array<double, K> Y1, Y2, Y3, Y4;
+		static RingBuffer<double, N, false> Ring1, Ring2;
+		static MovingAverage<N> Ave;
+		static SlidingMinMax<N> MinMax;
+
+		// 移動平均
+		const double t1 = Measure(Utab, Y1, [&](const double u){
+			Ring1.SetFirstValue(u);
+			return Statistics::Mean(Ring1.Buffer);	// 従来版：窓内を毎回全部足す
+		});
+		const double t2 = Measure(Utab, Y2, [&](const double u){ return Ave.GetSignal(u); });
+
+		// 移動最小値・最大値 (最小値と最大値の和を出力にして両方とも計算させる)
+		const double t3 = Measure(Utab, Y3, [&](const double u){
+			Ring2.SetFirstValue(u);
+			const auto [Min, Max] = std::minmax_element(Ring2.Buffer.begin(), Ring2.Buffer.end());	// 従来版：窓内を毎回全部走査
+			return *Min + *Max;
+		});
+		const double t4 = Measure(Utab, Y4, [&](const double u){
+			MinMax.Push(u);
+			return MinMax.GetMin() + MinMax.GetMax();
+		});
+
+		double e2 = 0, e4 = 0;
+		for(size_t k = 0; k < K; ++k){
+			e2 = std::max(e2, std::abs(Y2[k] - Y1[k]));
+			e4 = std::max(e4, std::abs(Y4[k] - Y3[k]));
+		}
+		printf("N = %5zu : Mean %8.1f -> %4.1f [ns] (x%6.1f, err. %7.1e), Min/Max %8.1f -> %4.1f [ns] (x%6.1f, err. %7.1e)\n",
+			N, t1, t2, t1/t2, e2, t3, t4, t3/t4, e4);
+		return e2 <= 1e-12 && e4 == 0;
+	}
+
+	//! @brief 直流成分の大きな信号を長時間入力したときの総和の誤差の蓄積を確認する関数
+	//! @return	true = 誤差が許容値以内
+	bool DriftCheck(void){
+		constexpr size_t N = 1000;			//!< 窓の長さ
+		constexpr size_t KD = 10000000;		//!< 入力するサンプル数
+		static SlidingWindow<double, N> Window;
+		static SlidingSum<N> Sum;
+		double Naive = 0;	// 差分だけで更新した総和
+		for(size_t k = 0; k < KD; ++k){
+			const double u = 1e4 + std::sin(0.001*static_cast<double>(k)) + 1e-3*static_cast<double>(k % 7);
+			Naive += u - Window.Push(u);
+			Sum.Push(u);
+		}
+		long double Exact = 0;	// 窓内を長倍精度で足し直した総和
+		for(const double v : Window.GetBuffer()) Exact += v;
+		const double e1 = static_cast<double>(std::abs(Naive - Exact)/Exact);
+		const double e2 = static_cast<double>(std::abs(Sum.GetSum() - Exact)/Exact);
+		printf("Drift after %zu samples (N = %zu) : running sum err. %7.1e, SlidingSum err. %7.1e\n", KD, N, e1, e2);
+		return e2 <= 1e-15;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	// 入力信号 (計算時間を含めないように予め表にしておく)
+	std::array<double, KU> Utab;
+	for(size_t k = 0; k < KU; ++k){
+		const double t = static_cast<double>(k)/KU;
+		Utab[k] = std::sin(2.0*M_PI*3.0*t) + 0.3*std::sin(2.0*M_PI*47.0*t);
+	}
+
+	bool Passed = true;
+	Passed &= Benchmark<10>(Utab);
+	Passed &= Benchmark<100>(Utab);
+	Passed &= Benchmark<1000>(Utab);
+	Passed &= Benchmark<10000>(Utab);
+	Passed &= DriftCheck();
+	printf("Accuracy check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
+
@@ -0,0 +1,147 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par 遅延線の消費時間と精度の確認
+//! - 従来の TimeDelay と DelayLine の整数遅延が同じ出力になることを確認し，消費時間を比較する。
+//! - 端数の遅延について，ラグランジュ補間とティラン補間の正弦波に対する誤差と消費時間を比較する。
+//! - ブロック処理版 GetSignals が1サンプルずつの GetSignal とビット単位で一致することを確認し，消費時間を比較する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <cstring>
+#include <chrono>
+#include <array>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "TimeDelay.hh"
+#include "DelayLine.hh"
+
+using namespace ARCS;
+
+namespace {
+	constexpr size_t C = 1000;		//!< [サンプル] 最大遅延時間
+	constexpr size_t K = 200000;	//!< 計算するサンプル数
+	constexpr size_t KB = 1000;		//!< ブロック処理の1ブロックのサンプル数
+	constexpr double W = 0.05;		//!< [rad/サンプル] 確認用の正弦波の角周波数
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 最適化で計算が消されないようにする関数
+	//! @param[in]	x	対象の変数
+	template<typename T>
+	inline void KeepAlive(T& x){
+		asm volatile("" : : "g"(&x) : "memory");
+	}
+
+	//! @brief 入力1サンプルごとに Func を呼んで，1サンプルあたりの消費時間を返す関数
+	//! @param[in]	U	入力信号
+	//! @param[out]	Y	出力信号
+	//! @param[in]	Func	入力から出力を返す関数
+	//! @return	[ns] 1サンプルあたりの消費時間
+	template<typename F>
+	double Measure(const std::array<double, K>& U, std::array<double, K>& Y, F&& Func){
+		const auto Start = Clock::now();
+		for(size_t k = 0; k < K; ++k){
+			Y[k] = Func(U[k]);
+			KeepAlive(Y[k]);
+		}
+		return std::chrono::duration<double>(Clock::now() - Start).count()/K*1e9;
+	}
+
+	//! @brief 正弦波入力に対する出力の，理論値 sin(W*(k - D)) に対する最大誤差を返す関数 (初期の過渡は除く)
+	//! @param[in]	Y	出力信号
+	//! @param[in]	D	[サンプル] 遅延時間
+	//! @return	最大誤差
+	double SineError(const std::array<double, K>& Y, const double D){
+		double e = 0;
+		for(size_t k = 2*C; k < K; ++k) e = std::max(e, std::abs(Y[k] - std::sin(W*(static_cast<double>(k) - D))));
+		return e;
+	}
+
+	//! @brief 2つの出力がビット単位で一致するかを返す関数
+	bool BitEqual(const std::array<double, K>& Y1, const std::array<double, K>& Y2){
+		return std::memcmp(Y1.data(), Y2.data(), sizeof(Y1)) == 0;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	static std::array<double, K> U, Y1, Y2, Y3;
+	for(size_t k = 0; k < K; ++k) U[k] = std::sin(W*static_cast<double>(k));
+	Y1.fill(0);	// 初回アクセスのページフォールトを計測に含めないように先に触っておく
+	Y2.fill(0);
+	Y3.fill(0);
+	bool Passed = true;
+
+	// 1. 整数遅延 (従来の TimeDelay との比較)
+	{
+		constexpr size_t D = 700;
+		TimeDelay Old(C + 1);
+		static DelayLine<C> New;
+		Old.SetDelayTime(D);
+		New.SetDelayTime(D);
+		const double t1 = Measure(U, Y1, [&](const double u){ return Old.GetSignal(u); });
+		const double t2 = Measure(U, Y2, [&](const double u){ return New.GetSignal(u); });
+		const bool Same = BitEqual(Y1, Y2);
+		printf("Integer delay %zu : TimeDelay %5.2f [ns], DelayLine %5.2f [ns] (x%4.2f), %s\n", D, t1, t2, t1/t2, Same ? "identical" : "MISMATCH");
+		Passed &= Same;
+	}
+
+	// 2. 端数の遅延 (ラグランジュ補間とティラン補間)
+	for(const double D : {1.5, 12.25, 700.7}){
+		static DelayLine<C> Lag;
+		static DelayLine<C, DelayInterp::DLY_THIRAN> Thi;
+		Lag.ClearDelayMemory();
+		Thi.ClearDelayMemory();
+		Lag.SetDelay(D);
+		Thi.SetDelay(D);
+		const double t1 = Measure(U, Y1, [&](const double u){ return Lag.GetSignal(u); });
+		const double t2 = Measure(U, Y2, [&](const double u){ return Thi.GetSignal(u); });
+		const double e1 = SineError(Y1, D), e2 = SineError(Y2, D);
+		printf("Fractional delay %6.2f : Lagrange %5.2f [ns] (err. %7.1e), Thiran %5.2f [ns] (err. %7.1e)\n", D, t1, e1, t2, e2);
+		Passed &= e1 < 1e-5 && e2 < 1e-4;
+	}
+
+	// 3. ブロック処理 (1サンプルずつの結果とビット単位で一致すること)
+	for(const double D : {700.0, 700.7}){
+		static DelayLine<C> Single, Block;
+		static ArcsMat<KB,1> Ub, Yb;
+		Single.ClearDelayMemory();
+		Block.ClearDelayMemory();
+		Single.SetDelay(D);
+		Block.SetDelay(D);
+		const double t1 = Measure(U, Y1, [&](const double u){ return Single.GetSignal(u); });
+		const auto Start = Clock::now();
+		for(size_t k0 = 0; k0 < K; k0 += KB){
+			std::memcpy(&Ub(1,1), &U[k0], sizeof(double)*KB);
+			Block.GetSignals(Ub, Yb);
+			std::memcpy(&Y3[k0], &Yb(1,1), sizeof(double)*KB);
+		}
+		const double t2 = std::chrono::duration<double>(Clock::now() - Start).count()/K*1e9;
+		const bool Same = BitEqual(Y1, Y3);
+		printf("Block processing %6.2f : GetSignal %5.2f [ns], GetSignals %5.2f [ns] (x%4.2f), %s\n", D, t1, t2, t1/t2, Same ? "identical" : "MISMATCH");
+		Passed &= Same;
+	}
+
+	printf("Accuracy check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
+
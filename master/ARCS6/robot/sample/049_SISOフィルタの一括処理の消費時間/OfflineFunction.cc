@@ -0,0 +1,146 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par SISOフィルタの一括処理の消費時間と一致の確認
+//! - LowPassFilter, HighPassFilter, Differentiator, NotchFilter, PhaseLeadLag, Integrator などについて，
+//!   1サンプルずつの GetSignal と一括処理の GetSignals の消費時間を比較する。
+//! - 一括処理の出力と処理後の状態変数が，1サンプルずつ処理した場合とビット単位で一致することを確認する。
+//!   (途中で区切って2回に分けた場合と，入出力に同じ配列を渡した場合も確認する)
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <cstring>
+#include <chrono>
+#include <array>
+
+// 追加のARCSライブラリをここに記述
+#include "LowPassFilter.hh"
+#include "HighPassFilter.hh"
+#include "Differentiator.hh"
+#include "NotchFilter.hh"
+#include "PhaseLeadLag.hh"
+#include "LowPassFilter2.hh"
+#include "HighPassFilter2.hh"
+#include "Differentiator2.hh"
+#include "Integrator.hh"
+#include "Integrator2.hh"
+
+using namespace ARCS;
+
+namespace {
+	constexpr double Ts = 100e-6;	//!< [s] サンプリング周期
+	constexpr size_t K = 1000000;	//!< 計算するサンプル数
+	constexpr size_t KS = 12345;	//!< 一括処理を2回に分けるときの区切り
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 最適化で計算が消されないようにする関数
+	//! @param[in]	x	対象の変数
+	template<typename T>
+	inline void KeepAlive(T& x){
+		asm volatile("" : : "g"(&x) : "memory");
+	}
+
+	//! @brief 1つのフィルタについて1サンプルずつの処理と一括処理を比較して表示する関数
+	//! @param[in]	Name	フィルタの名前
+	//! @param[in]	U		入力信号
+	//! @param[in]	Sys1	1サンプルずつ処理するフィルタ
+	//! @param[in]	Sys2	一括処理するフィルタ
+	//! @param[in]	Sys3	入出力に同じ配列を渡して一括処理するフィルタ
+	//! @return	true = ビット単位で一致
+	template<typename F>
+	bool Benchmark(const char* Name, const std::array<double, K>& U, F& Sys1, F& Sys2, F& Sys3){
+		static std::array<double, K> Y1, Y2, Y3;
+		Y1.fill(0);	// 初回アクセスのページフォールトを計測に含めないように先に触っておく
+		Y2.fill(0);
+		const auto Start1 = Clock::now();
+		for(size_t k = 0; k < K; ++k){
+			Y1[k] = Sys1.GetSignal(U[k]);
+			KeepAlive(Y1[k]);
+		}
+		const double t1 = std::chrono::duration<double>(Clock::now() - Start1).count()/K*1e9;
+		const auto Start2 = Clock::now();
+		Sys2.GetSignals(U.data(), Y2.data(), KS);				// 途中で区切って2回に分けても
+		Sys2.GetSignals(U.data() + KS, Y2.data() + KS, K - KS);	// 状態変数が引き継がれること
+		KeepAlive(Y2);
+		const double t2 = std::chrono::duration<double>(Clock::now() - Start2).count()/K*1e9;
+		Y3 = U;
+		Sys3.GetSignals(Y3.data(), Y3.data(), K);	// 入出力に同じ配列
+		const bool Same = std::memcmp(Y1.data(), Y2.data(), sizeof(Y1)) == 0 && std::memcmp(Y1.data(), Y3.data(), sizeof(Y1)) == 0
+			&& Sys1.GetSignal(1.0) == Sys2.GetSignal(1.0);	// 処理後の状態変数も一致すること
+		printf("%-24s : GetSignal %5.2f [ns], GetSignals %5.2f [ns] (x%4.1f), %s\n", Name, t1, t2, t1/t2, Same ? "identical" : "MISMATCH");
+		return Same;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	// 入力信号 (計算時間を含めないように予め計算しておく)
+	static std::array<double, K> U;
+	for(size_t k = 0; k < K; ++k){
+		const double t = Ts*static_cast<double>(k);
+		U[k] = std::sin(2.0*M_PI*3.0*t) + 0.3*std::sin(2.0*M_PI*470.0*t) + (k % 10000 == 0 ? 1.0 : 0.0);
+	}
+
+	bool Passed = true;
+	{
+		LowPassFilter a(300, Ts), b(300, Ts), c(300, Ts);
+		Passed &= Benchmark("LowPassFilter", U, a, b, c);
+	}
+	{
+		HighPassFilter a(300, Ts), b(300, Ts), c(300, Ts);
+		Passed &= Benchmark("HighPassFilter", U, a, b, c);
+	}
+	{
+		Differentiator a(1000, Ts), b(1000, Ts), c(1000, Ts);
+		Passed &= Benchmark("Differentiator", U, a, b, c);
+	}
+	{
+		NotchFilter a(2000, 0.7, Ts), b(2000, 0.7, Ts), c(2000, 0.7, Ts);
+		Passed &= Benchmark("NotchFilter", U, a, b, c);
+	}
+	{
+		PhaseLeadLag a(500, 3, Ts), b(500, 3, Ts), c(500, 3, Ts);
+		Passed &= Benchmark("PhaseLeadLag", U, a, b, c);
+	}
+	{
+		LowPassFilter2 a(300, 0.7, Ts), b(300, 0.7, Ts), c(300, 0.7, Ts);
+		Passed &= Benchmark("LowPassFilter2", U, a, b, c);
+	}
+	{
+		HighPassFilter2 a(300, 0.7, Ts), b(300, 0.7, Ts), c(300, 0.7, Ts);
+		Passed &= Benchmark("HighPassFilter2", U, a, b, c);
+	}
+	{
+		Differentiator2 a(1000, 0.7, Ts), b(1000, 0.7, Ts), c(1000, 0.7, Ts);
+		Passed &= Benchmark("Differentiator2", U, a, b, c);
+	}
+	{
+		Integrator<IntegralType::TRAPEZOIDAL> a(Ts), b(Ts), c(Ts);
+		Passed &= Benchmark("Integrator (trapezoidal)", U, a, b, c);
+	}
+	{
+		Integrator2 a(Ts), b(Ts), c(Ts);
+		Passed &= Benchmark("Integrator2", U, a, b, c);
+	}
+	printf("Bit-equality check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
+
@@ -0,0 +1,220 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par カスケード制御の消費時間と動作の確認
+//! - 軸数 N = 1～16 について，軸ごとに Limiter と PIcontroller(リミット偏差フィードバック版) を組み合わせた従来の書き方と，
+//!   CascadedServoLoop の1軸あたりの消費時間を比較する。CascadedServoLoop は，軸ごとにフィードバック値を設定して
+//!   1軸版の Update を呼ぶ場合と，ベクトルでまとめて設定して全軸を1本のループで計算する場合の両方を測る。
+//! - 電流が飽和する位置決めを慣性負荷で模擬して，両者の応答が一致することと，
+//!   アンチワインドアップによって行き過ぎが減ることを確認する。
+//! - 無効から有効に切り替えたときに電流指令が跳ばないこと(バンプレス切り替え)を確認する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <array>
+#include <vector>
+#include <algorithm>
+
+// 追加のARCSライブラリをここに記述
+#include "Limiter.hh"
+#include "PIcontroller.hh"
+#include "CascadedServoLoop.hh"
+
+using namespace ARCS;
+
+namespace {
+	constexpr double Ts = 125e-6;	//!< [s] 制御周期
+	constexpr double Kpp = 50;		//!< [1/s] 位置比例ゲイン
+	constexpr double Kvp = 0.2;		//!< 速度比例ゲイン
+	constexpr double Kvi = 8;		//!< 速度積分ゲイン
+	constexpr double Vmax = 100;	//!< [rad/s] 速度指令のリミット
+	constexpr double Imax = 3;		//!< [A] 電流指令のリミット
+	constexpr double Kt = 0.1;		//!< [Nm/A] トルク定数
+	constexpr double Jm = 1e-4;		//!< [kgm^2] 慣性
+	constexpr size_t K = 100000;	//!< 計算するサンプル数
+	constexpr size_t KU = 1000;		//!< 入力信号の表の長さ
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 最適化で計算が消されないようにする関数
+	//! @param[in]	x	対象の変数
+	template<typename T>
+	inline void KeepAlive(T& x){
+		asm volatile("" : : "g"(&x) : "memory");
+	}
+
+	//! @brief 従来の書き方による1軸分のカスケード制御器
+	struct Conventional {
+		PIcontroller<> PI{Kvp, Kvi, Ts};	//!< 速度制御器
+		double v = 0;	//!< リミット前の電流指令
+		double u = 0;	//!< リミット後の電流指令
+
+		//! @brief 電流指令を計算する関数
+		double GetSignal(const double PosRef, const double Theta, const double Omega){
+			const double wr = Limiter(Kpp*(PosRef - Theta), Vmax);
+			v = PI.GetSignal(wr - Omega, v, u);
+			u = Limiter(v, Imax);
+			return u;
+		}
+	};
+
+	//! @brief 軸数 N について従来の書き方と CascadedServoLoop の消費時間を比較して表示する関数
+	//! @param[in]	Theta	位置の表
+	//! @param[in]	Omega	速度の表
+	template<size_t N>
+	void Benchmark(const std::array<double, KU>& Theta, const std::array<double, KU>& Omega){
+		std::vector<Conventional> Old(N);
+		static CascadedServoLoop<N> New1(Ts), New2(Ts);
+		for(size_t i = 1; i <= N; ++i){
+			New1.SetGains(i, Kpp, Kvp, Kvi);
+			New1.SetLimits(i, Vmax, Imax);
+			New2.SetGains(i, Kpp, Kvp, Kvi);
+			New2.SetLimits(i, Vmax, Imax);
+		}
+		static std::array<ArcsMat<N,1>, KU> ThetaVec, OmegaVec;	// 全軸版に渡すフィードバックベクトル
+		for(size_t k = 0; k < KU; ++k){
+			for(size_t j = 0; j < N; ++j){
+				ThetaVec[k][j + 1] = Theta[(k + j) % KU];
+				OmegaVec[k][j + 1] = Omega[(k + j) % KU];
+			}
+		}
+		std::array<double, N> y1 = {0};
+		ArcsMat<N,1> y2, PosCmd, Zero;
+		PosCmd.FillAll(1.0);
+
+		// 従来の書き方 (軸ごとに Limiter と PIcontroller)
+		const auto Start1 = Clock::now();
+		for(size_t k = 0; k < K; ++k){
+			for(size_t j = 0; j < N; ++j) y1[j] = Old[j].GetSignal(1.0, Theta[(k + j) % KU], Omega[(k + j) % KU]);
+			KeepAlive(y1);
+		}
+		const double t1 = std::chrono::duration<double>(Clock::now() - Start1).count()/K*1e9;
+
+		// 軸ごとにフィードバック値を設定して1軸版の Update を呼ぶ
+		const auto Start2 = Clock::now();
+		for(size_t k = 0; k < K; ++k){
+			for(size_t i = 1; i <= N; ++i){
+				New1.SetReference(i, 1.0);
+				New1.SetFeedback(i, Theta[(k + i - 1) % KU], Omega[(k + i - 1) % KU], 0.0);
+				New1.Update(i);
+				y1[i - 1] = New1.GetCurrentRef(i);
+			}
+			KeepAlive(y1);
+		}
+		const double t2 = std::chrono::duration<double>(Clock::now() - Start2).count()/K*1e9;
+
+		// フィードバック値をベクトルでまとめて設定して全軸版の Update を呼ぶ
+		const auto Start3 = Clock::now();
+		for(size_t k = 0; k < K; ++k){
+			New2.SetReferences(PosCmd, Zero, Zero);
+			New2.SetFeedbacks(ThetaVec[k % KU], OmegaVec[k % KU], Zero);
+			New2.Update();
+			New2.GetCurrentRefs(y2);
+			KeepAlive(y2);
+		}
+		const double t3 = std::chrono::duration<double>(Clock::now() - Start3).count()/K*1e9;
+		printf("N = %2zu : Conventional %5.1f [ns/axis], per-axis Update %5.1f [ns/axis] (x%4.1f), all-axes Update %5.1f [ns/axis] (x%4.1f)\n",
+			N, t1/N, t2/N, t1/t2, t3/N, t1/t3);
+	}
+
+	//! @brief 慣性負荷の1軸を位置決めして，行き過ぎ量を返す関数
+	//! @param[in]	Ctrl	電流指令を返す関数
+	//! @param[out]	Pos		位置応答
+	//! @return	[rad] 行き過ぎ量
+	template<typename F>
+	double Positioning(F&& Ctrl, std::array<double, K>& Pos){
+		constexpr double Ref = 5;	// [rad] 位置指令 (電流が飽和する大きさ)
+		double th = 0, w = 0, Over = 0;
+		for(size_t k = 0; k < K; ++k){
+			const double i = Ctrl(Ref, th, w);
+			w += Ts*Kt*i/Jm;	// 慣性負荷
+			th += Ts*w;
+			Pos[k] = th;
+			Over = std::max(Over, th - Ref);
+		}
+		return Over;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	// 1. 消費時間 (入力信号は計算時間を含めないように予め表にしておく)
+	std::array<double, KU> Theta, Omega;
+	for(size_t k = 0; k < KU; ++k){
+		const double t = static_cast<double>(k)/KU;
+		Theta[k] = std::sin(2.0*M_PI*t);
+		Omega[k] = 2.0*M_PI*std::cos(2.0*M_PI*t);
+	}
+	Benchmark<1>(Theta, Omega);
+	Benchmark<3>(Theta, Omega);
+	Benchmark<6>(Theta, Omega);
+	Benchmark<16>(Theta, Omega);
+
+	// 2. 電流が飽和する位置決め
+	bool Passed = true;
+	{
+		static std::array<double, K> Pos1, Pos2, Pos3;
+		Conventional Old;
+		CascadedServoLoop<1> New(Ts), NoAW(Ts);
+		New.SetGains(1, Kpp, Kvp, Kvi);
+		New.SetLimits(1, Vmax, Imax);
+		NoAW.SetGains(1, Kpp, Kvp, Kvi, 0);	// アンチワインドアップ無し
+		NoAW.SetLimits(1, Vmax, Imax);
+		const double o1 = Positioning([&](const double r, const double th, const double w){ return Old.GetSignal(r, th, w); }, Pos1);
+		auto Run = [](CascadedServoLoop<1>& Sys){
+			return [&Sys](const double r, const double th, const double w){
+				Sys.SetReference(1, r);
+				Sys.SetFeedback(1, th, w, 0);
+				Sys.Update();
+				return Sys.GetCurrentRef(1);
+			};
+		};
+		const double o2 = Positioning(Run(New), Pos2);
+		const double o3 = Positioning(Run(NoAW), Pos3);
+		double e = 0;
+		for(size_t k = 0; k < K; ++k) e = std::max(e, std::abs(Pos2[k] - Pos1[k]));
+		printf("Positioning overshoot : Conventional %7.4f [rad], CascadedServoLoop %7.4f [rad] (diff. %7.1e), without anti-windup %7.4f [rad]\n",
+			o1, o2, e, o3);
+		Passed &= e < 1e-9 && o2 < 0.5*o3;
+	}
+
+	// 3. バンプレス切り替え
+	{
+		CascadedServoLoop<1> Sys(Ts);
+		Sys.SetGains(1, Kpp, Kvp, Kvi);
+		Sys.SetLimits(1, Vmax, Imax);
+		Sys.SetReference(1, 0.1);
+		Sys.SetEnable(1, false);
+		Sys.SetFeedback(1, 0.0, 0.0, 0.8);	// 無効の間は別の指令で 0.8 [A] 流れているとする
+		for(size_t k = 0; k < 100; ++k) Sys.Update();
+		const double Before = Sys.GetCurrentRef(1);
+		Sys.SetEnable(1, true);
+		Sys.Update();
+		const double Jump = std::abs(Sys.GetCurrentRef(1) - Before);
+		const double Step = Ts*Kvi*Kpp*0.1;					// 積分器の1サンプル分の増分 (これだけは動いて良い)
+		const double Naive = std::abs(Kvp*Kpp*0.1 + Step - Before);	// 積分器をゼロから始めた場合の跳び
+		printf("Bumpless transfer : jump %7.1e [A] (one integration step: %7.1e [A], integrator from zero: %7.1e [A])\n", Jump, Step, Naive);
+		Passed &= Jump <= Step*(1 + 1e-9);
+	}
+	printf("Behavior check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
+
@@ -0,0 +1,206 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par ゲインスケジューリングの精度と消費時間の確認
+//! - 推定帯域 gdis = 10～1000 [rad/s] の同一次元0次外乱オブザーバを GainScheduleTable で対数等間隔に離散化しておき，
+//!   格子点の中間での補間誤差と，推定外乱の応答の誤差を確認する。格子点上では離散化し直した結果と一致することも確認する。
+//! - 補間して設定する場合と，その場で離散化し直す場合(StateSpaceSystem::SetContinuous)の消費時間を比較する。
+//! - ModelRediscretizer に再離散化を要求してから差し替わるまでの周期数と，実時間ループ側の消費時間を確認する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <cstring>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "StateSpaceSystem.hh"
+#include "GainSchedule.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+
+namespace {
+	constexpr double Ts = 100e-6;	//!< [s] サンプリング周期
+	constexpr double Kt = 0.49;		//!< [Nm/A] トルク定数
+	constexpr double Jm = 1.10e-4;	//!< [kgm^2] モータ側慣性
+	constexpr double Gmin = 10;		//!< [rad/s] 推定帯域の最小値
+	constexpr double Gmax = 1000;	//!< [rad/s] 推定帯域の最大値
+	constexpr size_t P = 128;		//!< 格子点の数
+	constexpr size_t K = 20000;		//!< 応答を計算するサンプル数
+	constexpr size_t KT = 10000;	//!< 消費時間を測る回数
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 最適化で計算が消されないようにする関数
+	//! @param[in]	x	対象の変数
+	template<typename T>
+	inline void KeepAlive(T& x){
+		asm volatile("" : : "g"(&x) : "memory");
+	}
+
+	//! @brief 同一次元0次外乱オブザーバの連続系モデル (DisturbanceObsrv と同じ式)
+	//! @param[in]	gdis	[rad/s] 推定帯域
+	//! @param[out]	A, B, C, D	連続系のA,B,C,D行列
+	void DObModel(const double gdis, ArcsMat<2,2>& A, ArcsMat<2,2>& B, ArcsMat<1,2>& C, ArcsMat<1,2>& D){
+		const double l = -gdis;	// -gdis [rad/s] の重根設定
+		A.Set(
+			l + l,     -1.0/Jm,
+			Jm*l*l,          0
+		);
+		B.Set(
+			Kt/Jm,   -l - l,
+			    0, -Jm*l*l
+		);
+		C.Set(0, 1);
+		D.Set(0, 0);
+	}
+
+	//! @brief 推定外乱の応答を計算する関数
+	//! @param[in]	Sys	外乱オブザーバの状態空間モデル
+	//! @param[out]	Y	推定外乱
+	void Response(StateSpaceSystem<2,2,1>& Sys, std::array<double, K>& Y){
+		Sys.ClearStateVector();
+		for(size_t k = 0; k < K; ++k){
+			const double t = Ts*static_cast<double>(k);
+			const double iq = std::sin(2.0*M_PI*5.0*t) + (t < 0.5 ? 0.0 : 0.5);						// [A] 電流
+			const double wm = 100.0*std::sin(2.0*M_PI*2.0*t) + 20.0*std::sin(2.0*M_PI*40.0*t);		// [rad/s] 速度
+			Y[k] = Sys.GetNextResponse(iq, wm);
+		}
+	}
+
+	//! @brief 離散系モデルどうしの要素の最大差を返す関数
+	double MaxDiff(const DiscreteModel<2,2,1>& M1, const DiscreteModel<2,2,1>& M2){
+		return std::max(max(abs(ArcsMat<2,2>(M1.Ad - M2.Ad))), max(abs(ArcsMat<2,2>(M1.Bd - M2.Bd))));
+	}
+
+	//! @brief 離散系モデルどうしがビット単位で一致するかを返す関数
+	bool BitEqual(const DiscreteModel<2,2,1>& M1, const DiscreteModel<2,2,1>& M2){
+		return std::memcmp(&(M1.Ad.ReadOnlyRef()[0][0]), &(M2.Ad.ReadOnlyRef()[0][0]), sizeof(double)*4) == 0
+			&& std::memcmp(&(M1.Bd.ReadOnlyRef()[0][0]), &(M2.Bd.ReadOnlyRef()[0][0]), sizeof(double)*4) == 0;
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	bool Passed = true;
+	static GainScheduleTable<2,2,1,P> Table(DObModel, Gmin, Gmax, Ts, SchedGrid::SCHED_LOG);
+
+	// 1. 格子点の中間での補間誤差と，推定外乱の応答の誤差
+	{
+		double eM = 0, eY = 0;
+		static std::array<double, K> Y1, Y2;
+		StateSpaceSystem<2,2,1> Exact, Sched;
+		for(size_t k = 0; k < P - 1; ++k){
+			const double g = std::sqrt(Table.GetGridPoint(k)*Table.GetGridPoint(k + 1));	// 対数で見た中間
+			DiscreteModel<2,2,1> M1, M2;
+			M1.Discretize(DObModel, g, Ts);
+			Table.GetModel(g, M2);
+			eM = std::max(eM, MaxDiff(M1, M2));
+			M1.SetTo(Exact);
+			Table.SetSystem(g, Sched);
+			Response(Exact, Y1);
+			Response(Sched, Y2);
+			double d = 0, r = 0;
+			for(size_t j = 0; j < K; ++j){
+				d = std::max(d, std::abs(Y2[j] - Y1[j]));
+				r = std::max(r, std::abs(Y1[j]));
+			}
+			eY = std::max(eY, d/r);
+		}
+		printf("Interpolation (P = %zu, log grid) : max. matrix err. %7.1e, max. rel. response err. %7.1e\n", P, eM, eY);
+		Passed &= eM < 1e-4 && eY < 1e-3;
+
+		// 格子点上では離散化し直した結果と丸め誤差の範囲で一致すること
+		double eG = 0;
+		for(size_t k = 0; k < P; ++k){
+			DiscreteModel<2,2,1> M1, M2;
+			M1.Discretize(DObModel, Table.GetGridPoint(k), Ts);
+			Table.GetModel(Table.GetGridPoint(k), M2);
+			eG = std::max(eG, MaxDiff(M1, M2));
+		}
+		printf("On grid points : max. matrix err. %7.1e\n", eG);
+		Passed &= eG < 1e-12;
+	}
+
+	// 2. 実時間ループの中で推定帯域を変える場合の消費時間
+	{
+		StateSpaceSystem<2,2,1> Sys;
+		ArcsMat<2,2> A, B;
+		ArcsMat<1,2> C, D;
+		const auto Start1 = Clock::now();
+		for(size_t k = 0; k < KT; ++k){
+			const double g = Gmin + (Gmax - Gmin)*static_cast<double>(k)/KT;
+			DObModel(g, A, B, C, D);
+			Sys.SetContinuous(A, B, C, Ts);	// 従来の方法：その場で平衡化して離散化
+			KeepAlive(Sys);
+		}
+		const double t1 = std::chrono::duration<double>(Clock::now() - Start1).count()/KT*1e9;
+		const auto Start2 = Clock::now();
+		for(size_t k = 0; k < KT; ++k){
+			const double g = Gmin + (Gmax - Gmin)*static_cast<double>(k)/KT;
+			Table.SetSystem(g, Sys);		// 表から補間
+			KeepAlive(Sys);
+		}
+		const double t2 = std::chrono::duration<double>(Clock::now() - Start2).count()/KT*1e9;
+		printf("Changing gdis : SetContinuous %7.1f [ns], GainScheduleTable %5.1f [ns] (x%6.1f)\n", t1, t2, t1/t2);
+	}
+
+	// 3. バックグラウンド再離散化
+	{
+		StateSpaceSystem<2,2,1> Sys;
+		ModelRediscretizer<2,2,1> Redisc(DObModel, 100, Ts);
+		Redisc.GetModel().SetTo(Sys);
+		double tReq = 0, tApp = 0;
+		size_t Requested = 0, Swapped = 0;
+		for(size_t k = 1; k <= 1000 && Swapped == 0; ++k){
+			if(k == 10){
+				const auto Start = Clock::now();
+				Redisc.Request(500);	// 10周期目に推定帯域の変更を要求
+				tReq = std::chrono::duration<double>(Clock::now() - Start).count()*1e9;
+				Requested = k;
+			}
+			const auto Start = Clock::now();
+			if(Redisc.Apply(Sys)) Swapped = k;	// 出来上がっていれば差し替え
+			if(10 < k) tApp = std::max(tApp, std::chrono::duration<double>(Clock::now() - Start).count()*1e9);
+			std::this_thread::sleep_for(std::chrono::microseconds(100));	// 制御周期の代わり
+		}
+		DiscreteModel<2,2,1> M;
+		M.Discretize(DObModel, 500, Ts);
+		const bool Same = BitEqual(Redisc.GetModel(), M);
+		printf("Rediscretizer : swapped %zu cycles after request, Request %5.1f [ns], Apply max. %5.1f [ns], model %s\n",
+			Swapped - Requested, tReq, tApp, Same ? "identical" : "MISMATCH");
+		Passed &= Swapped != 0 && Same;
+
+		// 立て続けに要求したときは最新の要求が反映されること
+		Redisc.Request(200);
+		Redisc.Request(300);
+		Redisc.Request(400);
+		while(!Redisc.IsDone()) std::this_thread::sleep_for(std::chrono::microseconds(100));
+		Redisc.Apply(Sys);
+		printf("Rediscretizer : latest request %5.1f [rad/s] applied\n", Redisc.GetModel().Param);
+		Passed &= Redisc.GetModel().Param == 400;
+	}
+	printf("Accuracy check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
+
@@ -0,0 +1,220 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par 周波数応答解析の精度と消費時間の確認
+//! - 共振のある2次系のプラントに FRAgenerator の周波数ステップ正弦波を入力して，FRAanalyzer で逐次求めたボード線図と，
+//!   全区間を記録してから MATLAB のスクリプト(FRA.m)と同じ方法で計算したボード線図を，離散系の厳密な周波数応答と比較する。
+//!   各周波数の最初の数周期を読み捨てて過渡応答を除いた場合の精度も確認する。
+//! - ChirpGenerator のチャープ信号を入力して，複数のビンで解析したボード線図も同様に比較する。
+//! - 1サンプルあたりの消費時間と，記録に要するメモリ量を表示する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <complex>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "ArcsControl.hh"
+#include "FRAgenerator.hh"
+#include "ChirpGenerator.hh"
+#include "FRAanalyzer.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+
+namespace {
+	constexpr double Ts = 100e-6;		//!< [s] サンプリング周期
+	constexpr double Fn = 50;			//!< [Hz] プラントの共振周波数
+	constexpr double Zeta = 0.2;			//!< [-] プラントの減衰係数
+	constexpr double Fmin = 5;			//!< [Hz] FRAの開始周波数
+	constexpr double Fmax = 200;		//!< [Hz] FRAの終了周波数
+	constexpr double Fstep = 5;			//!< [Hz] FRAの周波数ステップ
+	constexpr double Ni = 10;			//!< [-] 積分周期
+	constexpr double Au = 1;			//!< [-] 振幅
+	constexpr double Bu = 0.2;			//!< [-] バイアス
+	constexpr double Tsta = 0.1;		//!< [s] FRA開始時刻
+	constexpr double Nsettle = 3;		//!< [-] 各周波数の最初に読み捨てる周期数
+	constexpr double Tchirp = 8;		//!< [s] チャープ信号の長さ
+	constexpr double Trest = 1;			//!< [s] チャープ信号の後に応答が収まるのを待つ時間
+	constexpr size_t NB = 40;			//!< チャープ信号の解析のビンの数
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 離散化したプラント
+	struct Plant {
+		ArcsMat<2,2> Ad;	//!< 離散系のA行列
+		ArcsMat<2,1> Bd;	//!< 離散系のB行列
+		ArcsMat<1,2> C;		//!< C行列
+		ArcsMat<2,1> x;		//!< 状態ベクトル
+
+		//! @brief コンストラクタ (共振のある2次系 wn^2/(s^2 + 2ζwn s + wn^2) を0次ホールドで離散化)
+		Plant()
+			: Ad(), Bd(), C(), x()
+		{
+			const double wn = 2.0*M_PI*Fn;
+			ArcsMat<2,2> A;
+			ArcsMat<2,1> B;
+			A.Set(
+				0,                   1,
+				-wn*wn, -2.0*Zeta*wn
+			);
+			B.Set(0, wn*wn);
+			C.Set(1, 0);
+			ArcsControl::Discretize(A, B, Ad, Bd, Ts);
+		}
+
+		//! @brief 現在の出力を返して，入力で1サンプル進める関数
+		double GetResponse(const double u){
+			const double y = (C*x)[1];
+			x = Ad*x + Bd*u;
+			return y;
+		}
+
+		//! @brief 離散系の厳密な周波数応答 C(zI - Ad)^-1 Bd を返す関数
+		//! @param[in]	f	[Hz] 周波数
+		std::complex<double> GetExact(const double f) const {
+			const std::complex<double> z = std::polar(1.0, 2.0*M_PI*f*Ts);
+			const std::complex<double> a = z - Ad(1,1), b = -Ad(1,2), c = -Ad(2,1), d = z - Ad(2,2);	// zI - Ad
+			return (d*Bd(1,1) - b*Bd(2,1))/(a*d - b*c);	// 2×2の逆行列の1行目と Bd の積
+		}
+	};
+
+	//! @brief 厳密な周波数応答とのゲインと位相の誤差の最大値を求める関数
+	//! @param[in]	P		プラント
+	//! @param[in]	Freq	[Hz] 周波数
+	//! @param[in]	Gain	[dB] ゲイン
+	//! @param[in]	Phase	[deg] 位相
+	//! @param[in,out]	eG	[dB] ゲイン誤差の最大値
+	//! @param[in,out]	eP	[deg] 位相誤差の最大値
+	void CompareExact(const Plant& P, const double Freq, const double Gain, const double Phase, double& eG, double& eP){
+		const std::complex<double> H = P.GetExact(Freq);
+		const double d = Phase - std::arg(H)*180.0/M_PI;
+		eG = std::max(eG, std::abs(Gain - 20.0*std::log10(std::abs(H))));
+		eP = std::max(eP, std::abs(d - 360.0*std::round(d/360.0)));
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	bool Passed = true;
+
+	// 1. 周波数ステップ正弦波
+	{
+		Plant P;
+		FRAgenerator FRA(Fmin, Fmax, Fstep, Ni, Au, Bu, Tsta);
+		static FRAanalyzer<64> Ana0(Ts), Ana(Ts, Nsettle);
+		std::vector<double> Trec, Frec, Yrec;	// 従来の方法のための全区間の記録
+		double tAna = 0;
+		size_t Nana = 0, Shown = 0;
+		for(size_t k = 0; !(FRA.IsRunning() == false && 0 < Nana); ++k){
+			const double t = Ts*static_cast<double>(k);
+			double f = 0;
+			const double u = FRA.GetSignal(t, f);
+			const double y = P.GetResponse(u);
+			const auto Start = Clock::now();
+			if(FRA.IsRunning()){
+				Ana.Update(f, u, y);	// 制御ループの中で逐次相関
+				++Nana;
+			}else{
+				Ana.Finish();			// 終わったら最後の周波数を表に追加
+			}
+			tAna += std::chrono::duration<double>(Clock::now() - Start).count();
+			if(FRA.IsRunning()){
+				Ana0.Update(f, u, y);	// 読み捨て無し
+				Trec.push_back(t - Tsta);
+				Frec.push_back(f);
+				Yrec.push_back(y);
+			}
+			// 周波数が1つ終わるごとに表が増える
+			for(; Shown < Ana.GetNumOfPoints(); ++Shown){
+				const auto [Freq, Gain, Phase] = Ana.GetPoint(Shown);
+				if(Shown % 8 == 0) printf("t = %6.3f [s] : %6.1f [Hz] %7.2f [dB] %8.2f [deg]\n", t, Freq, Gain, Phase);
+			}
+		}
+
+		Ana0.Finish();
+
+		// FRAanalyzer の結果
+		double eG0 = 0, eP0 = 0, eG1 = 0, eP1 = 0;
+		for(size_t i = 0; i < Ana.GetNumOfPoints(); ++i){
+			const auto [Freq0, Gain0, Phase0] = Ana0.GetPoint(i);
+			const auto [Freq, Gain, Phase] = Ana.GetPoint(i);
+			CompareExact(P, Freq0, Gain0, Phase0, eG0, eP0);
+			CompareExact(P, Freq, Gain, Phase, eG1, eP1);
+		}
+
+		// 従来の方法 (FRA.m と同じく記録した出力だけを余弦と正弦で相関して，振幅の設定値で割る)
+		double eG2 = 0, eP2 = 0, Ar = 0, Ai = 0, tini = 0;
+		size_t Npts = 0;
+		for(size_t i = 0; i + 1 < Trec.size(); ++i){
+			Ar += Yrec[i]*std::cos(2.0*M_PI*Frec[i]*(Trec[i] - tini))*Ts;
+			Ai += Yrec[i]*std::sin(2.0*M_PI*Frec[i]*(Trec[i] - tini))*Ts;
+			if(Frec[i] != Frec[i + 1]){
+				Ar *= 2.0*Frec[i]/Ni;
+				Ai *= 2.0*Frec[i]/Ni;
+				CompareExact(P, Frec[i], 20.0*std::log10(std::sqrt(Ar*Ar + Ai*Ai)/Au), -std::atan2(Ai, Ar)*180.0/M_PI, eG2, eP2);
+				Ar = Ai = 0;
+				tini = Trec[i + 1];
+				++Npts;
+			}
+		}
+		printf("Stepped sine : post-processing %zu points (max. err. %.3f [dB], %.3f [deg]), FRAanalyzer %zu points (max. err. %.3f [dB], %.3f [deg])\n",
+			Npts, eG2, eP2, Ana0.GetNumOfPoints(), eG0, eP0);
+		printf("Stepped sine : FRAanalyzer skipping %.0f periods (max. err. %.3f [dB], %.3f [deg])\n", Nsettle, eG1, eP1);
+		printf("Stepped sine : FRAanalyzer %5.1f [ns/sample], memory %zu [bytes] vs. record of %zu samples %zu [bytes]\n",
+			tAna/static_cast<double>(Nana)*1e9, sizeof(Ana), Trec.size(), 3*sizeof(double)*Trec.size());
+		Passed &= std::abs(eG0 - eG2) < 0.01 && std::abs(eP0 - eP2) < 0.1;	// 読み捨て無しなら従来の方法と同じ結果になる
+		Passed &= Ana.GetNumOfPoints() == Npts + 1 && eG1 < 0.1 && eP1 < 1.0;
+		printf("\n");
+	}
+
+	// 2. チャープ信号 (複数のビンで全区間を相関)
+	{
+		Plant P;
+		ChirpGenerator Chirp(1, 400, Tchirp);
+		static FRAanalyzer<NB> Ana(Ts);
+		Ana.SetBins(Fmin, Fmax, NB);
+		const size_t K = static_cast<size_t>((Tchirp + Trest)/Ts);
+		double tAna = 0;
+		for(size_t k = 0; k < K; ++k){
+			const double t = Ts*static_cast<double>(k);
+			const double u = t < Tchirp ? Chirp.GetSignal(t) : 0.0;
+			const double y = P.GetResponse(u);
+			const auto Start = Clock::now();
+			Ana.UpdateBins(u, y);
+			tAna += std::chrono::duration<double>(Clock::now() - Start).count();
+		}
+		Ana.Finish();
+		double eG = 0, eP = 0;
+		for(size_t i = 0; i < Ana.GetNumOfPoints(); ++i){
+			const auto [Freq, Gain, Phase] = Ana.GetPoint(i);
+			CompareExact(P, Freq, Gain, Phase, eG, eP);
+			if(i % 8 == 0) printf("Chirp : %6.1f [Hz] %7.2f [dB] %8.2f [deg]\n", Freq, Gain, Phase);
+		}
+		printf("Chirp : FRAanalyzer %zu bins (max. err. %.3f [dB], %.3f [deg]), %5.1f [ns/sample] (%4.2f [ns/bin])\n",
+			Ana.GetNumOfPoints(), eG, eP, tAna/static_cast<double>(K)*1e9, tAna/static_cast<double>(K*NB)*1e9);
+		Passed &= Ana.GetNumOfPoints() == NB && eG < 0.1 && eP < 1.0;
+	}
+	printf("Accuracy check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
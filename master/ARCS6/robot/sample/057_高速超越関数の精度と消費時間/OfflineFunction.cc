@@ -0,0 +1,245 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par 高速超越関数の精度と消費時間の確認
+//! - FastMath の exp, tanh, シグモイド, sin, cos, atan2 を libm と比較して，最大誤差を表示する。
+//!   倍精度版(DOUBLE)は倍精度のulp，単精度並み版(SINGLE)は相対誤差または絶対誤差で表示する。
+//! - constexpr で計算した値が実行時の値と一致することを確認する。
+//! - ArcsMat の要素ごとの計算と dq変換について，libm を呼ぶ場合との1要素あたりの消費時間を比較する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <tuple>
+#include <algorithm>
+#include <limits>
+#include <iterator>
+
+// 追加のARCSライブラリをここに記述
+#include "ArcsMatrix.hh"
+#include "FastMath.hh"
+#include "MotorFrameTransform.hh"
+
+using namespace ARCS;
+using namespace ArcsMatrix;
+using FastMath::Accuracy;
+
+namespace {
+	constexpr size_t NS = 1000000;	//!< 精度の確認に使う乱数の数
+	constexpr size_t NB = 256;		//!< 消費時間の計測に使う行列の要素数
+	constexpr size_t NR = 20000;	//!< 消費時間の計測の繰り返し回数
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 倍精度のulp単位の誤差を返す関数
+	//! @param[in]	y		近似値
+	//! @param[in]	yref	真値
+	//! @return	[ulp] 誤差
+	double GetUlp(const double y, const double yref){
+		if(y == yref) return 0;
+		const double a = std::abs(yref);
+		return std::abs(y - yref)/(std::nextafter(a, 2*a + 1) - a);
+	}
+
+	//! @brief 最大誤差の集計
+	struct MaxErr {
+		double Ulp = 0;	//!< [ulp] 最大誤差
+		double Rel = 0;	//!< 最大相対誤差
+		double Abs = 0;	//!< 最大絶対誤差
+
+		//! @brief 1点分の誤差を加える関数
+		//! @param[in]	y		近似値
+		//! @param[in]	yref	真値
+		void Add(const double y, const double yref){
+			Ulp = std::max(Ulp, GetUlp(y, yref));
+			Abs = std::max(Abs, std::abs(y - yref));
+			if(yref != 0) Rel = std::max(Rel, std::abs(y - yref)/std::abs(yref));
+		}
+	};
+
+	//! @brief 1つの関数について DOUBLE と SINGLE の誤差を調べて表示する関数
+	//! @param[in]	Name	関数名
+	//! @param[in]	Gen		入力の乱数を作る関数
+	//! @param[in]	Ref		libm による真値
+	//! @param[in]	Dbl		DOUBLE版
+	//! @param[in]	Sgl		SINGLE版
+	//! @param[in]	UseAbs	SINGLE版を絶対誤差で評価するとき true
+	//! @return	{DOUBLE版の最大誤差 [ulp], SINGLE版の最大誤差} のタプル
+	template<typename G, typename R, typename D, typename S>
+	std::tuple<double, double> CheckAccuracy(const char* Name, G Gen, R Ref, D Dbl, S Sgl, const bool UseAbs){
+		MaxErr Ed, Es;
+		for(size_t k = 0; k < NS; ++k){
+			const double x = Gen(k);
+			const double yref = Ref(x);
+			Ed.Add(Dbl(x), yref);
+			Es.Add(Sgl(x), yref);
+		}
+		const double es = UseAbs ? Es.Abs : Es.Rel;
+		printf("%-8s : DOUBLE %4.1f [ulp] (rel. %8.2e), SINGLE %s %8.2e\n", Name, Ed.Ulp, Ed.Rel, UseAbs ? "abs." : "rel.", es);
+		return {Ed.Ulp, es};
+	}
+
+	//! @brief 関数を繰り返し呼んで1要素あたりの消費時間を返す関数
+	//! @param[in]	Func	U から Y を計算する関数
+	//! @param[in]	U		入力行列
+	//! @param[out]	Y		出力行列
+	//! @return	[ns] 1要素あたりの消費時間
+	template<typename F>
+	double MeasureTime(F Func, const ArcsMat<NB,1>& U, ArcsMat<NB,1>& Y){
+		volatile double Sink = 0;	// 計算が最適化で消されないように結果の一部を読む
+		const auto Start = Clock::now();
+		for(size_t k = 0; k < NR; ++k){
+			Func(U, Y);
+			Sink = Sink + Y[k % NB + 1];
+		}
+		return std::chrono::duration<double>(Clock::now() - Start).count()/static_cast<double>(NR*NB)*1e9;
+	}
+
+	//! @brief libm を呼ぶ従来の dq軸からUVW相への変換 (比較用)
+	//! @param[in]	d, q	dq軸
+	//! @param[in]	theta	[rad] 電気角
+	//! @return	UVW相 (u, v, w)のタプル
+	std::tuple<double, double, double> DQtoUVWlibm(const double d, const double q, const double theta){
+		const double u = std::sqrt(2.0/3.0)*( d*std::cos(theta               ) - q*std::sin(theta               ) );
+		const double v = std::sqrt(2.0/3.0)*( d*std::cos(theta - 2.0/3.0*M_PI) - q*std::sin(theta - 2.0/3.0*M_PI) );
+		const double w = std::sqrt(2.0/3.0)*( d*std::cos(theta + 2.0/3.0*M_PI) - q*std::sin(theta + 2.0/3.0*M_PI) );
+		return {u, v, w};
+	}
+}
+
+//! @brief エントリポイント
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	bool Passed = true;
+	std::mt19937_64 Rand(1);
+	std::uniform_real_distribution<double> Uni(-1, 1);
+
+	// 1. 精度 (いろいろな大きさの入力を混ぜる)
+	printf("Accuracy (%zu random inputs each, compared with libm)\n", NS);
+	auto Mixed = [&](const double Scale){
+		return [&, Scale](const size_t k){
+			const double x = Uni(Rand);
+			return k % 2 == 0 ? Scale*x : std::ldexp(x, -static_cast<int>(k % 60));	// 半分は0付近の小さい値
+		};
+	};
+	auto Ea = CheckAccuracy("Exp", Mixed(708), [](double x){ return std::exp(x); },
+		[](double x){ return FastMath::Exp(x); }, [](double x){ return FastMath::Exp<Accuracy::SINGLE>(x); }, false);
+	auto Et = CheckAccuracy("Tanh", Mixed(25), [](double x){ return std::tanh(x); },
+		[](double x){ return FastMath::Tanh(x); }, [](double x){ return FastMath::Tanh<Accuracy::SINGLE>(x); }, false);
+	auto Eg = CheckAccuracy("Sigmoid", Mixed(40), [](double x){ return 1.0/(1.0 + std::exp(-x)); },
+		[](double x){ return FastMath::Sigmoid(x); }, [](double x){ return FastMath::Sigmoid<Accuracy::SINGLE>(x); }, false);
+	auto Es = CheckAccuracy("Sin", Mixed(1e6), [](double x){ return std::sin(x); },
+		[](double x){ return FastMath::Sin(x); }, [](double x){ return FastMath::Sin<Accuracy::SINGLE>(x); }, true);
+	auto Ec = CheckAccuracy("Cos", Mixed(1e6), [](double x){ return std::cos(x); },
+		[](double x){ return FastMath::Cos(x); }, [](double x){ return FastMath::Cos<Accuracy::SINGLE>(x); }, true);
+	double Yatan = 0;	// atan2 の分子 (分母は Gen の値)
+	auto Eatan = CheckAccuracy("Atan2", [&](const size_t k){ Yatan = 100*Uni(Rand); return Mixed(100)(k); },
+		[&](double x){ return std::atan2(Yatan, x); },
+		[&](double x){ return FastMath::Atan2(Yatan, x); }, [&](double x){ return FastMath::Atan2<Accuracy::SINGLE>(Yatan, x); }, true);
+	for(const auto& E : {Ea, Et, Eg, Es, Ec, Eatan}) Passed &= std::get<0>(E) <= 4;
+	for(const auto& E : {Ea, Et, Eg}) Passed &= std::get<1>(E) < 6e-8;		// 単精度の丸め誤差 2^-24 以下
+	for(const auto& E : {Es, Ec, Eatan}) Passed &= std::get<1>(E) < 1e-7;
+
+	// 範囲外の入力
+	Passed &= FastMath::Exp(710) == std::exp(710.0) && FastMath::Exp(-710) == 0 && FastMath::Tanh(30) == 1 && FastMath::Tanh(-30) == -1;
+	Passed &= FastMath::Sigmoid(800) == 1 && FastMath::Sigmoid(-800) == 0 && FastMath::Atan2(0, 0) == 0 && FastMath::Atan2(0, -1) == std::atan2(0.0, -1.0);
+
+	// atan2 の特殊な入力 (±0, ±∞, NaN) で libm と符号まで一致すること
+	{
+		constexpr double Inf = std::numeric_limits<double>::infinity(), NaN = std::numeric_limits<double>::quiet_NaN();
+		const double Sp[] = {0.0, -0.0, 1.0, -1.0, Inf, -Inf, NaN};
+		size_t Nmis = 0;
+		for(const double ys : Sp){
+			for(const double xs : Sp){
+				const double r = std::atan2(ys, xs), f1 = FastMath::Atan2(ys, xs), f2 = FastMath::Atan2<Accuracy::SINGLE>(ys, xs);
+				const auto Same = [r](const double f){ return std::isnan(r) ? std::isnan(f) : (f == r && std::signbit(f) == std::signbit(r)); };
+				if(Same(f1) == false || Same(f2) == false){
+					printf("Atan2(% g, % g) : libm % .17g, FastMath % .17g, % .17g\n", ys, xs, r, f1, f2);
+					++Nmis;
+				}
+			}
+		}
+		printf("Atan2 special values : %zu mismatches in %zu inputs\n\n", Nmis, std::size(Sp)*std::size(Sp));
+		Passed &= Nmis == 0;
+	}
+
+	// 2. constexpr (コンパイル時に計算した値と実行時の値が一致すること)
+	static constexpr double Cexp = FastMath::Exp(1.5), Ctanh = FastMath::Tanh(-0.3), Csin = FastMath::Sin(100.0), Catan = FastMath::Atan2(-1.0, -3.0);
+	static constexpr auto Csc = FastMath::SinCos<Accuracy::SINGLE>(2.0);
+	volatile double X[] = {1.5, -0.3, 100.0, -1.0, -3.0, 2.0};	// 実行時に計算させるための入力
+	const bool ConstOK = Cexp == FastMath::Exp(X[0]) && Ctanh == FastMath::Tanh(X[1]) && Csin == FastMath::Sin(X[2])
+		&& Catan == FastMath::Atan2(X[3], X[4]) && Csc == FastMath::SinCos<Accuracy::SINGLE>(X[5]);
+	printf("constexpr : %s\n\n", ConstOK ? "same as run time" : "MISMATCH");
+	Passed &= ConstOK;
+
+	// 3. ArcsMat の要素ごとの計算の消費時間
+	ArcsMat<NB,1> U, Y, C;
+	for(size_t i = 1; i <= NB; ++i) U[i] = 3*Uni(Rand);
+	printf("Time per element of ArcsMat<%zu,1> [ns]    libm  DOUBLE  SINGLE\n", NB);
+	const double Tel[][3] = {
+		{
+			MeasureTime([](const auto& u, auto& y){ ArcsMatrix::exp(u, y); }, U, Y),
+			MeasureTime([](const auto& u, auto& y){ FastMath::exp(u, y); }, U, Y),
+			MeasureTime([](const auto& u, auto& y){ FastMath::exp<Accuracy::SINGLE>(u, y); }, U, Y)
+		},{
+			MeasureTime([](const auto& u, auto& y){ ArcsMatrix::tanh(u, y); }, U, Y),
+			MeasureTime([](const auto& u, auto& y){ FastMath::tanh(u, y); }, U, Y),
+			MeasureTime([](const auto& u, auto& y){ FastMath::tanh<Accuracy::SINGLE>(u, y); }, U, Y)
+		},{
+			MeasureTime([](const auto& u, auto& y){ for(size_t i = 1; i <= NB; ++i) y[i] = 1.0/(1.0 + std::exp(-u[i])); }, U, Y),
+			MeasureTime([](const auto& u, auto& y){ FastMath::sigmoid(u, y); }, U, Y),
+			MeasureTime([](const auto& u, auto& y){ FastMath::sigmoid<Accuracy::SINGLE>(u, y); }, U, Y)
+		},{
+			MeasureTime([](const auto& u, auto& y){ ArcsMatrix::sin(u, y); }, U, Y),
+			MeasureTime([](const auto& u, auto& y){ FastMath::sin(u, y); }, U, Y),
+			MeasureTime([](const auto& u, auto& y){ FastMath::sin<Accuracy::SINGLE>(u, y); }, U, Y)
+		},{
+			MeasureTime([&](const auto& u, auto& y){ ArcsMatrix::sin(u, y); ArcsMatrix::cos(u, C); }, U, Y),
+			MeasureTime([&](const auto& u, auto& y){ FastMath::sincos(u, y, C); }, U, Y),
+			MeasureTime([&](const auto& u, auto& y){ FastMath::sincos<Accuracy::SINGLE>(u, y, C); }, U, Y)
+		},{
+			MeasureTime([&](const auto& u, auto& y){ for(size_t i = 1; i <= NB; ++i) y[i] = std::atan2(u[i], C[i]); }, U, Y),
+			MeasureTime([&](const auto& u, auto& y){ for(size_t i = 1; i <= NB; ++i) y[i] = FastMath::Atan2(u[i], C[i]); }, U, Y),
+			MeasureTime([&](const auto& u, auto& y){ for(size_t i = 1; i <= NB; ++i) y[i] = FastMath::Atan2<Accuracy::SINGLE>(u[i], C[i]); }, U, Y)
+		}
+	};
+	const char* Names[] = {"exp", "tanh", "sigmoid", "sin", "sin & cos (sincos)", "atan2 (scalar loop)"};
+	for(size_t i = 0; i < 6; ++i) printf("  %-38s %6.2f  %6.2f  %6.2f\n", Names[i], Tel[i][0], Tel[i][1], Tel[i][2]);
+
+	// 4. dq変換 (θ±2π/3 を加法定理で求めて sin と cos は1回ずつ)
+	double Edq = 0;
+	for(size_t i = 1; i <= NB; ++i){
+		const auto [u1, v1, w1] = DQtoUVW(0.3*U[i], U[i], 100*U[i]);
+		const auto [u2, v2, w2] = DQtoUVWlibm(0.3*U[i], U[i], 100*U[i]);
+		Edq = std::max({Edq, std::abs(u1 - u2), std::abs(v1 - v2), std::abs(w1 - w2)});
+	}
+	const double Tdq0 = MeasureTime([](const auto& u, auto& y){
+		for(size_t i = 1; i <= NB; ++i){ const auto [a, b, c] = DQtoUVWlibm(0.3, u[i], 100*u[i]); y[i] = a + b + c; }
+	}, U, Y);
+	const double Tdq1 = MeasureTime([](const auto& u, auto& y){
+		for(size_t i = 1; i <= NB; ++i){ const auto [a, b, c] = DQtoUVW(0.3, u[i], 100*u[i]); y[i] = a + b + c; }
+	}, U, Y);
+	printf("  %-38s %6.2f  %6.2f  (max. err. %.2e)\n", "DQtoUVW", Tdq0, Tdq1, Edq);
+	Passed &= Edq < 1e-13;	// 比較用の libm 版も θ±2π/3 の丸めで |θ| の ulp 程度(θ = 300 で 6e-14)の誤差を含む
+
+	printf("\nAccuracy check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
+
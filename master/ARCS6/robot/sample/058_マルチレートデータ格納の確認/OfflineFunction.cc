@@ -0,0 +1,192 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par マルチレートデータ格納の確認
+//! - 間引き数 {1, 4, 10, 4, 10} の5チャネルを MultiRateStorage で格納して，間引き数のグループ分けが期待通りかを確認する。
+//! - 保存時間より長くデータを与えてCSVファイルに書き出して読み戻し，チャネル毎に素直に間引いた参照値
+//!   (アンチエイリアス有効チャネルは間引き区間の平均値)と時刻・値・データ数が一致するかを確認する。
+//! - 間引き後のナイキスト周波数を超える成分を混ぜて，区間平均によるアンチエイリアスで折り返しが減ることを確認する。
+//! - 1周期あたりの消費時間を表示する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <array>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+// 追加のARCSライブラリをここに記述
+#include "MultiRateStorage.hh"
+
+using namespace ARCS;
+
+namespace {
+	constexpr unsigned long SmplTime = 100000;	//!< [ns] 制御周期
+	constexpr unsigned int SaveTime = 1;		//!< [s] 保存時間
+	constexpr double Ts = SmplTime*1e-9;		//!< [s] 制御周期
+	constexpr size_t NK = 12000;				//!< 与えるデータ数 (保存時間を超える分は捨てられる)
+	constexpr size_t N = 5;						//!< チャネル数
+	constexpr std::array<unsigned int, N> Rate = {1, 4, 10, 4, 10};	//!< 各チャネルの間引き数
+	constexpr std::array<bool, N> AA = {false, false, false, true, true};	//!< アンチエイリアス有効チャネル
+	constexpr double Flow = 3;			//!< [Hz] 低周波成分の周波数
+	constexpr double Fhigh = 1900;		//!< [Hz] 間引き数10のナイキスト周波数(500Hz)を超える高周波成分の周波数
+	constexpr double Ahigh = 0.5;		//!< [-] 高周波成分の振幅
+	using Storage = MultiRateStorage<SmplTime, SaveTime, 1, 4, 10, 4, 10>;
+	using Clock = std::chrono::steady_clock;
+
+	//! @brief 低周波成分
+	double LowFreq(const size_t k){
+		return std::sin(2.0*M_PI*Flow*Ts*static_cast<double>(k));
+	}
+
+	//! @brief チャネルへの入力 (低周波成分 + 高周波成分)
+	double Input(const size_t ch, const size_t k){
+		return LowFreq(k) + static_cast<double>(ch + 1)*0.01 + Ahigh*std::sin(2.0*M_PI*Fhigh*Ts*static_cast<double>(k));
+	}
+
+	//! @brief 書き出したCSVファイルを読み戻す関数
+	//! @param[in]	FileName	ファイル名
+	//! @return	チャネル毎の時刻と値の系列
+	std::array<std::vector<std::pair<double, double>>, N> LoadCsv(const std::string& FileName){
+		std::array<std::vector<std::pair<double, double>>, N> ret;
+		std::ifstream fin(FileName);
+		std::string Line;
+		while(std::getline(fin, Line)){
+			std::vector<std::string> Fields;
+			std::stringstream ss(Line);
+			std::string Field;
+			while(std::getline(ss, Field, ',')) Fields.push_back(Field);
+			if(Line.empty() == false && Line.back() == ',') Fields.push_back("");	// 末尾の空欄
+			for(size_t i = 0; i < N && 2*i + 1 < Fields.size(); ++i){
+				if(Fields[2*i].empty() == false) ret[i].emplace_back(std::stod(Fields[2*i]), std::stod(Fields[2*i + 1]));
+			}
+		}
+		return ret;
+	}
+}
+
+//! @brief オフライン計算用のメイン関数
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	bool Passed = true;
+
+	// 1. 間引き数のグループ分け
+	{
+		constexpr size_t G = MultiRateSchedule::CountGroups(Rate);
+		constexpr auto GroupRate = MultiRateSchedule::GroupRates<G>(Rate);
+		constexpr auto Order = MultiRateSchedule::ChannelOrder(Rate, GroupRate);
+		constexpr auto Begin = MultiRateSchedule::GroupBegin(Rate, GroupRate);
+		printf("Groups : %zu\n", G);
+		for(size_t g = 0; g < G; ++g){
+			printf("  rate %2u : channels", GroupRate[g]);
+			for(size_t k = Begin[g]; k < Begin[g + 1]; ++k) printf(" %zu", Order[k]);
+			printf("\n");
+		}
+		Passed &= G == 3;
+		Passed &= GroupRate == std::array<unsigned int, 3>{1, 4, 10};
+		Passed &= Order == std::array<size_t, N>{0, 1, 3, 2, 4};
+		Passed &= Begin == std::array<size_t, 4>{0, 1, 3, 5};
+		printf("\n");
+	}
+
+	// 2. 格納結果と参照値の比較
+	{
+		static Storage Stor;
+		for(size_t i = 0; i < N; ++i) Stor.SetAntiAlias(i, AA[i]);
+		for(size_t k = 0; k < NK; ++k){
+			Stor.SetData(Ts*static_cast<double>(k), Input(0, k), Input(1, k), Input(2, k), Input(3, k), Input(4, k));
+		}
+		Stor.SaveDataFile("MULTIRATE.csv", DataStorageType::FORMAT_CSV);
+		const auto Loaded = LoadCsv("MULTIRATE.csv");
+
+		for(size_t i = 0; i < N; ++i){
+			// 素直に間引いた参照値 (最初の保存は Rate 周期目，アンチエイリアス有効なら間引き区間の平均値)
+			const size_t Capacity = static_cast<size_t>(SaveTime*1000000000ULL/SmplTime/Rate[i]);
+			std::vector<std::pair<double, double>> Ref;
+			for(size_t k = Rate[i] - 1; k < NK && Ref.size() < Capacity; k += Rate[i]){
+				double y = Input(i, k);
+				if(AA[i] == true){
+					y = 0;
+					for(size_t j = k + 1 - Rate[i]; j <= k; ++j) y += Input(i, j);
+					y /= static_cast<double>(Rate[i]);
+				}
+				Ref.emplace_back(Ts*static_cast<double>(k), y);
+			}
+
+			// 比較
+			double Et = 0, Ey = 0;
+			const bool SameNum = Loaded[i].size() == Ref.size() && Stor.GetDataNum(i) == Ref.size();
+			for(size_t j = 0; j < std::min(Loaded[i].size(), Ref.size()); ++j){
+				Et = std::max(Et, std::abs(Loaded[i][j].first - Ref[j].first));
+				Ey = std::max(Ey, std::abs(Loaded[i][j].second - Ref[j].second));
+			}
+			printf("Channel %zu (rate %2u, anti-alias %s) : %5zu points (ref. %5zu), max. err. t = %.1e [s], y = %.1e\n",
+				i, Rate[i], AA[i] ? "on " : "off", Loaded[i].size(), Ref.size(), Et, Ey);
+			Passed &= SameNum && Et < 1e-12 && Ey < 1e-12;
+		}
+		printf("\n");
+	}
+
+	// 3. アンチエイリアスの効果 (間引き数10のチャネルの低周波成分からのずれ)
+	{
+		static Storage Stor;
+		Stor.SetAntiAlias(4, true);
+		for(size_t k = 0; k < NK; ++k){
+			Stor.SetData(Ts*static_cast<double>(k), Input(0, k), Input(1, k), Input(2, k), Input(3, k), Input(4, k));
+		}
+		Stor.SaveDataFile("MULTIRATE.csv", DataStorageType::FORMAT_CSV);
+		const auto Loaded = LoadCsv("MULTIRATE.csv");
+
+		// 低周波成分にも同じ区間平均がかかるので，参照も区間平均した低周波成分とする
+		double Eplain = 0, Eaa = 0;
+		for(size_t j = 0; j < Loaded[2].size(); ++j){
+			const size_t k = 10*j + 9;
+			double Mean = 0;
+			for(size_t m = k - 9; m <= k; ++m) Mean += LowFreq(m) + 0.05;
+			Mean /= 10.0;
+			Eplain = std::max(Eplain, std::abs(Loaded[2][j].second - (LowFreq(k) + 0.03)));
+			Eaa = std::max(Eaa, std::abs(Loaded[4][j].second - Mean));
+		}
+		printf("Aliasing of %.0f [Hz] at rate 10 : plain %.4f, anti-alias %.4f (boxcar gain %.4f)\n",
+			Fhigh, Eplain, Eaa, std::abs(std::sin(M_PI*Fhigh*10*Ts)/(10*std::sin(M_PI*Fhigh*Ts))));
+		Passed &= 0.9*Ahigh < Eplain && Eaa < 0.1*Eplain;
+		printf("\n");
+	}
+
+	// 4. 消費時間
+	{
+		static Storage Stor;
+		Stor.SetAntiAlias(3, true);
+		Stor.SetAntiAlias(4, true);
+		const auto t0 = Clock::now();
+		for(size_t k = 0; k < NK; ++k){
+			const double x = static_cast<double>(k);
+			Stor.SetData(Ts*x, x, 2*x, 3*x, 4*x, 5*x);
+		}
+		const auto t1 = Clock::now();
+		printf("SetData : %5.1f [ns/cycle] for %zu channels\n", std::chrono::duration<double, std::nano>(t1 - t0).count()/NK, N);
+	}
+
+	printf("\nAccuracy check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
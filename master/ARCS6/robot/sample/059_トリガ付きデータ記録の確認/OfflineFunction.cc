@@ -0,0 +1,178 @@
+//! @file OfflineFunction.cc
+//! @brief ARCS6 オフライン計算用メインコード
+//! @date 2026/10/19
+//! @author Yokokura, Yuki
+//!
+//! @par オフライン計算用のメインコード
+//! - 「make offline」でコンパイルすると，いつものARCS制御用のコードは走らずに，
+//!    このソースコードのみが走るようになる。
+//! - ARCSライブラリはもちろんそのままいつも通り使用可能。
+//! - 従って，オフラインで何か計算をしたいときに，このソースコードに記述すれば良い。
+//!
+//! @par トリガ付きデータ記録の確認
+//! - 正弦波と周期番号を TriggerRecorder に与えて，立ち上がりエッジ，立ち下がりエッジ，TriggerIf の順にトリガをかける。
+//! - 書き出したCSVファイルを読み戻し，トリガ時刻より前に PreNum 行，トリガ時刻以降に PostNum 行が
+//!   連続した周期番号で残っているか，書き出し後に再びトリガ待機状態に戻るかを確認する。
+//! - トリガ後のデータを記録中にレコーダを破棄して(異常で制御ループが止まった場合を模擬)，
+//!   途中までのトリガ後データが書き出されるかを確認する。
+//!
+// Copyright (C) 2011-2026 Yokokura, Yuki
+// MIT License. For details, see the LICENSE file.
+
+// 基本のインクルードファイル
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <array>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+// 追加のARCSライブラリをここに記述
+#include "TriggerRecorder.hh"
+
+using namespace ARCS;
+
+namespace {
+	constexpr double Ts = 1e-3;			//!< [s] 制御周期
+	constexpr size_t PreNum = 50;		//!< トリガ前に残すデータ数
+	constexpr size_t PostNum = 30;		//!< トリガ後(トリガ時点を含む)に残すデータ数
+	constexpr size_t Period = 200;		//!< 正弦波の周期 (周期数)
+	constexpr size_t ExitPost = 10;		//!< 破棄の確認でトリガ後に与えるデータ数 (トリガ時点を含む)
+	constexpr unsigned long WaitMax = 5000;	//!< [ms] 書き出し完了の最大待ち時間
+	using Recorder = TriggerRecorder<2, PreNum, PostNum>;
+
+	//! @brief 監視する信号 (k = 117 で 0.5 を立ち上がり，k = 217 で -0.5 を立ち下がる)
+	double Signal(const size_t k){
+		return std::sin(2.0*M_PI*static_cast<double>(k)/static_cast<double>(Period) - M_PI);
+	}
+
+	//! @brief 1周期分のデータを記録する関数
+	void Feed(Recorder& Rec, const size_t k){
+		Rec.SetData(Ts*static_cast<double>(k), Signal(k), static_cast<double>(k));
+	}
+
+	//! @brief 書き出しが終わって再びトリガ待機状態に戻るまで待つ関数
+	//! @param[in]	Rec		レコーダ
+	//! @param[in]	Count	待つファイル数
+	//! @return	true = 戻った，false = 時間切れ
+	bool WaitRearm(const Recorder& Rec, const size_t Count){
+		for(unsigned long i = 0; i < WaitMax; ++i){
+			if(Rec.GetCaptureCount() == Count && Rec.IsArmed() == true) return true;
+			usleep(1000);
+		}
+		return false;
+	}
+
+	//! @brief 書き出したCSVファイルを読み戻して，トリガ時点の前後のデータ数と内容を確認する関数
+	//! @param[in]	FileName	ファイル名
+	//! @param[in]	Name		表示名
+	//! @param[in]	kTrig		トリガ時点の周期番号
+	//! @param[in]	Post		期待するトリガ後のデータ数
+	//! @return	true = 期待通り
+	bool CheckCapture(const std::string& FileName, const char* Name, const size_t kTrig, const size_t Post){
+		std::ifstream fin(FileName);
+		std::string Line;
+		std::vector<std::array<double, 3>> Rows;
+		while(std::getline(fin, Line)){
+			std::array<double, 3> Row = {0};
+			std::stringstream ss(Line);
+			std::string Field;
+			for(size_t i = 0; i < Row.size() && std::getline(ss, Field, ','); ++i) Row[i] = std::stod(Field);
+			Rows.push_back(Row);
+		}
+
+		// トリガ時刻の前後で数え，周期番号が連続していて値が与えた信号と一致するかを見る
+		const double tTrig = Ts*static_cast<double>(kTrig);
+		size_t Pre = 0, PostRows = 0;
+		bool Contiguous = true;
+		double Err = 0;
+		for(size_t j = 0; j < Rows.size(); ++j){
+			const size_t k = kTrig - PreNum + j;
+			if(Rows[j][0] < tTrig - 0.5*Ts){
+				++Pre;
+			}else{
+				++PostRows;
+			}
+			Contiguous &= Rows[j][2] == static_cast<double>(k);
+			Err = std::max(Err, std::abs(Rows[j][0] - Ts*static_cast<double>(k)) + std::abs(Rows[j][1] - Signal(k)));
+		}
+		const bool ret = Pre == PreNum && PostRows == Post && Contiguous == true && Err < 1e-12;
+		printf("%-9s : trigger at k = %3zu, %2zu rows before (ref. %zu), %2zu rows from trigger (ref. %zu), %s, max. err. %.1e : %s\n",
+			Name, kTrig, Pre, PreNum, PostRows, Post, Contiguous ? "contiguous" : "gap", Err, ret ? "OK" : "NG");
+		return ret;
+	}
+}
+
+//! @brief オフライン計算用のメイン関数
+//! @return 終了状態
+int main(void){
+	printf("ARCS OFFLINE CALCULATION MODE\n");
+
+	// ここにオフライン計算のコードを記述
+	bool Passed = true;
+	size_t k = 0;
+
+	// 1. しきい値トリガ (立ち上がり，立ち下がり) と TriggerIf，書き出し後の再待機
+	{
+		Recorder Rec("TRIGREC");
+		const std::array<const char*, 3> Name = {"RISING", "FALLING", "TriggerIf"};
+		for(size_t n = 0; n < Name.size(); ++n){
+			// トリガ条件の設定
+			Rec.ClearTriggers();
+			if(n == 0) Rec.SetTrigger(0, 0,  0.5, TriggerMode::RISING);
+			if(n == 1) Rec.SetTrigger(0, 0, -0.5, TriggerMode::FALLING);
+			const size_t kIf = k + 2*PreNum;	// TriggerIf でトリガをかける周期番号
+
+			// トリガがかかるまで記録
+			const size_t kStart = k;
+			while(Rec.IsArmed() == true && k < kStart + Period){
+				Feed(Rec, k);
+				if(n == 2) Rec.TriggerIf(k == kIf);
+				++k;
+			}
+			const size_t kTrig = k - 1;
+
+			// 信号から求めたトリガ時点と一致するか
+			size_t kRef = kIf;
+			if(n < 2){
+				kRef = kStart + 1;
+				while(n == 0 ? !(Signal(kRef - 1) < 0.5 && 0.5 <= Signal(kRef)) : !(-0.5 < Signal(kRef - 1) && Signal(kRef) <= -0.5)) ++kRef;
+			}
+			Passed &= kTrig == kRef;
+
+			// トリガ後のデータを記録して書き出しを待つ
+			for(size_t j = 1; j < PostNum; ++j) Feed(Rec, k++);
+			Feed(Rec, k++);	// 凍結中のデータは捨てられること
+			const bool Rearmed = WaitRearm(Rec, n + 1);
+			printf("%-9s : re-armed %s, captures %zu\n", Name[n], Rearmed ? "yes" : "no", Rec.GetCaptureCount());
+			Passed &= Rearmed;
+
+			char Number[16];
+			snprintf(Number, sizeof(Number), "_%03zu.csv", n);
+			Passed &= CheckCapture(std::string("TRIGREC") + Number, Name[n], kTrig, PostNum);
+		}
+		printf("\n");
+	}
+
+	// 2. トリガ後のデータを記録中に破棄したとき
+	{
+		size_t kTrig = 0;
+		{
+			Recorder Rec("TRIGEXIT");
+			for(size_t j = 0; j < 2*PreNum; ++j, ++k) Feed(Rec, k);
+			kTrig = k - 1;
+			Rec.Trigger();
+			for(size_t j = 1; j < ExitPost; ++j, ++k) Feed(Rec, k);
+			printf("Destroyed while triggered (armed %s)\n", Rec.IsArmed() ? "yes" : "no");
+		}
+		Passed &= CheckCapture("TRIGEXIT_000.csv", "Exit", kTrig, ExitPost);
+	}
+
+	printf("\nAccuracy check : %s\n", Passed ? "PASS" : "FAIL");
+
+	return EXIT_SUCCESS;	// 正常終了
+}
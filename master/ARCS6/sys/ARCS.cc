@@ -1,6 +1,6 @@
 //! @file ARCS.cc
 //! @brief Advanced Robot Control System V6, ARCS6
-//! @date 2024/06/26
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //!
 //! @par コーディングの信条
@@ -83,9 +83,13 @@ int main(void){
 		
 		// 指令に従って挙動を変更
 		if(PhaseRef == ARCSscreen::PHAS_RESTART){			// 「RESTART」が押された場合は，
+			if constexpr(ARCSparams::SAVE_ON_RESTART){
+				ARCSthd.SaveDataFiles(true);				// 設定されていれば前回の測定データをバックグラウンドで保存しつつ，
+			}
 			ARCSthd.Reset();								// リアルタイムスレッドをリセットしてループ続行
 		}else if(PhaseRef == ARCSscreen::PHAS_SAVEEXIT){	// 「SAVE and EXIT」が押された場合は，
-			ARCSthd.SaveDataFiles();						// 測定データを保存して，
+			ARCSthd.SaveDataFiles(false);					// 測定データの保存を開始して，
+			ARCSthd.WaitSaveDataFiles();					// 保存完了を待ってから，
 			break;											// ループを抜ける
 		}else{
 			break;	// 「DISCARD and EXIT」が押された場合は何もせずループを抜ける
@@ -1,6 +1,6 @@
 //! @file ARCSassert.cc
 //! @brief ARCS用ASSERTクラス
-//! @date 2020/03/12
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2023 Yokokura, Yuki
@@ -20,8 +20,8 @@ pthread_cond_t ARCSassert::SyncCond = PTHREAD_COND_INITIALIZER;		//!< 待機条
 bool ARCSassert::RealtimeModeFlag = false;		//!< リアルタイムモードフラグ true = リアルタイム，false = 非リアルタイム
 bool ARCSassert::EmergencyStopFlag = false;		//!< 緊急停止フラグ  true = 緊急停止, false = 通常
 bool ARCSassert::EmergencyProcDoneFlag = true;	//!< 緊急停止処理完了フラグ true = 完了，false = 未完了 (WaitEmergencyが呼ばれる前はtrueで初期化しておく，WaitEmergencyが呼ばれる前にassertが失敗するとassert_from_macroでブロックされてしまうのを防止)
-std::string ARCSassert::EmergencyStopCond = "";	//!< 緊急停止時該当条件
-std::string ARCSassert::EmergencyStopFile = "";	//!< 緊急停止時ファイル名
+const char* ARCSassert::EmergencyStopCond = "";	//!< 緊急停止時該当条件
+const char* ARCSassert::EmergencyStopFile = "";	//!< 緊急停止時ファイル名
 int ARCSassert::EmergencyStopLine = 0;			//!< 緊急停止時行番号
 
 //! @brief コンストラクタ
@@ -36,13 +36,24 @@ ARCSassert::~ARCSassert(){
 	PassedLog();
 }
 
-//! @brief ARCS用assert関数(マクロから呼ばれることを想定)
+//! @brief ARCS用assert関数(旧マクロ互換用)
 //! @param[in] assertion assert条件
 //! @param[in] condition assert条件の文字列
 //! @param[in] file assert条件に引っかかったときのファイル名
 //! @param[in] line assert条件に引っかかったときの行番号
-void ARCSassert::assert_from_macro(const bool assertion, const std::string& condition, const std::string& file, const int line){
-	if(assertion == false && EmergencyStopFlag == false){	// assertion条件に一致しなくて且つ以前に緊急停止されていないとき
+void ARCSassert::assert_from_macro(const bool assertion, const char* condition, const char* file, const int line){
+	if(__builtin_expect(assertion, true)) return;	// 条件成立時は何もしない
+	assert_failed(condition, file, line);
+}
+
+//! @brief ARCS用assert失敗時処理関数(マクロから呼ばれることを想定)
+//! 条件が偽のときにのみ呼ばれる。以前に緊急停止されていないときは呼び出し元へは戻らない。
+//! 既に緊急停止が掛かっているときは従来通り何もせずに戻る。
+//! @param[in] condition assert条件の文字列(文字列リテラル)
+//! @param[in] file assert条件に引っかかったときのファイル名(文字列リテラル)
+//! @param[in] line assert条件に引っかかったときの行番号
+void ARCSassert::assert_failed(const char* condition, const char* file, const int line){
+	if(EmergencyStopFlag == false){	// 以前に緊急停止されていないとき
 		// assert情報を設定
 		pthread_mutex_lock(&SyncMutex);		// Mutexロック
 		EmergencyStopFlag = true;			// 緊急停止フラグを立てる
@@ -63,7 +74,7 @@ void ARCSassert::assert_from_macro(const bool assertion, const std::string& cond
 		EventLog("Waiting for Emergency Process...Done");
 		
 		// イベントログに状況を書き込む
-		ARCSeventlog::WriteEventLog(condition, ">>>>> EMERGENCY STOP <<<<< : " + file, line);
+		ARCSeventlog::WriteEventLog(condition, std::string(">>>>> EMERGENCY STOP <<<<< : ") + file, line);
 		
 		if(RealtimeModeFlag == true){
 			// リアルタイムモードで動作中のとき
@@ -74,8 +85,8 @@ void ARCSassert::assert_from_macro(const bool assertion, const std::string& cond
 			// assertionメッセージ表示
 			PassedLog();
 			printf("ASSERTION FAILED IN NON-REALTIME MODE\n");			// エラーメッセージ表示
-			printf("  CONDITION   : %s\n", EmergencyStopCond.c_str());	// 引っ掛かった条件表示
-			printf("  FILE NAME   : %s\n", EmergencyStopFile.c_str());	// 引っ掛かったファイル名
+			printf("  CONDITION   : %s\n", EmergencyStopCond);			// 引っ掛かった条件表示
+			printf("  FILE NAME   : %s\n", EmergencyStopFile);			// 引っ掛かったファイル名
 			printf("  LINE NUMBER : %d\n", EmergencyStopLine);			// 引っ掛かった行番号
 			exit(1);													// 強制終了
 		}
@@ -1,6 +1,6 @@
 //! @file ARCSassert.hh
 //! @brief ARCS用ASSERTクラス
-//! @date 2023/10/23
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2023 Yokokura, Yuki
@@ -13,8 +13,9 @@
 #include <pthread.h>
 #include <string>
 
-// 関数呼び出し用マクロ(コンパイル時定数の場合assertを呼び出し、実行時の場合assert_from_macroを呼び出す)
-#define arcs_assert(a) (__builtin_constant_p(a) ? assert(a) : ARCSassert::assert_from_macro(a,#a,__FILE__,__LINE__))	//!< ARCS用assertマクロ  a : assert条件
+// 関数呼び出し用マクロ(コンパイル時定数の場合assertを呼び出し、実行時の場合は条件が偽のときのみassert_failedを呼び出す)
+// 条件が真の場合は分岐予測の効く比較1回のみで済み、文字列の生成や関数呼び出しは一切発生しない
+#define arcs_assert(a) (__builtin_constant_p(a) ? assert(a) : (__builtin_expect(static_cast<bool>(a), true) ? static_cast<void>(0) : ARCS::ARCSassert::assert_failed(#a,__FILE__,__LINE__)))	//!< ARCS用assertマクロ  a : assert条件
 
 namespace ARCS {	// ARCS名前空間
 	//! @brief ARCS用ASSERTクラス
@@ -22,7 +23,9 @@ namespace ARCS {	// ARCS名前空間
 		public:
 			ARCSassert();	//!< コンストラクタ
 			~ARCSassert();	//!< デストラクタ
-			static void assert_from_macro(const bool assertion, const std::string& condition, const std::string& file, const int line); //!<ARCS用assert関数(マクロから呼ばれることを想定)
+			static void assert_from_macro(const bool assertion, const char* condition, const char* file, const int line); //!<ARCS用assert関数(旧マクロ互換用)
+			[[gnu::cold, gnu::noinline]]
+			static void assert_failed(const char* condition, const char* file, const int line);	//!< ARCS用assert失敗時処理関数(マクロから呼ばれることを想定)
 			bool IsRealtimeMode(void);		//!< リアルタイムモードかどうか返す関数
 			void SetRealtimeMode(void);		//!< リアルタイムモードに切り替える関数
 			void SetNonRealtimeMode(void);	//!< 非リアルタイムモードに切り替える関数
@@ -46,8 +49,8 @@ namespace ARCS {	// ARCS名前空間
 			static bool RealtimeModeFlag;			//!< リアルタイムモードフラグ
 			static bool EmergencyStopFlag;			//!< 緊急停止フラグ  true = 緊急停止, false = 通常
 			static bool EmergencyProcDoneFlag;		//!< 緊急停止処理完了フラグ true = 完了，false = 未完了
-			static std::string EmergencyStopCond;	//!< 緊急停止時該当条件
-			static std::string EmergencyStopFile;	//!< 緊急停止時ファイル名
+			static const char* EmergencyStopCond;	//!< 緊急停止時該当条件 (マクロから渡される文字列リテラルを指す)
+			static const char* EmergencyStopFile;	//!< 緊急停止時ファイル名 (マクロから渡される文字列リテラルを指す)
 			static int EmergencyStopLine;			//!< 緊急停止時行番号
 	};
 }
@@ -3,7 +3,7 @@
 //!
 //! グラフを描画するクラス
 //!
-//! @date 2024/10/11
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2024 Yokokura, Yuki
@@ -113,6 +113,24 @@ void ARCSgraphics::SaveScreenImage(void){
 	EventLog("Writing PNG File...Done");
 }
 
+//! @brief 画面の複製を取得する関数
+//! 複製した画像は別スレッドからSaveScreenImageでPNGファイルに書き出せる。
+//! @return	画面画像データへのスマートポインタ
+ARCSgraphics::ScreenImage ARCSgraphics::GetScreenSnapshot(void){
+	FG.LoadFrameToScreen();			// フレームバッファから画面バッファに読み込み
+	return FG.GetScreenSnapshot();	// 画面バッファの複製
+}
+
+//! @brief 画面の複製をPNGファイルとして出力する関数
+//! @param[in]	Image		GetScreenSnapshotで取得した画面画像データ
+//! @param[in]	FileName	PNGファイル名
+//! @param[in]	Progress	進捗通知用の関数オブジェクト(引数は0～1の進捗率)
+void ARCSgraphics::SaveScreenImage(const ScreenImage& Image, const std::string& FileName, const std::function<void(double)>& Progress){
+	EventLog("Writing PNG File...");
+	FG.SavePngImageFile(FileName, Image.get(), Progress);	// PNGファイル書き出し
+	EventLog("Writing PNG File...Done");
+}
+
 //! @brief 時系列プロット平面を描画する関数
 void ARCSgraphics::DrawTimeSeriesPlotPlane(void){
 	// 時系列プロット平面の分だけグラフパラメータの設定＆描画
@@ -3,7 +3,7 @@
 //!
 //! グラフを描画するクラス
 //!
-//! @date 2024/10/12
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2024 Yokokura, Yuki
@@ -15,6 +15,8 @@
 #include <pthread.h>
 #include <cfloat>
 #include <functional>
+#include <memory>
+#include <string>
 #include "ConstParams.hh"
 #include "EquipParams.hh"
 #include "ArcsMatrix.hh"
@@ -31,6 +33,11 @@ class ARCSgraphics {
 		void ResetWaves(void);		//!< プロットをリセットする関数
 		void SaveScreenImage(void);	//!< 画面をPNGファイルとして出力する関数
 		
+		//! @brief 画面画像データへのスマートポインタの型
+		using ScreenImage = std::unique_ptr<typename FrameGraphics<EquipParams::SCR_DEPTH>::TF[]>;
+		ScreenImage GetScreenSnapshot(void);	//!< 画面の複製を取得する関数
+		void SaveScreenImage(const ScreenImage& Image, const std::string& FileName, const std::function<void(double)>& Progress);	//!< 画面の複製をPNGファイルとして出力する関数
+		
 		//! @brief プロット描画時間に値を設定する関数
 		//! @param[in]	T	周期 [s]
 		//! @param[in]	t	時刻 [s]
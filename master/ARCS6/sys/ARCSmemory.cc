@@ -3,13 +3,14 @@
 //!
 //! 実験データ保存用のデータメモリクラス。CSVファイルへの出力も行う。
 //!
-//! @date 2024/05/06
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2024 Yokokura, Yuki
 // MIT License. For details, see the LICENSE file.
 
 #include <cassert>
+#include <algorithm>
 #include "ARCSmemory.hh"
 #include "CsvManipulator.hh"
 
@@ -31,10 +32,13 @@ using namespace ARCS;
 //! @brief コンストラクタ
 ARCSmemory::ARCSmemory()
 	: SaveBuffer(nullptr),
+	  RowBuffer({0}),
+	  LiveTelemetry(nullptr),
 	  Tindex(0),
 	  Nindex(0),
 	  Tperiod(0),
-	  Time(0)
+	  Time(0),
+	  SaveNow(false)
 {
 	PassedLog();
 	
@@ -42,10 +46,10 @@ ARCSmemory::ARCSmemory()
 	static_assert(ConstParams::DATA_START < ConstParams::DATA_END);
 	
 	// データバッファのメモリ確保とゼロ埋め
-	SaveBuffer = std::make_unique< std::array<std::array<double, ConstParams::DATA_NUM >, ARCSmemory::ELEMENT_NUM> >();
-	for(size_t j = 0; j < ARCSmemory::ELEMENT_NUM; ++j){
-		SaveBuffer->at(j).fill(0);
-	}
+	SaveBuffer = AllocateDataBuffer();
+	
+	// 共有メモリテレメトリの生成
+	if constexpr(ARCSparams::TELEMETRY_ENABLE) LiveTelemetry = std::make_unique<ARCSmemory::Telemetry>(ARCSparams::TELEMETRY_NAME);
 	
 	PassedLog();
 }
@@ -62,5 +66,39 @@ void ARCSmemory::Reset(void){
 
 //! @brief CSVファイルを書き出す関数
 void ARCSmemory::WriteCsvFile(void){
-	CsvManipulator::SaveFile(std::move(SaveBuffer), ConstParams::DATA_NAME, ConstParams::DATA_NUM, Tindex);
+	auto [Data, Num] = MoveDataBuffer(false);	// データバッファを引き取って，
+	WriteCsvFile(std::move(Data), Num, ConstParams::DATA_NAME, nullptr);	// そのまま書き出す
+}
+
+//! @brief データバッファを引き渡して新しいバッファに切り替える関数
+//! リアルタイムスレッド停止中に呼ぶこと。Renew = true なら引き渡した後は新しいバッファに次の実験データが格納される。
+//! 終了時のように次の実験が無い場合は Renew = false として，新しいバッファを確保しない(以降のデータは捨てられる)。
+//! @param[in]	Renew	true = 次の実験用に新しいバッファを確保する，false = 確保しない
+//! @return	データバッファ, 格納済みのデータ数
+std::tuple<ARCSmemory::DataBuffer, size_t> ARCSmemory::MoveDataBuffer(const bool Renew){
+	DataBuffer ret = std::move(SaveBuffer);	// データバッファをムーブで引き渡す
+	const size_t Num = std::min(Tindex, ELEMENT_NUM);	// 格納済みのデータ数
+	if(Renew) SaveBuffer = AllocateDataBuffer();	// 次の実験用に新しいバッファを確保
+	Tindex = 0;		// 時間用カウンタをゼロに戻す
+	return {std::move(ret), Num};
+}
+
+//! @brief 引き渡されたデータバッファをCSVファイルに書き出す関数
+//! 別スレッドから呼ばれることを想定
+//! @param[in]	Data		MoveDataBufferで引き渡されたデータバッファ
+//! @param[in]	Num			格納済みのデータ数
+//! @param[in]	FileName	CSVファイル名
+//! @param[in]	Progress	進捗通知用の関数オブジェクト(引数は0～1の進捗率, 不要ならnullptr)
+void ARCSmemory::WriteCsvFile(DataBuffer&& Data, const size_t Num, const std::string& FileName, const std::function<void(double)>& Progress){
+	CsvManipulator::SaveFile(std::move(Data), FileName, ConstParams::DATA_NUM, Num, Progress);
+}
+
+//! @brief ゼロ埋めしたデータバッファを確保する関数
+//! @return	データバッファ
+ARCSmemory::DataBuffer ARCSmemory::AllocateDataBuffer(void){
+	DataBuffer ret = std::make_unique< std::array<std::array<double, ConstParams::DATA_NUM >, ARCSmemory::ELEMENT_NUM> >();
+	for(size_t j = 0; j < ARCSmemory::ELEMENT_NUM; ++j){
+		ret->at(j).fill(0);
+	}
+	return ret;
 }
@@ -3,7 +3,7 @@
 //!
 //! 実験データを保存してCSVファイルへの出力を行うクラス。
 //!
-//! @date 2024/05/06
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2024 Yokokura, Yuki
@@ -14,22 +14,45 @@
 
 #include <array>
 #include <memory>
+#include <tuple>
+#include <functional>
+#include <string>
 #include <cmath>
 #include "ConstParams.hh"
+#include "ARCSparams.hh"
+#include "TelemetryRing.hh"
 
 namespace ARCS {	// ARCS名前空間
 	//! @brief データメモリクラス
 	class ARCSmemory {
 		public:
+			//! @brief [-] データの要素数(丸め誤差対策のために念のため1個分メモリを多く確保しておく)
+			static constexpr size_t ELEMENT_NUM = (ConstParams::DATA_END - ConstParams::DATA_START)/ConstParams::DATA_RESO + 1;
+			
+			//! @brief データバッファへのスマートポインタの型
+			//! 巨大なデータを扱えるようにヒープ領域に確保する
+			using DataBuffer = std::unique_ptr<std::array<
+				std::array<double, ConstParams::DATA_NUM>,
+				ELEMENT_NUM
+			>>;
+			
 			ARCSmemory();				//!< コンストラクタ
 			~ARCSmemory();				//!< デストラクタ
+			//! @brief 共有メモリテレメトリの型 (各サンプルの変数値はCSVファイルの1行と同じ並び)
+			using Telemetry = TelemetryWriter<ConstParams::DATA_NUM, ARCSparams::TELEMETRY_RING_LEN>;
+			
 			void Reset(void);			//!< リセットする関数
 			void WriteCsvFile(void);	//!< CSVファイルを書き出す関数
+			std::tuple<DataBuffer, size_t> MoveDataBuffer(const bool Renew);	//!< データバッファを引き渡して新しいバッファに切り替える関数
+			static void WriteCsvFile(DataBuffer&& Data, const size_t Num, const std::string& FileName, const std::function<void(double)>& Progress);	//!< 引き渡されたデータバッファをCSVファイルに書き出す関数
 			
 			//! @brief データを格納する関数(可変長引数テンプレート)
+			//! テレメトリが無効で保存時刻でもない周期では，時刻を読んだところで打ち切って1行分のバッファには触れない。
 			//! @param[in] u1...u2 インジケータの値
 			template<typename T1, typename... T2>
 			void SetData(const T1& u1, const T2&... u2){
+				static_assert(sizeof...(T2) <= ConstParams::DATA_NUM, "ARCSmemory: Too many variables");	// 周期と時刻を除いて DATA_NUM - 1 個まで
+				
 				// 再帰で順番に可変長引数を読み込んでいく
 				if(Nindex == 0){
 					// 1個目の引数は周期として一時的に格納
@@ -37,32 +60,33 @@ namespace ARCS {	// ARCS名前空間
 				}else if(Nindex == 1){
 					// 2個目の引数は時刻として一時的に格納
 					Time = (double)u1;
-					if(
-						Time < ConstParams::DATA_START || ConstParams::DATA_END <= Time	||
-						Tperiod < fmod(Time - ConstParams::DATA_START, ConstParams::DATA_RESO)
-					){
-						// 保存時間の範囲外，もしくは保存時刻でなかったら
+					SaveNow = IsSaveTime();
+					if(ARCSparams::TELEMETRY_ENABLE == false && SaveNow == false){
+						// テレメトリが無効で保存時刻でもなかったら
 						Nindex = 0;	// 再帰カウンタを零に戻しておいてから
 						return;		// 可変長引数の読み込みを打ち切る
 					}
+					RowBuffer[0] = Time;			// 1列目は時刻
 				}else{
-					// 3個目以降は変数値として処理
-					if(0 <= Tindex && Tindex < ELEMENT_NUM){
-						// 念のための要素番号リミッタ
-						SaveBuffer->at(Tindex).at(Nindex - 1) = (double)u1;	// 2列目以降に変数値を保存
-					}
+					// 3個目以降は変数値として処理 (引数の数は上の static_assert で確認済みなので要素番号の範囲確認は不要)
+					RowBuffer[Nindex - 1] = (double)u1;	// 2列目以降は変数値
 				}
 				++Nindex;		// 再帰カウンタをインクリメント
 				SetData(u2...);	// 自分自身を呼び出す(再帰)
 			}
 			//! @brief 再帰の最後に呼ばれる関数
 			void SetData(){
-				if(0 <= Tindex && Tindex < ELEMENT_NUM){
+				Nindex = 0;		// 可変長引数の読み込み作業が終わったので，再帰カウンタを零に戻しておく
+				
+				// 共有メモリテレメトリへは全周期で配信
+				if constexpr(ARCSparams::TELEMETRY_ENABLE) LiveTelemetry->Publish(Time, RowBuffer);
+				
+				if(SaveNow == false) return;	// 保存時刻でなかったら何もしない
+				if(0 <= Tindex && Tindex < ELEMENT_NUM && SaveBuffer != nullptr){
 					// 念のための要素番号リミッタ
-					SaveBuffer->at(Tindex).at(0) = Time;// 1列目に時刻を保存
+					SaveBuffer->at(Tindex) = RowBuffer;	// 1行分を保存
 				}
-				++Tindex;							// 時間用カウンタを進める
-				Nindex = 0;		// 可変長引数の読み込み作業が終わったので，再帰カウンタを零に戻しておく
+				++Tindex;		// 時間用カウンタを進める
 			}
 			
 		private:
@@ -70,19 +94,23 @@ namespace ARCS {	// ARCS名前空間
 			ARCSmemory(const ARCSmemory&) = delete;					//!< コピーコンストラクタ使用禁止
 			const ARCSmemory& operator=(const ARCSmemory&) = delete;//!< 代入演算子使用禁止
 			
-			//! @brief [-] データの要素数(丸め誤差対策のために念のため1個分メモリを多く確保しておく)
-			static constexpr size_t ELEMENT_NUM = (ConstParams::DATA_END - ConstParams::DATA_START)/ConstParams::DATA_RESO + 1;
+			static DataBuffer AllocateDataBuffer(void);	//!< ゼロ埋めしたデータバッファを確保する関数
 			
-			//! @brief データバッファへのスマートポインタ
-			//! 巨大なデータを扱えるようにヒープ領域に確保する
-			std::unique_ptr<std::array<
-				std::array<double, ConstParams::DATA_NUM>,
-				ELEMENT_NUM
-			>> SaveBuffer;
+			//! @brief 今回の時刻が保存時間の範囲内かつ保存時刻かを返す関数
+			//! @return true = 保存する
+			bool IsSaveTime(void) const {
+				return ConstParams::DATA_START <= Time && Time < ConstParams::DATA_END
+					&& fmod(Time - ConstParams::DATA_START, ConstParams::DATA_RESO) <= Tperiod;
+			}
+			
+			DataBuffer SaveBuffer;	//!< データバッファへのスマートポインタ
+			std::array<double, ConstParams::DATA_NUM> RowBuffer;	//!< 1行分のデータバッファ
+			std::unique_ptr<Telemetry> LiveTelemetry;	//!< 共有メモリテレメトリへのスマートポインタ
 			size_t Tindex;		//!< 時間用カウンタ
 			size_t Nindex;		//!< 変数用カウンタ
 			double Tperiod;		//!< [s] 周期
 			double Time;		//!< [s] 時刻
+			bool SaveNow;		//!< 今回の周期が保存時刻かどうか
 	};
 }
 
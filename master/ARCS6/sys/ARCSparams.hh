@@ -3,7 +3,7 @@
 //!
 //! ARCSシステムコード内で共通に使用するパラメータ設定のための静的関数クラス
 //!
-//! @date 2024/10/12
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2024 Yokokura, Yuki
@@ -32,23 +32,35 @@ class ARCSparams {
 		static constexpr int ARCS_POL_GRPL = SCHED_RR;	//!< グラフ表示スレッドのポリシー
 		static constexpr int ARCS_POL_INFO = SCHED_RR;	//!< 情報取得スレッドのポリシー
 		static constexpr int ARCS_POL_MAIN = SCHED_RR;	//!< main関数のポリシー
+		static constexpr int ARCS_POL_SAVE = SCHED_RR;	//!< データ保存スレッドのポリシー
 		static constexpr int ARCS_PRIO_CMDI = 32;		//!< 指令入力スレッドの優先順位(SCHED_RRはFIFO+32にするのがPOSIX.1-2001での決まり)
 		static constexpr int ARCS_PRIO_DISP = 33;		//!< 表示スレッドの優先順位
 		static constexpr int ARCS_PRIO_EMER = 34;		//!< 緊急停止スレッドの優先順位
 		static constexpr int ARCS_PRIO_GRPL = 35;		//!< グラフ表示スレッドの優先順位
 		static constexpr int ARCS_PRIO_INFO = 36;		//!< 情報取得スレッドの優先順位
 		static constexpr int ARCS_PRIO_MAIN = 37;		//!< main関数スレッドの優先順位
+		static constexpr int ARCS_PRIO_SAVE = 38;		//!< データ保存スレッドの優先順位(一番低くしておく)
 		static constexpr size_t  ARCS_CPU_CMDI = 0;		//!< 指令入力スレッドに割り当てるCPUコア番号（実時間スレッドとは別にすること）
 		static constexpr size_t  ARCS_CPU_DISP = 0;		//!< 表示スレッドに割り当てるCPUコア番号（実時間スレッドとは別にすること）
 		static constexpr size_t  ARCS_CPU_EMER = 0;		//!< 緊急停止スレッドに割り当てるCPUコア番号（実時間スレッドとは別にすること）
 		static constexpr size_t  ARCS_CPU_GRPL = 1;		//!< グラフ表示スレッドに割り当てるCPUコア番号（実時間スレッドとは別にすること）
 		static constexpr size_t  ARCS_CPU_INFO = 0;		//!< 情報取得スレッドに割り当てるCPUコア番号（実時間スレッドとは別にすること）
 		static constexpr size_t  ARCS_CPU_MAIN = 0;		//!< main関数に割り当てるCPUコア番号（実時間スレッドとは別にすること）
+		static constexpr size_t  ARCS_CPU_SAVE_PNG = 0;	//!< PNG画像保存スレッドに割り当てるCPUコア番号（実時間スレッドとは別にすること）
+		static constexpr size_t  ARCS_CPU_SAVE_CSV = 1;	//!< CSVファイル保存スレッドに割り当てるCPUコア番号（実時間スレッドとは別にすること）
 		static constexpr unsigned long ARCS_TIME_DISP = 33333;	//!< [us] 表示の更新時間（ここの時間は厳密ではない）
 		static constexpr unsigned long ARCS_TIME_GRPL = 33333;	//!< [us] グラフ表示の更新時間（ここの時間は厳密ではない）
 		static constexpr unsigned long ARCS_TIME_INFO = 33333;	//!< [us] 情報取得の更新時間（ここの時間は厳密ではない）
 		static constexpr size_t THREAD_MAX = 3;			//!< リアルタイムスレッド最大数 (変更不可)
 		
+		// データ保存の設定
+		static constexpr bool SAVE_ON_RESTART = false;	//!< RESTART時にも前回の実験データをバックグラウンドで保存するかどうか (true = 保存する，ファイル名に "_1", "_2", ... の実験番号が付く)
+		
+		// 共有メモリテレメトリの設定
+		static constexpr bool TELEMETRY_ENABLE = false;				//!< 実験データ保存変数を共有メモリへ全周期で配信するかどうか (true = 配信する，既定は無効)
+		static constexpr char TELEMETRY_NAME[] = "/ARCS_TELEMETRY";	//!< 共有メモリの名前 (/dev/shm以下に生成される)
+		static constexpr size_t TELEMETRY_RING_LEN = 16384;			//!< [-] 共有メモリリングバッファの長さ
+		
 		// 実験機アクチュエータの設定
 		static constexpr size_t ACTUATOR_MAX = 16;		//!< [基] ARCSが対応しているアクチュエータの最大数
 	
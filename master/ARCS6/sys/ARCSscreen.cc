@@ -1,13 +1,14 @@
 //! @file ARCSscreen.cc
 //! @brief ARCS画面描画クラス
 //!        ARCS用画面の描画を行います。
-//! @date 2024/10/11
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2024 Yokokura, Yuki
 // MIT License. For details, see the LICENSE file.
 
 #include <unistd.h>
+#include <cstdio>
 #include <iostream>
 #include <tuple>
 #include <stdexcept>
@@ -723,6 +724,13 @@ void ARCSscreen::DispButtons(void){
 
 //! @brief メッセージを表示する関数
 void ARCSscreen::DispMessage(void){
+	// データ保存の進捗表示文字列の生成(保存中のときのみ)
+	const auto [PngProgress, CsvProgress] = ScrPara.GetSaveProgress();
+	char SaveText[32] = {0};
+	if(PngProgress < 1 || CsvProgress < 1){
+		snprintf(SaveText, sizeof(SaveText), "  [PNG %3.0f%% CSV %3.0f%%]", PngProgress*100, CsvProgress*100);
+	}
+	
 	// 指令と実際の状態に従ってメッセージと表示灯を変える
 	if(      CommandStatus == PHAS_INIT && ActualStatus == PHAS_NONE){
 		ShowMessageText(" Now Loading ARCS...", CYAN_BLACK);						// ARCS読み込み中メッセージ表示
@@ -735,7 +743,7 @@ void ARCSscreen::DispMessage(void){
 	}else if(CommandStatus == PHAS_START && ActualStatus == PHAS_INIT){
 		ShowMessageText(" Now Loading Realtime Control Systems...", CYAN_BLACK);	// 制御系読み込み中メッセージ表示
 	}else if(CommandStatus == PHAS_START && ActualStatus == PHAS_START){
-		ShowMessageText(" Now Running Realtime Control Systems...", RED_BLACK);		// 動作中メッセージ表示
+		ShowMessageText(std::string(" Now Running Realtime Control Systems...") + SaveText, RED_BLACK);	// 動作中メッセージ表示(前回データの保存中は進捗も表示)
 		ShowOperationIndic(true);	// 「IN OPERATION」点灯
 	}else if(CommandStatus == PHAS_SETVAR && ActualStatus == PHAS_START){
 		ShowMessageText(" Now Waiting for Variable Settings...", GREEN_BLACK);		// 変数設定待機中メッセージ表示
@@ -756,7 +764,7 @@ void ARCSscreen::DispMessage(void){
 	}else if(CommandStatus == PHAS_DISCEXIT && ActualStatus == PHAS_DISCEXIT){
 		ShowMessageText(" Now Closing ARCS...Done", CYAN_BLACK);							// 破棄終了完了メッセージ表示
 	}else if(CommandStatus == PHAS_SAVEEXIT && ActualStatus == PHAS_STOP){
-		ShowMessageText(" Now Writing Storage Data and Closing ARCS...", CYAN_BLACK);		// 保存終了中メッセージ表示
+		ShowMessageText(std::string(" Now Writing Storage Data and Closing ARCS...") + SaveText, CYAN_BLACK);	// 保存終了中メッセージ表示(進捗も表示)
 		ShowStorageIndic(true);		// 「DATA STORAGE」点灯
 	}else if(CommandStatus == PHAS_SAVEEXIT && ActualStatus == PHAS_SAVEEXIT){
 		ShowMessageText(" Now Writing Storage Data and Closing ARCS...Done", CYAN_BLACK);	// 保存終了完了メッセージ表示
@@ -1,7 +1,7 @@
 //! @file ARCSscrparams.cc
 //! @brief ARCS画面パラメータ格納クラス
 //!        ARCS用画面に表示する各種パラメータを格納します。
-//! @date 2024/06/24
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2024 Yokokura, Yuki
@@ -19,6 +19,7 @@ ARCSscrparams::ARCSscrparams(void)
 	  ActMutex(PTHREAD_MUTEX_INITIALIZER),
 	  IndicMutex(PTHREAD_MUTEX_INITIALIZER),
 	  OnsetMutex(PTHREAD_MUTEX_INITIALIZER),
+	  SaveMutex(PTHREAD_MUTEX_INITIALIZER),
 	  Time(0),
 	  PeriodicTime({0}),
 	  ComputationTime({0}),
@@ -26,6 +27,8 @@ ARCSscrparams::ARCSscrparams(void)
 	  MinTime({0}),
 	  NetworkLink(false),
 	  Initializing(false),
+	  PngSaveProgress(1),
+	  CsvSaveProgress(1),
 	  CurrentRef({0}),
 	  PositionRes({0}),
 	  VarIndicator({0}),
@@ -42,6 +45,7 @@ ARCSscrparams::ARCSscrparams(void)
 	pthread_mutex_init(&ActMutex, nullptr);
 	pthread_mutex_init(&IndicMutex, nullptr);
 	pthread_mutex_init(&OnsetMutex, nullptr);
+	pthread_mutex_init(&SaveMutex, nullptr);
 }
 
 //! @brief デストラクタ
@@ -143,6 +147,33 @@ void ARCSscrparams::SetInitializing(const bool InitFlag){
 	Initializing = InitFlag;
 }
 
+//! @brief PNG画像とCSVファイルの保存進捗率を取得する関数
+//! @return PNG画像の保存進捗率, CSVファイルの保存進捗率 (0～1, 1なら保存完了)
+std::tuple<double, double> ARCSscrparams::GetSaveProgress(void){
+	double Png, Csv;
+	pthread_mutex_lock(&SaveMutex);
+	Png = PngSaveProgress;
+	Csv = CsvSaveProgress;
+	pthread_mutex_unlock(&SaveMutex);
+	return {Png, Csv};
+}
+
+//! @brief PNG画像の保存進捗率を設定する関数
+//! @param[in] Progress	保存進捗率 (0～1)
+void ARCSscrparams::SetPngSaveProgress(const double Progress){
+	pthread_mutex_lock(&SaveMutex);
+	PngSaveProgress = Progress;
+	pthread_mutex_unlock(&SaveMutex);
+}
+
+//! @brief CSVファイルの保存進捗率を設定する関数
+//! @param[in] Progress	保存進捗率 (0～1)
+void ARCSscrparams::SetCsvSaveProgress(const double Progress){
+	pthread_mutex_lock(&SaveMutex);
+	CsvSaveProgress = Progress;
+	pthread_mutex_unlock(&SaveMutex);
+}
+
 //! @brief 電流と位置を取得する関数
 //! @param[in]	ActNum	アクチュエータ番号
 //! @return	電流指令，位置応答
@@ -1,7 +1,7 @@
 //! @file ARCSscrparams.hh
 //! @brief ARCS画面パラメータ格納クラス
 //!        ARCS用画面に表示する各種パラメータを格納します。
-//! @date 2024/06/24
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2024 Yokokura, Yuki
@@ -12,6 +12,7 @@
 
 #include <pthread.h>
 #include <array>
+#include <tuple>
 #include "ARCSparams.hh"
 #include "EquipParams.hh"
 #include "ConstParams.hh"
@@ -48,6 +49,11 @@ namespace ARCS {	// ARCS名前空間
 			bool GetInitializing(void);					//!< ロボット初期化フラグを取得する関数
 			void SetInitializing(const bool InitFlag);	//!< ロボット初期化フラグを設定する関数
 			
+			// データ保存関連の関数
+			std::tuple<double, double> GetSaveProgress(void);	//!< PNG画像とCSVファイルの保存進捗率を取得する関数
+			void SetPngSaveProgress(const double Progress);		//!< PNG画像の保存進捗率を設定する関数
+			void SetCsvSaveProgress(const double Progress);		//!< CSVファイルの保存進捗率を設定する関数
+			
 			// アクチュエータ関連の関数
 			std::tuple<double, double>
 			 GetCurrentAndPosition(const unsigned int ActNum);	//!< 電流と位置を取得する関数
@@ -128,6 +134,7 @@ namespace ARCS {	// ARCS名前空間
 			pthread_mutex_t ActMutex;	//!< アクチュエータ関連変数アクセス用Mutex
 			pthread_mutex_t IndicMutex;	//!< 任意変数インジケータ関連変数アクセス用Mutex
 			pthread_mutex_t OnsetMutex;	//!< オンライン設定変数アクセス用Mutex
+			pthread_mutex_t SaveMutex;	//!< データ保存関連変数アクセス用Mutex
 			
 			// リアルタイムスレッド関連の変数
 			double Time;												//!< [s] 時刻 (一番速いスレッド THREAD0 の時刻)
@@ -140,6 +147,10 @@ namespace ARCS {	// ARCS名前空間
 			bool NetworkLink;		//!< ネットワークリンクフラグ
 			bool Initializing;		//!< ロボット初期化フラグ
 			
+			// データ保存関連の変数
+			double PngSaveProgress;	//!< PNG画像の保存進捗率 (0～1)
+			double CsvSaveProgress;	//!< CSVファイルの保存進捗率 (0～1)
+			
 			// アクチュエータ関連の変数
 			std::array<double, EquipParams::ACTUATOR_NUM> CurrentRef;	//!< [A] アクチュエータの電流指令値
 			std::array<double, EquipParams::ACTUATOR_NUM> PositionRes;	//!< [m]/[rad] アクチュエータの位置応答値
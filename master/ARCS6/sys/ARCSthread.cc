@@ -3,13 +3,14 @@
 //!
 //! リアルタイムスレッドの生成、開始、停止、破棄などの管理をします。
 //!
-//! @date 2024/10/15
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2024 Yokokura, Yuki
 // MIT License. For details, see the LICENSE file.
 
 #include <unistd.h>
+#include <tuple>
 #include "ARCSthread.hh"
 #include "ARCScommon.hh"
 #include "ARCSeventlog.hh"
@@ -34,7 +35,16 @@ ARCSthread::ARCSthread(ARCSassert& Asrt, ARCSscrparams& SP, ARCSgraphics& GP) :
 	InfoState(ITS_IDLE),					// 情報取得スレッドの初期状態
 	InfoMutex(PTHREAD_MUTEX_INITIALIZER),	// 情報取得スレッド同期用Mutex
 	InfoCond(PTHREAD_COND_INITIALIZER),		// 情報取得スレッド同期用条件
-	InfoGetThreadID()						// 情報取得スレッドの識別子の初期化
+	InfoGetThreadID(),						// 情報取得スレッドの識別子の初期化
+	PngImage(nullptr),	// 保存待ちのスクリーンショット
+	CsvData(nullptr),	// 保存待ちの実験データ
+	CsvDataNum(0),		// 保存待ちの実験データ数
+	PngFileName(),		// 保存待ちのPNGファイル名
+	CsvFileName(),		// 保存待ちのCSVファイル名
+	RestartSaveCount(0),// RESTART時に保存した回数
+	SaveActive(false),	// データ保存スレッドは停止中
+	PngSaveThreadID(),	// PNG画像保存スレッドの識別子の初期化
+	CsvSaveThreadID()	// CSVファイル保存スレッドの識別子の初期化
 {
 	PassedLog();
 	pthread_mutex_init(&InfoMutex, nullptr);// 情報取得スレッド同期用Mutex初期化
@@ -59,6 +69,7 @@ ARCSthread::ARCSthread(ARCSassert& Asrt, ARCSscrparams& SP, ARCSgraphics& GP) :
 
 //! @brief デストラクタ
 ARCSthread::~ARCSthread(){
+	WaitSaveDataFiles();				// データ保存中なら完了まで待機
 	pthread_mutex_lock(&InfoMutex);		// Mutexロック
 	InfoState = ITS_DSTRCT;				// スレッド破棄が指令されたことを知らせる
 	pthread_cond_broadcast(&InfoCond);	// 実際の状態が更新されたことをスレッドに知らせる
@@ -109,14 +120,78 @@ void ARCSthread::Reset(void){
 	ExpDatMem.Reset();	// 実験データ保存メモリもリセット
 }
 
-//! @brief 測定データを保存する関数
-void ARCSthread::SaveDataFiles(void){
+//! @brief 測定データのバックグラウンド保存を開始する関数
+//! リアルタイムスレッド停止中に呼ぶこと。スクリーンショットとデータバッファを引き取って，
+//! PNG画像とCSVファイルの書き出しは低優先度の別スレッドで行うので，この関数はすぐに戻る。
+//! @param[in]	Restart	true = RESTART時の保存(実験番号付きのファイル名にして次の実験用バッファを確保), false = 終了時の保存
+void ARCSthread::SaveDataFiles(const bool Restart){
+	WaitSaveDataFiles();	// 前回の保存がまだ終わっていなければ待機
 	EventLog("Writing PNG/CSV Data Files...");
-	Graph.SaveScreenImage();	// スクリーンショットをPNGに保存
-	ExpDatMem.WriteCsvFile();	// データメモリの中身をCSVに保存
+	if(Restart){
+		// RESTART時は前回までの保存を上書きしないように実験番号付きのファイル名にする
+		++RestartSaveCount;
+		PngFileName = AddRunIndex(ConstParams::PLOT_PNGFILENAME, RestartSaveCount);
+		CsvFileName = AddRunIndex(ConstParams::DATA_NAME, RestartSaveCount);
+	}else{
+		// 終了時は従来通りのファイル名
+		PngFileName = ConstParams::PLOT_PNGFILENAME;
+		CsvFileName = ConstParams::DATA_NAME;
+	}
+	PngImage = Graph.GetScreenSnapshot();	// スクリーンショットを取得
+	std::tie(CsvData, CsvDataNum) = ExpDatMem.MoveDataBuffer(Restart);	// データメモリの中身を引き取る(終了時は新しいバッファは不要)
+	ScrPara.SetPngSaveProgress(0);
+	ScrPara.SetCsvSaveProgress(0);
+	SaveActive = true;
+	
+	// データ保存スレッド生成とCPUコア，ポリシー，優先順位の設定
+	pthread_create(&PngSaveThreadID, NULL, (void*(*)(void*))PngSaveThread, this);
+	ARCScommon::SetCPUandPolicy(
+		PngSaveThreadID,
+		ARCSparams::ARCS_CPU_SAVE_PNG,
+		ARCSparams::ARCS_POL_SAVE,
+		ARCSparams::ARCS_PRIO_SAVE
+	);
+	pthread_create(&CsvSaveThreadID, NULL, (void*(*)(void*))CsvSaveThread, this);
+	ARCScommon::SetCPUandPolicy(
+		CsvSaveThreadID,
+		ARCSparams::ARCS_CPU_SAVE_CSV,
+		ARCSparams::ARCS_POL_SAVE,
+		ARCSparams::ARCS_PRIO_SAVE
+	);
+}
+
+//! @brief 測定データの保存完了を待機する関数
+void ARCSthread::WaitSaveDataFiles(void){
+	if(SaveActive == false) return;	// 保存中でなければ何もしない
+	pthread_join(PngSaveThreadID, nullptr);	// PNG画像保存スレッド終了待機
+	pthread_join(CsvSaveThreadID, nullptr);	// CSVファイル保存スレッド終了待機
+	SaveActive = false;
 	EventLog("Writing PNG/CSV Data Files...Done");
 }
 
+//! @brief PNG画像保存スレッド
+//! @param[in]	p	クラスメンバアクセス用ポインタ
+void ARCSthread::PngSaveThread(ARCSthread* const p){
+	p->Graph.SaveScreenImage(p->PngImage, p->PngFileName, [p](double Progress){ p->ScrPara.SetPngSaveProgress(Progress); });
+	p->PngImage.reset();	// 書き出し終わったスクリーンショットを解放
+}
+
+//! @brief CSVファイル保存スレッド
+//! @param[in]	p	クラスメンバアクセス用ポインタ
+void ARCSthread::CsvSaveThread(ARCSthread* const p){
+	ARCSmemory::WriteCsvFile(std::move(p->CsvData), p->CsvDataNum, p->CsvFileName, [p](double Progress){ p->ScrPara.SetCsvSaveProgress(Progress); });
+}
+
+//! @brief ファイル名の拡張子の前に実験番号を付ける関数 (例： DATA.csv → DATA_2.csv)
+//! @param[in]	FileName	ファイル名
+//! @param[in]	Index		実験番号
+//! @return	実験番号付きのファイル名
+std::string ARCSthread::AddRunIndex(const std::string& FileName, const size_t Index){
+	const size_t DotPos = FileName.find_last_of('.');	// 拡張子の位置
+	if(DotPos == std::string::npos) return FileName + "_" + std::to_string(Index);
+	return FileName.substr(0, DotPos) + "_" + std::to_string(Index) + FileName.substr(DotPos);
+}
+
 //! @brief 情報取得スレッド
 //! @param[in]	p	クラスメンバアクセス用ポインタ
 void ARCSthread::InfoGetThread(ARCSthread* const p){
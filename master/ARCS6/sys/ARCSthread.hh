@@ -3,7 +3,7 @@
 //!
 //! リアルタイムスレッドの生成、開始、停止、破棄などの管理をします。
 //!
-//! @date 2024/10/15
+//! @date 2026/10/19
 //! @author Yokokura, Yuki
 //
 // Copyright (C) 2011-2024 Yokokura, Yuki
@@ -15,15 +15,16 @@
 #include <pthread.h>
 #include <memory>
 #include <functional>
+#include <string>
 #include "ControlFunctions.hh"
 #include "SFthread.hh"
 #include "ARCSmemory.hh"
+#include "ARCSgraphics.hh"
 
 // 前方宣言
 namespace ARCS {
 	class ARCSassert;
 	class ARCSscrparams;
-	class ARCSgraphics;
 }
 
 namespace ARCS {	// ARCS名前空間
@@ -35,7 +36,8 @@ namespace ARCS {	// ARCS名前空間
 			void Start(void);				//!< スレッドを開始する関数
 			void Stop(void);				//!< スレッドを停止する関数
 			void Reset(void);				//!< スレッドをリセットする関数
-			void SaveDataFiles(void);		//!< 測定データを保存する関数
+			void SaveDataFiles(const bool Restart);	//!< 測定データのバックグラウンド保存を開始する関数
+			void WaitSaveDataFiles(void);	//!< 測定データの保存完了を待機する関数
 			
 		private:
 			ARCSthread(const ARCSthread&) = delete;					//!< コピーコンストラクタ使用禁止
@@ -63,6 +65,19 @@ namespace ARCS {	// ARCS名前空間
 			pthread_cond_t InfoCond;	//!< 情報取得スレッド同期用条件
 			pthread_t InfoGetThreadID;						//!< 情報取得スレッドの識別子
 			static void InfoGetThread(ARCSthread* const p);	//!< 情報取得スレッド
+			
+			ARCSgraphics::ScreenImage PngImage;	//!< 保存待ちのスクリーンショット
+			ARCSmemory::DataBuffer CsvData;		//!< 保存待ちの実験データ
+			size_t CsvDataNum;					//!< 保存待ちの実験データ数
+			std::string PngFileName;			//!< 保存待ちのPNGファイル名
+			std::string CsvFileName;			//!< 保存待ちのCSVファイル名
+			size_t RestartSaveCount;			//!< RESTART時に保存した回数
+			bool SaveActive;					//!< データ保存スレッドが動作中かどうか
+			pthread_t PngSaveThreadID;						//!< PNG画像保存スレッドの識別子
+			pthread_t CsvSaveThreadID;						//!< CSVファイル保存スレッドの識別子
+			static void PngSaveThread(ARCSthread* const p);	//!< PNG画像保存スレッド
+			static void CsvSaveThread(ARCSthread* const p);	//!< CSVファイル保存スレッド
+			static std::string AddRunIndex(const std::string& FileName, const size_t Index);	//!< ファイル名の拡張子の前に実験番号を付ける関数
 	};
 }
 